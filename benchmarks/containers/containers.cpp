@@ -0,0 +1,355 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures building, searching, iterating and erasing vector, deque, list, map and unordered_map with integer and
+// string keys, each with std::allocator and with the three pmr resources, and allocation from several threads at
+// once with a shared synchronized_pool_resource.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    // Each allocation scheme names itself, gives the string type its string keys have, and holds whatever memory
+    // resource the containers allocate from; a fresh one is made for every container built.
+    struct std_allocation {
+        static constexpr const char* name = "std";
+        template <class T>
+        using allocator = std::allocator<T>;
+        using string    = std::string;
+        struct resource {};
+    };
+
+    template <class Resource>
+    struct pmr_allocation {
+        template <class T>
+        using allocator = std::pmr::polymorphic_allocator<T>;
+        using string    = std::pmr::string;
+        using resource  = Resource;
+    };
+
+    struct unsync_pool_allocation : pmr_allocation<std::pmr::unsynchronized_pool_resource> {
+        static constexpr const char* name = "unsync_pool";
+    };
+
+    struct sync_pool_allocation : pmr_allocation<std::pmr::synchronized_pool_resource> {
+        static constexpr const char* name = "sync_pool";
+    };
+
+    struct monotonic_allocation : pmr_allocation<std::pmr::monotonic_buffer_resource> {
+        static constexpr const char* name = "monotonic";
+    };
+
+    template <class Container, class Resource>
+    Container make_container(Resource& resource) {
+        if constexpr (std::is_same_v<Resource, std_allocation::resource>) {
+            return Container{};
+        } else {
+            return Container{typename Container::allocator_type{&resource}};
+        }
+    }
+
+    template <class Container>
+    constexpr bool is_associative = requires { typename Container::key_type; };
+
+    // Keys are distinct and in no particular order. String keys are 24 characters, too long for the small string
+    // optimization, so that each one is an allocation of its own.
+    template <class Key>
+    std::vector<Key> make_keys(const std::size_t len) {
+        std::vector<std::uint32_t> order(len);
+        std::iota(order.begin(), order.end(), 0U);
+        std::shuffle(order.begin(), order.end(), std::mt19937{1729});
+        std::vector<Key> keys;
+        keys.reserve(len);
+        for (const auto idx : order) {
+            if constexpr (std::is_integral_v<Key>) {
+                keys.push_back(static_cast<Key>(idx));
+            } else {
+                auto digits = std::to_string(idx);
+                keys.emplace_back(24 - digits.size(), 'k');
+                keys.back().append(digits.begin(), digits.end());
+            }
+        }
+
+        return keys;
+    }
+
+    std::uint64_t weight(const std::uint32_t key) noexcept {
+        return key;
+    }
+
+    template <class String>
+    std::uint64_t weight(const String& key) noexcept {
+        return static_cast<std::uint64_t>(key.back());
+    }
+
+    template <class Container, class Key>
+    void add(Container& container, const Key& key) {
+        if constexpr (is_associative<Container>) {
+            container.emplace(key, std::uint64_t{1});
+        } else {
+            container.push_back(key);
+        }
+    }
+
+    template <class Container>
+    std::uint64_t sum(const Container& container) {
+        std::uint64_t result = 0;
+        for (const auto& elem : container) {
+            if constexpr (is_associative<Container>) {
+                result += weight(elem.first) + elem.second;
+            } else {
+                result += weight(elem);
+            }
+        }
+
+        return result;
+    }
+
+    template <class Container>
+    struct key_type_of {
+        using type = typename Container::value_type;
+    };
+
+    template <class Container>
+        requires is_associative<Container>
+    struct key_type_of<Container> {
+        using type = typename Container::key_type;
+    };
+
+    template <class Container>
+    using key_type_t = typename key_type_of<Container>::type;
+
+    // builds a container of len elements, then destroys it and its resource
+    template <class Allocation, class Container>
+    void build(benchmark::State& state) {
+        const auto keys = make_keys<key_type_t<Container>>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state) {
+            typename Allocation::resource resource;
+            auto container = make_container<Container>(resource);
+            for (const auto& key : keys) {
+                add(container, key);
+            }
+
+            benchmark::DoNotOptimize(container);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // looks up every key, in another order than they were inserted in
+    template <class Allocation, class Container>
+    void find(benchmark::State& state) {
+        const auto len  = static_cast<std::size_t>(state.range(0));
+        const auto keys = make_keys<key_type_t<Container>>(len);
+        typename Allocation::resource resource;
+        auto container = make_container<Container>(resource);
+        for (const auto& key : keys) {
+            add(container, key);
+        }
+
+        auto lookups = keys;
+        std::reverse(lookups.begin(), lookups.end());
+        for (auto _ : state) {
+            for (const auto& key : lookups) {
+                benchmark::DoNotOptimize(container.find(key));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <class Allocation, class Container>
+    void iterate(benchmark::State& state) {
+        const auto keys = make_keys<key_type_t<Container>>(static_cast<std::size_t>(state.range(0)));
+        typename Allocation::resource resource;
+        auto container = make_container<Container>(resource);
+        for (const auto& key : keys) {
+            add(container, key);
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(sum(container));
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // erases every key one at a time from associative containers, and about half the elements of sequences; the
+    // container is built and destroyed with the timer paused
+    template <class Allocation, class Container>
+    void erase(benchmark::State& state) {
+        const auto keys = make_keys<key_type_t<Container>>(static_cast<std::size_t>(state.range(0)));
+        for (auto _ : state) {
+            state.PauseTiming();
+            {
+                typename Allocation::resource resource;
+                auto container = make_container<Container>(resource);
+                for (const auto& key : keys) {
+                    add(container, key);
+                }
+
+                state.ResumeTiming();
+                if constexpr (is_associative<Container>) {
+                    for (const auto& key : keys) {
+                        container.erase(key);
+                    }
+                } else {
+                    std::erase_if(container, [](const auto& elem) { return (weight(elem) & 1) != 0; });
+                }
+
+                benchmark::DoNotOptimize(container);
+                state.PauseTiming();
+            }
+
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    std::vector<std::int64_t> benchmark_lengths() {
+        return {1 << 10, 1 << 14, 1 << 18};
+    }
+
+    std::vector<std::int64_t> benchmark_threads() {
+        const auto hw_threads = static_cast<std::int64_t>((std::max)(std::thread::hardware_concurrency(), 1U));
+        std::vector<std::int64_t> threads;
+        for (std::int64_t count = 1; count < hw_threads; count *= 2) {
+            threads.push_back(count);
+        }
+
+        threads.push_back(hw_threads);
+        return threads;
+    }
+
+    template <class Allocation, class Container>
+    void register_container(const std::string& container_name) {
+        const auto prefix = container_name + '/' + Allocation::name + '/';
+        benchmark::RegisterBenchmark((prefix + "build").c_str(), build<Allocation, Container>)
+            ->ArgNames({"len"})
+            ->ArgsProduct({benchmark_lengths()});
+        if constexpr (is_associative<Container>) {
+            benchmark::RegisterBenchmark((prefix + "find").c_str(), find<Allocation, Container>)
+                ->ArgNames({"len"})
+                ->ArgsProduct({benchmark_lengths()});
+        }
+
+        benchmark::RegisterBenchmark((prefix + "iterate").c_str(), iterate<Allocation, Container>)
+            ->ArgNames({"len"})
+            ->ArgsProduct({benchmark_lengths()});
+        benchmark::RegisterBenchmark((prefix + "erase").c_str(), erase<Allocation, Container>)
+            ->ArgNames({"len"})
+            ->ArgsProduct({benchmark_lengths()});
+    }
+
+    template <class Allocation, class Key, const char* KeyName>
+    void register_containers() {
+        using A = Allocation;
+        const std::string key_name{KeyName};
+        register_container<A, std::vector<Key, typename A::template allocator<Key>>>("vector<" + key_name + '>');
+        register_container<A, std::deque<Key, typename A::template allocator<Key>>>("deque<" + key_name + '>');
+        register_container<A, std::list<Key, typename A::template allocator<Key>>>("list<" + key_name + '>');
+        register_container<A,
+            std::map<Key, std::uint64_t, std::less<>,
+                typename A::template allocator<std::pair<const Key, std::uint64_t>>>>("map<" + key_name + '>');
+        register_container<A,
+            std::unordered_map<Key, std::uint64_t, std::hash<Key>, std::equal_to<>,
+                typename A::template allocator<std::pair<const Key, std::uint64_t>>>>(
+            "unordered_map<" + key_name + '>');
+    }
+
+    constexpr char u32_name[]    = "u32";
+    constexpr char string_name[] = "string";
+
+    template <class Allocation>
+    void register_allocation() {
+        register_containers<Allocation, std::uint32_t, u32_name>();
+        register_containers<Allocation, typename Allocation::string, string_name>();
+    }
+
+    // Every thread repeatedly builds and destroys a container of 4096 elements. With sync_pool the threads share one
+    // synchronized_pool_resource; with unsync_pool each has its own unsynchronized_pool_resource, which is the best
+    // a shared pool could hope for; with std they all use the global heap.
+    constexpr std::size_t threaded_len = 4096;
+
+    template <class Allocation, class Container>
+    void threaded_build(benchmark::State& state) {
+        static std::unique_ptr<typename Allocation::resource> shared;
+        if constexpr (std::is_same_v<Allocation, sync_pool_allocation>) {
+            if (state.thread_index() == 0) { // the other threads wait at the start of the loop below
+                shared = std::make_unique<typename Allocation::resource>();
+            }
+        }
+
+        const auto keys = make_keys<key_type_t<Container>>(threaded_len);
+        typename Allocation::resource own;
+        for (auto _ : state) {
+            auto& resource = shared ? *shared : own;
+            auto container = make_container<Container>(resource);
+            for (const auto& key : keys) {
+                add(container, key);
+            }
+
+            benchmark::DoNotOptimize(container);
+        }
+
+        if constexpr (std::is_same_v<Allocation, sync_pool_allocation>) {
+            if (state.thread_index() == 0) { // the other threads have left the loop above
+                shared.reset();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(threaded_len));
+    }
+
+    template <class Allocation, class Container>
+    void register_threaded(const std::string& container_name) {
+        const auto name = "threaded/" + container_name + '/' + Allocation::name + "/build";
+        auto* const bench = benchmark::RegisterBenchmark(name.c_str(), threaded_build<Allocation, Container>);
+        for (const auto threads : benchmark_threads()) {
+            bench->Threads(static_cast<int>(threads));
+        }
+
+        bench->UseRealTime();
+    }
+
+    template <class Allocation>
+    void register_threaded_allocation() {
+        using A = Allocation;
+        register_threaded<A, std::list<std::uint32_t, typename A::template allocator<std::uint32_t>>>("list<u32>");
+        register_threaded<A,
+            std::map<std::uint32_t, std::uint64_t, std::less<>,
+                typename A::template allocator<std::pair<const std::uint32_t, std::uint64_t>>>>("map<u32>");
+    }
+} // unnamed namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    register_allocation<std_allocation>();
+    register_allocation<unsync_pool_allocation>();
+    register_allocation<sync_pool_allocation>();
+    register_allocation<monotonic_allocation>();
+    register_threaded_allocation<std_allocation>();
+    register_threaded_allocation<unsync_pool_allocation>();
+    register_threaded_allocation<sync_pool_allocation>();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
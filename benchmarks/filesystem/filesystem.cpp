@@ -0,0 +1,343 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures directory_iterator, recursive_directory_iterator, the directory_entry observers, file_size, exists,
+// copy_file, remove_all, and path conversions over generated trees of files, and counts the calls into the separately
+// compiled filesystem code (__std_fs_get_stats, __std_fs_open_handle, __std_fs_directory_iterator_advance, ...) that
+// each file costs.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    constexpr std::size_t files_per_directory = 1000;
+
+    // root/dir{i}/file{j}.txt, with files_per_directory files in each directory, and file sizes from 0 to 99 bytes
+    struct tree {
+        fs::path root;
+        std::vector<fs::path> directories;
+        std::vector<fs::path> files;
+        std::vector<std::string> narrow_files; // files, as narrow strings
+
+        explicit tree(const fs::path& root_) : root(root_) {
+            fs::remove_all(root);
+            fs::create_directories(root);
+        }
+
+        tree(const tree&)            = delete;
+        tree& operator=(const tree&) = delete;
+
+        ~tree() {
+            std::error_code ec;
+            fs::remove_all(root, ec);
+        }
+
+        void add_files(const std::size_t count) {
+            for (std::size_t idx = 0; idx < count; ++idx) {
+                if (idx % files_per_directory == 0) {
+                    directories.push_back(root / ("dir" + std::to_string(idx / files_per_directory)));
+                    fs::create_directory(directories.back());
+                }
+
+                files.push_back(directories.back() / ("file" + std::to_string(idx % files_per_directory) + ".txt"));
+                narrow_files.push_back(files.back().string());
+                std::ofstream{files.back(), std::ios::binary} << std::string(idx % 100, 'x');
+            }
+        }
+    };
+
+    fs::path scratch_root() {
+        return fs::temp_directory_path() / "msvc_stl_filesystem_benchmarks";
+    }
+
+    // The tree of file_count files, which is made the first time it's asked for and kept until exit; making the
+    // million-file tree takes minutes.
+    const tree& tree_of(const std::size_t file_count) {
+        static std::map<std::size_t, std::unique_ptr<tree>> trees;
+        auto& result = trees[file_count];
+        if (!result) {
+            result = std::make_unique<tree>(scratch_root() / ("tree" + std::to_string(file_count)));
+            result->add_files(file_count);
+        }
+
+        return *result;
+    }
+
+    // Reports how many calls of each kind the separately compiled code got per file, from the counts since `before`;
+    // the kinds that every benchmark can make are always reported, so that they can be tracked across runs.
+    class call_counter {
+    public:
+        call_counter() noexcept : before(stdext::filesystem::call_stats()) {}
+
+        void pause() noexcept { // stops counting, to leave setup out of the counts
+            add(stdext::filesystem::call_stats(), before);
+        }
+
+        void resume() noexcept {
+            before = stdext::filesystem::call_stats();
+        }
+
+        void report(benchmark::State& state, const std::size_t files_per_iteration) {
+            pause();
+            state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(files_per_iteration));
+            for (const auto& kind : kinds) {
+                const auto count = counted.*kind.member;
+                if (kind.always || count != 0) {
+                    state.counters[kind.name] = benchmark::Counter(
+                        static_cast<double>(count) / static_cast<double>(files_per_iteration),
+                        benchmark::Counter::kAvgIterations);
+                }
+            }
+        }
+
+    private:
+        using call_statistics = stdext::filesystem::call_statistics;
+
+        struct kind {
+            const char* name;
+            unsigned long long call_statistics::*member;
+            bool always;
+        };
+
+        static constexpr kind kinds[] = {
+            {"stats", &call_statistics::get_stats, true},
+            {"opens", &call_statistics::open_handle, true},
+            {"dir_opens", &call_statistics::directory_iterator_open, false},
+            {"dir_advances", &call_statistics::directory_iterator_advance, true},
+            {"file_ids", &call_statistics::get_file_id, false},
+            {"copies", &call_statistics::copy_file, false},
+            {"removes", &call_statistics::remove, false},
+            {"mkdirs", &call_statistics::create_directory, false},
+            {"converts", &call_statistics::convert, true},
+        };
+
+        void add(const call_statistics& now, const call_statistics& then) noexcept {
+            for (const auto& kind : kinds) {
+                counted.*kind.member += now.*kind.member - then.*kind.member;
+            }
+        }
+
+        call_statistics before;
+        call_statistics counted{};
+    };
+
+    void iterate_directories(benchmark::State& state) {
+        const tree& files = tree_of(static_cast<std::size_t>(state.range(0)));
+        call_counter calls;
+        std::size_t found = 0;
+        for (auto _ : state) {
+            for (const auto& dir : files.directories) {
+                for (const auto& entry : fs::directory_iterator{dir}) {
+                    benchmark::DoNotOptimize(entry);
+                    ++found;
+                }
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+        calls.report(state, files.files.size());
+    }
+
+    // what is asked of each directory_entry that recursive_directory_iterator yields
+    struct observer {
+        const char* name;
+        std::uintmax_t (*observe)(const fs::directory_entry&);
+    };
+
+    const observer observers[] = {
+        {"none", [](const fs::directory_entry&) { return std::uintmax_t{0}; }},
+        {"is_regular_file", [](const fs::directory_entry& entry) { return std::uintmax_t{entry.is_regular_file()}; }},
+        {"file_size",
+            [](const fs::directory_entry& entry) {
+                return entry.is_regular_file() ? entry.file_size() : std::uintmax_t{0};
+            }},
+        {"last_write_time",
+            [](const fs::directory_entry& entry) {
+                return static_cast<std::uintmax_t>(entry.last_write_time().time_since_epoch().count());
+            }},
+        {"status", [](const fs::directory_entry& entry) { return static_cast<std::uintmax_t>(entry.status().type()); }},
+        {"symlink_status",
+            [](const fs::directory_entry& entry) {
+                return static_cast<std::uintmax_t>(entry.symlink_status().type());
+            }},
+        {"hard_link_count", [](const fs::directory_entry& entry) { return entry.hard_link_count(); }},
+        {"refresh",
+            [](const fs::directory_entry& entry) {
+                fs::directory_entry copy = entry;
+                copy.refresh();
+                return std::uintmax_t{copy.is_regular_file()};
+            }},
+    };
+
+    void iterate_recursively(benchmark::State& state, const observer& what) {
+        const tree& files = tree_of(static_cast<std::size_t>(state.range(0)));
+        call_counter calls;
+        std::uintmax_t sum = 0;
+        for (auto _ : state) {
+            for (const auto& entry : fs::recursive_directory_iterator{files.root}) {
+                sum += what.observe(entry);
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+        calls.report(state, files.files.size() + files.directories.size());
+    }
+
+    // a free function called with the path of each file
+    template <class Fn>
+    void per_file(benchmark::State& state, Fn fn) {
+        const tree& files = tree_of(static_cast<std::size_t>(state.range(0)));
+        call_counter calls;
+        std::uintmax_t sum = 0;
+        for (auto _ : state) {
+            for (const auto& file : files.files) {
+                sum += fn(file);
+            }
+        }
+
+        benchmark::DoNotOptimize(sum);
+        calls.report(state, files.files.size());
+    }
+
+    void file_size(benchmark::State& state) {
+        per_file(state, [](const fs::path& file) { return fs::file_size(file); });
+    }
+
+    void exists(benchmark::State& state) {
+        per_file(state, [](const fs::path& file) { return std::uintmax_t{fs::exists(file)}; });
+    }
+
+    void construct_entry(benchmark::State& state) {
+        per_file(state, [](const fs::path& file) { return fs::directory_entry{file}.file_size(); });
+    }
+
+    void copy_files(benchmark::State& state) {
+        const tree& files   = tree_of(static_cast<std::size_t>(state.range(0)));
+        const fs::path copy = scratch_root() / "copy";
+        call_counter calls;
+        for (auto _ : state) {
+            state.PauseTiming();
+            calls.pause();
+            fs::remove_all(copy);
+            for (const auto& dir : files.directories) {
+                fs::create_directories(copy / dir.filename());
+            }
+
+            calls.resume();
+            state.ResumeTiming();
+            for (const auto& file : files.files) {
+                fs::copy_file(file, copy / file.parent_path().filename() / file.filename());
+            }
+        }
+
+        calls.report(state, files.files.size());
+        fs::remove_all(copy);
+    }
+
+    void remove_tree(benchmark::State& state) {
+        const auto file_count = static_cast<std::size_t>(state.range(0));
+        std::unique_ptr<tree> doomed;
+        call_counter calls;
+        for (auto _ : state) {
+            state.PauseTiming();
+            calls.pause();
+            doomed.reset();
+            doomed = std::make_unique<tree>(scratch_root() / "doomed");
+            doomed->add_files(file_count);
+            calls.resume();
+            state.ResumeTiming();
+            benchmark::DoNotOptimize(fs::remove_all(doomed->root));
+        }
+
+        calls.report(state, file_count);
+    }
+
+    void path_from_narrow(benchmark::State& state) {
+        const tree& files = tree_of(static_cast<std::size_t>(state.range(0)));
+        call_counter calls;
+        for (auto _ : state) {
+            for (const auto& file : files.narrow_files) {
+                fs::path converted{file};
+                benchmark::DoNotOptimize(converted);
+            }
+        }
+
+        calls.report(state, files.files.size());
+    }
+
+    template <class Fn>
+    void path_conversion(benchmark::State& state, Fn fn) {
+        const tree& files = tree_of(static_cast<std::size_t>(state.range(0)));
+        call_counter calls;
+        for (auto _ : state) {
+            for (const auto& file : files.files) {
+                auto converted = fn(file);
+                benchmark::DoNotOptimize(converted);
+            }
+        }
+
+        calls.report(state, files.files.size());
+    }
+
+    void path_string(benchmark::State& state) {
+        path_conversion(state, [](const fs::path& file) { return file.string(); });
+    }
+
+    void path_u8string(benchmark::State& state) {
+        path_conversion(state, [](const fs::path& file) { return file.u8string(); });
+    }
+
+    void path_generic_string(benchmark::State& state) {
+        path_conversion(state, [](const fs::path& file) { return file.generic_string(); });
+    }
+
+    // every tree size from 10^3 to 10^6 files, or up to 10^4 for the benchmarks that make or remove files
+    void all_sizes(benchmark::internal::Benchmark* const bench) {
+        bench->ArgName("files")->RangeMultiplier(10)->Range(1'000, 1'000'000);
+    }
+
+    void writing_sizes(benchmark::internal::Benchmark* const bench) {
+        bench->ArgName("files")->RangeMultiplier(10)->Range(1'000, 10'000);
+    }
+
+    void register_benchmarks() {
+        benchmark::RegisterBenchmark("directory_iterator", iterate_directories)->Apply(all_sizes);
+        for (const auto& what : observers) {
+            benchmark::RegisterBenchmark(
+                (std::string{"recursive_directory_iterator/"} + what.name).c_str(), iterate_recursively, what)
+                ->Apply(all_sizes);
+        }
+
+        benchmark::RegisterBenchmark("directory_entry/construct", construct_entry)->Apply(all_sizes);
+        benchmark::RegisterBenchmark("file_size", file_size)->Apply(all_sizes);
+        benchmark::RegisterBenchmark("exists", exists)->Apply(all_sizes);
+        benchmark::RegisterBenchmark("copy_file", copy_files)->Apply(writing_sizes);
+        benchmark::RegisterBenchmark("remove_all", remove_tree)->Apply(writing_sizes);
+        benchmark::RegisterBenchmark("path/from_narrow", path_from_narrow)->Apply(all_sizes);
+        benchmark::RegisterBenchmark("path/string", path_string)->Apply(all_sizes);
+        benchmark::RegisterBenchmark("path/u8string", path_u8string)->Apply(all_sizes);
+        benchmark::RegisterBenchmark("path/generic_string", path_generic_string)->Apply(all_sizes);
+    }
+} // unnamed namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    stdext::filesystem::enable_call_stats(true);
+    register_benchmarks();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
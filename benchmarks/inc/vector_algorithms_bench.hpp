@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <isa_availability.h>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#if !defined(_M_IX86) && !defined(_M_X64)
+#error The vector_algorithms benchmarks require x86 or x64.
+#endif // !defined(_M_IX86) && !defined(_M_X64)
+
+extern "C" long __isa_enabled;
+
+namespace bench {
+    // The integer types that the __std_meow_N entry points take their values as.
+    template <std::size_t Size>
+    struct uint_of;
+    template <>
+    struct uint_of<1> {
+        using type = unsigned char;
+    };
+    template <>
+    struct uint_of<2> {
+        using type = unsigned short;
+    };
+    template <>
+    struct uint_of<4> {
+        using type = unsigned long;
+    };
+    template <>
+    struct uint_of<8> {
+        using type = unsigned long long;
+    };
+
+    template <std::size_t Size>
+    using uint_of_t = typename uint_of<Size>::type;
+
+    using u8  = uint_of_t<1>;
+    using u16 = uint_of_t<2>;
+    using u32 = uint_of_t<4>;
+    using u64 = uint_of_t<8>;
+
+    constexpr long isa_bit(const ISA_AVAILABILITY isa) noexcept {
+        return 1L << static_cast<int>(isa);
+    }
+
+    // An instruction set tier is simulated by hiding the bits of every later tier from __isa_enabled while the
+    // benchmark runs, the same way VSO_0000000_vector_algorithms exercises the fallback paths.
+    struct isa_tier {
+        const char* name;
+        ISA_AVAILABILITY required;
+        long hidden_bits;
+    };
+
+    inline constexpr isa_tier isa_tiers[] = {
+#ifdef _M_IX86
+        {"scalar", __ISA_AVAILABLE_X86,
+            isa_bit(__ISA_AVAILABLE_SSE2) | isa_bit(__ISA_AVAILABLE_SSE42) | isa_bit(__ISA_AVAILABLE_AVX)
+                | isa_bit(__ISA_AVAILABLE_AVX2) | isa_bit(__ISA_AVAILABLE_AVX512)},
+#endif // _M_IX86
+        {"sse2", __ISA_AVAILABLE_SSE2,
+            isa_bit(__ISA_AVAILABLE_SSE42) | isa_bit(__ISA_AVAILABLE_AVX) | isa_bit(__ISA_AVAILABLE_AVX2)
+                | isa_bit(__ISA_AVAILABLE_AVX512)},
+        {"sse42", __ISA_AVAILABLE_SSE42,
+            isa_bit(__ISA_AVAILABLE_AVX) | isa_bit(__ISA_AVAILABLE_AVX2) | isa_bit(__ISA_AVAILABLE_AVX512)},
+        {"avx2", __ISA_AVAILABLE_AVX2, isa_bit(__ISA_AVAILABLE_AVX512)},
+        {"avx512", __ISA_AVAILABLE_AVX512, 0},
+    };
+
+    class isa_tier_scope {
+    public:
+        explicit isa_tier_scope(const isa_tier& tier) noexcept : saved(__isa_enabled) {
+            __isa_enabled = saved & ~tier.hidden_bits;
+        }
+
+        isa_tier_scope(const isa_tier_scope&) = delete;
+        isa_tier_scope& operator=(const isa_tier_scope&) = delete;
+
+        ~isa_tier_scope() {
+            __isa_enabled = saved;
+        }
+
+    private:
+        long saved;
+    };
+
+    // Every benchmark takes its length in elements as range(0) and the misalignment of its buffers from a 64-byte
+    // boundary, in bytes, as range(1).
+    inline std::size_t length(const benchmark::State& state) {
+        return static_cast<std::size_t>(state.range(0));
+    }
+
+    inline std::size_t misalignment(const benchmark::State& state) {
+        return static_cast<std::size_t>(state.range(1));
+    }
+
+    template <class T>
+    class aligned_buffer {
+    public:
+        static constexpr std::size_t alignment = 64;
+
+        aligned_buffer(const std::size_t count, const std::size_t misalign)
+            : storage(new unsigned char[count * sizeof(T) + 2 * alignment]) {
+            const auto raw = reinterpret_cast<std::uintptr_t>(storage.get());
+            first          = reinterpret_cast<T*>((raw + alignment - 1) / alignment * alignment + misalign);
+            last           = first + count;
+        }
+
+        T* begin() const noexcept {
+            return first;
+        }
+
+        T* end() const noexcept {
+            return last;
+        }
+
+    private:
+        std::unique_ptr<unsigned char[]> storage;
+        T* first;
+        T* last;
+    };
+
+    // Fills [first, last) with pseudo-random values in [0, bound), the same ones for every run.
+    template <class T>
+    void fill_random(T* first, T* const last, const unsigned long long bound, const unsigned int seed = 1729) {
+        std::mt19937_64 gen{seed};
+        std::uniform_int_distribution<unsigned long long> dist{0, bound - 1};
+        for (; first != last; ++first) {
+            *first = static_cast<T>(dist(gen));
+        }
+    }
+
+    // Reports items and bytes per second for count elements of type T per iteration.
+    template <class T>
+    void set_processed(benchmark::State& state, const std::size_t count) {
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(count * sizeof(T)));
+    }
+
+    struct kernel_benchmark {
+        const char* name;
+        std::size_t elem_size;
+        void (*run)(benchmark::State&);
+    };
+
+    std::vector<kernel_benchmark>& kernel_registry();
+
+    // Each translation unit lists its kernels with a namespace-scope registrar; main() registers them with Google
+    // Benchmark once for every instruction set tier that this machine has.
+    struct kernel_registrar {
+        kernel_registrar(const std::initializer_list<kernel_benchmark> kernels) {
+            auto& registry = kernel_registry();
+            registry.insert(registry.end(), kernels);
+        }
+    };
+} // namespace bench
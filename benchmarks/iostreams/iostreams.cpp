@@ -0,0 +1,394 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures formatted stream input and output of integers and doubles, getline, message building with ostringstream,
+// from_chars and to_chars in each format, and stoi and to_string, against fread and fwrite of the same text.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace {
+    constexpr std::size_t value_count = 1 << 16;
+
+    template <class T>
+    using sum_type = std::conditional_t<std::is_integral_v<T>, long long, T>;
+
+    // The values, and their text one per line, shared by all benchmarks. Integers have every length up to 10
+    // digits and either sign; doubles span many magnitudes, and their text is the shortest round-trip form.
+    struct test_data {
+        std::vector<std::int32_t> ints;
+        std::vector<double> doubles;
+        std::string int_text;
+        std::string double_text;
+        std::string line_text; // log-like lines of 20 to 120 characters
+        std::filesystem::path int_file;
+        std::filesystem::path double_file;
+        std::filesystem::path line_file;
+        std::filesystem::path out_file;
+
+        test_data() {
+            std::mt19937_64 gen{1729};
+            std::uniform_int_distribution<int> digits_dist{1, 10};
+            std::uniform_int_distribution<int> exponent_dist{-20, 20};
+            std::uniform_real_distribution<double> mantissa_dist{1.0, 10.0};
+            std::uniform_int_distribution<int> line_dist{20, 120};
+            char buf[64];
+            for (std::size_t idx = 0; idx < value_count; ++idx) {
+                const int digits   = digits_dist(gen);
+                std::int64_t limit = 1;
+                for (int d = 0; d < digits; ++d) {
+                    limit *= 10;
+                }
+
+                std::uniform_int_distribution<std::int64_t> value_dist{
+                    0, (std::min)(limit - 1, std::int64_t{INT32_MAX})};
+                auto value = static_cast<std::int32_t>(value_dist(gen));
+                if (gen() & 1) {
+                    value = -value;
+                }
+
+                ints.push_back(value);
+                int_text.append(buf, std::to_chars(buf, buf + sizeof(buf), value).ptr);
+                int_text.push_back('\n');
+
+                const double dbl = std::ldexp(mantissa_dist(gen), exponent_dist(gen) * 3) * ((gen() & 1) ? -1.0 : 1.0);
+                doubles.push_back(dbl);
+                double_text.append(buf, std::to_chars(buf, buf + sizeof(buf), dbl).ptr);
+                double_text.push_back('\n');
+
+                const int line_len = line_dist(gen);
+                for (int ch = 0; ch < line_len; ++ch) {
+                    line_text.push_back(static_cast<char>('a' + gen() % 26));
+                }
+
+                line_text.push_back('\n');
+            }
+
+            const auto dir = std::filesystem::temp_directory_path();
+            int_file       = dir / "iostreams_benchmarks_int.txt";
+            double_file    = dir / "iostreams_benchmarks_double.txt";
+            line_file      = dir / "iostreams_benchmarks_line.txt";
+            out_file       = dir / "iostreams_benchmarks_out.txt";
+            write_file(int_file, int_text);
+            write_file(double_file, double_text);
+            write_file(line_file, line_text);
+        }
+
+        test_data(const test_data&)            = delete;
+        test_data& operator=(const test_data&) = delete;
+
+        ~test_data() {
+            std::error_code ec;
+            std::filesystem::remove(int_file, ec);
+            std::filesystem::remove(double_file, ec);
+            std::filesystem::remove(line_file, ec);
+            std::filesystem::remove(out_file, ec);
+        }
+
+        static void write_file(const std::filesystem::path& path, const std::string& text) {
+            std::ofstream out{path, std::ios::binary};
+            out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+    };
+
+    const test_data& data() {
+        static const test_data instance;
+        return instance;
+    }
+
+    void set_processed(benchmark::State& state, const std::string& text) {
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(value_count));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+    }
+
+    // reads all of path with fread in 64K pieces, which is what the formatted reads below are measured against
+    void read_fread(benchmark::State& state, const std::filesystem::path& path, const std::string& text) {
+        std::vector<char> buf(1 << 16);
+        for (auto _ : state) {
+            FILE* const file  = _wfopen(path.c_str(), L"rb");
+            std::size_t total = 0;
+            for (std::size_t got; (got = std::fread(buf.data(), 1, buf.size(), file)) != 0;) {
+                total += got;
+            }
+
+            std::fclose(file);
+            benchmark::DoNotOptimize(total);
+        }
+
+        set_processed(state, text);
+    }
+
+    template <class T>
+    void read_ifstream(benchmark::State& state, const std::filesystem::path& path, const std::string& text) {
+        for (auto _ : state) {
+            std::ifstream in{path};
+            T value{};
+            sum_type<T> sum{};
+            while (in >> value) {
+                sum += value;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        set_processed(state, text);
+    }
+
+    void read_getline(benchmark::State& state) {
+        for (auto _ : state) {
+            std::ifstream in{data().line_file};
+            std::string line;
+            std::size_t total = 0;
+            while (std::getline(in, line)) {
+                total += line.size();
+            }
+
+            benchmark::DoNotOptimize(total);
+        }
+
+        set_processed(state, data().line_text);
+    }
+
+    template <class T>
+    void read_from_chars(benchmark::State& state, const std::string& text) {
+        for (auto _ : state) {
+            const char* first      = text.data();
+            const char* const last = first + text.size();
+            sum_type<T> sum{};
+            while (first != last) {
+                T value{};
+                first = std::from_chars(first, last, value).ptr + 1; // skip the newline
+                sum += value;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        set_processed(state, text);
+    }
+
+    void read_stoi(benchmark::State& state) {
+        // stoi takes a string, so each line is copied into one first, as a caller holding strings would have
+        const auto& text = data().int_text;
+        for (auto _ : state) {
+            std::string token;
+            long long sum = 0;
+            for (std::size_t pos = 0; pos != text.size();) {
+                const auto newline = text.find('\n', pos);
+                token.assign(text, pos, newline - pos);
+                sum += std::stoi(token);
+                pos = newline + 1;
+            }
+
+            benchmark::DoNotOptimize(sum);
+        }
+
+        set_processed(state, text);
+    }
+
+    // writes text with fwrite in 64K pieces, which is what the formatted writes below are measured against
+    void write_fwrite(benchmark::State& state, const std::string& text) {
+        const auto& path = data().out_file;
+        for (auto _ : state) {
+            FILE* const file = _wfopen(path.c_str(), L"wb");
+            for (std::size_t pos = 0; pos < text.size(); pos += 1 << 16) {
+                std::fwrite(text.data() + pos, 1, (std::min)(text.size() - pos, std::size_t{1} << 16), file);
+            }
+
+            std::fclose(file);
+        }
+
+        set_processed(state, text);
+    }
+
+    template <class T>
+    void write_ofstream(benchmark::State& state, const std::vector<T>& values) {
+        // doubles are written with enough digits to round-trip, as the text they're compared with has
+        const auto& path   = data().out_file;
+        std::int64_t bytes = 0;
+        for (auto _ : state) {
+            std::ofstream out{path};
+            out << std::setprecision(17);
+            for (const auto& value : values) {
+                out << value << '\n';
+            }
+
+            bytes = static_cast<std::int64_t>(out.tellp());
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+        state.SetBytesProcessed(state.iterations() * bytes);
+    }
+
+    void write_ostringstream_message(benchmark::State& state) {
+        // a log message with text, an integer, a double, and a string in it, built in a fresh stream each time
+        const auto& ints    = data().ints;
+        const auto& doubles = data().doubles;
+        const std::string component{"allocator"};
+        std::size_t bytes = 0;
+        for (auto _ : state) {
+            bytes = 0;
+            for (std::size_t idx = 0; idx < value_count; ++idx) {
+                std::ostringstream message;
+                message << "request " << ints[idx] << " took " << doubles[idx] << " ms in " << component;
+                bytes += message.str().size();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(value_count));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes));
+    }
+
+    template <class T, class... Format>
+    void write_to_chars(benchmark::State& state, const std::vector<T>& values, const Format... format) {
+        std::vector<char> out(values.size() * 32);
+        std::size_t bytes = 0;
+        for (auto _ : state) {
+            char* first      = out.data();
+            char* const last = first + out.size();
+            for (const auto& value : values) {
+                first    = std::to_chars(first, last, value, format...).ptr;
+                *first++ = '\n';
+            }
+
+            bytes = static_cast<std::size_t>(first - out.data());
+            benchmark::DoNotOptimize(out.data());
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes));
+    }
+
+    template <class T>
+    void write_to_string(benchmark::State& state, const std::vector<T>& values) {
+        std::size_t bytes = 0;
+        for (auto _ : state) {
+            bytes = 0;
+            for (const auto& value : values) {
+                const auto str = std::to_string(value);
+                bytes += str.size() + 1;
+                benchmark::DoNotOptimize(str.data());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(values.size()));
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes));
+    }
+
+    void register_benchmarks() {
+        const auto& d = data();
+        benchmark::RegisterBenchmark("read/fread/int", read_fread, d.int_file, d.int_text);
+        benchmark::RegisterBenchmark("read/fread/double", read_fread, d.double_file, d.double_text);
+        benchmark::RegisterBenchmark("read/fread/line", read_fread, d.line_file, d.line_text);
+        benchmark::RegisterBenchmark("read/ifstream/int", read_ifstream<int>, d.int_file, d.int_text);
+        benchmark::RegisterBenchmark("read/ifstream/double", read_ifstream<double>, d.double_file, d.double_text);
+        benchmark::RegisterBenchmark("read/getline/line", read_getline);
+        benchmark::RegisterBenchmark("read/from_chars/int", read_from_chars<int>, d.int_text);
+        benchmark::RegisterBenchmark("read/from_chars/double", read_from_chars<double>, d.double_text);
+        benchmark::RegisterBenchmark("read/stoi/int", read_stoi);
+
+        benchmark::RegisterBenchmark("write/fwrite/int", write_fwrite, d.int_text);
+        benchmark::RegisterBenchmark("write/fwrite/double", write_fwrite, d.double_text);
+        benchmark::RegisterBenchmark("write/ofstream/int", write_ofstream<std::int32_t>, d.ints);
+        benchmark::RegisterBenchmark("write/ofstream/double", write_ofstream<double>, d.doubles);
+        benchmark::RegisterBenchmark("write/ostringstream/message", write_ostringstream_message);
+        benchmark::RegisterBenchmark("write/to_chars/int", write_to_chars<std::int32_t>, d.ints);
+        benchmark::RegisterBenchmark(
+            "write/to_chars/int_hex", [](benchmark::State& state) { write_to_chars(state, data().ints, 16); });
+        benchmark::RegisterBenchmark("write/to_chars/double_shortest", write_to_chars<double>, d.doubles);
+        benchmark::RegisterBenchmark("write/to_chars/double_fixed", [](benchmark::State& state) {
+            write_to_chars(state, data().doubles, std::chars_format::fixed, 6);
+        });
+        benchmark::RegisterBenchmark("write/to_chars/double_scientific", [](benchmark::State& state) {
+            write_to_chars(state, data().doubles, std::chars_format::scientific, 16);
+        });
+        benchmark::RegisterBenchmark("write/to_chars/double_hex", [](benchmark::State& state) {
+            write_to_chars(state, data().doubles, std::chars_format::hex);
+        });
+        benchmark::RegisterBenchmark("write/to_string/int", write_to_string<std::int32_t>, d.ints);
+        benchmark::RegisterBenchmark("write/to_string/double", write_to_string<double>, d.doubles);
+    }
+
+    // Prints the usual console output, and once every run is done, each benchmark's throughput in bytes of text as a
+    // fraction of fread's (for read/...) or fwrite's (for write/...) on the same kind of text; int, double, and line
+    // benchmarks are compared with their own fread/fwrite, others with int's.
+    class raw_io_reporter : public benchmark::ConsoleReporter {
+    public:
+        void ReportRuns(const std::vector<Run>& runs) override {
+            ConsoleReporter::ReportRuns(runs);
+            for (const auto& run : runs) {
+                const auto found = run.counters.find("bytes_per_second");
+                if (run.run_type != Run::RT_Iteration || found == run.counters.end()) {
+                    continue;
+                }
+
+                // with --benchmark_repetitions, keep the fastest repetition
+                auto& rate = rates[run.run_name.function_name];
+                if (found->second.value > rate) {
+                    rate = found->second.value;
+                }
+            }
+        }
+
+        void Finalize() override {
+            ConsoleReporter::Finalize();
+            auto& out = GetOutputStream();
+            out << "\nThroughput as a fraction of fread/fwrite of the same text:\n";
+            for (const auto& [name, rate] : rates) {
+                const auto raw = rates.find(baseline_of(name));
+                if (raw == rates.end() || raw->first == name || raw->second <= 0.0) {
+                    continue;
+                }
+
+                out << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(3)
+                    << rate / raw->second << '\n';
+            }
+        }
+
+    private:
+        static std::string baseline_of(const std::string& name) {
+            // "write/to_chars/double_fixed" -> "write/fwrite/double"
+            const auto direction = name.substr(0, name.find('/'));
+            const auto last      = name.substr(name.rfind('/') + 1);
+            std::string kind     = "int";
+            for (const std::string_view candidate : {"double", "line"}) {
+                if (last.compare(0, candidate.size(), candidate) == 0) {
+                    kind = candidate;
+                }
+            }
+
+            return direction + (direction == "read" ? "/fread/" : "/fwrite/") + kind;
+        }
+
+        std::map<std::string, double> rates;
+    };
+} // unnamed namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    register_benchmarks();
+    raw_io_reporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+}
@@ -0,0 +1,462 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures each parallel algorithm under seq and under par limited to 1, 2, 4, ... threads, and reports where par
+// starts to pay off; that's the data the _With_grain and _With_min_parallel_size hints of the execution policies
+// should be calibrated with. The kernel/ benchmarks compare par and par_unseq on a single thread, which isolates what
+// the unsequenced kernels gain per chunk from what the threads gain.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <numeric>
+#include <ostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+    // 64, 256, 1K, ..., 16M elements, so a crossover is found to within a factor of 4
+    std::vector<std::int64_t> benchmark_lengths() {
+        std::vector<std::int64_t> lengths;
+        for (std::int64_t len = 64; len <= (1 << 24); len *= 4) {
+            lengths.push_back(len);
+        }
+
+        return lengths;
+    }
+
+    // 1, 2, 4, ... threads, and every hardware thread
+    std::vector<std::int64_t> benchmark_threads() {
+        const auto hw_threads = static_cast<std::int64_t>((std::max)(std::thread::hardware_concurrency(), 1U));
+        std::vector<std::int64_t> threads;
+        for (std::int64_t count = 1; count < hw_threads; count *= 2) {
+            threads.push_back(count);
+        }
+
+        threads.push_back(hw_threads);
+        return threads;
+    }
+
+    std::size_t length(const benchmark::State& state) {
+        return static_cast<std::size_t>(state.range(0));
+    }
+
+    std::vector<double> random_doubles(const std::size_t len, const unsigned int seed = 1729) {
+        std::mt19937_64 gen{seed};
+        std::uniform_real_distribution<double> dist{0.0, 1.0};
+        std::vector<double> result(len);
+        for (auto& val : result) {
+            val = dist(gen);
+        }
+
+        return result;
+    }
+
+    std::vector<std::uint32_t> random_keys(const std::size_t len) {
+        std::mt19937 gen{1729};
+        std::vector<std::uint32_t> result(len);
+        for (auto& val : result) {
+            val = gen();
+        }
+
+        return result;
+    }
+
+    // multiples of step, in order
+    std::vector<std::uint32_t> multiples(const std::size_t len, const std::uint32_t step) {
+        std::vector<std::uint32_t> result(len);
+        for (std::size_t idx = 0; idx < len; ++idx) {
+            result[idx] = static_cast<std::uint32_t>(idx) * step;
+        }
+
+        return result;
+    }
+
+    // Each algorithm is a generic callable taking the state and an execution policy, registered once as name/seq
+    // and once as name/par for every thread count. Both are timed by the wall clock, as a parallel algorithm's
+    // calling thread spends much of its time waiting.
+    template <class Body>
+    void register_algorithm(const std::string& name, const Body body) {
+        benchmark::RegisterBenchmark((name + "/seq").c_str(),
+            [body](benchmark::State& state) {
+                body(state, std::execution::seq);
+                state.SetItemsProcessed(state.iterations() * state.range(0));
+            })
+            ->ArgNames({"len"})
+            ->ArgsProduct({benchmark_lengths()})
+            ->UseRealTime();
+
+        benchmark::RegisterBenchmark((name + "/par").c_str(),
+            [body](benchmark::State& state) {
+                body(state, std::execution::par._With_max_threads(static_cast<unsigned int>(state.range(1))));
+                state.SetItemsProcessed(state.iterations() * state.range(0));
+            })
+            ->ArgNames({"len", "threads"})
+            ->ArgsProduct({benchmark_lengths(), benchmark_threads()})
+            ->UseRealTime();
+    }
+
+    // registered as kernel/name/par and kernel/name/par_unseq, both on the calling thread alone
+    template <class Body>
+    void register_kernel(const std::string& name, const Body body) {
+        benchmark::RegisterBenchmark(("kernel/" + name + "/par").c_str(),
+            [body](benchmark::State& state) {
+                body(state, std::execution::par._With_max_threads(1));
+                state.SetItemsProcessed(state.iterations() * state.range(0));
+            })
+            ->ArgNames({"len"})
+            ->ArgsProduct({benchmark_lengths()});
+
+        benchmark::RegisterBenchmark(("kernel/" + name + "/par_unseq").c_str(),
+            [body](benchmark::State& state) {
+                body(state, std::execution::par_unseq._With_max_threads(1));
+                state.SetItemsProcessed(state.iterations() * state.range(0));
+            })
+            ->ArgNames({"len"})
+            ->ArgsProduct({benchmark_lengths()});
+    }
+
+    // a sum that isn't the plus<> that <numeric> already vectorizes
+    constexpr auto add = [](const double left, const double right) { return left + right; };
+
+    void register_kernels() {
+        register_kernel("reduce", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(std::reduce(exec, data.begin(), data.end(), 0.0, add));
+            }
+        });
+
+        register_kernel("transform_reduce_unary", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(std::transform_reduce(
+                    exec, data.begin(), data.end(), 0.0, add, [](const double val) { return val * val; }));
+            }
+        });
+
+        register_kernel("transform_reduce_binary", [](benchmark::State& state, const auto& exec) {
+            const auto left  = random_doubles(length(state));
+            const auto right = random_doubles(length(state), 42);
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(std::transform_reduce(exec, left.begin(), left.end(), right.begin(), 0.0, add,
+                    [](const double x, const double y) { return x * y; }));
+            }
+        });
+
+        register_kernel("transform", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            std::vector<double> out(data.size());
+            for (auto _ : state) {
+                std::transform(
+                    exec, data.begin(), data.end(), out.begin(), [](const double val) { return val * 0.5 + 0.25; });
+                benchmark::ClobberMemory();
+            }
+        });
+    }
+
+    void register_algorithms() {
+        register_algorithm("for_each", [](benchmark::State& state, const auto& exec) {
+            auto data = random_doubles(length(state));
+            for (auto _ : state) {
+                std::for_each(exec, data.begin(), data.end(), [](double& val) { val = val * 0.5 + 0.25; });
+                benchmark::ClobberMemory();
+            }
+        });
+
+        register_algorithm("transform", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            std::vector<double> out(data.size());
+            for (auto _ : state) {
+                std::transform(
+                    exec, data.begin(), data.end(), out.begin(), [](const double val) { return std::sqrt(val); });
+                benchmark::ClobberMemory();
+            }
+        });
+
+        register_algorithm("reduce", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(std::reduce(exec, data.begin(), data.end()));
+            }
+        });
+
+        register_algorithm("transform_reduce", [](benchmark::State& state, const auto& exec) {
+            const auto left  = random_doubles(length(state));
+            const auto right = random_doubles(length(state), 42);
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(std::transform_reduce(exec, left.begin(), left.end(), right.begin(), 0.0));
+            }
+        });
+
+        register_algorithm("inclusive_scan", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            std::vector<double> out(data.size());
+            for (auto _ : state) {
+                std::inclusive_scan(exec, data.begin(), data.end(), out.begin());
+                benchmark::ClobberMemory();
+            }
+        });
+
+        register_algorithm("exclusive_scan", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            std::vector<double> out(data.size());
+            for (auto _ : state) {
+                std::exclusive_scan(exec, data.begin(), data.end(), out.begin(), 0.0);
+                benchmark::ClobberMemory();
+            }
+        });
+
+        register_algorithm("count_if", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(
+                    std::count_if(exec, data.begin(), data.end(), [](const double val) { return val < 0.5; }));
+            }
+        });
+
+        register_algorithm("find", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(std::find(exec, data.begin(), data.end(), -1.0)); // not found
+            }
+        });
+
+        register_algorithm("copy_if", [](benchmark::State& state, const auto& exec) {
+            const auto data = random_doubles(length(state));
+            std::vector<double> out(data.size());
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(std::copy_if(
+                    exec, data.begin(), data.end(), out.begin(), [](const double val) { return val < 0.5; }));
+                benchmark::ClobberMemory();
+            }
+        });
+
+        // The algorithms below consume their input, which is restored between iterations with the timer paused.
+        register_algorithm("remove_if", [](benchmark::State& state, const auto& exec) {
+            const auto pristine = random_doubles(length(state));
+            auto data           = pristine;
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(
+                    std::remove_if(exec, data.begin(), data.end(), [](const double val) { return val < 0.5; }));
+                benchmark::ClobberMemory();
+                state.PauseTiming();
+                data = pristine;
+                state.ResumeTiming();
+            }
+        });
+
+        register_algorithm("sort", [](benchmark::State& state, const auto& exec) {
+            const auto pristine = random_keys(length(state));
+            auto data           = pristine;
+            for (auto _ : state) {
+                std::sort(exec, data.begin(), data.end());
+                benchmark::ClobberMemory();
+                state.PauseTiming();
+                data = pristine;
+                state.ResumeTiming();
+            }
+        });
+
+        register_algorithm("stable_sort", [](benchmark::State& state, const auto& exec) {
+            const auto pristine = random_doubles(length(state));
+            auto data           = pristine;
+            for (auto _ : state) {
+                std::stable_sort(exec, data.begin(), data.end());
+                benchmark::ClobberMemory();
+                state.PauseTiming();
+                data = pristine;
+                state.ResumeTiming();
+            }
+        });
+
+        register_algorithm("set_intersection", [](benchmark::State& state, const auto& exec) {
+            const auto left  = multiples(length(state), 2);
+            const auto right = multiples(length(state), 3);
+            std::vector<std::uint32_t> out(left.size());
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(
+                    std::set_intersection(exec, left.begin(), left.end(), right.begin(), right.end(), out.begin()));
+                benchmark::ClobberMemory();
+            }
+        });
+
+        register_algorithm("merge", [](benchmark::State& state, const auto& exec) {
+            const auto left  = multiples(length(state), 2);
+            const auto right = multiples(length(state), 3);
+            std::vector<std::uint32_t> out(left.size() + right.size());
+            for (auto _ : state) {
+                std::merge(exec, left.begin(), left.end(), right.begin(), right.end(), out.begin());
+                benchmark::ClobberMemory();
+            }
+        });
+    }
+
+    // returns the number after "key:" in args such as "len:1024/threads:4", or -1 if there is none
+    long long arg_value(const std::string& args, const std::string_view key) {
+        const auto pos = args.find(std::string{key} + ':');
+        if (pos == std::string::npos) {
+            return -1;
+        }
+
+        return std::stoll(args.substr(pos + key.size() + 1));
+    }
+
+    // Prints the usual console output, and once every run is done, the speedup of par over seq for each algorithm,
+    // thread count, and length, along with the crossover: the shortest length from which par is faster than seq at
+    // every longer length measured. With a file name, the same results are also written there as JSON.
+    class speedup_reporter : public benchmark::ConsoleReporter {
+    public:
+        explicit speedup_reporter(std::string json_path_) : json_path(std::move(json_path_)) {}
+
+        void ReportRuns(const std::vector<Run>& runs) override {
+            ConsoleReporter::ReportRuns(runs);
+            for (const auto& run : runs) {
+                if (run.run_type != Run::RT_Iteration) {
+                    continue;
+                }
+
+                const auto& function_name = run.run_name.function_name;
+                if (function_name.rfind("kernel/", 0) == 0) {
+                    continue; // not a comparison with seq
+                }
+
+                const auto slash          = function_name.rfind('/');
+                auto& times               = algorithms[function_name.substr(0, slash)];
+                const auto len            = arg_value(run.run_name.args, "len");
+                const auto threads        = arg_value(run.run_name.args, "threads");
+                auto& time = function_name.substr(slash + 1) == "seq" ? times.seq[len] : times.par[threads][len];
+                // with --benchmark_repetitions, keep the fastest repetition
+                const double elapsed = run.GetAdjustedRealTime();
+                if (time == 0.0 || elapsed < time) {
+                    time = elapsed;
+                }
+            }
+        }
+
+        void Finalize() override {
+            ConsoleReporter::Finalize();
+            print_summary(GetOutputStream());
+            if (!json_path.empty()) {
+                std::ofstream json{json_path};
+                write_json(json);
+            }
+        }
+
+    private:
+        struct algorithm_times {
+            std::map<long long, double> seq; // by length
+            std::map<long long, std::map<long long, double>> par; // by thread count, then length
+        };
+
+        // speedup by length, for the lengths measured under both policies
+        static std::map<long long, double> speedups(
+            const algorithm_times& times, const std::map<long long, double>& par) {
+            std::map<long long, double> result;
+            for (const auto& [len, par_time] : par) {
+                const auto seq_time = times.seq.find(len);
+                if (seq_time != times.seq.end() && par_time > 0.0) {
+                    result.emplace(len, seq_time->second / par_time);
+                }
+            }
+
+            return result;
+        }
+
+        // returns -1 if par is slower at the longest length measured
+        static long long crossover(const std::map<long long, double>& speedup) {
+            long long result = -1;
+            for (auto it = speedup.rbegin(); it != speedup.rend() && it->second > 1.0; ++it) {
+                result = it->first;
+            }
+
+            return result;
+        }
+
+        void print_summary(std::ostream& out) const {
+            out << "\nSpeedup of par over seq by length, and the crossover length from which par is faster:\n";
+            for (const auto& [name, times] : algorithms) {
+                for (const auto& [threads, par] : times.par) {
+                    const auto speedup = speedups(times, par);
+                    const auto cross   = crossover(speedup);
+                    out << std::left << std::setw(18) << name << std::right << std::setw(4) << threads << " threads  "
+                        << "crossover " << std::setw(9) << (cross < 0 ? std::string{"none"} : std::to_string(cross))
+                        << " ";
+                    for (const auto& [len, ratio] : speedup) {
+                        out << ' ' << len << ':' << std::fixed << std::setprecision(2) << ratio;
+                    }
+
+                    out << '\n';
+                }
+            }
+        }
+
+        void write_json(std::ostream& out) const {
+            out << "{\n";
+            bool first_algorithm = true;
+            for (const auto& [name, times] : algorithms) {
+                out << (first_algorithm ? "" : ",\n") << "  \"" << name << "\": [";
+                first_algorithm   = false;
+                bool first_thread = true;
+                for (const auto& [threads, par] : times.par) {
+                    const auto speedup = speedups(times, par);
+                    const auto cross   = crossover(speedup);
+                    out << (first_thread ? "\n" : ",\n") << "    {\"threads\": " << threads << ", \"crossover\": "
+                        << (cross < 0 ? std::string{"null"} : std::to_string(cross)) << ", \"speedup\": {";
+                    first_thread   = false;
+                    bool first_len = true;
+                    for (const auto& [len, ratio] : speedup) {
+                        out << (first_len ? "" : ", ") << '"' << len << "\": " << ratio;
+                        first_len = false;
+                    }
+
+                    out << "}}";
+                }
+
+                out << "\n  ]";
+            }
+
+            out << "\n}\n";
+        }
+
+        std::string json_path;
+        std::map<std::string, algorithm_times> algorithms;
+    };
+} // unnamed namespace
+
+int main(int argc, char** argv) {
+    // --speedup_out=file is ours; everything else goes to Google Benchmark
+    constexpr std::string_view speedup_flag = "--speedup_out=";
+    std::string speedup_out;
+    int kept = 1;
+    for (int idx = 1; idx < argc; ++idx) {
+        const std::string_view arg{argv[idx]};
+        if (arg.substr(0, speedup_flag.size()) == speedup_flag) {
+            speedup_out = arg.substr(speedup_flag.size());
+        } else {
+            argv[kept++] = argv[idx];
+        }
+    }
+
+    argc = kept;
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    register_algorithms();
+    register_kernels();
+    speedup_reporter reporter{speedup_out};
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    benchmark::Shutdown();
+}
@@ -0,0 +1,231 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the values per second of every engine in <random> and stdext's philox engines, of every distribution
+// (and stdext's ziggurat and alias method alternatives) under the engines worth choosing between, of
+// generate_canonical and random_device, and of shuffle and sample.
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+    constexpr std::size_t batch_size = 4096; // values produced per iteration
+
+    void set_items(benchmark::State& state, const std::size_t per_iteration) {
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(per_iteration));
+    }
+
+    // calls eng() for each value
+    template <class Engine>
+    void engine_call(benchmark::State& state) {
+        Engine eng;
+        for (auto _ : state) {
+            for (std::size_t idx = 0; idx < batch_size; ++idx) {
+                benchmark::DoNotOptimize(eng());
+            }
+        }
+
+        set_items(state, batch_size);
+    }
+
+    // stdext::generate, which engines with a bulk path fill a block at a time
+    template <class Engine>
+    void engine_generate(benchmark::State& state) {
+        Engine eng;
+        std::vector<typename Engine::result_type> values(batch_size);
+        for (auto _ : state) {
+            stdext::generate(eng, values.begin(), values.end());
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state, batch_size);
+    }
+
+    void random_device_call(benchmark::State& state) {
+        std::random_device device;
+        for (auto _ : state) {
+            for (std::size_t idx = 0; idx < batch_size; ++idx) {
+                benchmark::DoNotOptimize(device());
+            }
+        }
+
+        set_items(state, batch_size);
+    }
+
+    template <class Engine, class Real, std::size_t Bits>
+    void canonical(benchmark::State& state) {
+        Engine eng;
+        for (auto _ : state) {
+            for (std::size_t idx = 0; idx < batch_size; ++idx) {
+                benchmark::DoNotOptimize(std::generate_canonical<Real, Bits>(eng));
+            }
+        }
+
+        set_items(state, batch_size);
+    }
+
+    // calls dist(eng) for each value
+    template <class Engine, class Dist>
+    void distribution_call(benchmark::State& state, Dist dist) {
+        Engine eng;
+        for (auto _ : state) {
+            for (std::size_t idx = 0; idx < batch_size; ++idx) {
+                benchmark::DoNotOptimize(dist(eng));
+            }
+        }
+
+        set_items(state, batch_size);
+    }
+
+    // stdext::generate(eng, dist, ...), which lets mersenne_twister_engine temper a block at a time
+    template <class Engine, class Dist>
+    void distribution_generate(benchmark::State& state, Dist dist) {
+        // bytes for bernoulli_distribution, rather than the packed bits of vector<bool>
+        using result_type = typename Dist::result_type;
+        using value_type  = std::conditional_t<std::is_same_v<result_type, bool>, unsigned char, result_type>;
+        Engine eng;
+        std::vector<value_type> values(batch_size);
+        for (auto _ : state) {
+            stdext::generate(eng, dist, values.begin(), values.end());
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state, batch_size);
+    }
+
+    template <class Engine>
+    void shuffle(benchmark::State& state) {
+        Engine eng;
+        std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+        std::iota(values.begin(), values.end(), 0);
+        for (auto _ : state) {
+            std::shuffle(values.begin(), values.end(), eng);
+            benchmark::DoNotOptimize(values.data());
+        }
+
+        set_items(state, values.size());
+    }
+
+    // picks 1/16 of the population, as sample is often used to draw a subset for testing
+    template <class Engine>
+    void sample(benchmark::State& state) {
+        Engine eng;
+        std::vector<int> population(static_cast<std::size_t>(state.range(0)));
+        std::iota(population.begin(), population.end(), 0);
+        std::vector<int> chosen(population.size() / 16);
+        for (auto _ : state) {
+            std::sample(population.begin(), population.end(), chosen.begin(), chosen.size(), eng);
+            benchmark::DoNotOptimize(chosen.data());
+        }
+
+        set_items(state, population.size());
+    }
+
+    template <class Engine>
+    void register_engine(const std::string& name) {
+        benchmark::RegisterBenchmark(("engine/" + name + "/call").c_str(), engine_call<Engine>);
+        benchmark::RegisterBenchmark(("engine/" + name + "/generate").c_str(), engine_generate<Engine>);
+    }
+
+    std::vector<double> weights(const std::size_t count) { // a skewed distribution over count values
+        std::vector<double> result(count);
+        for (std::size_t idx = 0; idx < count; ++idx) {
+            result[idx] = 1.0 / static_cast<double>(idx + 1);
+        }
+
+        return result;
+    }
+
+    template <class Engine, class Dist>
+    void register_distribution(const std::string& dist_name, const std::string& engine_name, const Dist& dist) {
+        const std::string prefix = "distribution/" + dist_name + '/' + engine_name;
+        benchmark::RegisterBenchmark(
+            (prefix + "/call").c_str(), [dist](benchmark::State& state) { distribution_call<Engine>(state, dist); });
+        benchmark::RegisterBenchmark((prefix + "/generate").c_str(),
+            [dist](benchmark::State& state) { distribution_generate<Engine>(state, dist); });
+    }
+
+    template <class Engine>
+    void register_distributions(const std::string& engine_name) {
+        const auto w1k = weights(1000);
+        register_distribution<Engine>("uniform_int", engine_name, std::uniform_int_distribution<int>{0, 99'999});
+        register_distribution<Engine>(
+            "uniform_int_full", engine_name, std::uniform_int_distribution<std::uint64_t>{0, UINT64_MAX});
+        register_distribution<Engine>("uniform_real", engine_name, std::uniform_real_distribution<double>{0.0, 1.0});
+        register_distribution<Engine>("bernoulli", engine_name, std::bernoulli_distribution{0.3});
+        register_distribution<Engine>("normal", engine_name, std::normal_distribution<double>{0.0, 1.0});
+        register_distribution<Engine>(
+            "ziggurat_normal", engine_name, stdext::ziggurat_normal_distribution<double>{0.0, 1.0});
+        register_distribution<Engine>("exponential", engine_name, std::exponential_distribution<double>{1.0});
+        register_distribution<Engine>(
+            "ziggurat_exponential", engine_name, stdext::ziggurat_exponential_distribution<double>{1.0});
+        register_distribution<Engine>("poisson_4", engine_name, std::poisson_distribution<int>{4.0});
+        register_distribution<Engine>("poisson_1000", engine_name, std::poisson_distribution<int>{1000.0});
+        register_distribution<Engine>("binomial_20", engine_name, std::binomial_distribution<int>{20, 0.3});
+        register_distribution<Engine>("binomial_1000", engine_name, std::binomial_distribution<int>{1000, 0.3});
+        register_distribution<Engine>(
+            "discrete_1k", engine_name, std::discrete_distribution<int>(w1k.begin(), w1k.end()));
+        register_distribution<Engine>(
+            "alias_discrete_1k", engine_name, stdext::alias_discrete_distribution<int>(w1k.begin(), w1k.end()));
+    }
+
+    template <class Engine>
+    void register_shuffles(const std::string& engine_name) {
+        benchmark::RegisterBenchmark(("shuffle/" + engine_name).c_str(), shuffle<Engine>)
+            ->ArgName("len")
+            ->RangeMultiplier(64)
+            ->Range(1 << 10, 1 << 22);
+        benchmark::RegisterBenchmark(("sample/" + engine_name).c_str(), sample<Engine>)
+            ->ArgName("len")
+            ->RangeMultiplier(64)
+            ->Range(1 << 10, 1 << 22);
+    }
+
+    void register_benchmarks() {
+        register_engine<std::minstd_rand0>("minstd_rand0");
+        register_engine<std::minstd_rand>("minstd_rand");
+        register_engine<std::mt19937>("mt19937");
+        register_engine<std::mt19937_64>("mt19937_64");
+        register_engine<std::ranlux24_base>("ranlux24_base");
+        register_engine<std::ranlux48_base>("ranlux48_base");
+        register_engine<std::ranlux24>("ranlux24");
+        register_engine<std::ranlux48>("ranlux48");
+        register_engine<std::knuth_b>("knuth_b");
+        register_engine<stdext::philox4x32>("philox4x32");
+        register_engine<stdext::philox4x64>("philox4x64");
+        benchmark::RegisterBenchmark("engine/random_device/call", random_device_call);
+
+        benchmark::RegisterBenchmark("generate_canonical/float/mt19937", canonical<std::mt19937, float, 24>);
+        benchmark::RegisterBenchmark("generate_canonical/double/mt19937", canonical<std::mt19937, double, 53>);
+        benchmark::RegisterBenchmark("generate_canonical/double/mt19937_64", canonical<std::mt19937_64, double, 53>);
+
+        // the engines worth choosing between: the 32- and 64-bit twisters, the cheapest engine, and philox
+        register_distributions<std::mt19937>("mt19937");
+        register_distributions<std::mt19937_64>("mt19937_64");
+        register_distributions<std::minstd_rand>("minstd_rand");
+        register_distributions<stdext::philox4x32>("philox4x32");
+
+        register_shuffles<std::mt19937>("mt19937");
+        register_shuffles<std::mt19937_64>("mt19937_64");
+        register_shuffles<std::minstd_rand>("minstd_rand");
+    }
+} // unnamed namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    register_benchmarks();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -0,0 +1,376 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures compiling a corpus of realistic regular expressions, and running them through regex_match, regex_search,
+// regex_iterator, and regex_replace, under each engine: the backtracking _Matcher, and the DFA that regex::optimize
+// patterns get. Besides time, each benchmark reports the allocations it makes per iteration, and those that use a
+// cmatch report the deepest backtracking stack the matcher needed.
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace {
+    std::atomic<std::int64_t> allocation_count{0};
+} // unnamed namespace
+
+void* operator new(const std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* const ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* const ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* const ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+    // An engine is a way of compiling patterns. To compare a new engine, add a row whose flags select it, and have
+    // usable() tell whether a compiled pattern actually runs on it, so that patterns it can't take aren't reported
+    // under its name.
+    struct engine {
+        const char* name;
+        std::regex::flag_type flags;
+        bool (*usable)(const std::regex&);
+    };
+
+    const engine engines[] = {
+        {"backtrack", std::regex::ECMAScript, [](const std::regex& re) { return !re._Uses_dfa(); }},
+        {"dfa", std::regex::ECMAScript | std::regex::optimize, [](const std::regex& re) { return re._Uses_dfa(); }},
+    };
+
+    // the text every pattern runs over: lines of one kind, and all of them joined by newlines
+    struct corpus {
+        std::vector<std::string> lines;
+        std::string text;
+
+        explicit corpus(std::vector<std::string> lines_) : lines(std::move(lines_)) {
+            for (const auto& line : lines) {
+                text += line;
+                text += '\n';
+            }
+        }
+    };
+
+    constexpr int line_count = 4096;
+
+    std::string pick(std::mt19937& gen, const std::vector<std::string>& choices) {
+        return choices[gen() % choices.size()];
+    }
+
+    std::string digits(std::mt19937& gen, const int count) {
+        std::string result;
+        for (int idx = 0; idx < count; ++idx) {
+            result.push_back(static_cast<char>('0' + gen() % 10));
+        }
+
+        return result;
+    }
+
+    std::string word(std::mt19937& gen, const int min_len, const int max_len) {
+        std::string result;
+        const int len = min_len + static_cast<int>(gen() % static_cast<unsigned int>(max_len - min_len + 1));
+        for (int idx = 0; idx < len; ++idx) {
+            result.push_back(static_cast<char>('a' + gen() % 26));
+        }
+
+        return result;
+    }
+
+    const corpus& log_corpus() { // "2024-03-01 12:34:56 [WARN] cache: evicted 123 entries from shard7"
+        static const corpus instance{[] {
+            std::mt19937 gen{1729};
+            const std::vector<std::string> levels{"TRACE", "DEBUG", "INFO", "INFO", "INFO", "WARN", "ERROR"};
+            std::vector<std::string> lines;
+            for (int idx = 0; idx < line_count; ++idx) {
+                std::string message;
+                for (int words = 3 + static_cast<int>(gen() % 8); words != 0; --words) {
+                    message += word(gen, 2, 10);
+                    message += ' ';
+                }
+
+                lines.push_back("20" + digits(gen, 2) + '-' + digits(gen, 2) + '-' + digits(gen, 2) + ' '
+                                + digits(gen, 2) + ':' + digits(gen, 2) + ':' + digits(gen, 2) + " ["
+                                + pick(gen, levels) + "] " + word(gen, 3, 8) + ": " + message + digits(gen, 3));
+            }
+
+            return lines;
+        }()};
+        return instance;
+    }
+
+    const corpus& email_corpus() { // about a third of the addresses are malformed
+        static const corpus instance{[] {
+            std::mt19937 gen{1729};
+            const std::vector<std::string> tlds{"com", "org", "net", "io", "co.uk"};
+            std::vector<std::string> lines;
+            for (int idx = 0; idx < line_count; ++idx) {
+                std::string address = word(gen, 3, 12) + (gen() % 2 ? "." + word(gen, 2, 8) : "") + '@'
+                                    + word(gen, 3, 10) + '.' + pick(gen, tlds);
+                switch (gen() % 6) {
+                case 0:
+                    address.erase(address.find('@'), 1);
+                    break;
+                case 1:
+                    address += "@";
+                    break;
+                default:
+                    break;
+                }
+
+                lines.push_back(std::move(address));
+            }
+
+            return lines;
+        }()};
+        return instance;
+    }
+
+    const corpus& url_corpus() { // "https://host.example.com:8080/a/b/c?x=1&y=2#frag", with the optional parts varying
+        static const corpus instance{[] {
+            std::mt19937 gen{1729};
+            std::vector<std::string> lines;
+            for (int idx = 0; idx < line_count; ++idx) {
+                std::string url = std::string{gen() % 2 ? "https" : "http"} + "://" + word(gen, 3, 8) + '.'
+                                + word(gen, 4, 10) + ".com";
+                if (gen() % 4 == 0) {
+                    url += ':' + digits(gen, 4);
+                }
+
+                for (int segments = static_cast<int>(gen() % 5); segments != 0; --segments) {
+                    url += '/' + word(gen, 2, 12);
+                }
+
+                if (gen() % 2) {
+                    url += "?" + word(gen, 1, 5) + '=' + digits(gen, 3) + '&' + word(gen, 1, 5) + '=' + word(gen, 2, 8);
+                }
+
+                if (gen() % 5 == 0) {
+                    url += '#' + word(gen, 3, 10);
+                }
+
+                lines.push_back(std::move(url));
+            }
+
+            return lines;
+        }()};
+        return instance;
+    }
+
+    const corpus& csv_corpus() { // eight fields per row: names, numbers, and empty fields
+        static const corpus instance{[] {
+            std::mt19937 gen{1729};
+            std::vector<std::string> lines;
+            for (int idx = 0; idx < line_count; ++idx) {
+                std::string row;
+                for (int field = 0; field < 8; ++field) {
+                    if (field != 0) {
+                        row += ',';
+                    }
+
+                    switch (gen() % 4) {
+                    case 0:
+                        break;
+                    case 1:
+                        row += digits(gen, 1 + static_cast<int>(gen() % 6));
+                        break;
+                    default:
+                        row += word(gen, 1, 12);
+                        break;
+                    }
+                }
+
+                lines.push_back(std::move(row));
+            }
+
+            return lines;
+        }()};
+        return instance;
+    }
+
+    struct pattern {
+        const char* name;
+        const char* source;
+        const corpus& (*text)();
+        const char* replacement; // for regex_replace
+    };
+
+    const pattern patterns[] = {
+        {"log_line", R"((\d+)-(\d+)-(\d+) (\d+):(\d+):(\d+) \[([A-Z]+)\] ([a-z]+): (.*))", log_corpus,
+            "$7 $1$2$3T$4$5$6 $8"},
+        {"log_level", R"(\[(WARN|ERROR)\] ([a-z]+))", log_corpus, "[$1:$2]"},
+        {"log_number", R"([0-9]+)", log_corpus, "#"},
+        {"email", R"(([A-Za-z0-9._%+-]+)@([A-Za-z0-9-]+(\.[A-Za-z0-9-]+)*\.[A-Za-z]+))", email_corpus, "<$1 at $2>"},
+        {"url", R"((https?)://([^/:?#]+)(:[0-9]+)?(/[^?#]*)?(\?[^#]*)?(#.*)?)", url_corpus, "$2"},
+        {"csv_field", R"([^,]+)", csv_corpus, "\"$&\""},
+        {"csv_row", R"(([^,]*),([^,]*),([^,]*),([^,]*),([^,]*),([^,]*),([^,]*),([^,]*))", csv_corpus, "$8,$1"},
+    };
+
+    // peeks at the matcher's working storage, which a cmatch keeps between matches, to see how many backtracking
+    // frames the deepest match needed
+    std::size_t backtrack_depth(std::cmatch& matches) {
+        return matches._Scratch._Get()._Frames.size();
+    }
+
+    void set_counters(benchmark::State& state, const std::int64_t allocations, const std::size_t bytes) {
+        state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(bytes));
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+    }
+
+    void compile(benchmark::State& state, const pattern& pat, const engine& eng) {
+        const auto before = allocation_count.load(std::memory_order_relaxed);
+        for (auto _ : state) {
+            std::regex re{pat.source, eng.flags};
+            benchmark::DoNotOptimize(re);
+        }
+
+        state.counters["allocs"] = benchmark::Counter(
+            static_cast<double>(allocation_count.load(std::memory_order_relaxed) - before),
+            benchmark::Counter::kAvgIterations);
+    }
+
+    // regex_match of each line, or with search, regex_search in each line, with submatches
+    template <bool Search>
+    void match_lines(benchmark::State& state, const std::regex& re, const pattern& pat) {
+        const corpus& text = pat.text();
+        std::cmatch matches;
+        std::size_t found = 0;
+        const auto before = allocation_count.load(std::memory_order_relaxed);
+        for (auto _ : state) {
+            for (const auto& line : text.lines) {
+                const char* const first = line.data();
+                const char* const last  = first + line.size();
+                if (Search ? std::regex_search(first, last, matches, re) : std::regex_match(first, last, matches, re)) {
+                    ++found;
+                }
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+        set_counters(state, allocation_count.load(std::memory_order_relaxed) - before, text.text.size());
+        state.counters["depth"] = static_cast<double>(backtrack_depth(matches));
+    }
+
+    // regex_search in each line without match_results, which the DFA can answer alone
+    void test_lines(benchmark::State& state, const std::regex& re, const pattern& pat) {
+        const corpus& text = pat.text();
+        std::size_t found  = 0;
+        const auto before  = allocation_count.load(std::memory_order_relaxed);
+        for (auto _ : state) {
+            for (const auto& line : text.lines) {
+                if (std::regex_search(line.data(), line.data() + line.size(), re)) {
+                    ++found;
+                }
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+        set_counters(state, allocation_count.load(std::memory_order_relaxed) - before, text.text.size());
+    }
+
+    // every match in the whole text, one after another
+    void iterate(benchmark::State& state, const std::regex& re, const pattern& pat) {
+        const corpus& text      = pat.text();
+        const char* const first = text.text.data();
+        const char* const last  = first + text.text.size();
+        std::size_t found       = 0;
+        const auto before       = allocation_count.load(std::memory_order_relaxed);
+        for (auto _ : state) {
+            for (std::cregex_iterator it{first, last, re}, end; it != end; ++it) {
+                found += static_cast<std::size_t>(it->length());
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+        set_counters(state, allocation_count.load(std::memory_order_relaxed) - before, text.text.size());
+    }
+
+    void replace(benchmark::State& state, const std::regex& re, const pattern& pat) {
+        const corpus& text = pat.text();
+        std::string result;
+        const auto before = allocation_count.load(std::memory_order_relaxed);
+        for (auto _ : state) {
+            result.clear();
+            std::regex_replace(std::back_inserter(result), text.text.begin(), text.text.end(), re, pat.replacement);
+            benchmark::DoNotOptimize(result.data());
+        }
+
+        set_counters(state, allocation_count.load(std::memory_order_relaxed) - before, text.text.size());
+    }
+
+    // Catastrophic backtracking: (a+)+b against a run of n a's and no b takes the backtracking matcher about 2^n
+    // steps, until it gives up with error_complexity, while a DFA rejects it in n steps.
+    void pathological(benchmark::State& state, const engine& eng) {
+        const std::regex re{"(a+)+b", eng.flags};
+        if (!eng.usable(re)) {
+            state.SkipWithError("the engine doesn't take this pattern");
+            return;
+        }
+
+        const std::string text(static_cast<std::size_t>(state.range(0)), 'a');
+        std::cmatch matches;
+        const auto before = allocation_count.load(std::memory_order_relaxed);
+        try {
+            for (auto _ : state) {
+                benchmark::DoNotOptimize(std::regex_match(text.data(), text.data() + text.size(), matches, re));
+            }
+        } catch (const std::regex_error&) {
+            state.SkipWithError("error_complexity");
+            return;
+        }
+
+        set_counters(state, allocation_count.load(std::memory_order_relaxed) - before, text.size());
+        state.counters["depth"] = static_cast<double>(backtrack_depth(matches));
+    }
+
+    void register_benchmarks() {
+        for (const auto& eng : engines) {
+            for (const auto& pat : patterns) {
+                const std::regex re{pat.source, eng.flags};
+                if (!eng.usable(re)) {
+                    continue;
+                }
+
+                const std::string prefix = std::string{pat.name} + '/';
+                const std::string suffix = std::string{"/"} + eng.name;
+                benchmark::RegisterBenchmark((prefix + "compile" + suffix).c_str(), compile, pat, eng);
+                benchmark::RegisterBenchmark((prefix + "match" + suffix).c_str(), match_lines<false>, re, pat);
+                benchmark::RegisterBenchmark((prefix + "search" + suffix).c_str(), match_lines<true>, re, pat);
+                benchmark::RegisterBenchmark((prefix + "test" + suffix).c_str(), test_lines, re, pat);
+                benchmark::RegisterBenchmark((prefix + "iterate" + suffix).c_str(), iterate, re, pat);
+                benchmark::RegisterBenchmark((prefix + "replace" + suffix).c_str(), replace, re, pat);
+            }
+
+            benchmark::RegisterBenchmark((std::string{"pathological/match/"} + eng.name).c_str(), pathological, eng)
+                ->ArgName("len")
+                ->DenseRange(8, 24, 4);
+        }
+    }
+} // unnamed namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    register_benchmarks();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
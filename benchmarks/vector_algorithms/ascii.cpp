@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstddef>
+#include <string>
+
+#include <vector_algorithms_bench.hpp>
+
+namespace {
+    // printable ASCII, about a quarter of it letters of each case
+    bench::aligned_buffer<bench::u8> make_text(const benchmark::State& state) {
+        bench::aligned_buffer<bench::u8> buf(bench::length(state), bench::misalignment(state));
+        bench::fill_random(buf.begin(), buf.end(), 95);
+        for (auto& ch : buf) {
+            ch = static_cast<bench::u8>(ch + ' ');
+        }
+
+        return buf;
+    }
+
+    template <auto Kernel>
+    void change_case(benchmark::State& state) {
+        auto text = make_text(state);
+        for (auto _ : state) {
+            Kernel(text.begin(), text.end());
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<bench::u8>(state, bench::length(state));
+    }
+
+    void imismatch(benchmark::State& state) {
+        const auto left = make_text(state);
+        auto right      = make_text(state);
+        const auto len  = bench::length(state);
+        __std_ascii_toupper_1(right.begin(), right.end()); // equal ignoring case, so the whole range is compared
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(__std_ascii_imismatch_1(left.begin(), right.begin(), len));
+        }
+
+        bench::set_processed<bench::u8>(state, len);
+    }
+
+    const bench::kernel_registrar registrar{
+        {"ascii_tolower_1", 1, change_case<__std_ascii_tolower_1>},
+        {"ascii_toupper_1", 1, change_case<__std_ascii_toupper_1>},
+        {"ascii_imismatch_1", 1, imismatch},
+    };
+} // unnamed namespace
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <bitset>
+#include <cstddef>
+
+#include <vector_algorithms_bench.hpp>
+
+namespace {
+    // The length of these benchmarks is the number of bits in the bitset, which is also the number of characters in
+    // its string form.
+
+    void count(benchmark::State& state) {
+        const auto bytes = bench::length(state) / 8;
+        bench::aligned_buffer<bench::u8> words(bytes, bench::misalignment(state));
+        bench::fill_random(words.begin(), words.end(), 256);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(__std_bitset_count(words.begin(), words.end()));
+        }
+
+        bench::set_processed<bench::u8>(state, bytes);
+    }
+
+    template <class Elem, auto Kernel>
+    void to_string(benchmark::State& state) {
+        const auto len = bench::length(state);
+        bench::aligned_buffer<bench::u8> words(len / 8, 0);
+        bench::aligned_buffer<Elem> str(len, bench::misalignment(state));
+        bench::fill_random(words.begin(), words.end(), 256);
+        for (auto _ : state) {
+            Kernel(str.begin(), words.begin(), len, Elem{'0'}, Elem{'1'});
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<Elem>(state, len);
+    }
+
+    template <class Elem, auto Kernel>
+    void from_string(benchmark::State& state) {
+        const auto len   = bench::length(state);
+        const auto bytes = (len / 8 + 7) / 8 * 8; // whole 64-bit words, as bitset stores them
+        bench::aligned_buffer<bench::u8> words(bytes, 0);
+        bench::aligned_buffer<Elem> str(len, bench::misalignment(state));
+        bench::fill_random(str.begin(), str.end(), 2);
+        for (auto& ch : str) {
+            ch = static_cast<Elem>('0' + ch);
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(words.begin(), str.begin(), bytes, len, len, Elem{'0'}, Elem{'1'}));
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<Elem>(state, len);
+    }
+
+    const bench::kernel_registrar registrar{
+        {"bitset_count", 1, count},
+        {"bitset_to_string_1", 1, to_string<char, __std_bitset_to_string_1>},
+        {"bitset_to_string_2", 2, to_string<wchar_t, __std_bitset_to_string_2>},
+        {"bitset_from_string_1", 1, from_string<char, __std_bitset_from_string_1>},
+        {"bitset_from_string_2", 2, from_string<wchar_t, __std_bitset_from_string_2>},
+    };
+} // unnamed namespace
@@ -0,0 +1,138 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include <vector_algorithms_bench.hpp>
+
+namespace {
+    // The haystacks cycle through [0, 100), so that neighbours always differ and every search below that isn't meant
+    // to find anything scans the whole range.
+    template <class T>
+    bench::aligned_buffer<T> make_haystack(const benchmark::State& state) {
+        bench::aligned_buffer<T> buf(bench::length(state), bench::misalignment(state));
+        std::size_t idx = 0;
+        for (auto& elem : buf) {
+            elem = static_cast<T>(idx++ % 100);
+        }
+
+        return buf;
+    }
+
+    template <std::size_t Size, auto Kernel>
+    void find(benchmark::State& state) {
+        using T             = bench::uint_of_t<Size>;
+        const auto haystack = make_haystack<T>(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(haystack.begin(), haystack.end(), T{200}));
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    template <std::size_t Size, auto Kernel>
+    void count(benchmark::State& state) {
+        using T             = bench::uint_of_t<Size>;
+        const auto haystack = make_haystack<T>(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(haystack.begin(), haystack.end(), T{7}));
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    template <std::size_t Size, auto Kernel>
+    void adjacent_find(benchmark::State& state) {
+        using T             = bench::uint_of_t<Size>;
+        const auto haystack = make_haystack<T>(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(haystack.begin(), haystack.end()));
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    template <std::size_t Size, auto Kernel>
+    void find_first_of(benchmark::State& state) {
+        using T             = bench::uint_of_t<Size>;
+        const auto haystack = make_haystack<T>(state);
+        const T needle[]    = {200, 201, 202, 203, 204, 205, 206, 207};
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(haystack.begin(), haystack.end(), std::begin(needle), std::end(needle)));
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    template <std::size_t Size, auto Kernel>
+    void search(benchmark::State& state) {
+        using T             = bench::uint_of_t<Size>;
+        const auto haystack = make_haystack<T>(state);
+        const T needle[]    = {10, 11, 12, 13, 14, 15, 16, 18}; // every cycle matches all but the last element
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(haystack.begin(), haystack.end(), std::begin(needle), std::end(needle)));
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    template <std::size_t Size, auto Kernel>
+    void find_of_ascii(benchmark::State& state) {
+        using T             = bench::uint_of_t<Size>;
+        const auto haystack = make_haystack<T>(state);
+        const T needle[]    = {'x', 'y', 'z', '{', '|', '}', '~'};
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(haystack.begin(), haystack.end(), needle, std::size(needle), true));
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    template <std::size_t Size, auto Kernel>
+    void mismatch(benchmark::State& state) {
+        using T          = bench::uint_of_t<Size>;
+        const auto left  = make_haystack<T>(state);
+        const auto right = make_haystack<T>(state);
+        const auto len   = bench::length(state);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(left.begin(), right.begin(), len));
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    const bench::kernel_registrar registrar{
+        {"find_trivial_1", 1, find<1, __std_find_trivial_1>},
+        {"find_trivial_2", 2, find<2, __std_find_trivial_2>},
+        {"find_trivial_4", 4, find<4, __std_find_trivial_4>},
+        {"find_trivial_8", 8, find<8, __std_find_trivial_8>},
+        {"count_trivial_1", 1, count<1, __std_count_trivial_1>},
+        {"count_trivial_2", 2, count<2, __std_count_trivial_2>},
+        {"count_trivial_4", 4, count<4, __std_count_trivial_4>},
+        {"count_trivial_8", 8, count<8, __std_count_trivial_8>},
+        {"adjacent_find_1", 1, adjacent_find<1, __std_adjacent_find_1>},
+        {"adjacent_find_2", 2, adjacent_find<2, __std_adjacent_find_2>},
+        {"adjacent_find_4", 4, adjacent_find<4, __std_adjacent_find_4>},
+        {"adjacent_find_8", 8, adjacent_find<8, __std_adjacent_find_8>},
+        {"find_first_of_trivial_1", 1, find_first_of<1, __std_find_first_of_trivial_1>},
+        {"find_first_of_trivial_2", 2, find_first_of<2, __std_find_first_of_trivial_2>},
+        {"find_first_of_trivial_4", 4, find_first_of<4, __std_find_first_of_trivial_4>},
+        {"find_first_of_trivial_8", 8, find_first_of<8, __std_find_first_of_trivial_8>},
+        {"find_first_of_ascii_1", 1, find_of_ascii<1, __std_find_first_of_ascii_1>},
+        {"find_first_of_ascii_2", 2, find_of_ascii<2, __std_find_first_of_ascii_2>},
+        {"find_first_of_ascii_4", 4, find_of_ascii<4, __std_find_first_of_ascii_4>},
+        {"find_last_of_ascii_1", 1, find_of_ascii<1, __std_find_last_of_ascii_1>},
+        {"find_last_of_ascii_2", 2, find_of_ascii<2, __std_find_last_of_ascii_2>},
+        {"find_last_of_ascii_4", 4, find_of_ascii<4, __std_find_last_of_ascii_4>},
+        {"search_1", 1, search<1, __std_search_1>},
+        {"search_2", 2, search<2, __std_search_2>},
+        {"search_4", 4, search<4, __std_search_4>},
+        {"search_8", 8, search<8, __std_search_8>},
+        {"mismatch_1", 1, mismatch<1, __std_mismatch_1>},
+        {"mismatch_2", 2, mismatch<2, __std_mismatch_2>},
+        {"mismatch_4", 4, mismatch<4, __std_mismatch_4>},
+        {"mismatch_8", 8, mismatch<8, __std_mismatch_8>},
+    };
+} // unnamed namespace
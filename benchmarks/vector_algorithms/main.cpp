@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstddef>
+#include <cstdint>
+#include <intrin.h>
+#include <string>
+#include <vector>
+
+#include <vector_algorithms_bench.hpp>
+
+namespace bench {
+    std::vector<kernel_benchmark>& kernel_registry() {
+        static std::vector<kernel_benchmark> registry;
+        return registry;
+    }
+} // namespace bench
+
+namespace {
+    // 8, 64, 512, ..., 262144 and 1M elements: from below one vector up to well beyond the last level cache
+    std::vector<std::int64_t> benchmark_lengths() {
+        std::vector<std::int64_t> lengths;
+        for (std::int64_t len = 8; len < (1 << 20); len *= 8) {
+            lengths.push_back(len);
+        }
+
+        lengths.push_back(1 << 20);
+        return lengths;
+    }
+
+    // aligned to a cache line, off by one element, and aligned to 32 but not 64 bytes
+    std::vector<std::int64_t> benchmark_misalignments(const std::size_t elem_size) {
+        return {0, static_cast<std::int64_t>(elem_size), 32};
+    }
+
+    void register_kernels() {
+        const auto lengths = benchmark_lengths();
+        for (const auto& tier : bench::isa_tiers) {
+            if (!_bittest(&__isa_enabled, tier.required)) {
+                continue;
+            }
+
+            for (const auto& kernel : bench::kernel_registry()) {
+                const std::string name = std::string{kernel.name} + '/' + tier.name;
+                benchmark::RegisterBenchmark(name.c_str(),
+                    [&tier, run = kernel.run](benchmark::State& state) {
+                        const bench::isa_tier_scope scope{tier};
+                        run(state);
+                    })
+                    ->ArgNames({"len", "misalign"})
+                    ->ArgsProduct({lengths, benchmark_misalignments(kernel.elem_size)});
+            }
+        }
+    }
+} // unnamed namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // registered here, after every translation unit's registrar has run, so that each tier lists the kernels in the
+    // same order
+    register_kernels();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+}
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <valarray>
+
+#include <vector_algorithms_bench.hpp>
+
+// The elementwise math and complex kernels live in vector_math.cpp rather than vector_algorithms.cpp, but are
+// injected into the import libraries and dispatched on __isa_enabled the same way.
+
+namespace {
+    template <class T>
+    void fill_uniform(T* first, T* const last, const double low, const double high, const unsigned int seed = 1729) {
+        std::mt19937_64 gen{seed};
+        std::uniform_real_distribution<double> dist{low, high};
+        for (; first != last; ++first) {
+            *first = static_cast<T>(dist(gen));
+        }
+    }
+
+    // the arguments are spread over the range where the kernels do the work themselves rather than calling the CRT
+    template <class T, auto Kernel, int Low, int High>
+    void unary(benchmark::State& state) {
+        const auto len  = bench::length(state);
+        const auto skew = bench::misalignment(state);
+        bench::aligned_buffer<T> src(len, skew);
+        bench::aligned_buffer<T> dest(len, skew);
+        fill_uniform(src.begin(), src.end(), Low, High);
+        for (auto _ : state) {
+            Kernel(src.begin(), dest.begin(), len);
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    template <class T, auto Kernel>
+    void power(benchmark::State& state) {
+        const auto len  = bench::length(state);
+        const auto skew = bench::misalignment(state);
+        bench::aligned_buffer<T> base(len, skew);
+        bench::aligned_buffer<T> exponent(len, skew);
+        bench::aligned_buffer<T> dest(len, skew);
+        fill_uniform(base.begin(), base.end(), 0.01, 100.0);
+        fill_uniform(exponent.begin(), exponent.end(), -3.0, 3.0, 42);
+        for (auto _ : state) {
+            Kernel(base.begin(), exponent.begin(), dest.begin(), len, false, false);
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    // the length is the number of complex values, each two T
+    template <class T, auto Kernel>
+    void complex_multiply(benchmark::State& state) {
+        const auto len  = bench::length(state);
+        const auto skew = bench::misalignment(state);
+        bench::aligned_buffer<T> left(2 * len, skew);
+        bench::aligned_buffer<T> right(2 * len, skew);
+        bench::aligned_buffer<T> dest(2 * len, skew);
+        fill_uniform(left.begin(), left.end(), -1.0, 1.0);
+        fill_uniform(right.begin(), right.end(), -1.0, 1.0, 42);
+        fill_uniform(dest.begin(), dest.end(), -1.0, 1.0, 7);
+        for (auto _ : state) {
+            Kernel(left.begin(), right.begin(), dest.begin(), len);
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, 2 * len);
+    }
+
+    const bench::kernel_registrar registrar{
+        {"math_exp_f", 4, unary<float, __std_math_exp_f, -80, 80>},
+        {"math_exp_d", 8, unary<double, __std_math_exp_d, -700, 700>},
+        {"math_log_f", 4, unary<float, __std_math_log_f, 0, 1'000'000>},
+        {"math_log_d", 8, unary<double, __std_math_log_d, 0, 1'000'000>},
+        {"math_sin_f", 4, unary<float, __std_math_sin_f, -1000, 1000>},
+        {"math_sin_d", 8, unary<double, __std_math_sin_d, -1000, 1000>},
+        {"math_cos_f", 4, unary<float, __std_math_cos_f, -1000, 1000>},
+        {"math_cos_d", 8, unary<double, __std_math_cos_d, -1000, 1000>},
+        {"math_tanh_f", 4, unary<float, __std_math_tanh_f, -10, 10>},
+        {"math_tanh_d", 8, unary<double, __std_math_tanh_d, -20, 20>},
+        {"math_sqrt_f", 4, unary<float, __std_math_sqrt_f, 0, 1'000'000>},
+        {"math_sqrt_d", 8, unary<double, __std_math_sqrt_d, 0, 1'000'000>},
+        {"math_pow_f", 4, power<float, __std_math_pow_f>},
+        {"math_pow_d", 8, power<double, __std_math_pow_d>},
+        {"complex_multiply_f", 4, complex_multiply<float, __std_complex_multiply_f>},
+        {"complex_multiply_d", 8, complex_multiply<double, __std_complex_multiply_d>},
+        {"complex_multiply_add_f", 4, complex_multiply<float, __std_complex_multiply_add_f>},
+        {"complex_multiply_add_d", 8, complex_multiply<double, __std_complex_multiply_add_d>},
+    };
+} // unnamed namespace
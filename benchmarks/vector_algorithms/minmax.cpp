@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <type_traits>
+
+#include <vector_algorithms_bench.hpp>
+
+namespace {
+    template <class T>
+    bench::aligned_buffer<T> make_random(const benchmark::State& state) {
+        bench::aligned_buffer<T> buf(bench::length(state), bench::misalignment(state));
+        bench::fill_random(buf.begin(), buf.end(), 1'000'000);
+        return buf;
+    }
+
+    template <class T, auto Kernel>
+    void element(benchmark::State& state) {
+        const auto buf = make_random<T>(state);
+        for (auto _ : state) {
+            if constexpr (std::is_floating_point_v<T>) {
+                benchmark::DoNotOptimize(Kernel(buf.begin(), buf.end()));
+            } else {
+                benchmark::DoNotOptimize(Kernel(buf.begin(), buf.end(), false));
+            }
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    template <class T, auto Kernel>
+    void is_sorted_until(benchmark::State& state) {
+        bench::aligned_buffer<T> buf(bench::length(state), bench::misalignment(state));
+        std::fill(buf.begin(), buf.end(), T{0});
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(buf.begin(), buf.end(), false));
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    const bench::kernel_registrar registrar{
+        {"min_element_1", 1, element<bench::u8, __std_min_element_1>},
+        {"min_element_2", 2, element<bench::u16, __std_min_element_2>},
+        {"min_element_4", 4, element<bench::u32, __std_min_element_4>},
+        {"min_element_8", 8, element<bench::u64, __std_min_element_8>},
+        {"min_element_f", 4, element<float, __std_min_element_f>},
+        {"min_element_d", 8, element<double, __std_min_element_d>},
+        {"max_element_1", 1, element<bench::u8, __std_max_element_1>},
+        {"max_element_2", 2, element<bench::u16, __std_max_element_2>},
+        {"max_element_4", 4, element<bench::u32, __std_max_element_4>},
+        {"max_element_8", 8, element<bench::u64, __std_max_element_8>},
+        {"max_element_f", 4, element<float, __std_max_element_f>},
+        {"max_element_d", 8, element<double, __std_max_element_d>},
+        {"minmax_element_1", 1, element<bench::u8, __std_minmax_element_1>},
+        {"minmax_element_2", 2, element<bench::u16, __std_minmax_element_2>},
+        {"minmax_element_4", 4, element<bench::u32, __std_minmax_element_4>},
+        {"minmax_element_8", 8, element<bench::u64, __std_minmax_element_8>},
+        {"minmax_element_f", 4, element<float, __std_minmax_element_f>},
+        {"minmax_element_d", 8, element<double, __std_minmax_element_d>},
+        {"is_sorted_until_1", 1, is_sorted_until<bench::u8, __std_is_sorted_until_1>},
+        {"is_sorted_until_2", 2, is_sorted_until<bench::u16, __std_is_sorted_until_2>},
+        {"is_sorted_until_4", 4, is_sorted_until<bench::u32, __std_is_sorted_until_4>},
+        {"is_sorted_until_8", 8, is_sorted_until<bench::u64, __std_is_sorted_until_8>},
+    };
+} // unnamed namespace
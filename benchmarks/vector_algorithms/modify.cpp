@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <type_traits>
+
+#include <vector_algorithms_bench.hpp>
+
+namespace {
+    template <class T, auto Kernel>
+    void fill(benchmark::State& state) {
+        bench::aligned_buffer<T> buf(bench::length(state), bench::misalignment(state));
+        for (auto _ : state) {
+            Kernel(buf.begin(), buf.end(), T{0x5A});
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    template <class T, auto Kernel>
+    void replace(benchmark::State& state) {
+        bench::aligned_buffer<T> buf(bench::length(state), bench::misalignment(state));
+        bench::fill_random(buf.begin(), buf.end(), 100);
+        T old_val = 7;
+        T new_val = 200;
+        for (auto _ : state) {
+            // swapping the values each time keeps about 1% of the elements matching
+            Kernel(buf.begin(), buf.end(), old_val, new_val);
+            benchmark::ClobberMemory();
+            std::swap(old_val, new_val);
+        }
+
+        bench::set_processed<T>(state, bench::length(state));
+    }
+
+    // The kernels below leave their input rearranged, so each iteration first restores it from a pristine copy; that
+    // copy is part of the measured time, equally for every tier and every run being compared.
+    template <class T, class Fn>
+    void restore_and_run(benchmark::State& state, const unsigned long long bound, Fn fn) {
+        const auto len  = bench::length(state);
+        const auto skew = bench::misalignment(state);
+        bench::aligned_buffer<T> pristine(len, skew);
+        bench::aligned_buffer<T> buf(len, skew);
+        bench::fill_random(pristine.begin(), pristine.end(), bound);
+        for (auto _ : state) {
+            std::copy(pristine.begin(), pristine.end(), buf.begin());
+            benchmark::DoNotOptimize(fn(buf.begin(), buf.end()));
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    template <class T, auto Kernel>
+    void remove(benchmark::State& state) {
+        // removes about a quarter of the elements
+        restore_and_run<T>(state, 4, [](T* const first, T* const last) { return Kernel(first, last, T{0}); });
+    }
+
+    template <class T, auto Kernel>
+    void unique(benchmark::State& state) {
+        // runs of equal elements average 2 long
+        restore_and_run<T>(state, 2, [](T* const first, T* const last) { return Kernel(first, last); });
+    }
+
+    template <class T, auto Kernel>
+    void partition(benchmark::State& state) {
+        // puts the elements less than the pivot, about half of them, first
+        restore_and_run<T>(state, 1'000'000, [](T* const first, T* const last) {
+            if constexpr (std::is_floating_point_v<T>) {
+                return Kernel(first, last, T{500'000}, false);
+            } else {
+                return Kernel(first, last, T{500'000}, false, false);
+            }
+        });
+    }
+
+    template <class T, auto Kernel>
+    void partition_copy(benchmark::State& state) {
+        const auto len  = bench::length(state);
+        const auto skew = bench::misalignment(state);
+        bench::aligned_buffer<T> src(len, skew);
+        bench::aligned_buffer<T> dest_true(len, skew);
+        bench::aligned_buffer<T> dest_false(len, skew);
+        bench::fill_random(src.begin(), src.end(), 1'000'000);
+        for (auto _ : state) {
+            if constexpr (std::is_floating_point_v<T>) {
+                benchmark::DoNotOptimize(
+                    Kernel(src.begin(), src.end(), dest_true.begin(), dest_false.begin(), T{500'000}, false));
+            } else {
+                benchmark::DoNotOptimize(
+                    Kernel(src.begin(), src.end(), dest_true.begin(), dest_false.begin(), T{500'000}, false, false));
+            }
+
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    const bench::kernel_registrar registrar{
+        {"fill_2", 2, fill<bench::u16, __std_fill_2>},
+        {"fill_4", 4, fill<bench::u32, __std_fill_4>},
+        {"fill_8", 8, fill<bench::u64, __std_fill_8>},
+        {"replace_1", 1, replace<bench::u8, __std_replace_1>},
+        {"replace_2", 2, replace<bench::u16, __std_replace_2>},
+        {"replace_4", 4, replace<bench::u32, __std_replace_4>},
+        {"replace_8", 8, replace<bench::u64, __std_replace_8>},
+        {"remove_4", 4, remove<bench::u32, __std_remove_4>},
+        {"remove_8", 8, remove<bench::u64, __std_remove_8>},
+        {"unique_4", 4, unique<bench::u32, __std_unique_4>},
+        {"unique_8", 8, unique<bench::u64, __std_unique_8>},
+        {"partition_4", 4, partition<bench::u32, __std_partition_4>},
+        {"partition_8", 8, partition<bench::u64, __std_partition_8>},
+        {"partition_f", 4, partition<float, __std_partition_f>},
+        {"partition_d", 8, partition<double, __std_partition_d>},
+        {"partition_copy_4", 4, partition_copy<bench::u32, __std_partition_copy_4>},
+        {"partition_copy_8", 8, partition_copy<bench::u64, __std_partition_copy_8>},
+        {"partition_copy_f", 4, partition_copy<float, __std_partition_copy_f>},
+        {"partition_copy_d", 8, partition_copy<double, __std_partition_copy_d>},
+    };
+} // unnamed namespace
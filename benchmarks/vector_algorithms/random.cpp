@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstddef>
+#include <random>
+
+#include <vector_algorithms_bench.hpp>
+
+namespace {
+    // The parameters are those of mt19937 and mt19937_64; the length is the number of words produced.
+
+    template <class T, auto Kernel, T Px, T Hmsk>
+    void mersenne_twist(benchmark::State& state) {
+        const auto len  = bench::length(state);
+        const auto skew = bench::misalignment(state);
+        bench::aligned_buffer<T> src(len + 1, skew); // each word also reads its successor
+        bench::aligned_buffer<T> src_m(len, skew);
+        bench::aligned_buffer<T> dest(len, skew);
+        bench::fill_random(src.begin(), src.end(), ~0ULL);
+        bench::fill_random(src_m.begin(), src_m.end(), ~0ULL, 42);
+        for (auto _ : state) {
+            Kernel(dest.begin(), src.begin(), src_m.begin(), len, Px, Hmsk);
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    template <class T, auto Kernel, T Dx, T Bx, T Cx, int Ux, int Sx, int Tx, int Lx>
+    void mersenne_temper(benchmark::State& state) {
+        const auto len  = bench::length(state);
+        const auto skew = bench::misalignment(state);
+        bench::aligned_buffer<T> src(len, skew);
+        bench::aligned_buffer<T> dest(len, skew);
+        bench::fill_random(src.begin(), src.end(), ~0ULL);
+        for (auto _ : state) {
+            Kernel(dest.begin(), src.begin(), len, Dx, Bx, Cx, Ux, Sx, Tx, Lx);
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    void philox4x32(benchmark::State& state) {
+        // the parameters of philox4x32, which produces blocks of 4 words
+        constexpr unsigned int consts[] = {0xCD9E8D57, 0x9E3779B9, 0xD2511F53, 0xBB67AE85};
+        constexpr unsigned int key[]    = {0x12345678, 0x9ABCDEF0};
+        unsigned int counter[4]         = {};
+        const auto len                  = bench::length(state);
+        bench::aligned_buffer<unsigned int> dest(len, bench::misalignment(state));
+        for (auto _ : state) {
+            __std_philox4x32(dest.begin(), len / 4, counter, key, consts, 10);
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<unsigned int>(state, len);
+    }
+
+    const bench::kernel_registrar registrar{
+        {"mersenne_twist_4", 4, mersenne_twist<bench::u32, __std_mersenne_twist_4, 0x9908B0DF, 0x80000000>},
+        {"mersenne_twist_8", 8,
+            mersenne_twist<bench::u64, __std_mersenne_twist_8, 0xB5026F5AA96619E9, 0xFFFFFFFF80000000>},
+        {"mersenne_temper_4", 4,
+            mersenne_temper<bench::u32, __std_mersenne_temper_4, 0xFFFFFFFF, 0x9D2C5680, 0xEFC60000, 11, 7, 15, 18>},
+        {"mersenne_temper_8", 8,
+            mersenne_temper<bench::u64, __std_mersenne_temper_8, 0x5555555555555555, 0x71D67FFFEDA60000,
+                0xFFF7EEE000000000, 29, 17, 37, 43>},
+        {"philox4x32", 4, philox4x32},
+    };
+} // unnamed namespace
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cstddef>
+
+#include <vector_algorithms_bench.hpp>
+
+// TRANSITION, ABI: preserved for binary compatibility, and not declared by any header
+extern "C" void* __cdecl __std_swap_ranges_trivially_swappable(void* first1, void* last1, void* first2) noexcept;
+
+namespace {
+    template <std::size_t Size, auto Kernel>
+    void swap_ranges(benchmark::State& state) {
+        using T         = bench::uint_of_t<Size>;
+        const auto len  = bench::length(state);
+        const auto skew = bench::misalignment(state);
+        bench::aligned_buffer<T> left(len, skew);
+        bench::aligned_buffer<T> right(len, skew);
+        bench::fill_random(left.begin(), left.end(), 256);
+        bench::fill_random(right.begin(), right.end(), 256, 42);
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Kernel(left.begin(), left.end(), right.begin()));
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    // __std_swap_ranges_trivially_swappable_noalias returns void; adapt it to the shape of its sibling
+    void* swap_ranges_noalias(void* const first1, void* const last1, void* const first2) noexcept {
+        __std_swap_ranges_trivially_swappable_noalias(first1, last1, first2);
+        return first2;
+    }
+
+    template <std::size_t Size, auto Kernel>
+    void reverse(benchmark::State& state) {
+        using T        = bench::uint_of_t<Size>;
+        const auto len = bench::length(state);
+        bench::aligned_buffer<T> buf(len, bench::misalignment(state));
+        bench::fill_random(buf.begin(), buf.end(), 256);
+        for (auto _ : state) {
+            Kernel(buf.begin(), buf.end());
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    template <std::size_t Size, auto Kernel>
+    void reverse_copy(benchmark::State& state) {
+        using T         = bench::uint_of_t<Size>;
+        const auto len  = bench::length(state);
+        const auto skew = bench::misalignment(state);
+        bench::aligned_buffer<T> src(len, skew);
+        bench::aligned_buffer<T> dest(len, skew);
+        bench::fill_random(src.begin(), src.end(), 256);
+        for (auto _ : state) {
+            Kernel(src.begin(), src.end(), dest.begin());
+            benchmark::ClobberMemory();
+        }
+
+        bench::set_processed<T>(state, len);
+    }
+
+    const bench::kernel_registrar registrar{
+        {"swap_ranges_trivially_swappable_noalias", 1, swap_ranges<1, swap_ranges_noalias>},
+        {"swap_ranges_trivially_swappable", 1, swap_ranges<1, __std_swap_ranges_trivially_swappable>},
+        {"reverse_trivially_swappable_1", 1, reverse<1, __std_reverse_trivially_swappable_1>},
+        {"reverse_trivially_swappable_2", 2, reverse<2, __std_reverse_trivially_swappable_2>},
+        {"reverse_trivially_swappable_4", 4, reverse<4, __std_reverse_trivially_swappable_4>},
+        {"reverse_trivially_swappable_8", 8, reverse<8, __std_reverse_trivially_swappable_8>},
+        {"reverse_copy_trivially_copyable_1", 1, reverse_copy<1, __std_reverse_copy_trivially_copyable_1>},
+        {"reverse_copy_trivially_copyable_2", 2, reverse_copy<2, __std_reverse_copy_trivially_copyable_2>},
+        {"reverse_copy_trivially_copyable_4", 4, reverse_copy<4, __std_reverse_copy_trivially_copyable_4>},
+        {"reverse_copy_trivially_copyable_8", 8, reverse_copy<8, __std_reverse_copy_trivially_copyable_8>},
+    };
+} // unnamed namespace
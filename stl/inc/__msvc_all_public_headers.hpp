@@ -49,9 +49,16 @@
 #include <complex>
 #include <concepts>
 #include <coroutine>
+#include <dary_heap>
 #include <deque>
+#include <dynamic_bitset>
 #include <exception>
 #include <filesystem>
+#include <flat_map>
+#include <flat_set>
+#include <flat_unordered_map>
+#include <flat_unordered_set>
+#include <format>
 #include <forward_list>
 #include <fstream>
 #include <functional>
@@ -68,21 +75,28 @@
 #include <list>
 #include <locale>
 #include <map>
+#include <mdspan>
 #include <memory>
 #include <memory_resource>
 #include <new>
 #include <numbers>
 #include <numeric>
 #include <optional>
+#include <order_statistic_tree>
 #include <ostream>
+#include <persistent_vector>
+#include <pooled_allocator>
 #include <queue>
 #include <random>
 #include <ranges>
 #include <ratio>
 #include <regex>
+#include <ring_buffer>
 #include <scoped_allocator>
 #include <set>
+#include <small_vector>
 #include <span>
+#include <spanstream>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
@@ -105,15 +119,29 @@
 
 #ifndef _M_CEE_PURE
 #include <atomic>
+#include <barrier>
+#include <bounded_queue>
+#include <concurrent_unordered_map>
+#include <latch>
+#include <semaphore>
+#include <shared_string>
+#include <stop_token>
+#include <syncstream>
+#include <tsc_clock>
+#include <wall_clock>
 #endif // _M_CEE_PURE
 
 #ifndef _M_CEE
+#include <async_file>
 #include <condition_variable>
+#include <coroutine_task>
 #include <execution>
 #include <future>
 #include <mutex>
+#include <parallel_walk>
 #include <shared_mutex>
 #include <thread>
+#include <thread_pool>
 #endif // _M_CEE
 
 #include <cassert>
@@ -0,0 +1,42 @@
+// __msvc_utf_transcode_abi.hpp internal header (core)
+
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#pragma once
+#ifndef __MSVC_UTF_TRANSCODE_ABI_HPP
+#define __MSVC_UTF_TRANSCODE_ABI_HPP
+#include <yvals_core.h>
+#if _STL_COMPILER_PREPROCESSOR
+#include <stddef.h>
+
+#pragma pack(push, _CRT_PACKING)
+#pragma warning(push, _STL_WARNING_LEVEL)
+#pragma warning(disable : _STL_DISABLED_WARNINGS)
+_STL_DISABLE_CLANG_WARNINGS
+#pragma push_macro("new")
+#undef new
+
+_EXTERN_C
+struct __std_utf_transcode_result {
+    size_t _Read; // code units consumed
+    size_t _Written; // code units produced, or that would have been produced when measuring
+};
+
+// Each function converts the longest prefix of [_Src, _Src + _Src_size) that consists of complete, well-formed
+// sequences and whose conversion fits in _Dest_size code units, and stops at the first sequence that doesn't.
+// Well-formed excludes overlong UTF-8, encoded surrogates, values above U+10FFFF, and unpaired UTF-16 surrogates.
+// A null _Dest measures the conversion of the well-formed prefix instead; _Dest_size is then ignored.
+_NODISCARD __std_utf_transcode_result __stdcall __std_utf8_to_utf16(
+    const char* _Src, size_t _Src_size, char16_t* _Dest, size_t _Dest_size) noexcept;
+_NODISCARD __std_utf_transcode_result __stdcall __std_utf16_to_utf8(
+    const char16_t* _Src, size_t _Src_size, char* _Dest, size_t _Dest_size) noexcept;
+_END_EXTERN_C
+
+#pragma pop_macro("new")
+_STL_RESTORE_CLANG_WARNINGS
+#pragma warning(pop)
+#pragma pack(pop)
+
+#endif // _STL_COMPILER_PREPROCESSOR
+#endif // __MSVC_UTF_TRANSCODE_ABI_HPP
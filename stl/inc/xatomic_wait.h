@@ -62,6 +62,15 @@ void __stdcall __std_atomic_notify_all_indirect(const void* _Storage) noexcept;
 unsigned long long __stdcall __std_atomic_wait_get_deadline(unsigned long long _Timeout) noexcept;
 unsigned long __stdcall __std_atomic_wait_get_remaining_timeout(unsigned long long _Deadline) noexcept;
 
+// These functions lock and unlock the mutex that guards the atomic free functions for the shared_ptr at _Storage; it is
+// chosen by address from a padded table, so that operations on unrelated shared_ptrs don't contend.
+void __stdcall __std_atomic_shared_ptr_lock(const void* _Storage) noexcept;
+void __stdcall __std_atomic_shared_ptr_unlock(const void* _Storage) noexcept;
+
+// Returns the SRWLOCK, as an _Smtx_t*, that guards non-lock-free atomic_ref operations on the object at _Key; it is
+// chosen by address from a padded table of its own, because it is taken inside __std_atomic_wait_indirect's callback.
+void* __stdcall __std_atomic_get_mutex(const void* _Key) noexcept;
+
 _END_EXTERN_C
 
 #pragma pop_macro("new")
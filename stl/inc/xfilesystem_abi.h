@@ -42,6 +42,8 @@ enum class __std_win_error : unsigned long {
     _Already_exists            = 183, // #define ERROR_ALREADY_EXISTS             183L
     _Filename_exceeds_range    = 206, // #define ERROR_FILENAME_EXCED_RANGE       206L
     _Directory_name_is_invalid = 267, // #define ERROR_DIRECTORY                  267L
+    _Io_pending                = 997, // #define ERROR_IO_PENDING                 997L
+    _Request_aborted           = 1235, // #define ERROR_REQUEST_ABORTED            1235L
     _Max                       = ~0UL // sentinel not used by Win32
 };
 
@@ -229,6 +231,31 @@ enum class __std_fs_copy_options {
 
 _BITMASK_OPS(__std_fs_copy_options)
 
+enum class __std_fs_copy_file_flags {
+    _None                   = 0x0,
+    _Clone_blocks           = 0x1, // share clusters with the source where the file system can (ReFS)
+    _Unbuffered_large_files = 0x2, // bypass the system cache for large files
+};
+
+_BITMASK_OPS(__std_fs_copy_file_flags)
+
+// receives the bytes copied so far and the total; returning 0 cancels the copy and removes the target
+using __std_fs_copy_progress_callback = int(__stdcall*)(
+    unsigned long long _Copied, unsigned long long _Total, void* _Context);
+
+enum class __std_fs_call { // the entry points counted while __std_fs_call_counts_enable(true) is in effect
+    _Get_stats,
+    _Open_handle,
+    _Directory_iterator_open,
+    _Directory_iterator_advance,
+    _Get_file_id,
+    _Copy_file,
+    _Remove,
+    _Create_directory,
+    _Convert, // each of the narrow to wide and wide to narrow conversions
+    _Count
+};
+
 _EXTERN_C
 _NODISCARD __std_ulong_and_error __stdcall __std_fs_get_full_path_name(_In_z_ const wchar_t* _Source,
     _In_ unsigned long _Target_size, _Out_writes_z_(_Target_size) wchar_t* _Target) noexcept;
@@ -254,6 +281,10 @@ struct __std_fs_copy_file_result {
 _NODISCARD __std_fs_copy_file_result __stdcall __std_fs_copy_file(
     _In_z_ const wchar_t* _Source, _In_z_ const wchar_t* _Target, _In_ __std_fs_copy_options _Options) noexcept;
 
+_NODISCARD __std_fs_copy_file_result __stdcall __std_fs_copy_file_ex(_In_z_ const wchar_t* _Source,
+    _In_z_ const wchar_t* _Target, _In_ __std_fs_copy_options _Options, _In_ __std_fs_copy_file_flags _Flags,
+    _In_opt_ __std_fs_copy_progress_callback _Progress, _Inout_opt_ void* _Context) noexcept;
+
 _NODISCARD __std_win_error __stdcall __std_fs_directory_iterator_open(_In_z_ const wchar_t* _Path_spec,
     _Inout_ __std_fs_dir_handle* _Handle, _Out_ __std_fs_find_data* _Results) noexcept;
 
@@ -334,6 +365,11 @@ _NODISCARD __std_win_error __stdcall __std_fs_resize_file(_In_z_ const wchar_t*
 
 _NODISCARD __std_win_error __stdcall __std_fs_space(_In_z_ const wchar_t* _Target, _Out_ uintmax_t* _Available,
     _Out_ uintmax_t* _Total_bytes, _Out_ uintmax_t* _Free_bytes) noexcept;
+
+void __stdcall __std_fs_call_counts_enable(_In_ bool _Enable) noexcept;
+
+void __stdcall __std_fs_call_counts(
+    _Out_writes_(static_cast<int>(__std_fs_call::_Count)) unsigned long long* _Counts) noexcept;
 _END_EXTERN_C
 
 _STD_BEGIN
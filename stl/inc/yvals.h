@@ -164,6 +164,25 @@ _STL_DISABLE_CLANG_WARNINGS
 #error _ITERATOR_DEBUG_LEVEL != 0 must imply _CONTAINER_DEBUG_LEVEL == 1.
 #endif // _ITERATOR_DEBUG_LEVEL != 0 && _CONTAINER_DEBUG_LEVEL == 0
 
+// _ITERATOR_DEBUG_GENERATIONS == 1 adds invalidation checks to _ITERATOR_DEBUG_LEVEL == 1, which otherwise checks only
+// ranges and iterator compatibility. Each container counts the times it has invalidated all of its iterators (by
+// reallocating, clearing, or being assigned to), and each iterator remembers the count from when it was made. Using an
+// iterator whose count is stale is reported. Unlike _ITERATOR_DEBUG_LEVEL == 2, no lock is taken and no list of live
+// iterators is kept, so operations that invalidate only some iterators (like vector::erase) aren't checked, nor are
+// iterators into destroyed containers. The container proxy and the iterators keep a generation where they would link
+// iterators, so every translation unit must agree on the setting; otherwise, fresh iterators would be reported as stale
+// and stale ones would go unreported. The STL's own sources are exempt: at _ITERATOR_DEBUG_LEVEL == 1 they never touch
+// the iterator links, and they don't exchange iterators with their callers.
+#ifndef _ITERATOR_DEBUG_GENERATIONS
+#define _ITERATOR_DEBUG_GENERATIONS 0
+#elif _ITERATOR_DEBUG_GENERATIONS != 0 && _ITERATOR_DEBUG_LEVEL != 1
+#error _ITERATOR_DEBUG_GENERATIONS == 1 requires _ITERATOR_DEBUG_LEVEL == 1.
+#endif // _ITERATOR_DEBUG_GENERATIONS
+
+#if defined(__cplusplus) && !defined(_ALLOW_ITERATOR_DEBUG_GENERATIONS_MISMATCH) && !defined(_CRTBLD)
+#pragma detect_mismatch("_ITERATOR_DEBUG_GENERATIONS", _STRINGIZE(_ITERATOR_DEBUG_GENERATIONS))
+#endif // defined(__cplusplus) && !defined(_ALLOW_ITERATOR_DEBUG_GENERATIONS_MISMATCH) && !defined(_CRTBLD)
+
 #define _STL_REPORT_ERROR(mesg)              \
     do {                                     \
         _RPTF0(_CRT_ASSERT, mesg);           \
@@ -131,15 +131,24 @@
 // Other C++17 deprecation warnings
 
 // _HAS_CXX20 directly controls:
+// P0009R18 <mdspan>
+// P0019R8 atomic_ref
 // P0020R6 atomic<float>, atomic<double>, atomic<long double>
+// P0053R7 <syncstream>
 // P0122R7 <span>
 // P0202R3 constexpr For <algorithm> And exchange()
+// P0288R9 move_only_function
 // P0318R1 unwrap_reference, unwrap_ref_decay
 // P0325R4 to_array()
 // P0356R5 bind_front()
 // P0357R3 Supporting Incomplete Types In reference_wrapper
+// P0401R6 Providing Size Feedback In The Allocator Interface
+// P0408R7 Efficient Access To basic_stringbuf's Buffer
+//     (allocator-extended overloads not yet implemented)
 // P0415R1 constexpr For <complex> (Again)
+// P0429R9 <flat_map>
 // P0439R0 enum class memory_order
+// P0448R4 <spanstream>
 // P0457R2 starts_with()/ends_with() For basic_string/basic_string_view
 // P0458R2 contains() For Ordered And Unordered Associative Containers
 // P0463R1 endian
@@ -154,15 +163,19 @@
 // P0595R2 is_constant_evaluated()
 // P0616R0 Using move() In <numeric>
 // P0631R8 <numbers> Math Constants
+// P0645R10 <format> Text Formatting
+//     (partially implemented)
 // P0646R1 list/forward_list remove()/remove_if()/unique() Return size_type
 // P0653R2 to_address()
 // P0655R1 visit<R>()
+// P0660R10 <stop_token> And jthread
 // P0674R1 make_shared() For Arrays
 // P0718R2 atomic<shared_ptr<T>>, atomic<weak_ptr<T>>
 // P0758R1 is_nothrow_convertible
 // P0768R1 Library Support For The Spaceship Comparison Operator <=>
 //     (partially implemented)
 // P0769R2 shift_left(), shift_right()
+// P0784R7 Library Support For More constexpr Containers
 // P0811R3 midpoint(), lerp()
 // P0879R0 constexpr For Swapping Functions
 // P0887R1 type_identity
@@ -173,18 +186,24 @@
 //     (partially implemented, missing noop coroutines)
 // P0919R3 Heterogeneous Lookup For Unordered Containers
 // P0966R1 string::reserve() Should Not Shrink
+// P0980R1 constexpr std::string
 // P1001R2 execution::unseq
+// P1004R2 constexpr std::vector
 // P1006R1 constexpr For pointer_traits<T*>::pointer_to()
+// P1020R1 Smart Pointer Creation With Default Initialization
 // P1023R0 constexpr For std::array Comparisons
 // P1024R3 Enhancing span Usability
 // P1032R1 Miscellaneous constexpr
 // P1065R2 constexpr INVOKE
 //     (except the std::invoke function which is implemented in C++17)
+// P1072R10 basic_string::resize_and_overwrite()
 // P1085R2 Removing span Comparisons
 // P1115R3 erase()/erase_if() Return size_type
+// P1135R6 The C++20 Synchronization Library
 // P1207R4 Movability Of Single-Pass Iterators
 //     (partially implemented)
 // P1209R0 erase_if(), erase()
+// P1222R4 <flat_set>
 // P1227R2 Signed std::ssize(), Unsigned span::size()
 // P1243R4 Rangify New Algorithms
 //     (partially implemented)
@@ -200,6 +219,7 @@
 // P1690R1 Refining Heterogeneous Lookup For Unordered Containers
 // P1716R3 Range Comparison Algorithms Are Over-Constrained
 // P1754R1 Rename Concepts To standard_case
+// P1869R1 Renaming condition_variable_any Interruptible Wait Methods
 // P1870R1 Rename forwarding-range To borrowed_range (Was safe_range before LWG-3379)
 // P1871R1 disable_sized_sentinel_for
 // P1872R0 span Should Have size_type, Not index_type
@@ -212,6 +232,7 @@
 // P2091R0 Fixing Issues With Range Access CPOs
 // P2102R0 Making "Implicit Expression Variations" More Explicit
 // P2116R0 Removing tuple-Like Protocol Support From Fixed-Extent span
+// P2630R4 submdspan()
 // P????R? directory_entry::clear_cache()
 
 // _HAS_CXX20 indirectly controls:
@@ -533,6 +554,13 @@
 #define _CONSTEXPR20 inline
 #endif // ^^^ inline (not constexpr) in C++17 and earlier ^^^
 
+// Functions that became constexpr in C++20 via P0784R7, which need the compiler to support constexpr allocation
+#if _HAS_CXX20 && defined(__cpp_constexpr_dynamic_alloc)
+#define _CONSTEXPR20_CONTAINER constexpr
+#else // ^^^ constexpr with constexpr allocation / inline (not constexpr) without it vvv
+#define _CONSTEXPR20_CONTAINER inline
+#endif // ^^^ inline (not constexpr) without constexpr allocation ^^^
+
 // P0607R0 Inline Variables For The STL
 #if _HAS_CXX17
 #define _INLINE_VAR inline
@@ -617,6 +645,45 @@
 #define _STL_OPTIMIZE_SYSTEM_ERROR_OPERATORS 1
 #endif // _STL_OPTIMIZE_SYSTEM_ERROR_OPERATORS
 
+// Controls whether hash<basic_string>, hash<basic_string_view>, and hash<filesystem::path> use a multiply-fold hash
+// that consumes 16 bytes per step instead of FNV-1a. This changes hash values, so all translation units must agree on
+// it. The STL's own sources never hash strings for their callers.
+#ifndef _STL_WIDE_STRING_HASH
+#define _STL_WIDE_STRING_HASH 0
+#endif // _STL_WIDE_STRING_HASH
+
+#if !defined(_ALLOW_WIDE_STRING_HASH_MISMATCH) && !defined(_CRTBLD)
+#if _STL_WIDE_STRING_HASH
+#pragma detect_mismatch("_STL_WIDE_STRING_HASH", "1")
+#else // ^^^ _STL_WIDE_STRING_HASH / !_STL_WIDE_STRING_HASH vvv
+#pragma detect_mismatch("_STL_WIDE_STRING_HASH", "0")
+#endif // _STL_WIDE_STRING_HASH
+#endif // !defined(_ALLOW_WIDE_STRING_HASH_MISMATCH) && !defined(_CRTBLD)
+
+// Controls whether hash of integral, enumeration, and pointer types mixes the key's bits with a multiply-xorshift
+// finalizer instead of running FNV-1a over its bytes. This changes hash values, so all translation units must agree on
+// it. The STL's own sources never hash keys for their callers.
+#ifndef _STL_FAST_INTEGER_HASH
+#define _STL_FAST_INTEGER_HASH 0
+#endif // _STL_FAST_INTEGER_HASH
+
+#if !defined(_ALLOW_FAST_INTEGER_HASH_MISMATCH) && !defined(_CRTBLD)
+#if _STL_FAST_INTEGER_HASH
+#pragma detect_mismatch("_STL_FAST_INTEGER_HASH", "1")
+#else // ^^^ _STL_FAST_INTEGER_HASH / !_STL_FAST_INTEGER_HASH vvv
+#pragma detect_mismatch("_STL_FAST_INTEGER_HASH", "0")
+#endif // _STL_FAST_INTEGER_HASH
+#endif // !defined(_ALLOW_FAST_INTEGER_HASH_MISMATCH) && !defined(_CRTBLD)
+
+// Controls whether std::allocator and the heap storage of function and move_only_function report their allocations and
+// deallocations to the hook installed with stdext::set_allocation_hook. Translation units may differ; each one reports
+// the allocations of the code it compiles.
+#ifndef _STL_ALLOCATION_TRACKING
+#define _STL_ALLOCATION_TRACKING 0
+#elif _STL_ALLOCATION_TRACKING != 0 && defined(_M_CEE)
+#error _STL_ALLOCATION_TRACKING is not supported under /clr.
+#endif // _STL_ALLOCATION_TRACKING
+
 #if _HAS_IF_CONSTEXPR
 #define _CONSTEXPR_IF constexpr
 #else // _HAS_IF_CONSTEXPR
@@ -1134,11 +1201,14 @@
 #define __cpp_lib_atomic_value_initialization 201911L
 
 #if _HAS_CXX20
+#define __cpp_lib_allocate_at_least             202106L
 #define __cpp_lib_atomic_flag_test              201907L
 #define __cpp_lib_atomic_float                  201711L
 #define __cpp_lib_atomic_lock_free_type_aliases 201907L
+#define __cpp_lib_atomic_ref                    201806L
 #define __cpp_lib_atomic_shared_ptr             201711L
 #define __cpp_lib_atomic_wait                   201907L
+#define __cpp_lib_barrier                       201907L
 #define __cpp_lib_bind_front                    201907L
 #define __cpp_lib_bit_cast                      201806L
 #define __cpp_lib_bitops                        201907L
@@ -1154,14 +1224,28 @@
 
 #define __cpp_lib_constexpr_algorithms  201806L
 #define __cpp_lib_constexpr_complex     201711L
-#define __cpp_lib_constexpr_functional  201907L
-#define __cpp_lib_constexpr_iterator    201811L
-#define __cpp_lib_constexpr_memory      201811L
-#define __cpp_lib_constexpr_numeric     201911L
+
+#ifdef __cpp_constexpr_dynamic_alloc
+#define __cpp_lib_constexpr_dynamic_alloc 201907L
+#endif // __cpp_constexpr_dynamic_alloc
+
+#define __cpp_lib_constexpr_functional 201907L
+#define __cpp_lib_constexpr_iterator   201811L
+#define __cpp_lib_constexpr_memory     201811L
+#define __cpp_lib_constexpr_numeric    201911L
+
+#ifdef __cpp_constexpr_dynamic_alloc
+#define __cpp_lib_constexpr_string 201907L
+#endif // __cpp_constexpr_dynamic_alloc
+
 #define __cpp_lib_constexpr_string_view 201811L
 #define __cpp_lib_constexpr_tuple       201811L
 #define __cpp_lib_constexpr_utility     201811L
 
+#ifdef __cpp_constexpr_dynamic_alloc
+#define __cpp_lib_constexpr_vector 201907L
+#endif // __cpp_constexpr_dynamic_alloc
+
 #ifdef __cpp_impl_coroutine // TRANSITION, VS 2019 16.8 Preview 1
 #define __cpp_lib_coroutine 197000L
 #endif // __cpp_impl_coroutine
@@ -1169,23 +1253,43 @@
 #define __cpp_lib_destroying_delete            201806L
 #define __cpp_lib_endian                       201907L
 #define __cpp_lib_erase_if                     202002L
+#define __cpp_lib_flat_map                     202207L
+#define __cpp_lib_flat_set                     202207L
 #define __cpp_lib_generic_unordered_lookup     201811L
 #define __cpp_lib_int_pow2                     202002L
 #define __cpp_lib_integer_comparison_functions 202002L
 #define __cpp_lib_interpolate                  201902L
 #define __cpp_lib_is_constant_evaluated        201811L
 #define __cpp_lib_is_nothrow_convertible       201806L
+#define __cpp_lib_jthread                      201911L
+#define __cpp_lib_latch                        201907L
 #define __cpp_lib_list_remove_return_type      201806L
 #define __cpp_lib_math_constants               201907L
-#define __cpp_lib_remove_cvref                 201711L
-#define __cpp_lib_shift                        201806L
-#define __cpp_lib_span                         202002L
-#define __cpp_lib_ssize                        201902L
-#define __cpp_lib_starts_ends_with             201711L
-#define __cpp_lib_to_address                   201711L
-#define __cpp_lib_to_array                     201907L
-#define __cpp_lib_type_identity                201806L
-#define __cpp_lib_unwrap_ref                   201811L
+
+#ifdef __cpp_lib_concepts
+#define __cpp_lib_mdspan 202207L
+#endif // __cpp_lib_concepts
+
+#define __cpp_lib_move_only_function          202110L
+#define __cpp_lib_remove_cvref                201711L
+#define __cpp_lib_semaphore                   201907L
+#define __cpp_lib_shift                       201806L
+#define __cpp_lib_smart_ptr_for_overwrite     202002L
+#define __cpp_lib_span                        202002L
+#define __cpp_lib_spanstream                  202106L
+#define __cpp_lib_ssize                       201902L
+#define __cpp_lib_starts_ends_with            201711L
+#define __cpp_lib_string_resize_and_overwrite 202110L
+
+#ifdef __cpp_lib_concepts
+#define __cpp_lib_submdspan 202306L
+#endif // __cpp_lib_concepts
+
+#define __cpp_lib_syncbuf       201711L
+#define __cpp_lib_to_address    201711L
+#define __cpp_lib_to_array      201907L
+#define __cpp_lib_type_identity 201806L
+#define __cpp_lib_unwrap_ref    201811L
 #endif // _HAS_CXX20
 
 #ifndef _M_CEE
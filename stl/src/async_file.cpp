@@ -0,0 +1,163 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// support for stdext::async_file in <async_file>
+
+#include <cstddef>
+#include <cstdlib>
+#include <internal_shared.h>
+#include <xfilesystem_abi.h>
+
+struct __std_async_file { // an overlapped file handle and the thread pool I/O object that completes its requests
+    HANDLE _Handle;
+    PTP_IO _Io;
+    bool _Skip_completion_on_success;
+};
+
+struct __std_async_file_request; // must match <async_file>
+
+using __std_async_file_completion = void(__stdcall*)(__std_async_file_request*) noexcept;
+
+struct __std_async_file_request {
+    OVERLAPPED _Overlapped;
+    __std_async_file_completion _Completion;
+    __std_win_error _Error;
+    unsigned long _Transferred;
+};
+
+static_assert(offsetof(__std_async_file_request, _Completion) == sizeof(OVERLAPPED),
+    "the request in <async_file> begins with the members of an OVERLAPPED");
+
+enum class __std_async_file_mode : unsigned long { _Read, _Read_write, _Truncate };
+
+extern "C" _NODISCARD PTP_IO __stdcall __std_create_threadpool_io(
+    HANDLE _Handle, PTP_WIN32_IO_CALLBACK _Callback, void* _Context, PTP_CALLBACK_ENVIRON _Callback_environ) noexcept;
+
+namespace {
+    _NODISCARD __std_win_error _Finish_request(
+        __std_async_file_request* const _Request, const unsigned long _Error, const ULONG_PTR _Transferred) noexcept {
+        // reading at or past the end of the file isn't an error; it just transfers nothing
+        if (_Error == ERROR_HANDLE_EOF) {
+            _Request->_Error       = __std_win_error::_Success;
+            _Request->_Transferred = 0;
+        } else {
+            _Request->_Error       = __std_win_error{_Error};
+            _Request->_Transferred = static_cast<unsigned long>(_Transferred);
+        }
+
+        return _Request->_Error;
+    }
+
+    void __stdcall _Io_callback(PTP_CALLBACK_INSTANCE, void*, void* const _Overlapped, const ULONG _Io_result,
+        const ULONG_PTR _Transferred, PTP_IO) noexcept {
+        const auto _Request = static_cast<__std_async_file_request*>(_Overlapped);
+        (void) _Finish_request(_Request, _Io_result, _Transferred);
+        _Request->_Completion(_Request);
+    }
+
+    _NODISCARD __std_win_error _Start_request(__std_async_file* const _File, __std_async_file_request* const _Request,
+        const BOOL _Finished) noexcept {
+        // _Finished is the result of ReadFile or WriteFile; a request that won't reach _Io_callback is finished here
+        if (_Finished) {
+            if (!_File->_Skip_completion_on_success) {
+                return __std_win_error::_Io_pending; // the completion is queued to the thread pool anyway
+            }
+
+            CancelThreadpoolIo(_File->_Io);
+            DWORD _Transferred = 0;
+            if (!GetOverlappedResult(_File->_Handle, &_Request->_Overlapped, &_Transferred, FALSE)) {
+                return _Finish_request(_Request, GetLastError(), 0);
+            }
+
+            return _Finish_request(_Request, ERROR_SUCCESS, _Transferred);
+        }
+
+        const DWORD _Error = GetLastError();
+        if (_Error == ERROR_IO_PENDING) {
+            return __std_win_error::_Io_pending;
+        }
+
+        CancelThreadpoolIo(_File->_Io);
+        return _Finish_request(_Request, _Error, 0);
+    }
+} // unnamed namespace
+
+extern "C" {
+
+_NODISCARD __std_win_error __stdcall __std_async_file_open(__std_async_file** const _File,
+    const wchar_t* const _Filename, const __std_async_file_mode _Mode) noexcept {
+    *_File = nullptr;
+
+    DWORD _Access      = GENERIC_READ | GENERIC_WRITE;
+    DWORD _Disposition = OPEN_ALWAYS;
+    if (_Mode == __std_async_file_mode::_Read) {
+        _Access      = GENERIC_READ;
+        _Disposition = OPEN_EXISTING;
+    } else if (_Mode == __std_async_file_mode::_Truncate) {
+        _Disposition = CREATE_ALWAYS;
+    }
+
+    const auto _Result = static_cast<__std_async_file*>(_CSTD malloc(sizeof(__std_async_file)));
+    if (!_Result) {
+        return __std_win_error::_Not_enough_memory;
+    }
+
+    // other handles to the file may keep reading and writing it, as with __std_fs_open_handle
+    _Result->_Handle = CreateFileW(_Filename, _Access, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+        nullptr, _Disposition, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED, nullptr);
+    if (_Result->_Handle == INVALID_HANDLE_VALUE) {
+        const auto _Error = __std_win_error{GetLastError()};
+        _CSTD free(_Result);
+        return _Error;
+    }
+
+    // requests satisfied from the cache finish in ReadFile or WriteFile, without a trip through the thread pool
+    _Result->_Skip_completion_on_success = SetFileCompletionNotificationModes(
+        _Result->_Handle, FILE_SKIP_COMPLETION_PORT_ON_SUCCESS | FILE_SKIP_SET_EVENT_ON_HANDLE) != FALSE;
+
+    _Result->_Io = __std_create_threadpool_io(_Result->_Handle, &_Io_callback, nullptr, nullptr);
+    if (!_Result->_Io) {
+        const auto _Error = __std_win_error{GetLastError()};
+        CloseHandle(_Result->_Handle);
+        _CSTD free(_Result);
+        return _Error;
+    }
+
+    *_File = _Result;
+    return __std_win_error::_Success;
+}
+
+void __stdcall __std_async_file_close(__std_async_file* const _File) noexcept {
+    // no requests may be outstanding; this may run in _Io_callback, so it doesn't wait for the thread pool, which
+    // frees the I/O object once the callback returns
+    CloseHandle(_File->_Handle);
+    CloseThreadpoolIo(_File->_Io);
+    _CSTD free(_File);
+}
+
+_NODISCARD __std_win_error __stdcall __std_async_file_size(
+    __std_async_file* const _File, unsigned long long* const _Size) noexcept {
+    LARGE_INTEGER _File_size;
+    if (!GetFileSizeEx(_File->_Handle, &_File_size)) {
+        return __std_win_error{GetLastError()};
+    }
+
+    *_Size = static_cast<unsigned long long>(_File_size.QuadPart);
+    return __std_win_error::_Success;
+}
+
+// _Request's offset and _Completion are set by the caller; returns _Io_pending if _Completion will be called on the
+// thread pool, otherwise the request is finished and its result stored in _Request
+_NODISCARD __std_win_error __stdcall __std_async_file_read(__std_async_file* const _File,
+    __std_async_file_request* const _Request, void* const _Buffer, const unsigned long _Size) noexcept {
+    StartThreadpoolIo(_File->_Io);
+    return _Start_request(_File, _Request, ReadFile(_File->_Handle, _Buffer, _Size, nullptr, &_Request->_Overlapped));
+}
+
+_NODISCARD __std_win_error __stdcall __std_async_file_write(__std_async_file* const _File,
+    __std_async_file_request* const _Request, const void* const _Buffer, const unsigned long _Size) noexcept {
+    StartThreadpoolIo(_File->_Io);
+    return _Start_request(
+        _File, _Request, WriteFile(_File->_Handle, _Buffer, _Size, nullptr, &_Request->_Overlapped));
+}
+} // extern "C"
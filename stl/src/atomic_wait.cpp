@@ -11,13 +11,18 @@
 #include <thread>
 #include <Windows.h>
 
+#include "sync_stats.hpp"
 // clang-format on
 
 namespace {
 
-    constexpr size_t _Wait_table_size_power = 8;
-    constexpr size_t _Wait_table_size       = 1 << _Wait_table_size_power;
-    constexpr size_t _Wait_table_index_mask = _Wait_table_size - 1;
+    // the table has at least 256 entries, and 16 per hardware thread up to 16384 entries
+    constexpr size_t _Wait_table_min_size_power           = 8;
+    constexpr size_t _Wait_table_max_size_power           = 14;
+    constexpr size_t _Wait_table_entries_per_thread_power = 4;
+
+    // before parking, an indirect wait rechecks the value this many times, pausing twice as long after each check
+    constexpr int _Wait_spin_rounds = 7;
 
     struct _Wait_context {
         const void* _Storage; // Pointer to wait on
@@ -44,21 +49,23 @@ namespace {
         _Guarded_wait_context& operator=(const _Guarded_wait_context&) = delete;
     };
 
-    class _SrwLock_guard {
+    class _Waiter_count_guard {
     public:
-        explicit _SrwLock_guard(SRWLOCK& _Locked_) noexcept : _Locked(&_Locked_) {
-            AcquireSRWLockExclusive(_Locked);
+        explicit _Waiter_count_guard(_STD atomic<size_t>& _Waiters_) noexcept : _Waiters(_Waiters_) {
+            _Waiters.fetch_add(1, _STD memory_order_relaxed);
+            // pairs with the fence in _Has_waiters; the caller rechecks the value after this
+            _STD atomic_thread_fence(_STD memory_order_seq_cst);
         }
 
-        ~_SrwLock_guard() {
-            ReleaseSRWLockExclusive(_Locked);
+        ~_Waiter_count_guard() {
+            _Waiters.fetch_sub(1, _STD memory_order_relaxed);
         }
 
-        _SrwLock_guard(const _SrwLock_guard&) = delete;
-        _SrwLock_guard& operator=(const _SrwLock_guard&) = delete;
+        _Waiter_count_guard(const _Waiter_count_guard&) = delete;
+        _Waiter_count_guard& operator=(const _Waiter_count_guard&) = delete;
 
     private:
-        SRWLOCK* _Locked;
+        _STD atomic<size_t>& _Waiters;
     };
 
 
@@ -67,17 +74,115 @@ namespace {
     struct alignas(_STD hardware_destructive_interference_size) _Wait_table_entry {
         SRWLOCK _Lock                 = SRWLOCK_INIT;
         _Wait_context _Wait_list_head = {nullptr, &_Wait_list_head, &_Wait_list_head, CONDITION_VARIABLE_INIT};
+        // threads in __std_atomic_wait_indirect on any address of this entry; changed under _Lock, but read without
+        // it so that notifying an address nobody waits on stays cheap
+        _STD atomic<size_t> _Waiters{0};
 
         constexpr _Wait_table_entry() noexcept = default;
     };
 #pragma warning(pop)
 
+    struct _Wait_table {
+        _Wait_table_entry* _Entries;
+        size_t _Size_power;
+        bool _Spin; // spinning before parking can only help with another hardware thread to change the value
+    };
+
+    [[nodiscard]] _Wait_table _Make_wait_table() noexcept {
+        static _Wait_table_entry _Min_table[size_t{1} << _Wait_table_min_size_power];
+        const unsigned int _Hw_threads = _STD thread::hardware_concurrency();
+        size_t _Size_power             = _Wait_table_min_size_power;
+        while (_Size_power < _Wait_table_max_size_power
+               && (size_t{1} << (_Size_power - _Wait_table_entries_per_thread_power)) < _Hw_threads) {
+            ++_Size_power;
+        }
+
+        if (_Size_power != _Wait_table_min_size_power) {
+            // never freed, as waits and notifies may happen until the process ends
+            const auto _Entries = new (_STD nothrow) _Wait_table_entry[size_t{1} << _Size_power];
+            if (_Entries) {
+                return {_Entries, _Size_power, true};
+            }
+        }
+
+        return {_Min_table, _Wait_table_min_size_power, _Hw_threads > 1};
+    }
+
+    [[nodiscard]] const _Wait_table& _Get_wait_table() noexcept {
+        static const _Wait_table _Table = _Make_wait_table();
+        return _Table;
+    }
+
     [[nodiscard]] _Wait_table_entry& _Atomic_wait_table_entry(const void* const _Storage) noexcept {
-        static _Wait_table_entry wait_table[_Wait_table_size];
-        auto index = reinterpret_cast<_STD uintptr_t>(_Storage);
-        index ^= index >> (_Wait_table_size_power * 2);
-        index ^= index >> _Wait_table_size_power;
-        return wait_table[index & _Wait_table_index_mask];
+        const auto& _Table = _Get_wait_table();
+        auto index         = reinterpret_cast<_STD uintptr_t>(_Storage);
+        index ^= index >> (_Table._Size_power * 2);
+        index ^= index >> _Table._Size_power;
+        return _Table._Entries[index & ((size_t{1} << _Table._Size_power) - 1)];
+    }
+
+    // one _Lock_counters per wait table entry, allocated by the first __std_atomic_wait_stats_enable(true) and never
+    // freed; _Wait_table_counting points to them while stdext::sync_stats are enabled
+    _STD atomic<_Lock_counters*> _Wait_table_counters{nullptr};
+    _STD atomic<_Lock_counters*> _Wait_table_counting{nullptr};
+
+    void _Acquire_entry(_Wait_table_entry& _Entry) noexcept {
+        const auto _Counters = _Wait_table_counting.load(_STD memory_order_acquire);
+        if (!_Counters) {
+            AcquireSRWLockExclusive(&_Entry._Lock);
+            return;
+        }
+
+        auto& _Entry_counters = _Counters[&_Entry - _Get_wait_table()._Entries];
+#if _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7
+        if (TryAcquireSRWLockExclusive(&_Entry._Lock)) {
+            _Entry_counters._Record(0);
+        } else {
+            const long long _Wait_start = _Sync_stats_now();
+            AcquireSRWLockExclusive(&_Entry._Lock);
+            _Entry_counters._Record(_Wait_start);
+        }
+#else // ^^^ _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7 ^^^ // vvv _STL_WIN32_WINNT < _WIN32_WINNT_WIN7 vvv
+        const long long _Start = _Sync_stats_now();
+        AcquireSRWLockExclusive(&_Entry._Lock);
+        _Entry_counters._Record_timed(_Start);
+#endif // _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7
+    }
+
+    class _SrwLock_guard {
+    public:
+        explicit _SrwLock_guard(_Wait_table_entry& _Entry) noexcept : _Locked(&_Entry._Lock) {
+            _Acquire_entry(_Entry);
+        }
+
+        ~_SrwLock_guard() {
+            ReleaseSRWLockExclusive(_Locked);
+        }
+
+        _SrwLock_guard(const _SrwLock_guard&) = delete;
+        _SrwLock_guard& operator=(const _SrwLock_guard&) = delete;
+
+    private:
+        SRWLOCK* _Locked;
+    };
+
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure was padded due to alignment specifier
+    struct alignas(_STD hardware_destructive_interference_size) _Mutex_table_entry {
+        SRWLOCK _Lock = SRWLOCK_INIT;
+
+        constexpr _Mutex_table_entry() noexcept = default;
+    };
+#pragma warning(pop)
+
+    constexpr size_t _Mutex_table_size_power = 8;
+    _Mutex_table_entry _Mutex_table[size_t{1} << _Mutex_table_size_power];
+
+    [[nodiscard]] bool _Has_waiters(const _Wait_table_entry& _Entry) noexcept {
+        // pairs with the fence in __std_atomic_wait_indirect: either the waiter sees the notifier's new value, or
+        // the notifier sees the waiter's count
+        _STD atomic_thread_fence(_STD memory_order_seq_cst);
+        return _Entry._Waiters.load(_STD memory_order_relaxed) != 0;
     }
 
     void _Assume_timeout() noexcept {
@@ -236,7 +341,11 @@ void __stdcall __std_atomic_notify_all_direct(const void* const _Storage) noexce
 
 void __stdcall __std_atomic_notify_one_indirect(const void* const _Storage) noexcept {
     auto& _Entry = _Atomic_wait_table_entry(_Storage);
-    _SrwLock_guard _Guard(_Entry._Lock);
+    if (!_Has_waiters(_Entry)) {
+        return;
+    }
+
+    _SrwLock_guard _Guard(_Entry);
     _Wait_context* _Context = _Entry._Wait_list_head._Next;
     for (; _Context != &_Entry._Wait_list_head; _Context = _Context->_Next) {
         if (_Context->_Storage == _Storage) {
@@ -249,7 +358,11 @@ void __stdcall __std_atomic_notify_one_indirect(const void* const _Storage) noex
 
 void __stdcall __std_atomic_notify_all_indirect(const void* const _Storage) noexcept {
     auto& _Entry = _Atomic_wait_table_entry(_Storage);
-    _SrwLock_guard _Guard(_Entry._Lock);
+    if (!_Has_waiters(_Entry)) {
+        return;
+    }
+
+    _SrwLock_guard _Guard(_Entry);
     _Wait_context* _Context = _Entry._Wait_list_head._Next;
     for (; _Context != &_Entry._Wait_list_head; _Context = _Context->_Next) {
         if (_Context->_Storage == _Storage) {
@@ -261,10 +374,25 @@ void __stdcall __std_atomic_notify_all_indirect(const void* const _Storage) noex
 
 int __stdcall __std_atomic_wait_indirect(const void* _Storage, void* _Comparand, size_t _Size, void* _Param,
     _Atomic_wait_indirect_equal_callback_t _Are_equal, unsigned long _Remaining_timeout) noexcept {
+    if (_Remaining_timeout != 0 && _Get_wait_table()._Spin) {
+        // a notify that comes soon after the wait starts is seen without parking; callers recheck their value, so
+        // returning early is a spurious wake
+        for (int _Round = 0; _Round < _Wait_spin_rounds; ++_Round) {
+            for (int _Pause = 0; _Pause < 1 << _Round; ++_Pause) {
+                YieldProcessor();
+            }
+
+            if (!_Are_equal(_Storage, _Comparand, _Size, _Param)) {
+                return TRUE;
+            }
+        }
+    }
+
     auto& _Entry = _Atomic_wait_table_entry(_Storage);
 
-    _SrwLock_guard _Guard(_Entry._Lock);
+    _SrwLock_guard _Guard(_Entry);
     _Guarded_wait_context _Context{_Storage, &_Entry._Wait_list_head};
+    _Waiter_count_guard _Count{_Entry._Waiters};
     for (;;) {
         if (!_Are_equal(_Storage, _Comparand, _Size, _Param)) { // note: under lock to prevent lost wakes
             return TRUE;
@@ -331,4 +459,73 @@ __std_atomic_api_level __stdcall __std_atomic_set_api_level(__std_atomic_api_lev
     return _Acquire_wait_functions();
 #endif // !_ATOMIC_WAIT_ON_ADDRESS_STATICALLY_AVAILABLE
 }
+
+void __stdcall __std_atomic_shared_ptr_lock(const void* const _Storage) noexcept {
+    // shares the wait table's striped locks; callers never wait or notify while they hold one
+    _Acquire_entry(_Atomic_wait_table_entry(_Storage));
+}
+
+void __stdcall __std_atomic_shared_ptr_unlock(const void* const _Storage) noexcept {
+    ReleaseSRWLockExclusive(&_Atomic_wait_table_entry(_Storage)._Lock);
+}
+
+void* __stdcall __std_atomic_get_mutex(const void* const _Key) noexcept {
+    auto index = reinterpret_cast<_STD uintptr_t>(_Key);
+    index ^= index >> (_Mutex_table_size_power * 2);
+    index ^= index >> _Mutex_table_size_power;
+    return &_Mutex_table[index & ((size_t{1} << _Mutex_table_size_power) - 1)]._Lock;
+}
+
+void __stdcall __std_atomic_wait_stats_enable(const bool _Enable) noexcept {
+    if (!_Enable) { // keep the counts for reading
+        _Wait_table_counting.store(nullptr, _STD memory_order_relaxed);
+        return;
+    }
+
+    const size_t _Size = size_t{1} << _Get_wait_table()._Size_power;
+    auto _Counters     = _Wait_table_counters.load(_STD memory_order_acquire);
+    if (_Counters) { // start over
+        for (size_t _Idx = 0; _Idx < _Size; ++_Idx) {
+            _Counters[_Idx]._Reset();
+        }
+    } else {
+        const auto _New_counters = new (_STD nothrow) _Lock_counters[_Size];
+        if (!_New_counters) { // the wait table's locks go uncounted
+            return;
+        }
+
+        if (_Wait_table_counters.compare_exchange_strong(_Counters, _New_counters, _STD memory_order_acq_rel)) {
+            _Counters = _New_counters;
+        } else { // another thread enabled them first
+            delete[] _New_counters;
+        }
+    }
+
+    _Wait_table_counting.store(_Counters, _STD memory_order_release);
+}
+
+size_t __stdcall __std_atomic_wait_stats(
+    stdext::lock_statistics* const _Buckets, const size_t _Count, stdext::lock_statistics* const _Total) noexcept {
+    // returns how many buckets the wait table has
+    const size_t _Size   = size_t{1} << _Get_wait_table()._Size_power;
+    const auto _Counters = _Wait_table_counters.load(_STD memory_order_acquire);
+    if (_Total) {
+        *_Total = {};
+    }
+
+    for (size_t _Idx = 0; _Idx < _Size; ++_Idx) {
+        const auto _Stats = _Counters ? _Counters[_Idx]._Read() : stdext::lock_statistics{};
+        if (_Idx < _Count) {
+            _Buckets[_Idx] = _Stats;
+        }
+
+        if (_Total) {
+            _Total->acquisitions += _Stats.acquisitions;
+            _Total->contended += _Stats.contended;
+            _Total->wait_nanoseconds += _Stats.wait_nanoseconds;
+        }
+    }
+
+    return _Size;
+}
 _END_EXTERN_C
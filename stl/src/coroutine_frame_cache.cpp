@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// support for <experimental/generator>
+
+#include <cstddef>
+#include <cstdlib>
+#include <internal_shared.h>
+
+namespace {
+    // frames are cached in size classes of this many bytes; larger frames go straight back to the heap
+    constexpr size_t _Frame_granularity      = 64;
+    constexpr size_t _Max_cached_frame_bytes = 4096;
+    constexpr size_t _Frame_classes          = _Max_cached_frame_bytes / _Frame_granularity;
+
+    // frames kept per size class, enough for a pipeline of nested generators
+    constexpr unsigned int _Max_cached_frames = 8;
+
+    struct _Free_frame {
+        _Free_frame* _Next;
+    };
+
+    struct _Frame_cache { // keeps the thread's recently freed coroutine frames for the next coroutine of the same size
+        _Free_frame* _Heads[_Frame_classes]  = {};
+        unsigned int _Counts[_Frame_classes] = {};
+
+        _Frame_cache() = default;
+        _Frame_cache(const _Frame_cache&) = delete;
+        _Frame_cache& operator=(const _Frame_cache&) = delete;
+
+        ~_Frame_cache() {
+            for (auto _Head : _Heads) {
+                while (_Head) {
+                    const auto _Next = _Head->_Next;
+                    _CSTD free(_Head);
+                    _Head = _Next;
+                }
+            }
+        }
+    };
+
+    thread_local _Frame_cache _Coroutine_thread_frames;
+
+    size_t _Frame_class(const size_t _Bytes) noexcept { // _Frame_classes for frames too large to cache
+        if (_Bytes == 0 || _Bytes > _Max_cached_frame_bytes) {
+            return _Frame_classes;
+        }
+
+        return (_Bytes - 1) / _Frame_granularity;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+_NODISCARD void* __stdcall __std_coroutine_frame_allocate(const size_t _Bytes) noexcept {
+    // returns nullptr on failure
+    const size_t _Class = _Frame_class(_Bytes);
+    if (_Class == _Frame_classes) {
+        return _CSTD malloc(_Bytes == 0 ? 1 : _Bytes);
+    }
+
+    auto& _Cache = _Coroutine_thread_frames;
+    if (const auto _Head = _Cache._Heads[_Class]) {
+        _Cache._Heads[_Class] = _Head->_Next;
+        --_Cache._Counts[_Class];
+        return _Head;
+    }
+
+    return _CSTD malloc((_Class + 1) * _Frame_granularity);
+}
+
+void __stdcall __std_coroutine_frame_deallocate(void* const _Ptr, const size_t _Bytes) noexcept {
+    // _Bytes must be the size passed to __std_coroutine_frame_allocate; the frame may have been allocated by another
+    // thread
+    if (!_Ptr) {
+        return;
+    }
+
+    const size_t _Class = _Frame_class(_Bytes);
+    auto& _Cache        = _Coroutine_thread_frames;
+    if (_Class == _Frame_classes || _Cache._Counts[_Class] == _Max_cached_frames) {
+        _CSTD free(_Ptr);
+        return;
+    }
+
+    const auto _Frame     = static_cast<_Free_frame*>(_Ptr);
+    _Frame->_Next         = _Cache._Heads[_Class];
+    _Cache._Heads[_Class] = _Frame;
+    ++_Cache._Counts[_Class];
+}
+} // extern "C"
@@ -0,0 +1,140 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// bounded process-wide cache of system_category() messages for <system_error>
+
+// clang-format off
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <internal_shared.h>
+#include <Windows.h>
+// clang-format on
+
+namespace {
+    struct _Message_node { // an immutable cached message; its characters follow the node
+        int _Value;
+        LANGID _Language;
+        size_t _Length;
+
+        _NODISCARD const char* _Text() const noexcept {
+            return reinterpret_cast<const char*>(this + 1);
+        }
+    };
+
+    // an open addressing table that is never more than 3/4 full, so probing always ends at an empty slot; messages
+    // longer than _Max_message_length are left to the caller, which bounds the cache's memory
+    constexpr size_t _Slot_count         = 1024;
+    constexpr size_t _Max_entries        = _Slot_count / 4 * 3;
+    constexpr size_t _Max_message_length = 1024;
+
+    class _Message_cache {
+    public:
+        _Message_cache() = default;
+
+        _Message_cache(const _Message_cache&)            = delete;
+        _Message_cache& operator=(const _Message_cache&) = delete;
+
+        ~_Message_cache() {
+            // runs when the satellite DLL is unloaded, or at exit in the static libraries; afterwards, lookups miss
+            // and insertions fail, so system_category().message() formats every message again
+            _Entries.store(_Max_entries, _STD memory_order_relaxed);
+            for (auto& _Slot : _Slots) {
+                _CSTD free(_Slot.exchange(nullptr, _STD memory_order_acquire));
+            }
+        }
+
+        _NODISCARD const _Message_node* _Find(const int _Value, const LANGID _Language) const noexcept {
+            for (size_t _Idx = _Home_slot(_Value, _Language);; _Idx = (_Idx + 1) % _Slot_count) {
+                const auto _Node = _Slots[_Idx].load(_STD memory_order_acquire);
+                if (!_Node || _Matches(*_Node, _Value, _Language)) {
+                    return _Node;
+                }
+            }
+        }
+
+        _NODISCARD const _Message_node* _Insert(
+            const int _Value, const LANGID _Language, const char* const _Str, const size_t _Length) noexcept {
+            if (_Length == 0 || _Length > _Max_message_length) {
+                return nullptr;
+            }
+
+            if (_Entries.fetch_add(1, _STD memory_order_relaxed) >= _Max_entries) {
+                _Entries.fetch_sub(1, _STD memory_order_relaxed);
+                return nullptr;
+            }
+
+            const auto _Node = static_cast<_Message_node*>(_CSTD malloc(sizeof(_Message_node) + _Length + 1));
+            if (!_Node) {
+                _Entries.fetch_sub(1, _STD memory_order_relaxed);
+                return nullptr;
+            }
+
+            _Node->_Value    = _Value;
+            _Node->_Language = _Language;
+            _Node->_Length   = _Length;
+            const auto _Text = reinterpret_cast<char*>(_Node + 1);
+            _CSTD memcpy(_Text, _Str, _Length);
+            _Text[_Length] = '\0';
+
+            for (size_t _Idx = _Home_slot(_Value, _Language);; _Idx = (_Idx + 1) % _Slot_count) {
+                _Message_node* _Existing = nullptr;
+                if (_Slots[_Idx].compare_exchange_strong(
+                        _Existing, _Node, _STD memory_order_acq_rel, _STD memory_order_acquire)) {
+                    return _Node;
+                }
+
+                if (_Matches(*_Existing, _Value, _Language)) { // another thread cached the same message first
+                    _CSTD free(_Node);
+                    _Entries.fetch_sub(1, _STD memory_order_relaxed);
+                    return _Existing;
+                }
+            }
+        }
+
+    private:
+        _NODISCARD static size_t _Home_slot(const int _Value, const LANGID _Language) noexcept {
+            const size_t _Hash = static_cast<unsigned int>(_Value) * size_t{0x9E3779B1} + _Language;
+            return (_Hash ^ (_Hash >> 16)) % _Slot_count;
+        }
+
+        _NODISCARD static bool _Matches(const _Message_node& _Node, const int _Value, const LANGID _Language) noexcept {
+            return _Node._Value == _Value && _Node._Language == _Language;
+        }
+
+        _STD atomic<_Message_node*> _Slots[_Slot_count]{};
+        _STD atomic<size_t> _Entries{0};
+    };
+
+    _Message_cache _Cache;
+} // unnamed namespace
+
+extern "C" {
+
+_NODISCARD const char* __stdcall __std_error_message_cache_find(const int _Value, size_t* const _Length) noexcept {
+    // the cached message for system error _Value in the calling thread's UI language, or nullptr if it isn't cached
+    const auto _Found = _Cache._Find(_Value, GetThreadUILanguage());
+    if (!_Found) {
+        return nullptr;
+    }
+
+    *_Length = _Found->_Length;
+    return _Found->_Text();
+}
+
+_NODISCARD const char* __stdcall __std_error_message_cache_insert(
+    const int _Value, const char* const _Str, size_t* const _Length) noexcept {
+    // caches a copy of [_Str, _Str + *_Length), which FormatMessage produced for system error _Value in the calling
+    // thread's UI language, unless another thread cached it first; returns the cached message and stores its length in
+    // *_Length, or returns nullptr if the message is empty or too long, the cache is full, or memory is exhausted
+    const auto _Cached = _Cache._Insert(_Value, GetThreadUILanguage(), _Str, *_Length);
+    if (!_Cached) {
+        return nullptr;
+    }
+
+    *_Length = _Cached->_Length;
+    return _Cached->_Text();
+}
+} // extern "C"
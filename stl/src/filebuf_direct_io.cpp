@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// support for large transfers by basic_filebuf<char> in <fstream>
+
+#include <climits>
+#include <cstdio>
+#include <io.h>
+
+namespace {
+    constexpr size_t _Max_chunk = INT_MAX; // _read and _write count in unsigned int but report in int
+} // unnamed namespace
+
+extern "C" {
+
+_NODISCARD size_t __stdcall __std_fread_direct(FILE* const _File, void* const _Data, const size_t _Size) noexcept {
+    // flushes _File, whose buffered input the caller has already consumed, then reads straight from the file
+    // descriptor beneath it; _read still translates text mode, and in binary mode issues one ReadFile per chunk
+    if (_CSTD fflush(_File) != 0) {
+        return 0;
+    }
+
+    const int _Fd     = _fileno(_File);
+    const auto _Bytes = static_cast<char*>(_Data);
+    size_t _Done      = 0;
+    while (_Done < _Size) {
+        const size_t _Chunk = _Size - _Done < _Max_chunk ? _Size - _Done : _Max_chunk;
+        const int _Result   = _read(_Fd, _Bytes + _Done, static_cast<unsigned int>(_Chunk));
+        if (_Result <= 0) { // end of file or error
+            break;
+        }
+
+        _Done += static_cast<size_t>(_Result);
+    }
+
+    return _Done;
+}
+
+_NODISCARD size_t __stdcall __std_fwrite_direct(
+    FILE* const _File, const void* const _Data, const size_t _Size) noexcept {
+    // flushes _File, then writes straight to the file descriptor beneath it; see __std_fread_direct
+    if (_CSTD fflush(_File) != 0) {
+        return 0;
+    }
+
+    const int _Fd     = _fileno(_File);
+    const auto _Bytes = static_cast<const char*>(_Data);
+    size_t _Done      = 0;
+    while (_Done < _Size) {
+        const size_t _Chunk = _Size - _Done < _Max_chunk ? _Size - _Done : _Max_chunk;
+        const int _Result   = _write(_Fd, _Bytes + _Done, static_cast<unsigned int>(_Chunk));
+        if (_Result <= 0) {
+            break;
+        }
+
+        _Done += static_cast<size_t>(_Result);
+    }
+
+    return _Done;
+}
+} // extern "C"
@@ -9,6 +9,7 @@
 // Do not include or define anything else here.
 // In particular, basic_string must not be included here.
 
+#include <__msvc_utf_transcode_abi.hpp>
 #include <corecrt_terminate.h>
 #include <internal_shared.h>
 #include <limits.h>
@@ -178,13 +179,55 @@ namespace {
         return __std_win_error{GetLastError()};
     }
 
+    // STRUCT _Copy_progress
+    struct _Copy_progress { // the caller's progress callback, reached through the Win32 copy callbacks
+        __std_fs_copy_progress_callback _Callback;
+        void* _Context;
+
+        [[nodiscard]] bool _Continue(const unsigned long long _Copied, const unsigned long long _Total) const noexcept {
+            return _Callback(_Copied, _Total, _Context) != 0;
+        }
+    };
+
+#if defined(_CRT_APP)
+    COPYFILE2_MESSAGE_ACTION __stdcall _Copy_progress_routine(
+        const COPYFILE2_MESSAGE* const _Message, void* const _Data) noexcept {
+        if (_Message->Type == COPYFILE2_CALLBACK_CHUNK_FINISHED) {
+            const auto& _Chunk = _Message->Info.ChunkFinished;
+            if (!static_cast<const _Copy_progress*>(_Data)->_Continue(
+                    _Chunk.uliTotalBytesTransferred.QuadPart, _Chunk.uliTotalFileSize.QuadPart)) {
+                return COPYFILE2_PROGRESS_CANCEL;
+            }
+        }
+
+        return COPYFILE2_PROGRESS_CONTINUE;
+    }
+#else // ^^^ defined(_CRT_APP) ^^^ // vvv !defined(_CRT_APP) vvv
+    DWORD __stdcall _Copy_progress_routine(const LARGE_INTEGER _Total_file_size,
+        const LARGE_INTEGER _Total_bytes_transferred, LARGE_INTEGER, LARGE_INTEGER, DWORD, DWORD, HANDLE, HANDLE,
+        void* const _Data) noexcept {
+        const auto _Copied = static_cast<unsigned long long>(_Total_bytes_transferred.QuadPart);
+        const auto _Total  = static_cast<unsigned long long>(_Total_file_size.QuadPart);
+        if (static_cast<const _Copy_progress*>(_Data)->_Continue(_Copied, _Total)) {
+            return PROGRESS_CONTINUE;
+        }
+
+        return PROGRESS_CANCEL;
+    }
+#endif // defined(_CRT_APP)
+
     // FUNCTION __vcp_CopyFile
-    [[nodiscard]] __std_fs_copy_file_result __stdcall __vcp_Copyfile(
-        const wchar_t* const _Source, const wchar_t* const _Target, const bool _Fail_if_exists) noexcept {
+    [[nodiscard]] __std_fs_copy_file_result __stdcall __vcp_Copyfile(const wchar_t* const _Source,
+        const wchar_t* const _Target, const bool _Fail_if_exists, const unsigned long _Extra_flags = 0,
+        const _Copy_progress* const _Progress = nullptr) noexcept {
 #if defined(_CRT_APP)
         COPYFILE2_EXTENDED_PARAMETERS _Params{};
         _Params.dwSize      = sizeof(_Params);
-        _Params.dwCopyFlags = _Fail_if_exists ? COPY_FILE_FAIL_IF_EXISTS : 0;
+        _Params.dwCopyFlags = (_Fail_if_exists ? COPY_FILE_FAIL_IF_EXISTS : 0) | _Extra_flags;
+        if (_Progress) {
+            _Params.pProgressRoutine  = &_Copy_progress_routine;
+            _Params.pvCallbackContext = const_cast<_Copy_progress*>(_Progress);
+        }
 
         const HRESULT _Copy_result = CopyFile2(_Source, _Target, &_Params);
         if (SUCCEEDED(_Copy_result)) {
@@ -194,7 +237,9 @@ namespace {
         // take lower bits to undo HRESULT_FROM_WIN32
         return {false, __std_win_error{_Copy_result & 0x0000FFFFU}};
 #else // ^^^ defined(_CRT_APP) ^^^ // vvv !defined(_CRT_APP) vvv
-        if (CopyFileW(_Source, _Target, _Fail_if_exists)) {
+        if (CopyFileExW(_Source, _Target, _Progress ? &_Copy_progress_routine : nullptr,
+                const_cast<_Copy_progress*>(_Progress), nullptr,
+                (_Fail_if_exists ? COPY_FILE_FAIL_IF_EXISTS : 0) | _Extra_flags)) {
             return {true, __std_win_error::_Success};
         }
 
@@ -202,6 +247,189 @@ namespace {
 #endif // defined(_CRT_APP)
     }
 
+    enum class _Clone_result { _Cloned, _Canceled, _Not_cloned };
+
+#if !defined(_CRT_APP) && _STL_WIN32_WINNT >= _WIN32_WINNT_VISTA
+    // block cloning control codes and buffers from Windows 10's WinIoCtl.h, which we may be built without
+    constexpr unsigned long _File_supports_block_refcounting = 0x08000000; // FILE_SUPPORTS_BLOCK_REFCOUNTING
+    constexpr unsigned long _Fsctl_get_integrity_information = 0x0009027C; // FSCTL_GET_INTEGRITY_INFORMATION
+    constexpr unsigned long _Fsctl_set_integrity_information = 0x0009C280; // FSCTL_SET_INTEGRITY_INFORMATION
+    constexpr unsigned long _Fsctl_duplicate_extents_to_file = 0x00098344; // FSCTL_DUPLICATE_EXTENTS_TO_FILE
+    constexpr unsigned long long _Clone_chunk_size           = 1ULL << 30; // each request must clone under 4 GiB
+
+    struct _Get_integrity_information_buffer { // FSCTL_GET_INTEGRITY_INFORMATION_BUFFER
+        unsigned short _Checksum_algorithm;
+        unsigned short _Reserved;
+        unsigned long _Flags;
+        unsigned long _Checksum_chunk_size_in_bytes;
+        unsigned long _Cluster_size_in_bytes;
+    };
+
+    struct _Set_integrity_information_buffer { // FSCTL_SET_INTEGRITY_INFORMATION_BUFFER
+        unsigned short _Checksum_algorithm;
+        unsigned short _Reserved;
+        unsigned long _Flags;
+    };
+
+    struct _Duplicate_extents_data { // DUPLICATE_EXTENTS_DATA
+        HANDLE _File_handle;
+        LARGE_INTEGER _Source_file_offset;
+        LARGE_INTEGER _Target_file_offset;
+        LARGE_INTEGER _Byte_count;
+    };
+
+    [[nodiscard]] _Clone_result __stdcall _Clone_extents(const HANDLE _Source, const HANDLE _Target,
+        const FILE_BASIC_INFO& _Basic_info, const unsigned long long _Size,
+        const _Get_integrity_information_buffer& _Integrity, const _Copy_progress* const _Progress) noexcept {
+        // makes the freshly created _Target share _Source's clusters, then gives it _Source's attributes
+        unsigned long _Bytes_returned;
+        if ((_Basic_info.FileAttributes & FILE_ATTRIBUTE_SPARSE_FILE) != 0
+            && !DeviceIoControl(_Target, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &_Bytes_returned, nullptr)) {
+            return _Clone_result::_Not_cloned;
+        }
+
+        // the two files must agree on integrity streams for their clusters to be shared
+        _Set_integrity_information_buffer _Set_integrity{_Integrity._Checksum_algorithm, 0, _Integrity._Flags};
+        if (!DeviceIoControl(_Target, _Fsctl_set_integrity_information, &_Set_integrity, sizeof(_Set_integrity),
+                nullptr, 0, &_Bytes_returned, nullptr)) {
+            return _Clone_result::_Not_cloned;
+        }
+
+        FILE_END_OF_FILE_INFO _End_of_file;
+        _End_of_file.EndOfFile.QuadPart = static_cast<long long>(_Size);
+        if (!__vcrt_SetFileInformationByHandle(_Target, FileEndOfFileInfo, &_End_of_file, sizeof(_End_of_file))) {
+            return _Clone_result::_Not_cloned;
+        }
+
+        // clones must end on a cluster boundary, even where that is past the end of the file
+        const unsigned long long _Cluster = _Integrity._Cluster_size_in_bytes;
+        _Duplicate_extents_data _Extents{_Source, {}, {}, {}};
+        for (unsigned long long _Offset = 0; _Offset < _Size;) {
+            const unsigned long long _Remaining = (_Size - _Offset + _Cluster - 1) / _Cluster * _Cluster;
+            const unsigned long long _Count     = _Remaining < _Clone_chunk_size ? _Remaining : _Clone_chunk_size;
+            _Extents._Source_file_offset.QuadPart = static_cast<long long>(_Offset);
+            _Extents._Target_file_offset.QuadPart = static_cast<long long>(_Offset);
+            _Extents._Byte_count.QuadPart         = static_cast<long long>(_Count);
+            if (!DeviceIoControl(_Target, _Fsctl_duplicate_extents_to_file, &_Extents, sizeof(_Extents), nullptr, 0,
+                    &_Bytes_returned, nullptr)) {
+                return _Clone_result::_Not_cloned;
+            }
+
+            _Offset = _Size - _Offset < _Count ? _Size : _Offset + _Count;
+            if (_Progress && !_Progress->_Continue(_Offset, _Size)) {
+                return _Clone_result::_Canceled;
+            }
+        }
+
+        // as CopyFile does, keep the last write time and the attributes that can be set, and mark for archiving
+        FILE_BASIC_INFO _Target_info{};
+        _Target_info.LastWriteTime  = _Basic_info.LastWriteTime;
+        _Target_info.FileAttributes = (_Basic_info.FileAttributes
+                                          & (FILE_ATTRIBUTE_READONLY | FILE_ATTRIBUTE_HIDDEN | FILE_ATTRIBUTE_SYSTEM
+                                              | FILE_ATTRIBUTE_NOT_CONTENT_INDEXED))
+                                    | FILE_ATTRIBUTE_ARCHIVE;
+        if (!__vcrt_SetFileInformationByHandle(_Target, FileBasicInfo, &_Target_info, sizeof(_Target_info))) {
+            return _Clone_result::_Not_cloned;
+        }
+
+        return _Clone_result::_Cloned;
+    }
+#endif // !defined(_CRT_APP) && _STL_WIN32_WINNT >= _WIN32_WINNT_VISTA
+
+    // FUNCTION _Try_clone_file
+    [[nodiscard]] _Clone_result __stdcall _Try_clone_file(const wchar_t* const _Source, const wchar_t* const _Target,
+        const bool _Fail_if_exists, const _Copy_progress* const _Progress) noexcept {
+        // shares _Source's clusters with a new _Target on volumes that support block cloning, like ReFS; whatever
+        // keeps that from working leaves no _Target behind, so the caller can copy the data instead
+#if defined(_CRT_APP) || _STL_WIN32_WINNT < _WIN32_WINNT_VISTA
+        (void) _Source;
+        (void) _Target;
+        (void) _Fail_if_exists;
+        (void) _Progress;
+        return _Clone_result::_Not_cloned;
+#else // ^^^ no block cloning ^^^ // vvv block cloning vvv
+        const _STD _Fs_file _Source_handle(__vcp_CreateFile(
+            _Source, FILE_READ_DATA | FILE_READ_ATTRIBUTES, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, 0));
+        if (_Source_handle._Get() == INVALID_HANDLE_VALUE) {
+            return _Clone_result::_Not_cloned;
+        }
+
+        unsigned long _File_system_flags;
+        if (!GetVolumeInformationByHandleW(
+                _Source_handle._Get(), nullptr, 0, nullptr, nullptr, &_File_system_flags, nullptr, 0)
+            || (_File_system_flags & _File_supports_block_refcounting) == 0) {
+            return _Clone_result::_Not_cloned;
+        }
+
+        // alternate data streams aren't cloned, so files with more than the unnamed stream are copied instead
+        alignas(FILE_STREAM_INFO) unsigned char _Streams[sizeof(FILE_STREAM_INFO) + 64 * sizeof(wchar_t)];
+        FILE_BASIC_INFO _Basic_info;
+        FILE_STANDARD_INFO _Standard_info;
+        _Get_integrity_information_buffer _Integrity;
+        unsigned long _Bytes_returned;
+        if (!__vcrt_GetFileInformationByHandleEx(_Source_handle._Get(), FileStreamInfo, _Streams, sizeof(_Streams))
+            || reinterpret_cast<const FILE_STREAM_INFO*>(_Streams)->NextEntryOffset != 0
+            || !__vcrt_GetFileInformationByHandleEx(
+                _Source_handle._Get(), FileBasicInfo, &_Basic_info, sizeof(_Basic_info))
+            || !__vcrt_GetFileInformationByHandleEx(
+                _Source_handle._Get(), FileStandardInfo, &_Standard_info, sizeof(_Standard_info))
+            || _Standard_info.Directory
+            || !DeviceIoControl(_Source_handle._Get(), _Fsctl_get_integrity_information, nullptr, 0, &_Integrity,
+                sizeof(_Integrity), &_Bytes_returned, nullptr)
+            || _Integrity._Cluster_size_in_bytes == 0 || _Clone_chunk_size % _Integrity._Cluster_size_in_bytes != 0) {
+            return _Clone_result::_Not_cloned;
+        }
+
+        const _STD _Fs_file _Target_handle(__vcp_CreateFile(_Target, GENERIC_READ | GENERIC_WRITE | DELETE, 0,
+            nullptr, _Fail_if_exists ? CREATE_NEW : CREATE_ALWAYS, 0, 0));
+        if (_Target_handle._Get() == INVALID_HANDLE_VALUE) {
+            return _Clone_result::_Not_cloned;
+        }
+
+        const _Clone_result _Result = _Clone_extents(_Source_handle._Get(), _Target_handle._Get(), _Basic_info,
+            static_cast<unsigned long long>(_Standard_info.EndOfFile.QuadPart), _Integrity, _Progress);
+        if (_Result != _Clone_result::_Cloned) {
+            FILE_DISPOSITION_INFO _Delete{TRUE};
+            (void) __vcrt_SetFileInformationByHandle(_Target_handle._Get(), FileDispositionInfo, &_Delete,
+                sizeof(_Delete)); // removes _Target when the handle closes
+        }
+
+        return _Result;
+#endif // ^^^ block cloning ^^^
+    }
+
+    // bypass the system cache when copying files at least this large, so they don't evict everything else
+    constexpr unsigned long long _Unbuffered_copy_threshold = 256ULL << 20;
+
+    // FUNCTION _Copy_file_once
+    [[nodiscard]] __std_fs_copy_file_result __stdcall _Copy_file_once(const wchar_t* const _Source,
+        const wchar_t* const _Target, const bool _Fail_if_exists, const __std_fs_copy_file_flags _Flags,
+        const _Copy_progress* const _Progress) noexcept {
+        if ((_Flags & __std_fs_copy_file_flags::_Clone_blocks) != __std_fs_copy_file_flags::_None) {
+            switch (_Try_clone_file(_Source, _Target, _Fail_if_exists, _Progress)) {
+            case _Clone_result::_Cloned:
+                return {true, __std_win_error::_Success};
+            case _Clone_result::_Canceled:
+                return {false, __std_win_error::_Request_aborted};
+            case _Clone_result::_Not_cloned:
+                break;
+            }
+        }
+
+        unsigned long _Extra_flags = 0;
+#if _STL_WIN32_WINNT >= _WIN32_WINNT_VISTA
+        WIN32_FILE_ATTRIBUTE_DATA _Source_data;
+        if ((_Flags & __std_fs_copy_file_flags::_Unbuffered_large_files) != __std_fs_copy_file_flags::_None
+            && GetFileAttributesExW(_Source, GetFileExInfoStandard, &_Source_data)
+            && ((static_cast<unsigned long long>(_Source_data.nFileSizeHigh) << 32) | _Source_data.nFileSizeLow)
+                   >= _Unbuffered_copy_threshold) {
+            _Extra_flags = COPY_FILE_NO_BUFFERING;
+        }
+#endif // _STL_WIN32_WINNT >= _WIN32_WINNT_VISTA
+
+        return __vcp_Copyfile(_Source, _Target, _Fail_if_exists, _Extra_flags, _Progress);
+    }
+
     [[nodiscard]] __std_win_error __stdcall _Create_symlink(
         const wchar_t* const _Symlink_file_name, const wchar_t* const _Target_file_name, const DWORD _Flags) noexcept {
         if (__vcrt_CreateSymbolicLinkW(
@@ -256,6 +484,78 @@ namespace {
 
         return _Last_error;
     }
+
+    // Directory enumeration reads FILE_FULL_DIR_INFO records in batches that fill this buffer; FindNextFileW goes back
+    // to the file system every few entries, which dominates the cost of crawling large trees.
+    constexpr unsigned long _Dir_enum_buffer_size = 64 * 1024;
+    constexpr unsigned long _Dir_enum_no_record   = ULONG_MAX; // _Next_offset when the buffer must be refilled
+
+    struct _Dir_enumerator {
+        HANDLE _Dir; // the directory, opened for listing
+#if _STL_WIN32_WINNT < _WIN32_WINNT_VISTA
+        bool _Find_handle; // _Dir came from FindFirstFileExW because GetFileInformationByHandleEx is unavailable
+#endif // _STL_WIN32_WINNT < _WIN32_WINNT_VISTA
+        unsigned long _Next_offset; // offset in _Buffer of the next record to report
+        alignas(LONGLONG) unsigned char _Buffer[_Dir_enum_buffer_size];
+    };
+
+    void _Fill_find_data(__std_fs_find_data& _Results, const FILE_FULL_DIR_INFO& _Record) noexcept {
+        _Results._Attributes = __std_fs_file_attr{_Record.FileAttributes};
+        _CSTD memcpy(&_Results._Creation_time, &_Record.CreationTime, sizeof(_Results._Creation_time));
+        _CSTD memcpy(&_Results._Last_access_time, &_Record.LastAccessTime, sizeof(_Results._Last_access_time));
+        _CSTD memcpy(&_Results._Last_write_time, &_Record.LastWriteTime, sizeof(_Results._Last_write_time));
+        _Results._File_size_high = static_cast<unsigned long>(_Record.EndOfFile.HighPart);
+        _Results._File_size_low  = _Record.EndOfFile.LowPart;
+
+        // as FindNextFileW reports in dwReserved0, EaSize holds the reparse tag of reparse points
+        if (_Bitmask_includes(_Results._Attributes, __std_fs_file_attr::_Reparse_point)) {
+            _Results._Reparse_point_tag = __std_fs_reparse_tag{_Record.EaSize};
+        } else {
+            _Results._Reparse_point_tag = __std_fs_reparse_tag::_None;
+        }
+
+        _Results._Reserved1 = 0;
+
+        auto _Name_length = _Record.FileNameLength / sizeof(wchar_t);
+        if (_Name_length >= __std_fs_max_path) { // can't happen for names the file systems accept
+            _Name_length = __std_fs_max_path - 1;
+        }
+
+        _CSTD memcpy(_Results._File_name, _Record.FileName, _Name_length * sizeof(wchar_t));
+        _Results._File_name[_Name_length] = L'\0';
+        _Results._Short_file_name[0]      = L'\0';
+    }
+
+    [[nodiscard]] __std_win_error _Read_dir_record(
+        _Dir_enumerator& _Enum, __std_fs_find_data& _Results, const FILE_INFO_BY_HANDLE_CLASS _Class) noexcept {
+        if (_Enum._Next_offset == _Dir_enum_no_record) {
+            if (!__vcrt_GetFileInformationByHandleEx(_Enum._Dir, _Class, _Enum._Buffer, _Dir_enum_buffer_size)) {
+                return __std_win_error{GetLastError()};
+            }
+
+            _Enum._Next_offset = 0;
+        }
+
+        const auto& _Record = *reinterpret_cast<const FILE_FULL_DIR_INFO*>(_Enum._Buffer + _Enum._Next_offset);
+        if (_Record.NextEntryOffset == 0) {
+            _Enum._Next_offset = _Dir_enum_no_record;
+        } else {
+            _Enum._Next_offset += _Record.NextEntryOffset;
+        }
+
+        _Fill_find_data(_Results, _Record);
+        return __std_win_error::_Success;
+    }
+
+    // calls of each __std_fs_call entry point; while counting is off, an entry point pays for one load
+    volatile long _Call_counting = 0;
+    volatile long long _Call_counts[static_cast<int>(__std_fs_call::_Count)];
+
+    void _Count_call(const __std_fs_call _Call) noexcept {
+        if (__iso_volatile_load32(reinterpret_cast<const volatile int*>(&_Call_counting)) != 0) {
+            InterlockedIncrement64(&_Call_counts[static_cast<int>(_Call)]);
+        }
+    }
 } // unnamed namespace
 
 _EXTERN_C
@@ -269,6 +569,7 @@ _EXTERN_C
 [[nodiscard]] __std_win_error __stdcall __std_fs_open_handle(__std_fs_file_handle* const _Handle,
     const wchar_t* const _File_name, const __std_access_rights _Desired_access,
     const __std_fs_file_flags _Flags) noexcept { // calls CreateFile2 or CreateFileW
+    _Count_call(__std_fs_call::_Open_handle);
     const HANDLE _Result = __vcp_CreateFile(_File_name, static_cast<unsigned long>(_Desired_access),
         FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
         static_cast<unsigned long>(_Flags), 0);
@@ -324,44 +625,102 @@ static_assert(alignof(WIN32_FIND_DATAW) == alignof(__std_fs_find_data));
 
 [[nodiscard]] __std_win_error __stdcall __std_fs_directory_iterator_open(
     const wchar_t* const _Path_spec, __std_fs_dir_handle* const _Handle, __std_fs_find_data* const _Results) noexcept {
+    // _Path_spec is the directory followed by the wildcard *, which matches every entry
+    _Count_call(__std_fs_call::_Directory_iterator_open);
     __std_fs_directory_iterator_close(*_Handle);
-    *_Handle = __std_fs_dir_handle{reinterpret_cast<intptr_t>(
-        FindFirstFileExW(_Path_spec, FindExInfoBasic, _Results, FindExSearchNameMatch, nullptr, 0))};
-    if (*_Handle != __std_fs_dir_handle::_Invalid) {
+    *_Handle = __std_fs_dir_handle::_Invalid;
+
+    const auto _Enum = _malloc_crt_t(_Dir_enumerator, 1);
+    if (!_Enum) {
+        return __std_win_error::_Not_enough_memory;
+    }
+
+#if _STL_WIN32_WINNT < _WIN32_WINNT_VISTA
+    _Enum->_Find_handle = !_GetFileInfoByHandleEx{}._Supported();
+    if (_Enum->_Find_handle) {
+        _Enum->_Dir = FindFirstFileExW(_Path_spec, FindExInfoStandard, _Results, FindExSearchNameMatch, nullptr, 0);
+        if (_Enum->_Dir == INVALID_HANDLE_VALUE) {
+            const __std_win_error _Last_error{GetLastError()};
+            _free_crt(_Enum);
+            return _Last_error;
+        }
+
+        *_Handle = __std_fs_dir_handle{reinterpret_cast<intptr_t>(_Enum)};
         return __std_win_error::_Success;
     }
+#endif // _STL_WIN32_WINNT < _WIN32_WINNT_VISTA
 
-#if _STL_WIN32_WINNT < _WIN32_WINNT_WIN7
-    // If the above call failed, we might be on pre Windows 7 / Windows Server 2008 R2, which doesn't support
-    // FindExInfoBasic; try again with FindExInfoStandard if we got an invalid parameter error.
-    const __std_win_error _Last_error{GetLastError()};
-    if (_Last_error != __std_win_error::_Not_supported && _Last_error != __std_win_error::_Invalid_parameter) {
-        return _Last_error;
+    const size_t _Dir_length = wcslen(_Path_spec) - 1; // keep the trailing separator, drop the wildcard
+    __crt_unique_heap_ptr<wchar_t> _Dir_name(_malloc_crt_t(wchar_t, _Dir_length + 1));
+    if (!_Dir_name) {
+        _free_crt(_Enum);
+        return __std_win_error::_Not_enough_memory;
     }
 
-    *_Handle = __std_fs_dir_handle{reinterpret_cast<intptr_t>(
-        FindFirstFileExW(_Path_spec, FindExInfoStandard, _Results, FindExSearchNameMatch, nullptr, 0))};
-    if (*_Handle != __std_fs_dir_handle::_Invalid) {
-        return __std_win_error::_Success;
+    memcpy(_Dir_name.get(), _Path_spec, _Dir_length * sizeof(wchar_t));
+    _Dir_name.get()[_Dir_length] = L'\0';
+
+    _Enum->_Dir = __vcp_CreateFile(_Dir_name.get(), FILE_LIST_DIRECTORY | SYNCHRONIZE,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, 0);
+    __std_win_error _Last_error = _Translate_CreateFile_last_error(_Enum->_Dir);
+    if (_Last_error == __std_win_error::_Success) {
+        _Enum->_Next_offset = _Dir_enum_no_record;
+        _Last_error         = _Read_dir_record(*_Enum, *_Results, FileFullDirectoryRestartInfo);
+        if (_Last_error == __std_win_error::_Success) {
+            *_Handle = __std_fs_dir_handle{reinterpret_cast<intptr_t>(_Enum)};
+            return __std_win_error::_Success;
+        }
+
+        if (_Last_error == __std_win_error::_Invalid_parameter) { // opened something other than a directory
+            _Last_error = __std_win_error::_Directory_name_is_invalid;
+        }
+
+        CloseHandle(_Enum->_Dir);
     }
-#endif // _STL_WIN32_WINNT < _WIN32_WINNT_WIN7
 
-    return __std_win_error{GetLastError()};
+    _free_crt(_Enum);
+    return _Last_error;
 }
 
 void __stdcall __std_fs_directory_iterator_close(const __std_fs_dir_handle _Handle) noexcept {
-    if (_Handle != __std_fs_dir_handle::_Invalid && !FindClose(reinterpret_cast<HANDLE>(_Handle))) {
+    if (_Handle == __std_fs_dir_handle::_Invalid) {
+        return;
+    }
+
+    const auto _Enum = reinterpret_cast<_Dir_enumerator*>(_Handle);
+#if _STL_WIN32_WINNT < _WIN32_WINNT_VISTA
+    if (_Enum->_Find_handle) {
+        if (!FindClose(_Enum->_Dir)) {
+            terminate();
+        }
+
+        _free_crt(_Enum);
+        return;
+    }
+#endif // _STL_WIN32_WINNT < _WIN32_WINNT_VISTA
+
+    if (!CloseHandle(_Enum->_Dir)) {
         terminate();
     }
+
+    _free_crt(_Enum);
 }
 
 [[nodiscard]] __std_win_error __stdcall __std_fs_directory_iterator_advance(
     const __std_fs_dir_handle _Handle, __std_fs_find_data* const _Results) noexcept {
-    if (FindNextFileW(reinterpret_cast<HANDLE>(_Handle), reinterpret_cast<WIN32_FIND_DATAW*>(_Results))) {
-        return __std_win_error::_Success;
+    _Count_call(__std_fs_call::_Directory_iterator_advance);
+    auto& _Enum = *reinterpret_cast<_Dir_enumerator*>(_Handle);
+#if _STL_WIN32_WINNT < _WIN32_WINNT_VISTA
+    if (_Enum._Find_handle) {
+        if (FindNextFileW(_Enum._Dir, reinterpret_cast<WIN32_FIND_DATAW*>(_Results))) {
+            return __std_win_error::_Success;
+        }
+
+        return __std_win_error{GetLastError()};
     }
+#endif // _STL_WIN32_WINNT < _WIN32_WINNT_VISTA
 
-    return __std_win_error{GetLastError()};
+    return _Read_dir_record(_Enum, *_Results, FileFullDirectoryInfo);
 }
 
 [[nodiscard]] __std_code_page __stdcall __std_fs_code_page() noexcept {
@@ -380,6 +739,16 @@ void __stdcall __std_fs_directory_iterator_close(const __std_fs_dir_handle _Hand
 
 [[nodiscard]] __std_fs_convert_result __stdcall __std_fs_convert_narrow_to_wide(const __std_code_page _Code_page,
     const char* const _Input_str, const int _Input_len, wchar_t* const _Output_str, const int _Output_len) noexcept {
+    _Count_call(__std_fs_call::_Convert);
+    if (_Code_page == __std_code_page::_Utf8 && _Input_len > 0 && _Output_len >= 0) {
+        // Well-formed input that fits converts here; anything else is left to the API to report as before.
+        const auto _Result = __std_utf8_to_utf16(_Input_str, static_cast<size_t>(_Input_len),
+            _Output_len == 0 ? nullptr : reinterpret_cast<char16_t*>(_Output_str), static_cast<size_t>(_Output_len));
+        if (_Result._Read == static_cast<size_t>(_Input_len)) {
+            return {static_cast<int>(_Result._Written), __std_win_error::_Success};
+        }
+    }
+
     const int _Len = MultiByteToWideChar(
         static_cast<unsigned int>(_Code_page), MB_ERR_INVALID_CHARS, _Input_str, _Input_len, _Output_str, _Output_len);
     return {_Len, _Len == 0 ? __std_win_error{GetLastError()} : __std_win_error::_Success};
@@ -387,6 +756,17 @@ void __stdcall __std_fs_directory_iterator_close(const __std_fs_dir_handle _Hand
 
 [[nodiscard]] __std_fs_convert_result __stdcall __std_fs_convert_wide_to_narrow(const __std_code_page _Code_page,
     const wchar_t* const _Input_str, const int _Input_len, char* const _Output_str, const int _Output_len) noexcept {
+    _Count_call(__std_fs_call::_Convert);
+    if (_Code_page == __std_code_page::_Utf8 && _Input_len > 0 && _Output_len >= 0) {
+        // as in __std_fs_convert_narrow_to_wide
+        const auto _Utf16_str   = reinterpret_cast<const char16_t*>(_Input_str);
+        const auto _Utf8_result = __std_utf16_to_utf8(_Utf16_str, static_cast<size_t>(_Input_len),
+            _Output_len == 0 ? nullptr : _Output_str, static_cast<size_t>(_Output_len));
+        if (_Utf8_result._Read == static_cast<size_t>(_Input_len) && _Utf8_result._Written <= INT_MAX) {
+            return {static_cast<int>(_Utf8_result._Written), __std_win_error::_Success};
+        }
+    }
+
     __std_fs_convert_result _Result;
 
     if (_Code_page == __std_code_page{CP_UTF8} || _Code_page == __std_code_page{54936}) {
@@ -423,6 +803,7 @@ void __stdcall __std_fs_directory_iterator_close(const __std_fs_dir_handle _Hand
 [[nodiscard]] __std_fs_convert_result __stdcall __std_fs_convert_wide_to_narrow_replace_chars(
     const __std_code_page _Code_page, const wchar_t* const _Input_str, const int _Input_len, char* const _Output_str,
     const int _Output_len) noexcept {
+    _Count_call(__std_fs_call::_Convert);
     __std_fs_convert_result _Result;
 
     _Result._Len = WideCharToMultiByte(static_cast<unsigned int>(_Code_page), WC_NO_BEST_FIT_CHARS, _Input_str,
@@ -442,11 +823,21 @@ void __stdcall __std_fs_directory_iterator_close(const __std_fs_dir_handle _Hand
 }
 
 [[nodiscard]] __std_fs_copy_file_result __stdcall __std_fs_copy_file(const wchar_t* const _Source,
-    const wchar_t* const _Target, __std_fs_copy_options _Options) noexcept { // copy _Source to _Target
+    const wchar_t* const _Target, const __std_fs_copy_options _Options) noexcept { // copy _Source to _Target
+    return __std_fs_copy_file_ex(_Source, _Target, _Options, __std_fs_copy_file_flags::_None, nullptr, nullptr);
+}
+
+[[nodiscard]] __std_fs_copy_file_result __stdcall __std_fs_copy_file_ex(const wchar_t* const _Source,
+    const wchar_t* const _Target, __std_fs_copy_options _Options, const __std_fs_copy_file_flags _Flags,
+    const __std_fs_copy_progress_callback _Progress_callback, void* const _Context) noexcept {
+    // copy _Source to _Target as above, trying the faster paths _Flags allows and reporting progress
+    _Count_call(__std_fs_call::_Copy_file);
+    const _Copy_progress _Progress_storage{_Progress_callback, _Context};
+    const _Copy_progress* const _Progress = _Progress_callback ? &_Progress_storage : nullptr;
     _Options &= __std_fs_copy_options::_Existing_mask;
     if (_Options != __std_fs_copy_options::_Overwrite_existing) {
         const __std_fs_copy_file_result _First_try_result =
-            __vcp_Copyfile(_Source, _Target, /* _Fail_if_exists = */ true);
+            _Copy_file_once(_Source, _Target, /* _Fail_if_exists = */ true, _Flags, _Progress);
         if (_First_try_result._Error != __std_win_error::_File_exists // successful copy or I/O error
             || _Options == __std_fs_copy_options::_None) { // caller requested fail if exists behavior
             return _First_try_result;
@@ -503,10 +894,11 @@ void __stdcall __std_fs_directory_iterator_close(const __std_fs_dir_handle _Hand
     // is_regular_file(from) is false => ERROR_ACCESS_DENIED
     // exists(to) is true and is_regular_file(to) is false => ERROR_ACCESS_DENIED
     // exists(to) is true and equivalent(from, to) is true => ERROR_SHARING_VIOLATION
-    return __vcp_Copyfile(_Source, _Target, /* _Fail_if_exists = */ false);
+    return _Copy_file_once(_Source, _Target, /* _Fail_if_exists = */ false, _Flags, _Progress);
 }
 
 __std_win_error __stdcall __std_fs_get_file_id(__std_fs_file_id* const _Id, const wchar_t* const _Path) noexcept {
+    _Count_call(__std_fs_call::_Get_file_id);
     __std_win_error _Last_error;
     const _STD _Fs_file _Handle(
         _Path, __std_access_rights::_File_read_attributes, __std_fs_file_flags::_Backup_semantics, &_Last_error);
@@ -623,6 +1015,7 @@ __std_win_error __stdcall __std_fs_get_file_id(__std_fs_file_id* const _Id, cons
 
 [[nodiscard]] __std_fs_remove_result __stdcall __std_fs_remove(const wchar_t* const _Target) noexcept {
     // remove _Target without caring whether _Target is a file or directory
+    _Count_call(__std_fs_call::_Remove);
     __std_win_error _Last_error;
 #if _STL_ALWAYS_HAS_SetFileInformationByHandle
 #define _SetFileInformationByHandle SetFileInformationByHandle
@@ -903,6 +1296,7 @@ struct alignas(long long) _Aligned_file_attrs {
 
 [[nodiscard]] __std_win_error __stdcall __std_fs_get_stats(const wchar_t* const _Path, __std_fs_stats* const _Stats,
     __std_fs_stats_flags _Flags, const __std_fs_file_attr _Symlink_attribute_hint) noexcept {
+    _Count_call(__std_fs_call::_Get_stats);
     static_assert((offsetof(_Aligned_file_attrs, _Data._Last_write_time) % 8) == 0, "_Last_write_time not aligned");
     static_assert(sizeof(_File_attr_data) == sizeof(WIN32_FILE_ATTRIBUTE_DATA));
     static_assert(alignof(_File_attr_data) == alignof(WIN32_FILE_ATTRIBUTE_DATA));
@@ -1055,6 +1449,7 @@ struct alignas(long long) _Aligned_file_attrs {
 
 [[nodiscard]] __std_fs_create_directory_result __stdcall __std_fs_create_directory(
     const wchar_t* const _New_directory) noexcept {
+    _Count_call(__std_fs_call::_Create_directory);
     if (CreateDirectoryW(_New_directory, nullptr)) {
         return {true, __std_win_error::_Success};
     }
@@ -1114,4 +1509,20 @@ struct alignas(long long) _Aligned_file_attrs {
     return __std_win_error::_Success;
 }
 
+void __stdcall __std_fs_call_counts_enable(const bool _Enable) noexcept {
+    if (_Enable) { // start over
+        for (auto& _Count : _Call_counts) {
+            InterlockedExchange64(&_Count, 0);
+        }
+    }
+
+    InterlockedExchange(&_Call_counting, _Enable ? 1 : 0);
+}
+
+void __stdcall __std_fs_call_counts(unsigned long long* const _Counts) noexcept {
+    for (int _Call = 0; _Call < static_cast<int>(__std_fs_call::_Count); ++_Call) {
+        _Counts[_Call] = static_cast<unsigned long long>(InterlockedCompareExchange64(&_Call_counts[_Call], 0, 0));
+    }
+}
+
 _END_EXTERN_C
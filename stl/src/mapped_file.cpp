@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// support for stdext::mapped_filebuf in <fstream>
+
+#include <internal_shared.h>
+
+namespace {
+    _NODISCARD int _Map_file(const HANDLE _File, const void** const _View, size_t* const _Size) noexcept {
+        // maps all of _File read-only and closes _File; an empty file, which cannot be mapped, gets a null view
+        if (_File == INVALID_HANDLE_VALUE) {
+            return 0;
+        }
+
+        int _Result = 0;
+        LARGE_INTEGER _File_size;
+        if (GetFileSizeEx(_File, &_File_size) && static_cast<unsigned long long>(_File_size.QuadPart) <= SIZE_MAX) {
+            if (_File_size.QuadPart == 0) {
+                *_View  = nullptr;
+                *_Size  = 0;
+                _Result = 1;
+            } else {
+                const HANDLE _Mapping = CreateFileMappingW(_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (_Mapping) {
+                    // the view keeps the mapping, and with it the file, alive until UnmapViewOfFile
+                    const void* const _Mapped = MapViewOfFile(_Mapping, FILE_MAP_READ, 0, 0, 0);
+                    if (_Mapped) {
+                        *_View  = _Mapped;
+                        *_Size  = static_cast<size_t>(_File_size.QuadPart);
+                        _Result = 1;
+                    }
+
+                    CloseHandle(_Mapping);
+                }
+            }
+        }
+
+        CloseHandle(_File);
+        return _Result;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+_NODISCARD int __stdcall __std_map_file_for_reading(
+    const wchar_t* const _Filename, const void** const _View, size_t* const _Size) noexcept {
+    // other processes may keep writing to the file, as with _wfsopen(_Filename, L"rb", _SH_DENYNO)
+    return _Map_file(CreateFileW(_Filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                         FILE_ATTRIBUTE_NORMAL, nullptr),
+        _View, _Size);
+}
+
+_NODISCARD int __stdcall __std_map_file_for_reading_narrow(
+    const char* const _Filename, const void** const _View, size_t* const _Size) noexcept {
+    // the narrow name is in the ANSI code page, as with fopen()
+    return _Map_file(CreateFileA(_Filename, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                         FILE_ATTRIBUTE_NORMAL, nullptr),
+        _View, _Size);
+}
+
+void __stdcall __std_unmap_file(const void* const _View) noexcept {
+    UnmapViewOfFile(_View);
+}
+} // extern "C"
@@ -1,14 +1,56 @@
 // Copyright (c) Microsoft Corporation.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <atomic>
 #include <internal_shared.h>
+#include <malloc.h>
+#include <memory>
 #include <memory_resource>
 #include <system_error>
 
+#include <Windows.h>
+
+_STDEXT_BEGIN
+namespace {
+    _STD atomic<allocation_hook> _Allocation_hook{nullptr};
+    _STD atomic<unsigned int> _Allocation_sample_period{1};
+
+    // with no hook installed, threads ask again only this often, so that one installed later reaches them soon
+    constexpr unsigned int _Unhooked_skip = 255;
+
+    thread_local bool _Reporting_allocation = false;
+} // unnamed namespace
+
+extern "C" _CRT_SATELLITE_1 allocation_hook __cdecl _Set_allocation_hook(
+    const allocation_hook _Hook, const unsigned int _Sample_period) noexcept {
+    _Allocation_sample_period.store(_Sample_period == 0 ? 1 : _Sample_period, _STD memory_order_relaxed);
+    return _Allocation_hook.exchange(_Hook);
+}
+
+extern "C" _CRT_SATELLITE_1 unsigned int __cdecl _Report_allocation(allocation_event* const _Event) noexcept {
+    // returns how many of the calling thread's allocations and deallocations to skip before it reports another one
+    const allocation_hook _Hook = _Allocation_hook.load();
+    if (!_Hook) {
+        return _Unhooked_skip;
+    }
+
+    const unsigned int _Period = _Allocation_sample_period.load(_STD memory_order_relaxed);
+    if (!_Reporting_allocation) { // the hook's own allocations aren't reported
+        _Reporting_allocation = true;
+        _Event->sample_period = _Period;
+        _Hook(*_Event);
+        _Reporting_allocation = false;
+    }
+
+    return _Period - 1;
+}
+_STDEXT_END
+
 _STD_BEGIN
 namespace pmr {
 
     static memory_resource* _Default_resource{nullptr};
+    static atomic<bool> _Large_pages_denied{false}; // the process lacks SeLockMemoryPrivilege; stop asking
 
     extern "C" _CRT_SATELLITE_1 _Aligned_new_delete_resource_impl* __cdecl _Aligned_new_delete_resource() noexcept {
         return &const_cast<_Aligned_new_delete_resource_impl&>(
@@ -20,12 +62,58 @@ namespace pmr {
             _Immortalize_memcpy_image<_Unaligned_new_delete_resource_impl>());
     }
 
+    thread_local unsigned int _Default_resource_skip = 0;
+
+    template <bool _Aligned>
+    class _Tracked_new_delete_resource final : public memory_resource {
+        // get_default_resource() returns this in place of new_delete_resource() while an allocation hook is installed
+        static memory_resource* _Upstream() noexcept {
+            if constexpr (_Aligned) {
+                return _Aligned_new_delete_resource();
+            } else {
+                return _Unaligned_new_delete_resource();
+            }
+        }
+
+        static void _Track(
+            void* const _Ptr, const size_t _Bytes, const size_t _Align, const bool _Deallocation) noexcept {
+            if (_Default_resource_skip != 0) {
+                --_Default_resource_skip;
+                return;
+            }
+
+            _STDEXT allocation_event _Event{
+                _Ptr, _Bytes, _Align, _STDEXT allocation_kind::default_resource, _Deallocation, 1};
+            _Default_resource_skip = _STDEXT _Report_allocation(&_Event);
+        }
+
+        virtual void* do_allocate(const size_t _Bytes, const size_t _Align) override {
+            void* const _Ptr = _Upstream()->allocate(_Bytes, _Align);
+            _Track(_Ptr, _Bytes, _Align, false);
+            return _Ptr;
+        }
+
+        virtual void do_deallocate(void* const _Ptr, const size_t _Bytes, const size_t _Align) override {
+            _Track(_Ptr, _Bytes, _Align, true);
+            _Upstream()->deallocate(_Ptr, _Bytes, _Align);
+        }
+
+        virtual bool do_is_equal(const memory_resource& _That) const noexcept override {
+            return this == &_That || _Upstream()->is_equal(_That);
+        }
+    };
+
     extern "C" _CRT_SATELLITE_1 memory_resource* __cdecl _Aligned_get_default_resource() noexcept {
         memory_resource* const _Temp = __crt_interlocked_read_pointer(&_Default_resource);
         if (_Temp) {
             return _Temp;
         }
 
+        if (_STDEXT _Allocation_hook.load(memory_order_relaxed)) {
+            return &const_cast<_Tracked_new_delete_resource<true>&>(
+                _Immortalize_memcpy_image<_Tracked_new_delete_resource<true>>());
+        }
+
         return _Aligned_new_delete_resource();
     }
 
@@ -35,6 +123,11 @@ namespace pmr {
             return _Temp;
         }
 
+        if (_STDEXT _Allocation_hook.load(memory_order_relaxed)) {
+            return &const_cast<_Tracked_new_delete_resource<false>&>(
+                _Immortalize_memcpy_image<_Tracked_new_delete_resource<false>>());
+        }
+
         return _Unaligned_new_delete_resource();
     }
 
@@ -70,5 +163,161 @@ namespace pmr {
         return &const_cast<_Null_resource&>(_Immortalize_memcpy_image<_Null_resource>());
     }
 
+    // FUNCTIONS FOR stdext::pmr::large_page_resource
+    extern "C" _CRT_SATELLITE_1 size_t __cdecl _Large_page_minimum() noexcept {
+        return GetLargePageMinimum();
+    }
+
+    extern "C" _CRT_SATELLITE_1 void* __cdecl _Virtual_allocate(
+        const size_t _Bytes, const size_t _Align, const bool _Large_pages) noexcept {
+        // reserve and commit _Bytes of fresh pages aligned to _Align; returns nullptr on failure
+        if (_Large_pages && _Large_pages_denied.load(memory_order_relaxed)) {
+            return nullptr;
+        }
+
+        const DWORD _Type = MEM_RESERVE | MEM_COMMIT | (_Large_pages ? MEM_LARGE_PAGES : 0);
+        void* _Ptr        = VirtualAlloc(nullptr, _Bytes, _Type, PAGE_READWRITE);
+        if (!_Ptr) {
+            if (_Large_pages && GetLastError() == ERROR_PRIVILEGE_NOT_HELD) {
+                _Large_pages_denied.store(true, memory_order_relaxed);
+            }
+
+            return nullptr;
+        }
+
+        if ((reinterpret_cast<uintptr_t>(_Ptr) & (_Align - 1)) == 0) {
+            return _Ptr;
+        }
+
+        // VirtualAlloc aligns to the allocation granularity (or the large page size); for stricter alignment, find
+        // a suitable address in an oversized reservation and claim it after releasing the reservation
+        VirtualFree(_Ptr, 0, MEM_RELEASE);
+        if (_Bytes > SIZE_MAX - _Align) {
+            return nullptr;
+        }
+
+        for (int _Attempts = 0; _Attempts < 8; ++_Attempts) { // another thread may claim the address in between
+            void* const _Probe = VirtualAlloc(nullptr, _Bytes + _Align, MEM_RESERVE, PAGE_NOACCESS);
+            if (!_Probe) {
+                return nullptr;
+            }
+
+            VirtualFree(_Probe, 0, MEM_RELEASE);
+            const auto _Aligned = (reinterpret_cast<uintptr_t>(_Probe) + _Align - 1) & ~(_Align - 1);
+            _Ptr                = VirtualAlloc(reinterpret_cast<void*>(_Aligned), _Bytes, _Type, PAGE_READWRITE);
+            if (_Ptr) {
+                return _Ptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    extern "C" _CRT_SATELLITE_1 void __cdecl _Virtual_deallocate(void* const _Ptr) noexcept {
+        VirtualFree(_Ptr, 0, MEM_RELEASE);
+    }
+
 } // namespace pmr
 _STD_END
+
+_STDEXT_BEGIN
+namespace {
+    // FUNCTIONS FOR stdext::cached_allocator
+    constexpr size_t _Cached_class_count       = 33; // four classes per power of two, 4 KiB through 1 MiB
+    constexpr size_t _Cached_blocks_per_class  = 4;
+    constexpr size_t _Cached_bytes_per_thread  = 4 * 1024 * 1024; // beyond this, freed blocks go back to the heap
+    constexpr size_t _Cached_class_minimum_log = 12;
+
+    static_assert(_Cached_allocation_minimum == size_t{1} << _Cached_class_minimum_log, "size class 0 is 4 KiB");
+
+    size_t _Cached_size_class(const size_t _Bytes) noexcept {
+        // the smallest class that holds _Bytes in [_Cached_allocation_minimum, _Cached_allocation_maximum]
+        if (_Bytes <= _Cached_allocation_minimum) {
+            return 0;
+        }
+
+        const size_t _Last = _Bytes - 1;
+        size_t _Log        = _Cached_class_minimum_log;
+        while ((_Last >> (_Log + 1)) != 0) {
+            ++_Log;
+        }
+
+        // _Last >> (_Log - 2) is in [4, 7]; the class above it is the first one that holds _Bytes
+        return (_Log - _Cached_class_minimum_log) * 4 + (_Last >> (_Log - 2)) - 3;
+    }
+
+    size_t _Cached_class_bytes(const size_t _Class) noexcept {
+        return (4 + _Class % 4) << (_Cached_class_minimum_log - 2 + _Class / 4);
+    }
+
+    struct _Cached_block_cache { // the calling thread's recently freed blocks, by size class
+        void* _Blocks[_Cached_class_count][_Cached_blocks_per_class] = {};
+        size_t _Counts[_Cached_class_count]                          = {};
+        cached_allocator_statistics _Stats{};
+
+        _Cached_block_cache() = default;
+        _Cached_block_cache(const _Cached_block_cache&) = delete;
+        _Cached_block_cache& operator=(const _Cached_block_cache&) = delete;
+
+        ~_Cached_block_cache() {
+            _Release();
+        }
+
+        void _Release() noexcept {
+            for (size_t _Class = 0; _Class < _Cached_class_count; ++_Class) {
+                for (size_t _Idx = 0; _Idx < _Counts[_Class]; ++_Idx) {
+                    _aligned_free(_Blocks[_Class][_Idx]);
+                }
+
+                _Counts[_Class] = 0;
+            }
+
+            _Stats.cached_bytes = 0;
+        }
+    };
+
+    thread_local _Cached_block_cache _Thread_block_cache;
+} // unnamed namespace
+
+extern "C" _CRT_SATELLITE_1 void* __cdecl _Cached_allocate(const size_t _Bytes) noexcept {
+    // returns nullptr on failure
+    auto& _Cache        = _Thread_block_cache;
+    const size_t _Class = _Cached_size_class(_Bytes);
+    const size_t _Size  = _Cached_class_bytes(_Class);
+    if (_Cache._Counts[_Class] != 0) {
+        ++_Cache._Stats.hits;
+        _Cache._Stats.cached_bytes -= _Size;
+        return _Cache._Blocks[_Class][--_Cache._Counts[_Class]];
+    }
+
+    ++_Cache._Stats.misses;
+    return _aligned_malloc(_Size, _Cached_allocation_alignment);
+}
+
+extern "C" _CRT_SATELLITE_1 void __cdecl _Cached_deallocate(void* const _Ptr, const size_t _Bytes) noexcept {
+    if (!_Ptr) {
+        return;
+    }
+
+    auto& _Cache        = _Thread_block_cache;
+    const size_t _Class = _Cached_size_class(_Bytes);
+    const size_t _Size  = _Cached_class_bytes(_Class);
+    if (_Cache._Counts[_Class] == _Cached_blocks_per_class
+        || _Cache._Stats.cached_bytes + _Size > _Cached_bytes_per_thread) {
+        _aligned_free(_Ptr);
+        return;
+    }
+
+    _Cache._Blocks[_Class][_Cache._Counts[_Class]++] = _Ptr;
+    _Cache._Stats.cached_bytes += _Size;
+}
+
+extern "C" _CRT_SATELLITE_1 void __cdecl _Cached_allocator_statistics(
+    cached_allocator_statistics* const _Stats) noexcept {
+    *_Stats = _Thread_block_cache._Stats;
+}
+
+extern "C" _CRT_SATELLITE_1 void __cdecl _Cached_allocator_release() noexcept {
+    _Thread_block_cache._Release();
+}
+_STDEXT_END
@@ -11,6 +11,7 @@
 #include <xtimec.h>
 
 #include "primitives.hpp"
+#include "sync_stats.hpp"
 
 extern "C" _CRTIMP2_PURE void _Thrd_abort(const char* msg) { // abort on precondition failure
     fputs(msg, stderr);
@@ -88,10 +89,25 @@ void _Mtx_destroy(_Mtx_t mtx) { // destroy mutex
     }
 }
 
+static void mtx_lock_cs(_Mtx_t mtx) { // lock the critical section, counting contention on sampled acquisitions
+    const auto stats = _Sync_stats_if_enabled();
+    if (stats && stats->_Sample_mutex()) {
+        if (mtx->_get_cs()->try_lock()) {
+            stats->_Mutex(mtx, 0);
+        } else {
+            const long long wait_start = _Sync_stats_now();
+            mtx->_get_cs()->lock();
+            stats->_Mutex(mtx, wait_start);
+        }
+    } else {
+        mtx->_get_cs()->lock();
+    }
+}
+
 static int mtx_do_lock(_Mtx_t mtx, const xtime* target) { // lock mutex
     if ((mtx->type & ~_Mtx_recursive) == _Mtx_plain) { // set the lock
         if (mtx->thread_id != static_cast<long>(GetCurrentThreadId())) { // not current thread, do lock
-            mtx->_get_cs()->lock();
+            mtx_lock_cs(mtx);
             mtx->thread_id = static_cast<long>(GetCurrentThreadId());
         }
         ++mtx->count;
@@ -101,7 +117,7 @@ static int mtx_do_lock(_Mtx_t mtx, const xtime* target) { // lock mutex
         int res = WAIT_TIMEOUT;
         if (target == nullptr) { // no target --> plain wait (i.e. infinite timeout)
             if (mtx->thread_id != static_cast<long>(GetCurrentThreadId())) {
-                mtx->_get_cs()->lock();
+                mtx_lock_cs(mtx);
             }
 
             res = WAIT_OBJECT_0;
@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// process-wide cache of the implementations of named locales for <xlocale>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <internal_shared.h>
+
+namespace {
+    struct _Named_locale_node { // a locale constructed from a name with all categories; its name follows the node
+        _Named_locale_node* _Next;
+        void* _Imp;
+
+        _NODISCARD const char* _Name() const noexcept {
+            return reinterpret_cast<const char*>(this + 1);
+        }
+    };
+
+    // nodes are pushed onto the front and never removed, so lookups need no lock; the implementations they hold
+    // belong to msvcp140, so they stay cached until the process ends
+    _STD atomic<_Named_locale_node*> _Named_locales{nullptr};
+
+    _NODISCARD const _Named_locale_node* _Find_in(
+        const _Named_locale_node* _Node, const char* const _Locname) noexcept {
+        for (; _Node; _Node = _Node->_Next) {
+            if (_CSTD strcmp(_Node->_Name(), _Locname) == 0) {
+                return _Node;
+            }
+        }
+
+        return nullptr;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+_NODISCARD void* __stdcall __std_named_locale_find(const char* const _Locname) noexcept {
+    // the cached implementation of the locale named _Locname with all categories, or nullptr if none was cached
+    const auto _Found = _Find_in(_Named_locales.load(_STD memory_order_acquire), _Locname);
+    return _Found ? _Found->_Imp : nullptr;
+}
+
+_NODISCARD void* __stdcall __std_named_locale_cache(const char* const _Locname, void* const _Imp) noexcept {
+    // caches _Imp, just constructed from _Locname with all categories, unless another thread cached a locale of that
+    // name first; returns the cached implementation, which is _Imp if the cache took the caller's reference to it, or
+    // nullptr if memory is exhausted
+    const size_t _Length = _CSTD strlen(_Locname);
+    const auto _Node     = static_cast<_Named_locale_node*>(_CSTD malloc(sizeof(_Named_locale_node) + _Length + 1));
+    if (!_Node) {
+        return nullptr;
+    }
+
+    _CSTD memcpy(_Node + 1, _Locname, _Length + 1);
+    _Node->_Imp = _Imp;
+
+    auto _Head = _Named_locales.load(_STD memory_order_acquire);
+    for (;;) {
+        const auto _Other = _Find_in(_Head, _Locname);
+        if (_Other) { // lost a race to cache the same name
+            _CSTD free(_Node);
+            return _Other->_Imp;
+        }
+
+        _Node->_Next = _Head;
+        if (_Named_locales.compare_exchange_weak(_Head, _Node, _STD memory_order_release, _STD memory_order_acquire)) {
+            return _Imp;
+        }
+    }
+}
+} // extern "C"
@@ -3,10 +3,32 @@
 
 // support for <execution>
 
+#include <atomic>
 #include <internal_shared.h>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
 #include <thread>
 #include <xatomic_wait.h>
 
+#include <Windows.h>
+#include <evntprov.h>
+
+#if defined(_M_IX86) || defined(_M_X64)
+#include <emmintrin.h>
+#endif // defined(_M_IX86) || defined(_M_X64)
+
+struct __std_parallel_hints { // must match <execution>
+    size_t _Grain;
+    unsigned int _Max_threads;
+};
+
+struct __std_thread_pool { // a private Windows thread pool, and the callback environment that submits work to it
+    PTP_POOL _Pool;
+    TP_CALLBACK_ENVIRON _Callback_environ;
+    unsigned int _Max_threads;
+};
+
 namespace {
     unsigned char _Atomic_load_uchar(const volatile unsigned char* _Ptr) noexcept {
         // atomic load of unsigned char, copied from <atomic> except ARM and ARM64 bits
@@ -19,17 +41,449 @@ namespace {
 #endif
         return _Value;
     }
+
+    // set by __std_parallel_algorithms_set_environment
+    _STD atomic<PTP_CALLBACK_ENVIRON> _Parallel_callback_environ{nullptr};
+    _STD atomic<unsigned int> _Parallel_max_threads{0};
+
+    // computed by __std_parallel_algorithms_numa_nodes on first use; 0 means not yet computed
+    _STD atomic<unsigned int> _Parallel_numa_nodes{0};
+
+    // set by __std_parallel_algorithms_exchange_hints while an algorithm called with a hinted policy runs
+    thread_local __std_parallel_hints _Parallel_thread_hints{};
+
+    // set by __std_parallel_algorithms_exchange_scratch_resource; a std::pmr::memory_resource*, or nullptr to use
+    // _Parallel_thread_scratch
+    thread_local void* _Parallel_thread_scratch_resource = nullptr;
+
+    // blocks larger than this go straight back to the heap instead of staying with the thread
+    constexpr size_t _Max_cached_scratch_bytes = 16 * 1024 * 1024;
+
+    struct _Scratch_cache { // keeps the thread's largest recently freed scratch block for the next algorithm
+        void* _Cached        = nullptr;
+        size_t _Cached_bytes = 0;
+        size_t _Cached_align = 0;
+        void* _Lent          = nullptr; // the block last handed out from _Cached; it may be larger than requested
+        size_t _Lent_bytes   = 0;
+        size_t _Lent_align   = 0;
+
+        _Scratch_cache() = default;
+        _Scratch_cache(const _Scratch_cache&) = delete;
+        _Scratch_cache& operator=(const _Scratch_cache&) = delete;
+
+        ~_Scratch_cache() {
+            _aligned_free(_Cached);
+        }
+    };
+
+    thread_local _Scratch_cache _Parallel_thread_scratch;
+
+    unsigned int _Get_parallel_max_threads() noexcept {
+        // the tighter of the program's and the calling thread's thread limits; 0 means unlimited
+        const unsigned int _Max_threads        = _Parallel_max_threads.load(_STD memory_order_relaxed);
+        const unsigned int _Thread_max_threads = _Parallel_thread_hints._Max_threads;
+        if (_Max_threads == 0 || (_Thread_max_threads != 0 && _Thread_max_threads < _Max_threads)) {
+            return _Thread_max_threads;
+        }
+
+        return _Max_threads;
+    }
+
+    // TraceLogging events written while _STL_TRACE_PARALLEL_ALGORITHMS is 1 and an ETW session enables the provider.
+    // They're encoded by hand rather than with TraceLoggingProvider.h, and advapi32.dll is loaded on first use, so
+    // that programs which never trace don't depend on it.
+    constexpr UCHAR _Trace_level_info             = 4; // TRACE_LEVEL_INFORMATION; start, stop and serial fallback
+    constexpr UCHAR _Trace_level_verbose          = 5; // TRACE_LEVEL_VERBOSE; chunks and steals
+    constexpr UCHAR _Trace_opcode_start           = 1; // WINEVENT_OPCODE_START
+    constexpr UCHAR _Trace_opcode_stop            = 2; // WINEVENT_OPCODE_STOP
+    constexpr UCHAR _Trace_channel                = 11; // WINEVENT_CHANNEL_TRACELOGGING
+    constexpr ULONG _Trace_provider_metadata_type = 2; // EVENT_DATA_DESCRIPTOR_TYPE_PROVIDER_METADATA
+    constexpr ULONG _Trace_event_metadata_type    = 1; // EVENT_DATA_DESCRIPTOR_TYPE_EVENT_METADATA
+    constexpr int _Trace_set_traits               = 2; // EventProviderSetTraits
+
+    // Windows 8 and later
+    using _EventSetInformation_t = ULONG(WINAPI*)(REGHANDLE, int, PVOID, ULONG);
+
+    // "Microsoft.STL.ParallelAlgorithms"; this is the GUID the name hashes to, so tools can enable it by name too
+    constexpr GUID _Trace_provider_id = {0xe9707c1f, 0x0ada, 0x5ef8, {0x58, 0x7b, 0x49, 0xe2, 0xb6, 0x95, 0x38, 0x9d}};
+
+#pragma pack(push, 1)
+    template <size_t _Len>
+    struct _Trace_metadata { // a TraceLogging metadata blob: its size, then the _Len - 1 bytes of _Content
+        UINT16 _Size;
+        char _Content[_Len];
+    };
+#pragma pack(pop)
+
+    template <size_t _Len>
+    constexpr _Trace_metadata<_Len> _Make_trace_metadata(const char (&_Content)[_Len]) noexcept {
+        // the string literal's terminating null isn't part of the blob
+        _Trace_metadata<_Len> _Result{static_cast<UINT16>(sizeof(UINT16) + _Len - 1), {}};
+        for (size_t _Idx = 0; _Idx < _Len; ++_Idx) {
+            _Result._Content[_Idx] = _Content[_Idx];
+        }
+
+        return _Result;
+    }
+
+    // provider traits: the null-terminated provider name
+    constexpr auto _Trace_traits = _Make_trace_metadata("Microsoft.STL.ParallelAlgorithms\0");
+
+    // event metadata: a tags byte and the null-terminated event name, then each field's null-terminated name and
+    // input type (8 = UINT32, 10 = UINT64, 13 = BOOL32)
+    constexpr auto _Trace_algorithm_start = _Make_trace_metadata(
+        "\0AlgorithmStart\0Count\0\x0a" "Chunks\0\x0a" "Threads\0\x08" "WorkStealing\0\x0d");
+    constexpr auto _Trace_algorithm_stop  = _Make_trace_metadata(
+        "\0AlgorithmStop\0Participants\0\x0a" "Chunks\0\x0a" "MaxChunks\0\x0a" "Steals\0\x0a" "WaitMicroseconds\0\x0a");
+    constexpr auto _Trace_chunk           = _Make_trace_metadata("\0Chunk\0Microseconds\0\x0a");
+    constexpr auto _Trace_steal           = _Make_trace_metadata("\0Steal\0Count\0\x0a");
+    constexpr auto _Trace_serial_fallback = _Make_trace_metadata("\0SerialFallback\0");
+
+    struct _Trace_provider { // the registration of the provider, made on first use and undone at exit
+        decltype(&::EventRegister) _Register            = nullptr;
+        decltype(&::EventUnregister) _Unregister        = nullptr;
+        decltype(&::EventWriteTransfer) _Write_transfer = nullptr;
+        REGHANDLE _Handle                               = 0;
+        LONGLONG _Ticks_per_second                      = 1;
+        _STD atomic<UCHAR> _Level{0}; // the level an ETW session enabled; 0 while none does
+        _STD atomic<unsigned long long> _Next_activity{1};
+
+        _Trace_provider() noexcept {
+            LARGE_INTEGER _Frequency;
+            QueryPerformanceFrequency(&_Frequency);
+            _Ticks_per_second = _Frequency.QuadPart;
+
+            // the module stays loaded for the life of the process
+            const HMODULE _Advapi = LoadLibraryExW(L"advapi32.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32);
+            if (!_Advapi) {
+                return;
+            }
+
+            _Register = reinterpret_cast<decltype(&::EventRegister)>(GetProcAddress(_Advapi, "EventRegister"));
+            _Unregister =
+                reinterpret_cast<decltype(&::EventUnregister)>(GetProcAddress(_Advapi, "EventUnregister"));
+            _Write_transfer =
+                reinterpret_cast<decltype(&::EventWriteTransfer)>(GetProcAddress(_Advapi, "EventWriteTransfer"));
+            if (!_Register || !_Unregister || !_Write_transfer
+                || _Register(&_Trace_provider_id, &_Enable_callback, this, &_Handle) != ERROR_SUCCESS) {
+                _Handle = 0;
+                return;
+            }
+
+            // Windows 8 and later also want the traits at registration
+            const auto _Set_information =
+                reinterpret_cast<_EventSetInformation_t>(GetProcAddress(_Advapi, "EventSetInformation"));
+            if (_Set_information) {
+                (void) _Set_information(_Handle, _Trace_set_traits,
+                    const_cast<void*>(static_cast<const void*>(&_Trace_traits)), _Trace_traits._Size);
+            }
+        }
+
+        _Trace_provider(const _Trace_provider&) = delete;
+        _Trace_provider& operator=(const _Trace_provider&) = delete;
+
+        ~_Trace_provider() {
+            // ETW must not call _Enable_callback once this module is unloaded
+            if (_Handle != 0) {
+                _Unregister(_Handle);
+            }
+        }
+
+        static void NTAPI _Enable_callback(LPCGUID, const ULONG _Control_code, const UCHAR _Enabled_level, ULONGLONG,
+            ULONGLONG, PEVENT_FILTER_DESCRIPTOR, const PVOID _Context) noexcept {
+            const auto _This = static_cast<_Trace_provider*>(_Context);
+            if (_Control_code == EVENT_CONTROL_CODE_ENABLE_PROVIDER) { // level 0 enables all levels
+                _This->_Level.store(_Enabled_level == 0 ? UCHAR{0xFF} : _Enabled_level, _STD memory_order_relaxed);
+            } else if (_Control_code == EVENT_CONTROL_CODE_DISABLE_PROVIDER) {
+                _This->_Level.store(0, _STD memory_order_relaxed);
+            }
+        }
+
+        _NODISCARD bool _Enabled(const UCHAR _Event_level) const noexcept {
+            const UCHAR _Enabled_level = _Level.load(_STD memory_order_relaxed);
+            return _Enabled_level != 0 && _Event_level <= _Enabled_level;
+        }
+
+        _NODISCARD unsigned long long _Microseconds_since(const long long _Start) const noexcept {
+            LARGE_INTEGER _Now;
+            QueryPerformanceCounter(&_Now);
+            const auto _Ticks = static_cast<unsigned long long>(_Now.QuadPart - _Start);
+            const auto _Freq  = static_cast<unsigned long long>(_Ticks_per_second);
+            return _Ticks / _Freq * 1'000'000 + _Ticks % _Freq * 1'000'000 / _Freq;
+        }
+
+        template <size_t _Len, class... _Fields>
+        void _Write(const UCHAR _Event_level, const UCHAR _Opcode, const unsigned long long _Activity,
+            const _Trace_metadata<_Len>& _Event, const _Fields&... _Values) const noexcept {
+            // _Activity 0 means none; the others are made unique by the process ID
+            if (!_Enabled(_Event_level)) {
+                return;
+            }
+
+            EVENT_DESCRIPTOR _Descriptor{};
+            _Descriptor.Channel = _Trace_channel;
+            _Descriptor.Level   = _Event_level;
+            _Descriptor.Opcode  = _Opcode;
+
+            EVENT_DATA_DESCRIPTOR _Data[2 + sizeof...(_Fields)];
+            EventDataDescCreate(&_Data[0], &_Trace_traits, _Trace_traits._Size);
+            _Data[0].Reserved = _Trace_provider_metadata_type;
+            EventDataDescCreate(&_Data[1], &_Event, _Event._Size);
+            _Data[1].Reserved = _Trace_event_metadata_type;
+            ULONG _Count      = 2;
+            ((EventDataDescCreate(&_Data[_Count++], &_Values, sizeof(_Values))), ...);
+
+            GUID _Activity_id{GetCurrentProcessId(), 0, 0, {}};
+            for (size_t _Idx = 0; _Idx < 8; ++_Idx) {
+                _Activity_id.Data4[_Idx] = static_cast<UCHAR>(_Activity >> (_Idx * 8));
+            }
+
+            (void) _Write_transfer(
+                _Handle, &_Descriptor, _Activity == 0 ? nullptr : &_Activity_id, nullptr, _Count, _Data);
+        }
+    };
+
+    _NODISCARD _Trace_provider& _Get_trace_provider() noexcept {
+        static _Trace_provider _Provider;
+        return _Provider;
+    }
 } // unnamed namespace
 
 extern "C" {
 
-// TRANSITION, ABI
 _NODISCARD unsigned int __stdcall __std_parallel_algorithms_hw_threads() noexcept {
-    return _STD thread::hardware_concurrency();
+    // the number of threads the parallel algorithms divide their work for
+    const unsigned int _Hw_threads  = _STD thread::hardware_concurrency();
+    const unsigned int _Max_threads = _Get_parallel_max_threads();
+    if (_Max_threads != 0 && _Max_threads < _Hw_threads) {
+        return _Max_threads;
+    }
+
+    return _Hw_threads;
+}
+
+_NODISCARD unsigned int __stdcall __std_parallel_algorithms_numa_nodes() noexcept {
+    // the number of NUMA nodes the parallel algorithms spread their chunks over; 1 on non-NUMA machines
+    unsigned int _Nodes = _Parallel_numa_nodes.load(_STD memory_order_relaxed);
+    if (_Nodes == 0) {
+        ULONG _Highest_node;
+        if (GetNumaHighestNodeNumber(&_Highest_node)) {
+            _Nodes = static_cast<unsigned int>(_Highest_node) + 1;
+        } else {
+            _Nodes = 1;
+        }
+
+        _Parallel_numa_nodes.store(_Nodes, _STD memory_order_relaxed);
+    }
+
+    return _Nodes;
+}
+
+_NODISCARD unsigned int __stdcall __std_parallel_algorithms_current_numa_node() noexcept {
+    // the NUMA node of the processor the calling thread is running on, or 0 if that can't be determined
+#if _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7
+    PROCESSOR_NUMBER _Processor;
+    GetCurrentProcessorNumberEx(&_Processor);
+    USHORT _Node;
+    if (!GetNumaProcessorNodeEx(&_Processor, &_Node) || _Node == MAXUSHORT) {
+        return 0;
+    }
+#else // ^^^ _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7 ^^^ // vvv _STL_WIN32_WINNT < _WIN32_WINNT_WIN7 vvv
+    // without processor groups, only the processors of the calling thread's group can be mapped
+    UCHAR _Node;
+    if (!GetNumaProcessorNode(static_cast<UCHAR>(GetCurrentProcessorNumber()), &_Node) || _Node == MAXBYTE) {
+        return 0;
+    }
+#endif // _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7
+
+    return _Node;
+}
+
+void __stdcall __std_parallel_algorithms_set_environment(
+    PTP_CALLBACK_ENVIRON _Callback_environ, const unsigned int _Max_threads) noexcept {
+    _Parallel_callback_environ.store(_Callback_environ, _STD memory_order_relaxed);
+    _Parallel_max_threads.store(_Max_threads, _STD memory_order_relaxed);
+}
+
+void __stdcall __std_parallel_algorithms_exchange_hints(__std_parallel_hints* const _Hints) noexcept {
+    const __std_parallel_hints _Previous = _Parallel_thread_hints;
+    _Parallel_thread_hints               = *_Hints;
+    *_Hints                              = _Previous;
+}
+
+_NODISCARD size_t __stdcall __std_parallel_algorithms_grain() noexcept {
+    return _Parallel_thread_hints._Grain;
+}
+
+_NODISCARD void* __stdcall __std_parallel_algorithms_exchange_scratch_resource(void* const _Resource) noexcept {
+    void* const _Previous             = _Parallel_thread_scratch_resource;
+    _Parallel_thread_scratch_resource = _Resource;
+    return _Previous;
+}
+
+_NODISCARD void* __stdcall __std_parallel_algorithms_scratch_resource() noexcept {
+    return _Parallel_thread_scratch_resource;
+}
+
+_NODISCARD void* __stdcall __std_parallel_algorithms_scratch_allocate(size_t _Bytes, const size_t _Align) noexcept {
+    // returns nullptr on failure
+    auto& _Cache = _Parallel_thread_scratch;
+    if (_Cache._Cached && _Cache._Cached_bytes >= _Bytes && _Cache._Cached_bytes / 4 <= _Bytes
+        && _Cache._Cached_align >= _Align) { // reuse the cached block unless it would waste most of itself
+        _Cache._Lent       = _Cache._Cached;
+        _Cache._Lent_bytes = _Cache._Cached_bytes;
+        _Cache._Lent_align = _Cache._Cached_align;
+        _Cache._Cached     = nullptr;
+        return _Cache._Lent;
+    }
+
+    if (_Bytes == 0) {
+        _Bytes = 1;
+    }
+
+    return _aligned_malloc(_Bytes, _Align);
+}
+
+void __stdcall __std_parallel_algorithms_scratch_deallocate(void* const _Ptr, size_t _Bytes, size_t _Align) noexcept {
+    if (!_Ptr) {
+        return;
+    }
+
+    auto& _Cache = _Parallel_thread_scratch;
+    if (_Ptr == _Cache._Lent) { // recover the block's true size
+        _Bytes       = _Cache._Lent_bytes;
+        _Align       = _Cache._Lent_align;
+        _Cache._Lent = nullptr;
+    }
+
+    if (_Bytes > _Max_cached_scratch_bytes || (_Cache._Cached && _Bytes < _Cache._Cached_bytes)) {
+        _aligned_free(_Ptr);
+        return;
+    }
+
+    _aligned_free(_Cache._Cached);
+    _Cache._Cached       = _Ptr;
+    _Cache._Cached_bytes = _Bytes;
+    _Cache._Cached_align = _Align;
+}
+
+_NODISCARD bool __stdcall __std_parallel_algorithms_tracing() noexcept {
+    // registers the provider on first use
+    return _Get_trace_provider()._Enabled(_Trace_level_info);
+}
+
+_NODISCARD long long __stdcall __std_parallel_algorithms_trace_clock() noexcept {
+    LARGE_INTEGER _Now;
+    QueryPerformanceCounter(&_Now);
+    return _Now.QuadPart;
+}
+
+_NODISCARD unsigned long long __stdcall __std_parallel_algorithms_trace_start(
+    const size_t _Count, const size_t _Chunks, const bool _Work_stealing) noexcept {
+    // returns the activity that ties the algorithm's other events together
+    auto& _Provider             = _Get_trace_provider();
+    const auto _Activity        = _Provider._Next_activity.fetch_add(1, _STD memory_order_relaxed);
+    const ULONG _Threads        = __std_parallel_algorithms_hw_threads();
+    const BOOL _Stealing        = _Work_stealing;
+    const unsigned long long _N = _Count;
+    const unsigned long long _C = _Chunks;
+    _Provider._Write(_Trace_level_info, _Trace_opcode_start, _Activity, _Trace_algorithm_start, _N, _C, _Threads,
+        _Stealing);
+    return _Activity;
+}
+
+void __stdcall __std_parallel_algorithms_trace_stop(const unsigned long long _Activity, const size_t _Participants,
+    const size_t _Chunks, const size_t _Max_chunks, const size_t _Steals, const long long _Wait_start) noexcept {
+    // _Wait_start is when the calling thread ran out of chunks, or 0 if it never did
+    const auto& _Provider          = _Get_trace_provider();
+    const unsigned long long _Wait = _Wait_start == 0 ? 0 : _Provider._Microseconds_since(_Wait_start);
+    const unsigned long long _P    = _Participants;
+    const unsigned long long _C    = _Chunks;
+    const unsigned long long _Max  = _Max_chunks;
+    const unsigned long long _S    = _Steals;
+    _Provider._Write(
+        _Trace_level_info, _Trace_opcode_stop, _Activity, _Trace_algorithm_stop, _P, _C, _Max, _S, _Wait);
+}
+
+void __stdcall __std_parallel_algorithms_trace_chunk(
+    const unsigned long long _Activity, const long long _Start) noexcept {
+    const auto& _Provider = _Get_trace_provider();
+    if (_Provider._Enabled(_Trace_level_verbose)) {
+        const unsigned long long _Duration = _Provider._Microseconds_since(_Start);
+        _Provider._Write(_Trace_level_verbose, 0, _Activity, _Trace_chunk, _Duration);
+    }
+}
+
+void __stdcall __std_parallel_algorithms_trace_steal(const unsigned long long _Activity, const size_t _Count) noexcept {
+    const unsigned long long _N = _Count;
+    _Get_trace_provider()._Write(_Trace_level_verbose, 0, _Activity, _Trace_steal, _N);
+}
+
+void __stdcall __std_parallel_algorithms_trace_fallback() noexcept {
+    _Get_trace_provider()._Write(_Trace_level_info, 0, 0, _Trace_serial_fallback);
+}
+
+// The bulk copy and fill of <execution> hand each core a chunk of several megabytes, which nothing will read back
+// soon enough to find it still in the cache; streaming stores write it straight to memory, instead of first reading
+// every destination line into the cache and evicting the source to make room.
+void __stdcall __std_parallel_algorithms_copy_bytes(void* const _Dest, const void* const _Src, size_t _Bytes) noexcept {
+    auto _Out = static_cast<unsigned char*>(_Dest);
+    auto _In  = static_cast<const unsigned char*>(_Src);
+#if defined(_M_IX86) || defined(_M_X64)
+    const size_t _Head = (16 - reinterpret_cast<uintptr_t>(_Out) % 16) % 16; // bytes before the first aligned store
+    if (_Bytes >= _Head + 64) {
+        _CSTD memcpy(_Out, _In, _Head);
+        _Out += _Head;
+        _In += _Head;
+        _Bytes -= _Head;
+        for (; _Bytes >= 64; _Bytes -= 64, _Out += 64, _In += 64) {
+            const __m128i _Val0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_In));
+            const __m128i _Val1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_In + 16));
+            const __m128i _Val2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_In + 32));
+            const __m128i _Val3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_In + 48));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_Out), _Val0);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_Out + 16), _Val1);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_Out + 32), _Val2);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_Out + 48), _Val3);
+        }
+
+        _mm_sfence(); // streaming stores are weakly ordered; publish them before the chunk is reported done
+    }
+#endif // defined(_M_IX86) || defined(_M_X64)
+
+    _CSTD memcpy(_Out, _In, _Bytes);
+}
+
+void __stdcall __std_parallel_algorithms_fill_bytes(
+    void* const _Dest, const unsigned char _Val, size_t _Bytes) noexcept {
+    auto _Out = static_cast<unsigned char*>(_Dest);
+#if defined(_M_IX86) || defined(_M_X64)
+    const size_t _Head = (16 - reinterpret_cast<uintptr_t>(_Out) % 16) % 16; // bytes before the first aligned store
+    if (_Bytes >= _Head + 64) {
+        _CSTD memset(_Out, _Val, _Head);
+        _Out += _Head;
+        _Bytes -= _Head;
+        const __m128i _Pattern = _mm_set1_epi8(static_cast<char>(_Val));
+        for (; _Bytes >= 64; _Bytes -= 64, _Out += 64) {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_Out), _Pattern);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_Out + 16), _Pattern);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_Out + 32), _Pattern);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(_Out + 48), _Pattern);
+        }
+
+        _mm_sfence(); // as above
+    }
+#endif // defined(_M_IX86) || defined(_M_X64)
+
+    _CSTD memset(_Out, _Val, _Bytes);
 }
 
 _NODISCARD PTP_WORK __stdcall __std_create_threadpool_work(
     PTP_WORK_CALLBACK _Callback, void* _Context, PTP_CALLBACK_ENVIRON _Callback_environ) noexcept {
+    if (!_Callback_environ) { // the headers always pass nullptr; use the environment chosen by the program, if any
+        _Callback_environ = _Parallel_callback_environ.load(_STD memory_order_relaxed);
+    }
+
     return CreateThreadpoolWork(_Callback, _Context, _Callback_environ);
 }
 
@@ -37,7 +491,13 @@ void __stdcall __std_submit_threadpool_work(PTP_WORK _Work) noexcept {
     SubmitThreadpoolWork(_Work);
 }
 
-void __stdcall __std_bulk_submit_threadpool_work(PTP_WORK _Work, const size_t _Submissions) noexcept {
+void __stdcall __std_bulk_submit_threadpool_work(PTP_WORK _Work, size_t _Submissions) noexcept {
+    // each parallel algorithm submits its work once, and the calling thread takes part too
+    const unsigned int _Max_threads = _Get_parallel_max_threads();
+    if (_Max_threads != 0 && _Submissions >= _Max_threads) {
+        _Submissions = _Max_threads - 1;
+    }
+
     for (size_t _Idx = 0; _Idx < _Submissions; ++_Idx) {
         SubmitThreadpoolWork(_Work);
     }
@@ -51,6 +511,87 @@ void __stdcall __std_wait_for_threadpool_work_callbacks(PTP_WORK _Work, BOOL _Ca
     WaitForThreadpoolWorkCallbacks(_Work, _Cancel);
 }
 
+_NODISCARD PTP_IO __stdcall __std_create_threadpool_io(
+    HANDLE _Handle, PTP_WIN32_IO_CALLBACK _Callback, void* _Context, PTP_CALLBACK_ENVIRON _Callback_environ) noexcept {
+    // used by async_file.cpp; completions run in the program's chosen environment, as with threadpool work
+    if (!_Callback_environ) {
+        _Callback_environ = _Parallel_callback_environ.load(_STD memory_order_relaxed);
+    }
+
+    return CreateThreadpoolIo(_Handle, _Callback, _Context, _Callback_environ);
+}
+
+BOOL __stdcall __std_try_submit_threadpool_callback(PTP_SIMPLE_CALLBACK _Callback, void* _Context) noexcept {
+    // used by std::async; runs in the program's chosen environment, but not limited to its thread count
+    return TrySubmitThreadpoolCallback(
+        _Callback, _Context, _Parallel_callback_environ.load(_STD memory_order_relaxed));
+}
+
+_NODISCARD __std_thread_pool* __stdcall __std_thread_pool_create(
+    const unsigned int _Min_threads, unsigned int _Max_threads) noexcept {
+    // returns nullptr on failure; _Max_threads == 0 means thread::hardware_concurrency()
+    if (_Max_threads == 0) {
+        _Max_threads = _STD thread::hardware_concurrency();
+        if (_Max_threads == 0) {
+            _Max_threads = 1;
+        }
+    }
+
+    const auto _Result = static_cast<__std_thread_pool*>(_CSTD malloc(sizeof(__std_thread_pool)));
+    if (!_Result) {
+        return nullptr;
+    }
+
+    _Result->_Pool = CreateThreadpool(nullptr);
+    if (!_Result->_Pool) {
+        _CSTD free(_Result);
+        return nullptr;
+    }
+
+    SetThreadpoolThreadMaximum(_Result->_Pool, _Max_threads);
+    if (!SetThreadpoolThreadMinimum(_Result->_Pool, _Min_threads < _Max_threads ? _Min_threads : _Max_threads)) {
+        CloseThreadpool(_Result->_Pool);
+        _CSTD free(_Result);
+        return nullptr;
+    }
+
+    InitializeThreadpoolEnvironment(&_Result->_Callback_environ);
+    SetThreadpoolCallbackPool(&_Result->_Callback_environ, _Result->_Pool);
+    _Result->_Max_threads = _Max_threads;
+    return _Result;
+}
+
+void __stdcall __std_thread_pool_close(__std_thread_pool* const _Pool) noexcept {
+    // work still bound to the pool keeps it alive; if it is the program's chosen environment, the system thread pool
+    // takes its place
+    PTP_CALLBACK_ENVIRON _Expected = &_Pool->_Callback_environ;
+    if (_Parallel_callback_environ.compare_exchange_strong(_Expected, nullptr)) {
+        _Parallel_max_threads.store(0, _STD memory_order_relaxed);
+    }
+
+    DestroyThreadpoolEnvironment(&_Pool->_Callback_environ);
+    CloseThreadpool(_Pool->_Pool);
+    _CSTD free(_Pool);
+}
+
+_NODISCARD unsigned int __stdcall __std_thread_pool_max_threads(const __std_thread_pool* const _Pool) noexcept {
+    return _Pool->_Max_threads;
+}
+
+BOOL __stdcall __std_thread_pool_try_submit(
+    __std_thread_pool* const _Pool, PTP_SIMPLE_CALLBACK _Callback, void* _Context) noexcept {
+    return TrySubmitThreadpoolCallback(_Callback, _Context, &_Pool->_Callback_environ);
+}
+
+void __stdcall __std_thread_pool_make_default(__std_thread_pool* const _Pool) noexcept {
+    // nullptr selects the system thread pool
+    if (_Pool) {
+        __std_parallel_algorithms_set_environment(&_Pool->_Callback_environ, _Pool->_Max_threads);
+    } else {
+        __std_parallel_algorithms_set_environment(nullptr, 0);
+    }
+}
+
 void __stdcall __std_execution_wait_on_uchar(const volatile unsigned char* _Address, unsigned char _Compare) noexcept {
     __std_atomic_wait_direct(const_cast<const unsigned char*>(_Address), &_Compare, 1, _Atomic_wait_no_timeout);
 }
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// support for random_device
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <internal_shared.h>
+
+#include <Windows.h>
+#include <bcrypt.h>
+
+namespace {
+    using _BCryptGenRandom_t = decltype(&BCryptGenRandom);
+
+    // each thread keeps this many bytes of system randomness; larger requests bypass the pool
+    constexpr size_t _Pool_size = 256;
+
+    struct _Random_pool { // the unused tail of a block of system randomness
+        unsigned char _Bytes[_Pool_size];
+        size_t _Used = _Pool_size;
+
+        _Random_pool() = default;
+        _Random_pool(const _Random_pool&) = delete;
+        _Random_pool& operator=(const _Random_pool&) = delete;
+
+        ~_Random_pool() { // don't leave spent randomness behind in freed thread-local storage
+            SecureZeroMemory(_Bytes, sizeof(_Bytes));
+        }
+    };
+
+    thread_local _Random_pool _Thread_random_pool;
+
+    [[nodiscard]] _BCryptGenRandom_t _Load_bcrypt_gen_random() noexcept { // nullptr if bcrypt.dll is unavailable
+        const HMODULE _Bcrypt = LoadLibraryExW(L"bcrypt.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32);
+        if (!_Bcrypt) {
+            return nullptr;
+        }
+
+        // the module stays loaded for the life of the process
+        return reinterpret_cast<_BCryptGenRandom_t>(GetProcAddress(_Bcrypt, "BCryptGenRandom"));
+    }
+
+    [[nodiscard]] bool _Fill_from_system(unsigned char* _Dest, size_t _Size) noexcept {
+        static const _BCryptGenRandom_t _Gen_random = _Load_bcrypt_gen_random();
+        if (_Gen_random) {
+            while (_Size != 0) {
+                const ULONG _Chunk = static_cast<ULONG>(_Size < 0x8000'0000 ? _Size : 0x8000'0000);
+                if (!BCRYPT_SUCCESS(_Gen_random(nullptr, _Dest, _Chunk, BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
+                    return false;
+                }
+
+                _Dest += _Chunk;
+                _Size -= _Chunk;
+            }
+
+            return true;
+        }
+
+        while (_Size != 0) { // one 32-bit value at a time, as _Random_device() has always done
+            unsigned int _Val;
+            if (_CSTD rand_s(&_Val) != 0) {
+                return false;
+            }
+
+            const size_t _Chunk = _Size < sizeof(_Val) ? _Size : sizeof(_Val);
+            _CSTD memcpy(_Dest, &_Val, _Chunk);
+            _Dest += _Chunk;
+            _Size -= _Chunk;
+        }
+
+        return true;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+_NODISCARD int __stdcall __std_random_device_fill(void* const _Dest, size_t _Size) noexcept {
+    // returns 0 on failure, leaving the contents of _Dest unspecified
+    auto _Out = static_cast<unsigned char*>(_Dest);
+    if (_Size >= _Pool_size) {
+        return _Fill_from_system(_Out, _Size);
+    }
+
+    _Random_pool& _Pool = _Thread_random_pool;
+    for (;;) {
+        const size_t _Left  = _Pool_size - _Pool._Used;
+        const size_t _Chunk = _Size < _Left ? _Size : _Left;
+        _CSTD memcpy(_Out, _Pool._Bytes + _Pool._Used, _Chunk);
+        SecureZeroMemory(_Pool._Bytes + _Pool._Used, _Chunk); // each byte is handed out once
+        _Pool._Used += _Chunk;
+        _Out += _Chunk;
+        _Size -= _Chunk;
+        if (_Size == 0) {
+            return 1;
+        }
+
+        if (!_Fill_from_system(_Pool._Bytes, _Pool_size)) {
+            return 0;
+        }
+
+        _Pool._Used = 0;
+    }
+}
+
+} // extern "C"
@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// support for stdext::intern in <shared_string>
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <shared_string>
+
+#include <Windows.h>
+
+namespace {
+    using _STD _Shared_string_rep;
+
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure was padded due to alignment specifier
+    struct alignas(_STD hardware_destructive_interference_size) _Intern_shard {
+        // a chained hash table of interned representations, each holding at least one reference while it is linked
+        SRWLOCK _Lock                 = SRWLOCK_INIT;
+        _Shared_string_rep** _Buckets = nullptr;
+        size_t _Bucket_count          = 0; // 0 or a power of 2
+        size_t _Count                 = 0;
+
+        constexpr _Intern_shard() noexcept = default;
+    };
+#pragma warning(pop)
+
+    // shards spread out unrelated strings so that threads interning different keys seldom share a lock
+    constexpr size_t _Intern_shard_count_power = 6;
+    _Intern_shard _Intern_shards[size_t{1} << _Intern_shard_count_power];
+
+    constexpr size_t _Initial_bucket_count = 64;
+
+    [[nodiscard]] _Intern_shard& _Intern_shard_for(const size_t _Hash) noexcept {
+        // buckets are chosen by the low bits of the hash, so shards use the high ones
+        constexpr int _Shift = static_cast<int>(sizeof(size_t) * CHAR_BIT - _Intern_shard_count_power);
+        return _Intern_shards[_Hash >> _Shift];
+    }
+
+    void _Grow_buckets(_Intern_shard& _Shard) noexcept {
+        // doubles the bucket array; on allocation failure the chains just get longer
+        const size_t _New_count = _Shard._Bucket_count == 0 ? _Initial_bucket_count : _Shard._Bucket_count * 2;
+        const auto _New_buckets =
+            static_cast<_Shared_string_rep**>(_CSTD calloc(_New_count, sizeof(_Shared_string_rep*)));
+        if (!_New_buckets) {
+            return;
+        }
+
+        for (size_t _Idx = 0; _Idx < _Shard._Bucket_count; ++_Idx) {
+            auto _Rep = _Shard._Buckets[_Idx];
+            while (_Rep) {
+                const auto _Next     = _Rep->_Next_interned;
+                auto& _Head          = _New_buckets[_Rep->_Hash & (_New_count - 1)];
+                _Rep->_Next_interned = _Head;
+                _Head                = _Rep;
+                _Rep                 = _Next;
+            }
+        }
+
+        _CSTD free(_Shard._Buckets);
+        _Shard._Buckets      = _New_buckets;
+        _Shard._Bucket_count = _New_count;
+    }
+
+    [[nodiscard]] _Shared_string_rep* _Intern_locked(_Intern_shard& _Shard, const void* const _First,
+        const size_t _Count, const size_t _Elem_size, const size_t _Hash) noexcept {
+        const size_t _Bytes = _Count * _Elem_size;
+        if (_Shard._Bucket_count != 0) {
+            for (auto _Rep = _Shard._Buckets[_Hash & (_Shard._Bucket_count - 1)]; _Rep; _Rep = _Rep->_Next_interned) {
+                if (_Rep->_Hash == _Hash && _Rep->_Size == _Count && _Rep->_Elem_size == _Elem_size
+                    && _CSTD memcmp(_Rep + 1, _First, _Bytes) == 0) {
+                    // linked representations hold a reference until their last release takes this lock, so this
+                    // can't revive a dead one
+                    _Rep->_Refs.fetch_add(1, _STD memory_order_relaxed);
+                    return _Rep;
+                }
+            }
+        }
+
+        const auto _Rep =
+            static_cast<_Shared_string_rep*>(_CSTD malloc(sizeof(_Shared_string_rep) + _Bytes + _Elem_size));
+        if (!_Rep) {
+            return nullptr;
+        }
+
+        ::new (static_cast<void*>(&_Rep->_Refs)) _STD atomic<size_t>(1);
+        _Rep->_Hash      = _Hash;
+        _Rep->_Size      = _Count;
+        _Rep->_Elem_size = static_cast<unsigned char>(_Elem_size);
+        _Rep->_Interned  = true;
+        const auto _Data = reinterpret_cast<unsigned char*>(_Rep + 1);
+        _CSTD memcpy(_Data, _First, _Bytes);
+        _CSTD memset(_Data + _Bytes, 0, _Elem_size);
+
+        if (_Shard._Count >= _Shard._Bucket_count) {
+            _Grow_buckets(_Shard);
+            if (_Shard._Bucket_count == 0) {
+                _CSTD free(_Rep);
+                return nullptr;
+            }
+        }
+
+        auto& _Head          = _Shard._Buckets[_Hash & (_Shard._Bucket_count - 1)];
+        _Rep->_Next_interned = _Head;
+        _Head                = _Rep;
+        ++_Shard._Count;
+        return _Rep;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+[[nodiscard]] void* __stdcall __std_shared_string_intern(
+    const void* const _First, const size_t _Count, const size_t _Elem_size, const size_t _Hash) noexcept {
+    auto& _Shard = _Intern_shard_for(_Hash);
+    AcquireSRWLockExclusive(&_Shard._Lock);
+    const auto _Rep = _Intern_locked(_Shard, _First, _Count, _Elem_size, _Hash);
+    ReleaseSRWLockExclusive(&_Shard._Lock);
+    return _Rep;
+}
+
+void __stdcall __std_shared_string_release_interned(void* const _Ptr) noexcept {
+    const auto _Rep = static_cast<_Shared_string_rep*>(_Ptr);
+    auto& _Shard    = _Intern_shard_for(_Rep->_Hash);
+    AcquireSRWLockExclusive(&_Shard._Lock);
+    if (_Rep->_Refs.fetch_sub(1, _STD memory_order_acq_rel) != 1) { // another reference was handed out meanwhile
+        ReleaseSRWLockExclusive(&_Shard._Lock);
+        return;
+    }
+
+    auto _Link = &_Shard._Buckets[_Rep->_Hash & (_Shard._Bucket_count - 1)];
+    while (*_Link != _Rep) {
+        _Link = &(*_Link)->_Next_interned;
+    }
+
+    *_Link = _Rep->_Next_interned;
+    --_Shard._Count;
+    ReleaseSRWLockExclusive(&_Shard._Lock);
+    _CSTD free(_Rep);
+}
+} // extern "C"
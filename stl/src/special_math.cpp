@@ -25,6 +25,7 @@
 #include <boost/math/special_functions/ellint_2.hpp>
 #include <boost/math/special_functions/ellint_3.hpp>
 #include <boost/math/special_functions/expint.hpp>
+#include <boost/math/special_functions/factorials.hpp>
 #include <boost/math/special_functions/hermite.hpp>
 #include <boost/math/special_functions/laguerre.hpp>
 #include <boost/math/special_functions/legendre.hpp>
@@ -46,6 +47,59 @@ namespace {
         return _STD numeric_limits<_Ty>::quiet_NaN();
         _CATCH_END
     }
+
+    constexpr double _Max_fast_bessel_order = 50.0;
+    constexpr double _Max_fast_bessel_arg   = 50.0; // bounds the length of the recurrence, and keeps e^x finite
+
+    _NODISCARD bool _Is_fast_bessel_i(const double _Pnu, const double _Px) noexcept {
+        // integer orders from 2 to 50 at moderate arguments; Boost's minimax approximations already cover orders 0
+        // and 1, but other orders go through its general algorithm for real orders
+        return _Pnu >= 2.0 && _Pnu <= _Max_fast_bessel_order && _Pnu == _STD floor(_Pnu) && _Px >= 0.0
+            && _Px <= _Max_fast_bessel_arg;
+    }
+
+    _NODISCARD double _Bessel_in(const int _Order, const double _Px) noexcept { // for _Is_fast_bessel_i(_Order, _Px)
+        const double _Half = 0.5 * _Px;
+        const double _Sq   = _Half * _Half;
+        if (_Sq <= _Order + 1) {
+            // the power series (x/2)^n / n! * sum((x^2/4)^k / (k! (n+1)...(n+k))), whose terms are all positive and
+            // shrink at least as fast as 1 / k!
+            double _Term = 1.0;
+            double _Sum  = 1.0;
+            for (int _Kx = 1; _Term > _Sum * 0x1p-54; ++_Kx) {
+                _Term *= _Sq / (_Kx * static_cast<double>(_Kx + _Order));
+                _Sum += _Term;
+            }
+
+            return _STD pow(_Half, _Order) / ::boost::math::unchecked_factorial<double>(_Order) * _Sum;
+        }
+
+        // Miller's backward recurrence I_(j-1) = I_(j+1) + (2j / x) * I_j, started where I_j is negligible and
+        // normalized by e^x = I_0 + 2 * sum(I_k), so that every step adds positive terms
+        double _Next   = 0.0;
+        double _Cur    = 1.0;
+        double _Result = 0.0;
+        double _Sum    = 0.0;
+        for (int _Jx = _Order + static_cast<int>(_Px) + 20; _Jx > 0; --_Jx) {
+            // dividing each time, rather than multiplying by 2 / x, keeps that rounding from compounding
+            const double _Prev = _Next + (_Jx + _Jx) / _Px * _Cur;
+            _Next              = _Cur;
+            _Cur               = _Prev;
+            _Sum += _Next;
+            if (_Cur > 0x1p64) { // power-of-2 rescaling is exact
+                _Result *= 0x1p-64;
+                _Next *= 0x1p-64;
+                _Cur *= 0x1p-64;
+                _Sum *= 0x1p-64;
+            }
+
+            if (_Jx == _Order) {
+                _Result = _Next;
+            }
+        }
+
+        return _Result / (_Cur + 2.0 * _Sum) * _STD exp(_Px);
+    }
 } // unnamed namespace
 
 _EXTERN_C
@@ -164,6 +218,10 @@ _CRT_SATELLITE_2 _NODISCARD double __stdcall __std_smf_cyl_bessel_i(const double
         return _Px;
     }
 
+    if (_Is_fast_bessel_i(_Pnu, _Px)) {
+        return _Bessel_in(static_cast<int>(_Pnu), _Px);
+    }
+
     return _Boost_call([=] { return ::boost::math::cyl_bessel_i(_Pnu, _Px); });
 }
 
@@ -176,9 +234,27 @@ _CRT_SATELLITE_2 _NODISCARD float __stdcall __std_smf_cyl_bessel_if(const float
         return _Px;
     }
 
+    if (_Is_fast_bessel_i(_Pnu, _Px)) {
+        return static_cast<float>(_Bessel_in(static_cast<int>(_Pnu), _Px));
+    }
+
     return _Boost_call([=] { return ::boost::math::cyl_bessel_i(_Pnu, _Px); });
 }
 
+_CRT_SATELLITE_2 void __stdcall __std_smf_cyl_bessel_i_array(
+    const double _Pnu, const double* const _Px, double* const _Dest, const size_t _Count) noexcept {
+    for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+        _Dest[_Idx] = __std_smf_cyl_bessel_i(_Pnu, _Px[_Idx]);
+    }
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_cyl_bessel_if_array(
+    const float _Pnu, const float* const _Px, float* const _Dest, const size_t _Count) noexcept {
+    for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+        _Dest[_Idx] = __std_smf_cyl_bessel_if(_Pnu, _Px[_Idx]);
+    }
+}
+
 _CRT_SATELLITE_2 _NODISCARD double __stdcall __std_smf_cyl_bessel_j(const double _Pnu, const double _Px) noexcept {
     if (_STD isnan(_Pnu)) {
         return _Pnu;
@@ -349,6 +425,20 @@ _CRT_SATELLITE_2 _NODISCARD float __stdcall __std_smf_expintf(const float _Px) n
     return _Boost_call([=] { return ::boost::math::expint(_Px); });
 }
 
+_CRT_SATELLITE_2 void __stdcall __std_smf_expint_array(
+    const double* const _Px, double* const _Dest, const size_t _Count) noexcept {
+    for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+        _Dest[_Idx] = __std_smf_expint(_Px[_Idx]);
+    }
+}
+
+_CRT_SATELLITE_2 void __stdcall __std_smf_expintf_array(
+    const float* const _Px, float* const _Dest, const size_t _Count) noexcept {
+    for (size_t _Idx = 0; _Idx < _Count; ++_Idx) {
+        _Dest[_Idx] = __std_smf_expintf(_Px[_Idx]);
+    }
+}
+
 _CRT_SATELLITE_2 _NODISCARD double __stdcall __std_smf_hermite(const unsigned int _Pn, const double _Px) noexcept {
     if (_STD isnan(_Px)) {
         return _Px;
@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// _Lockit and mutex contention counters for stdext::sync_stats in <mutex>
+
+#include <cstdint>
+
+#include "sync_stats.hpp"
+
+namespace {
+    _STD atomic<bool> _Sync_stats_enabled{false};
+
+    constexpr int _Lockit_kinds = 8; // must match _Max_lock in xlock.cpp
+
+    static_assert(sizeof(stdext::sync_statistics::lockit) / sizeof(stdext::lock_statistics) == _Lockit_kinds,
+        "sync_statistics must have a lockit element for each _Lockit kind");
+
+    _Lock_counters _Lockit_counters[_Lockit_kinds];
+
+    // mutexes are told apart by address; once every slot is taken, further mutexes share _Mutex_overflow
+    constexpr size_t _Mutex_slot_count = 64;
+
+    struct _Mutex_slot {
+        _STD atomic<const void*> _Mutex{nullptr};
+        _Lock_counters _Counters;
+    };
+
+    _Mutex_slot _Mutex_slots[_Mutex_slot_count];
+    _Lock_counters _Mutex_overflow;
+
+    thread_local unsigned int _Mutex_acquisitions = 0;
+
+    [[nodiscard]] _Lock_counters& _Counters_for(const void* const _Mtx) noexcept {
+        auto _Index = reinterpret_cast<_STD uintptr_t>(_Mtx);
+        _Index ^= _Index >> 12;
+        for (size_t _Probe = 0; _Probe < _Mutex_slot_count; ++_Probe) {
+            auto& _Slot          = _Mutex_slots[(_Index + _Probe) % _Mutex_slot_count];
+            const void* _Current = _Slot._Mutex.load(_STD memory_order_relaxed);
+            if (_Current == nullptr
+                && _Slot._Mutex.compare_exchange_strong(_Current, _Mtx, _STD memory_order_relaxed)) {
+                return _Slot._Counters;
+            }
+
+            if (_Current == _Mtx) { // already ours, or another thread claimed it for _Mtx first
+                return _Slot._Counters;
+            }
+        }
+
+        return _Mutex_overflow;
+    }
+
+    void _Record_lockit(const int _Kind, const long long _Wait_start) noexcept {
+        _Lockit_counters[_Kind & (_Lockit_kinds - 1)]._Record(_Wait_start);
+    }
+
+    void _Record_lockit_timed(const int _Kind, const long long _Start) noexcept {
+        _Lockit_counters[_Kind & (_Lockit_kinds - 1)]._Record_timed(_Start);
+    }
+
+    [[nodiscard]] bool _Sample_mutex() noexcept {
+        return (++_Mutex_acquisitions & (stdext::mutex_stats_sample_period - 1)) == 0;
+    }
+
+    void _Record_mutex(const void* const _Mtx, const long long _Wait_start) noexcept {
+        _Counters_for(_Mtx)._Record(_Wait_start);
+    }
+
+    constexpr _Sync_stats_hooks _Hooks{
+        &_Sync_stats_enabled, _Record_lockit, _Record_lockit_timed, _Sample_mutex, _Record_mutex};
+
+#ifdef _BUILDING_SATELLITE_ATOMIC_WAIT
+    // constructing it tells msvcp where _Hooks are; see _Init_locks in xlock.cpp
+    _STD _Init_locks _Hooks_announcement;
+#endif // _BUILDING_SATELLITE_ATOMIC_WAIT
+} // unnamed namespace
+
+_EXTERN_C
+[[nodiscard]] const _Sync_stats_hooks* __stdcall __std_sync_stats_hooks() noexcept {
+    return &_Hooks;
+}
+
+void __stdcall __std_sync_stats_enable(const bool _Enable) noexcept {
+    if (_Enable) { // start over
+        for (auto& _Counters : _Lockit_counters) {
+            _Counters._Reset();
+        }
+
+        for (auto& _Slot : _Mutex_slots) {
+            _Slot._Mutex.store(nullptr, _STD memory_order_relaxed);
+            _Slot._Counters._Reset();
+        }
+
+        _Mutex_overflow._Reset();
+    }
+
+    _Sync_stats_enabled.store(_Enable, _STD memory_order_relaxed);
+}
+
+void __stdcall __std_sync_stats_lockit(stdext::lock_statistics* const _Stats) noexcept {
+    // _Stats has room for _Lockit_kinds elements
+    for (int _Kind = 0; _Kind < _Lockit_kinds; ++_Kind) {
+        _Stats[_Kind] = _Lockit_counters[_Kind]._Read();
+    }
+}
+
+size_t __stdcall __std_sync_stats_mutexes(stdext::mutex_statistics* const _Stats, const size_t _Count) noexcept {
+    // returns how many entries there are, of which the first _Count are stored
+    size_t _Found = 0;
+    for (const auto& _Slot : _Mutex_slots) {
+        const void* const _Mtx = _Slot._Mutex.load(_STD memory_order_relaxed);
+        if (_Mtx) {
+            if (_Found < _Count) {
+                _Stats[_Found] = {_Mtx, _Slot._Counters._Read()};
+            }
+
+            ++_Found;
+        }
+    }
+
+    const auto _Overflow = _Mutex_overflow._Read();
+    if (_Overflow.acquisitions != 0) {
+        if (_Found < _Count) {
+            _Stats[_Found] = {nullptr, _Overflow};
+        }
+
+        ++_Found;
+    }
+
+    return _Found;
+}
+_END_EXTERN_C
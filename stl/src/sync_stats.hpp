@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// lock contention counters behind stdext::sync_stats in <mutex>; while they're disabled, a lock only pays for two
+// relaxed loads to find that out
+
+#pragma once
+#ifndef _SYNC_STATS_HPP
+#define _SYNC_STATS_HPP
+#include <atomic>
+#include <mutex>
+
+#include <Windows.h>
+
+// acquisitions that took at least this long count as contended for locks that can't be tried first
+constexpr unsigned long long _Sync_stats_timed_threshold_ns = 1000;
+
+[[nodiscard]] inline long long _Sync_stats_now() noexcept {
+    LARGE_INTEGER _Now;
+    QueryPerformanceCounter(&_Now);
+    return _Now.QuadPart;
+}
+
+[[nodiscard]] inline unsigned long long _Sync_stats_nanoseconds_since(const long long _Start) noexcept {
+    static const auto _Ticks_per_second = [] {
+        LARGE_INTEGER _Frequency;
+        QueryPerformanceFrequency(&_Frequency);
+        return static_cast<unsigned long long>(_Frequency.QuadPart);
+    }();
+
+    const auto _Ticks = static_cast<unsigned long long>(_Sync_stats_now() - _Start);
+    return _Ticks / _Ticks_per_second * 1'000'000'000 + _Ticks % _Ticks_per_second * 1'000'000'000 / _Ticks_per_second;
+}
+
+struct _Lock_counters { // the acquisitions of one lock, or of a group of locks
+    _STD atomic<unsigned long long> _Acquisitions{0};
+    _STD atomic<unsigned long long> _Contended{0};
+    _STD atomic<unsigned long long> _Wait_nanoseconds{0};
+
+    void _Record(const long long _Wait_start) noexcept {
+        // _Wait_start is when a contended acquisition started to wait, or 0 for an uncontended one
+        _Acquisitions.fetch_add(1, _STD memory_order_relaxed);
+        if (_Wait_start != 0) {
+            _Contended.fetch_add(1, _STD memory_order_relaxed);
+            _Wait_nanoseconds.fetch_add(_Sync_stats_nanoseconds_since(_Wait_start), _STD memory_order_relaxed);
+        }
+    }
+
+    void _Record_timed(const long long _Start) noexcept {
+        // for locks that can't be tried: _Start is when the acquisition began
+        const unsigned long long _Elapsed = _Sync_stats_nanoseconds_since(_Start);
+        _Acquisitions.fetch_add(1, _STD memory_order_relaxed);
+        if (_Elapsed >= _Sync_stats_timed_threshold_ns) {
+            _Contended.fetch_add(1, _STD memory_order_relaxed);
+            _Wait_nanoseconds.fetch_add(_Elapsed, _STD memory_order_relaxed);
+        }
+    }
+
+    void _Reset() noexcept {
+        _Acquisitions.store(0, _STD memory_order_relaxed);
+        _Contended.store(0, _STD memory_order_relaxed);
+        _Wait_nanoseconds.store(0, _STD memory_order_relaxed);
+    }
+
+    [[nodiscard]] stdext::lock_statistics _Read() const noexcept {
+        return {_Acquisitions.load(_STD memory_order_relaxed), _Contended.load(_STD memory_order_relaxed),
+            _Wait_nanoseconds.load(_STD memory_order_relaxed)};
+    }
+};
+
+struct _Sync_stats_hooks { // the _Lockit and mutex counters, which live in sync_stats.cpp in the atomic wait satellite
+    const _STD atomic<bool>* _Enabled;
+    void (*_Lockit)(int _Kind, long long _Wait_start) noexcept;
+    void (*_Lockit_timed)(int _Kind, long long _Start) noexcept;
+    bool (*_Sample_mutex)() noexcept;
+    void (*_Mutex)(const void* _Mtx, long long _Wait_start) noexcept;
+};
+
+extern "C" [[nodiscard]] const _Sync_stats_hooks* __stdcall __std_sync_stats_hooks() noexcept;
+
+// msvcp can't import from the satellite, so _Lockit and _Mtx reach the counters through the hooks that the
+// _Init_locks constructor in xlock.cpp stores here once it finds them
+extern _STD atomic<const _Sync_stats_hooks*> _Sync_stats_found;
+
+[[nodiscard]] inline const _Sync_stats_hooks* _Sync_stats_if_enabled() noexcept {
+    const auto _Hooks = _Sync_stats_found.load(_STD memory_order_acquire);
+    if (_Hooks && _Hooks->_Enabled->load(_STD memory_order_relaxed)) {
+        return _Hooks;
+    }
+
+    return nullptr;
+}
+#endif // _SYNC_STATS_HPP
@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// support for <syncstream>
+
+// clang-format off
+
+#include <cstdint>
+#include <new>
+#include <Windows.h>
+
+// clang-format on
+
+namespace {
+#pragma warning(push)
+#pragma warning(disable : 4324) // structure was padded due to alignment specifier
+    struct alignas(_STD hardware_destructive_interference_size) _Syncstream_lock_entry {
+        SRWLOCK _Lock = SRWLOCK_INIT;
+
+        constexpr _Syncstream_lock_entry() noexcept = default;
+    };
+#pragma warning(pop)
+
+    // separate from the atomic mutex table so that a wrapped stream buffer may use atomics while emit() holds a lock
+    constexpr size_t _Syncstream_lock_table_size_power = 8;
+    _Syncstream_lock_entry _Syncstream_lock_table[size_t{1} << _Syncstream_lock_table_size_power];
+
+    [[nodiscard]] SRWLOCK& _Syncstream_lock_for(const void* const _Wrapped) noexcept {
+        auto _Index = reinterpret_cast<_STD uintptr_t>(_Wrapped);
+        _Index ^= _Index >> (_Syncstream_lock_table_size_power * 2);
+        _Index ^= _Index >> _Syncstream_lock_table_size_power;
+        return _Syncstream_lock_table[_Index & ((size_t{1} << _Syncstream_lock_table_size_power) - 1)]._Lock;
+    }
+} // unnamed namespace
+
+extern "C" {
+
+void __stdcall __std_syncstream_lock(const void* const _Wrapped) noexcept {
+    AcquireSRWLockExclusive(&_Syncstream_lock_for(_Wrapped));
+}
+
+void __stdcall __std_syncstream_unlock(const void* const _Wrapped) noexcept {
+    ReleaseSRWLockExclusive(&_Syncstream_lock_for(_Wrapped));
+}
+} // extern "C"
@@ -212,12 +212,33 @@ static constexpr _Sys_errtab_t _Sys_errtab[] = {
     {errc::wrong_protocol_type, "wrong protocol type"},
 };
 
-_CRTIMP2_PURE const char* __CLRCALL_PURE_OR_CDECL _Syserror_map(int _Errcode) { // convert to name of generic error
+static constexpr int _Sys_errtab_limit() noexcept { // one more than the largest errc in _Sys_errtab
+    int _Limit = 0;
     for (const auto& _Entry : _Sys_errtab) {
-        if (static_cast<int>(_Entry._Errcode) == _Errcode) {
-            return _Entry._Name;
+        if (static_cast<int>(_Entry._Errcode) >= _Limit) {
+            _Limit = static_cast<int>(_Entry._Errcode) + 1;
+        }
+    }
+
+    return _Limit;
+}
+
+struct _Sys_errtab_index_t { // the names of _Sys_errtab indexed by errc value, so lookups don't walk the table
+    const char* _Names[_Sys_errtab_limit()]{};
+
+    constexpr _Sys_errtab_index_t() noexcept {
+        for (const auto& _Entry : _Sys_errtab) {
+            _Names[static_cast<int>(_Entry._Errcode)] = _Entry._Name;
         }
     }
+};
+
+static constexpr _Sys_errtab_index_t _Sys_errtab_index;
+
+_CRTIMP2_PURE const char* __CLRCALL_PURE_OR_CDECL _Syserror_map(int _Errcode) { // convert to name of generic error
+    if (_Errcode >= 0 && _Errcode < _Sys_errtab_limit() && _Sys_errtab_index._Names[_Errcode]) {
+        return _Sys_errtab_index._Names[_Errcode];
+    }
 
     return "unknown error";
 }
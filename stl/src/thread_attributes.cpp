@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// support for stdext::thread_attributes in <thread>
+
+#include <cstddef>
+#include <internal_shared.h>
+
+#include <Windows.h>
+
+namespace {
+    using _SetThreadDescription_t = HRESULT(WINAPI*)(HANDLE, PCWSTR);
+
+    [[nodiscard]] _SetThreadDescription_t _Load_set_thread_description() noexcept {
+        // SetThreadDescription is available starting with Windows 10, version 1607
+        const HMODULE _Kernel32 = GetModuleHandleW(L"kernel32.dll");
+        if (!_Kernel32) {
+            return nullptr;
+        }
+
+        return reinterpret_cast<_SetThreadDescription_t>(GetProcAddress(_Kernel32, "SetThreadDescription"));
+    }
+} // unnamed namespace
+
+extern "C" {
+
+_NODISCARD int __stdcall __std_thread_set_attributes(void* const _Thread, const unsigned short _Group,
+    const size_t _Affinity_mask, const int _Priority, const wchar_t* const _Description) noexcept {
+    // applies the attributes to a thread that hasn't started running; returns 0 if the affinity or priority is
+    // rejected. The description is only a hint for debuggers, so systems without SetThreadDescription ignore it.
+    const HANDLE _Handle = static_cast<HANDLE>(_Thread);
+    if (_Affinity_mask != 0) {
+#if _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7
+        GROUP_AFFINITY _Affinity{};
+        _Affinity.Mask  = static_cast<KAFFINITY>(_Affinity_mask);
+        _Affinity.Group = _Group;
+        if (!SetThreadGroupAffinity(_Handle, &_Affinity, nullptr)) {
+            return 0;
+        }
+#else // ^^^ _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7 ^^^ // vvv _STL_WIN32_WINNT < _WIN32_WINNT_WIN7 vvv
+        // without processor groups, only the processors of group 0 can be selected
+        if (_Group != 0 || SetThreadAffinityMask(_Handle, static_cast<DWORD_PTR>(_Affinity_mask)) == 0) {
+            return 0;
+        }
+#endif // _STL_WIN32_WINNT >= _WIN32_WINNT_WIN7
+    }
+
+    if (_Priority != THREAD_PRIORITY_NORMAL && !SetThreadPriority(_Handle, _Priority)) {
+        return 0;
+    }
+
+    if (_Description) {
+        static const _SetThreadDescription_t _Set_description = _Load_set_thread_description();
+        if (_Set_description) {
+            (void) _Set_description(_Handle, _Description);
+        }
+    }
+
+    return 1;
+}
+
+void __stdcall __std_thread_resume(void* const _Thread) noexcept {
+    // starts a thread created with CREATE_SUSPENDED
+    (void) ResumeThread(static_cast<HANDLE>(_Thread));
+}
+} // extern "C"
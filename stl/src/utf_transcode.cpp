@@ -0,0 +1,334 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// UTF-8 <-> UTF-16 transcoding for <filesystem> and the UTF-8 codecvt facets
+
+// This must be as small as possible, because its contents are
+// injected into the msvcprt.lib and msvcprtd.lib import libraries.
+// Do not include or define anything else here.
+// In particular, basic_string must not be included here.
+
+#include <__msvc_utf_transcode_abi.hpp>
+
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_CEE_PURE)
+#define _UTF_TRANSCODE_VECTORIZED 1
+#include <emmintrin.h>
+#include <immintrin.h>
+#include <intrin0.h>
+#include <isa_availability.h>
+
+extern "C" long __isa_enabled;
+#else // ^^^ vectorized / scalar vvv
+#define _UTF_TRANSCODE_VECTORIZED 0
+#endif // ^^^ scalar ^^^
+
+// Runs of ASCII are converted 32 (AVX2) or 16 (SSE2) code units at a time; when a block isn't all ASCII, the
+// sequences in it are converted one at a time before the vector loop is retried. Measuring UTF-16 also counts blocks
+// without surrogates 8 code units at a time. Anything the scalar loops don't accept ends the conversion, so callers
+// can hand the rest to a more lenient (or error-reporting) converter.
+
+namespace {
+#if _UTF_TRANSCODE_VECTORIZED
+    bool _Use_avx2() noexcept {
+        return _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2) != 0;
+    }
+
+    bool _Use_sse2() noexcept {
+#ifdef _M_IX86
+        return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+        return true;
+#endif // _M_IX86
+    }
+#endif // _UTF_TRANSCODE_VECTORIZED
+
+    // returns the length of the well-formed UTF-8 sequence at _First, or 0 if there isn't a complete one
+    size_t _Decode_utf8(const unsigned char* const _First, const size_t _Available, char32_t& _Code_point) noexcept {
+        const unsigned int _Lead = _First[0];
+        unsigned int _Lower      = 0x80u; // the bounds of the second byte, which rule out overlong forms, surrogates,
+        unsigned int _Upper      = 0xBFu; // and values above U+10FFFF
+        size_t _Size;
+        if (_Lead < 0x80u) {
+            _Code_point = _Lead;
+            return 1;
+        } else if (_Lead < 0xC2u) { // trailing byte or overlong 2-byte sequence
+            return 0;
+        } else if (_Lead < 0xE0u) {
+            _Code_point = _Lead & 0x1Fu;
+            _Size       = 2;
+        } else if (_Lead < 0xF0u) {
+            if (_Lead == 0xE0u) {
+                _Lower = 0xA0u;
+            } else if (_Lead == 0xEDu) {
+                _Upper = 0x9Fu;
+            }
+
+            _Code_point = _Lead & 0x0Fu;
+            _Size       = 3;
+        } else if (_Lead < 0xF5u) {
+            if (_Lead == 0xF0u) {
+                _Lower = 0x90u;
+            } else if (_Lead == 0xF4u) {
+                _Upper = 0x8Fu;
+            }
+
+            _Code_point = _Lead & 0x07u;
+            _Size       = 4;
+        } else {
+            return 0;
+        }
+
+        if (_Available < _Size || _First[1] < _Lower || _First[1] > _Upper) {
+            return 0;
+        }
+
+        for (size_t _Idx = 1; _Idx < _Size; ++_Idx) {
+            const unsigned int _Trail = _First[_Idx];
+            if ((_Trail & 0xC0u) != 0x80u) {
+                return 0;
+            }
+
+            _Code_point = (_Code_point << 6) | (_Trail & 0x3Fu);
+        }
+
+        return _Size;
+    }
+
+    template <bool _Store>
+    __std_utf_transcode_result _Utf8_to_utf16(const unsigned char* const _Src, const size_t _Src_size,
+        char16_t* const _Dest, const size_t _Dest_size) noexcept {
+        size_t _Read    = 0;
+        size_t _Written = 0;
+        for (;;) {
+            size_t _Scalar_end = _Src_size;
+#if _UTF_TRANSCODE_VECTORIZED
+            if (_Src_size - _Read >= 32 && _Dest_size - _Written >= 32 && _Use_avx2()) {
+                do {
+                    const __m256i _Block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src + _Read));
+                    if (_mm256_movemask_epi8(_Block) != 0) {
+                        break;
+                    }
+
+                    if constexpr (_Store) {
+                        const auto _Out = reinterpret_cast<__m256i*>(_Dest + _Written);
+                        _mm256_storeu_si256(_Out, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(_Block)));
+                        _mm256_storeu_si256(_Out + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(_Block, 1)));
+                    }
+
+                    _Read += 32;
+                    _Written += 32;
+                } while (_Src_size - _Read >= 32 && _Dest_size - _Written >= 32);
+            }
+
+            if (_Src_size - _Read >= 16 && _Dest_size - _Written >= 16 && _Use_sse2()) {
+                const __m128i _Zero = _mm_setzero_si128();
+                do {
+                    const __m128i _Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Read));
+                    if (_mm_movemask_epi8(_Block) != 0) {
+                        // convert the sequences in this block one at a time
+                        _Scalar_end = _Read + 16;
+                        break;
+                    }
+
+                    if constexpr (_Store) {
+                        const auto _Out = reinterpret_cast<__m128i*>(_Dest + _Written);
+                        _mm_storeu_si128(_Out, _mm_unpacklo_epi8(_Block, _Zero));
+                        _mm_storeu_si128(_Out + 1, _mm_unpackhi_epi8(_Block, _Zero));
+                    }
+
+                    _Read += 16;
+                    _Written += 16;
+                } while (_Src_size - _Read >= 16 && _Dest_size - _Written >= 16);
+            }
+#endif // _UTF_TRANSCODE_VECTORIZED
+
+            while (_Read < _Scalar_end) {
+                char32_t _Code_point;
+                const size_t _Size = _Decode_utf8(_Src + _Read, _Src_size - _Read, _Code_point);
+                if (_Size == 0) {
+                    return {_Read, _Written};
+                }
+
+                if (_Code_point < 0x10000u) {
+                    if (_Dest_size == _Written) {
+                        return {_Read, _Written};
+                    }
+
+                    if constexpr (_Store) {
+                        _Dest[_Written] = static_cast<char16_t>(_Code_point);
+                    }
+
+                    ++_Written;
+                } else {
+                    if (_Dest_size - _Written < 2) {
+                        return {_Read, _Written};
+                    }
+
+                    if constexpr (_Store) {
+                        _Code_point -= 0x10000u;
+                        _Dest[_Written]     = static_cast<char16_t>(0xD800u | (_Code_point >> 10));
+                        _Dest[_Written + 1] = static_cast<char16_t>(0xDC00u | (_Code_point & 0x3FFu));
+                    }
+
+                    _Written += 2;
+                }
+
+                _Read += _Size;
+            }
+
+            if (_Read >= _Src_size) {
+                return {_Read, _Written};
+            }
+        }
+    }
+
+    template <bool _Store>
+    __std_utf_transcode_result _Utf16_to_utf8(const char16_t* const _Src, const size_t _Src_size,
+        unsigned char* const _Dest, const size_t _Dest_size) noexcept {
+        size_t _Read    = 0;
+        size_t _Written = 0;
+        for (;;) {
+            size_t _Scalar_end = _Src_size;
+#if _UTF_TRANSCODE_VECTORIZED
+            if constexpr (_Store) {
+                if (_Src_size - _Read >= 32 && _Dest_size - _Written >= 32 && _Use_avx2()) {
+                    const __m256i _Non_ascii = _mm256_set1_epi16(static_cast<short>(0xFF80));
+                    do {
+                        const auto _In      = reinterpret_cast<const __m256i*>(_Src + _Read);
+                        const __m256i _Low  = _mm256_loadu_si256(_In);
+                        const __m256i _High = _mm256_loadu_si256(_In + 1);
+                        if (!_mm256_testz_si256(_mm256_or_si256(_Low, _High), _Non_ascii)) {
+                            break;
+                        }
+
+                        // packus works within 128-bit lanes, leaving the quarters in the order 0, 2, 1, 3
+                        const __m256i _Packed = _mm256_packus_epi16(_Low, _High);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest + _Written),
+                            _mm256_permute4x64_epi64(_Packed, 0b11'01'10'00));
+                        _Read += 32;
+                        _Written += 32;
+                    } while (_Src_size - _Read >= 32 && _Dest_size - _Written >= 32);
+                }
+
+                if (_Src_size - _Read >= 16 && _Dest_size - _Written >= 16 && _Use_sse2()) {
+                    const __m128i _Non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+                    const __m128i _Zero      = _mm_setzero_si128();
+                    do {
+                        const auto _In      = reinterpret_cast<const __m128i*>(_Src + _Read);
+                        const __m128i _Low  = _mm_loadu_si128(_In);
+                        const __m128i _High = _mm_loadu_si128(_In + 1);
+                        const __m128i _Bits = _mm_and_si128(_mm_or_si128(_Low, _High), _Non_ascii);
+                        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_Bits, _Zero)) != 0xFFFF) {
+                            _Scalar_end = _Read + 16;
+                            break;
+                        }
+
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest + _Written), _mm_packus_epi16(_Low, _High));
+                        _Read += 16;
+                        _Written += 16;
+                    } while (_Src_size - _Read >= 16 && _Dest_size - _Written >= 16);
+                }
+            } else {
+                // without surrogates, a code unit takes 3 bytes, less one below U+0800 and another below U+0080
+                if (_Src_size - _Read >= 8 && _Use_sse2()) {
+                    const __m128i _Zero           = _mm_setzero_si128();
+                    const __m128i _Surrogate_mask = _mm_set1_epi16(static_cast<short>(0xF800));
+                    const __m128i _Surrogate_bits = _mm_set1_epi16(static_cast<short>(0xD800));
+                    const __m128i _Max_one_byte   = _mm_set1_epi16(0x7F);
+                    const __m128i _Max_two_bytes  = _mm_set1_epi16(0x7FF);
+                    do {
+                        const __m128i _Units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src + _Read));
+                        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_Units, _Surrogate_mask), _Surrogate_bits))
+                            != 0) {
+                            _Scalar_end = _Read + 8;
+                            break;
+                        }
+
+                        // each lane is 0, -1, or -2 (the number of thresholds it's below, negated)
+                        const __m128i _One_byte  = _mm_cmpeq_epi16(_mm_subs_epu16(_Units, _Max_one_byte), _Zero);
+                        const __m128i _Two_bytes = _mm_cmpeq_epi16(_mm_subs_epu16(_Units, _Max_two_bytes), _Zero);
+                        const __m128i _Below     = _mm_add_epi16(_One_byte, _Two_bytes);
+                        const __m128i _Sums = _mm_sad_epu8(_mm_sub_epi16(_Zero, _Below), _Zero);
+                        const auto _Saved   = static_cast<size_t>(_mm_cvtsi128_si32(_Sums))
+                                          + static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(_Sums, 8)));
+                        _Read += 8;
+                        _Written += 24 - _Saved;
+                    } while (_Src_size - _Read >= 8);
+                }
+            }
+#endif // _UTF_TRANSCODE_VECTORIZED
+
+            while (_Read < _Scalar_end) {
+                char32_t _Code_point = _Src[_Read];
+                size_t _Units        = 1;
+                if (_Code_point >= 0xD800u && _Code_point < 0xE000u) {
+                    if (_Code_point >= 0xDC00u || _Src_size - _Read < 2 || _Src[_Read + 1] < 0xDC00u
+                        || _Src[_Read + 1] >= 0xE000u) { // unpaired surrogate
+                        return {_Read, _Written};
+                    }
+
+                    _Code_point = 0x10000u + (((_Code_point & 0x3FFu) << 10) | (_Src[_Read + 1] & 0x3FFu));
+                    _Units      = 2;
+                }
+
+                size_t _Size;
+                if (_Code_point < 0x80u) {
+                    _Size = 1;
+                } else if (_Code_point < 0x800u) {
+                    _Size = 2;
+                } else if (_Code_point < 0x10000u) {
+                    _Size = 3;
+                } else {
+                    _Size = 4;
+                }
+
+                if (_Dest_size - _Written < _Size) {
+                    return {_Read, _Written};
+                }
+
+                if constexpr (_Store) {
+                    unsigned char* const _Out = _Dest + _Written;
+                    if (_Size == 1) {
+                        _Out[0] = static_cast<unsigned char>(_Code_point);
+                    } else {
+                        static constexpr unsigned char _Lead_bits[] = {0, 0, 0xC0u, 0xE0u, 0xF0u};
+                        for (size_t _Idx = _Size - 1; _Idx != 0; --_Idx) {
+                            _Out[_Idx] = static_cast<unsigned char>(0x80u | (_Code_point & 0x3Fu));
+                            _Code_point >>= 6;
+                        }
+
+                        _Out[0] = static_cast<unsigned char>(_Lead_bits[_Size] | _Code_point);
+                    }
+                }
+
+                _Read += _Units;
+                _Written += _Size;
+            }
+
+            if (_Read >= _Src_size) {
+                return {_Read, _Written};
+            }
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+[[nodiscard]] __std_utf_transcode_result __stdcall __std_utf8_to_utf16(
+    const char* const _Src, const size_t _Src_size, char16_t* const _Dest, const size_t _Dest_size) noexcept {
+    const auto _Bytes = reinterpret_cast<const unsigned char*>(_Src);
+    if (_Dest) {
+        return _Utf8_to_utf16<true>(_Bytes, _Src_size, _Dest, _Dest_size);
+    }
+
+    return _Utf8_to_utf16<false>(_Bytes, _Src_size, nullptr, static_cast<size_t>(-1));
+}
+
+[[nodiscard]] __std_utf_transcode_result __stdcall __std_utf16_to_utf8(
+    const char16_t* const _Src, const size_t _Src_size, char* const _Dest, const size_t _Dest_size) noexcept {
+    if (_Dest) {
+        return _Utf16_to_utf8<true>(_Src, _Src_size, reinterpret_cast<unsigned char*>(_Dest), _Dest_size);
+    }
+
+    return _Utf16_to_utf8<false>(_Src, _Src_size, nullptr, static_cast<size_t>(-1));
+}
+} // extern "C"
@@ -43,9 +43,27 @@ static void _Advance_bytes(const void*& _Target, ptrdiff_t _Offset) noexcept {
     _Target = static_cast<const unsigned char*>(_Target) + _Offset;
 }
 
+static __m512i _Reverse_lanes_avx512(const __m512i _Val) noexcept {
+    return _mm512_shuffle_i64x2(_Val, _Val, 27);
+}
+
 extern "C" {
 __declspec(noalias) void __cdecl __std_swap_ranges_trivially_swappable_noalias(
     void* _First1, void* _Last1, void* _First2) noexcept {
+    constexpr size_t _Mask_64 = ~((static_cast<size_t>(1) << 6) - 1);
+    if (_Byte_length(_First1, _Last1) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const void* _Stop_at = _First1;
+        _Advance_bytes(_Stop_at, _Byte_length(_First1, _Last1) & _Mask_64);
+        do {
+            const __m512i _Left  = _mm512_loadu_si512(_First1);
+            const __m512i _Right = _mm512_loadu_si512(_First2);
+            _mm512_storeu_si512(_First1, _Right);
+            _mm512_storeu_si512(_First2, _Left);
+            _Advance_bytes(_First1, 64);
+            _Advance_bytes(_First2, 64);
+        } while (_First1 != _Stop_at);
+    }
+
     constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
     if (_Byte_length(_First1, _Last1) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _First1;
@@ -127,6 +145,24 @@ void* __cdecl __std_swap_ranges_trivially_swappable(void* _First1, void* _Last1,
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_1(void* _First, void* _Last) noexcept {
+    if (_Byte_length(_First, _Last) >= 128 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        // vpshufb reverses the chars within each 128-bit lane, and vshufi64x2 reverses the lanes
+        const __m512i _Reverse_char_avx512 =
+            _mm512_broadcast_i32x4(_mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        const void* _Stop_at               = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 7 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Left           = _mm512_loadu_si512(_First);
+            const __m512i _Right          = _mm512_loadu_si512(_Last);
+            const __m512i _Left_reversed  = _Reverse_lanes_avx512(_mm512_shuffle_epi8(_Left, _Reverse_char_avx512));
+            const __m512i _Right_reversed = _Reverse_lanes_avx512(_mm512_shuffle_epi8(_Right, _Reverse_char_avx512));
+            _mm512_storeu_si512(_First, _Right_reversed);
+            _mm512_storeu_si512(_Last, _Left_reversed);
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+
     if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const __m256i _Reverse_char_lanes_avx = _mm256_set_epi8( //
             0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
@@ -167,6 +203,23 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_1(void* _Firs
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_2(void* _First, void* _Last) noexcept {
+    if (_Byte_length(_First, _Last) >= 128 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const __m512i _Reverse_short_avx512 =
+            _mm512_broadcast_i32x4(_mm_set_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+        const void* _Stop_at                = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 7 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Left           = _mm512_loadu_si512(_First);
+            const __m512i _Right          = _mm512_loadu_si512(_Last);
+            const __m512i _Left_reversed  = _Reverse_lanes_avx512(_mm512_shuffle_epi8(_Left, _Reverse_short_avx512));
+            const __m512i _Right_reversed = _Reverse_lanes_avx512(_mm512_shuffle_epi8(_Right, _Reverse_short_avx512));
+            _mm512_storeu_si512(_First, _Right_reversed);
+            _mm512_storeu_si512(_Last, _Left_reversed);
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+
     if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const __m256i _Reverse_short_lanes_avx = _mm256_set_epi8( //
             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, //
@@ -205,6 +258,22 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_2(void* _Firs
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_4(void* _First, void* _Last) noexcept {
+    if (_Byte_length(_First, _Last) >= 128 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const __m512i _Reverse_long_avx512 = _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        const void* _Stop_at               = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 7 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Left           = _mm512_loadu_si512(_First);
+            const __m512i _Right          = _mm512_loadu_si512(_Last);
+            const __m512i _Left_reversed  = _mm512_permutexvar_epi32(_Reverse_long_avx512, _Left);
+            const __m512i _Right_reversed = _mm512_permutexvar_epi32(_Reverse_long_avx512, _Right);
+            _mm512_storeu_si512(_First, _Right_reversed);
+            _mm512_storeu_si512(_Last, _Left_reversed);
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+
     if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _First;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 5);
@@ -243,6 +312,22 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_4(void* _Firs
 }
 
 __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_8(void* _First, void* _Last) noexcept {
+    if (_Byte_length(_First, _Last) >= 128 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const __m512i _Reverse_long_long_avx512 = _mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+        const void* _Stop_at                    = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 7 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Left           = _mm512_loadu_si512(_First);
+            const __m512i _Right          = _mm512_loadu_si512(_Last);
+            const __m512i _Left_reversed  = _mm512_permutexvar_epi64(_Reverse_long_long_avx512, _Left);
+            const __m512i _Right_reversed = _mm512_permutexvar_epi64(_Reverse_long_long_avx512, _Right);
+            _mm512_storeu_si512(_First, _Right_reversed);
+            _mm512_storeu_si512(_Last, _Left_reversed);
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+
     if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _First;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 5);
@@ -282,6 +367,21 @@ __declspec(noalias) void __cdecl __std_reverse_trivially_swappable_8(void* _Firs
 
 __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_1(
     const void* _First, const void* _Last, void* _Dest) noexcept {
+    if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        // vpshufb reverses the chars within each 128-bit lane, and vshufi64x2 reverses the lanes
+        const __m512i _Reverse_char_avx512 =
+            _mm512_broadcast_i32x4(_mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        const void* _Stop_at               = _Dest;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Block          = _mm512_loadu_si512(_Last);
+            const __m512i _Block_reversed = _Reverse_lanes_avx512(_mm512_shuffle_epi8(_Block, _Reverse_char_avx512));
+            _mm512_storeu_si512(_Dest, _Block_reversed);
+            _Advance_bytes(_Dest, 64);
+        } while (_Dest != _Stop_at);
+    }
+
     if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const __m256i _Reverse_char_lanes_avx = _mm256_set_epi8( //
             0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
@@ -316,6 +416,20 @@ __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_1(
 
 __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_2(
     const void* _First, const void* _Last, void* _Dest) noexcept {
+    if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const __m512i _Reverse_short_avx512 =
+            _mm512_broadcast_i32x4(_mm_set_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+        const void* _Stop_at                = _Dest;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Block          = _mm512_loadu_si512(_Last);
+            const __m512i _Block_reversed = _Reverse_lanes_avx512(_mm512_shuffle_epi8(_Block, _Reverse_short_avx512));
+            _mm512_storeu_si512(_Dest, _Block_reversed);
+            _Advance_bytes(_Dest, 64);
+        } while (_Dest != _Stop_at);
+    }
+
     if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const __m256i _Reverse_short_lanes_avx = _mm256_set_epi8( //
             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, //
@@ -350,6 +464,19 @@ __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_2(
 
 __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_4(
     const void* _First, const void* _Last, void* _Dest) noexcept {
+    if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const __m512i _Reverse_long_avx512 = _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        const void* _Stop_at               = _Dest;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Block          = _mm512_loadu_si512(_Last);
+            const __m512i _Block_reversed = _mm512_permutexvar_epi32(_Reverse_long_avx512, _Block);
+            _mm512_storeu_si512(_Dest, _Block_reversed);
+            _Advance_bytes(_Dest, 64);
+        } while (_Dest != _Stop_at);
+    }
+
     if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _Dest;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
@@ -384,6 +511,19 @@ __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_4(
 
 __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_8(
     const void* _First, const void* _Last, void* _Dest) noexcept {
+    if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const __m512i _Reverse_long_long_avx512 = _mm512_set_epi64(0, 1, 2, 3, 4, 5, 6, 7);
+        const void* _Stop_at                    = _Dest;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 6);
+        do {
+            _Advance_bytes(_Last, -64);
+            const __m512i _Block          = _mm512_loadu_si512(_Last);
+            const __m512i _Block_reversed = _mm512_permutexvar_epi64(_Reverse_long_long_avx512, _Block);
+            _mm512_storeu_si512(_Dest, _Block_reversed);
+            _Advance_bytes(_Dest, 64);
+        } while (_Dest != _Stop_at);
+    }
+
     if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
         const void* _Stop_at = _Dest;
         _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
@@ -416,7 +556,3640 @@ __declspec(noalias) void __cdecl __std_reverse_copy_trivially_copyable_8(
         static_cast<unsigned long long*>(_Dest));
 }
 
+} // extern "C"
+
+namespace {
+    struct _Find_traits_1 {
+        static __m256i _Set_avx(const unsigned char _Val) noexcept {
+            return _mm256_set1_epi8(static_cast<char>(_Val));
+        }
+
+        static __m128i _Set_sse(const unsigned char _Val) noexcept {
+            return _mm_set1_epi8(static_cast<char>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi8(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi8(_Lhs, _Rhs);
+        }
+
+        static bool _Sse_available() noexcept {
+#ifdef _M_IX86
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+            return true;
+#endif // _M_IX86
+        }
+    };
+
+    struct _Find_traits_2 {
+        static __m256i _Set_avx(const unsigned short _Val) noexcept {
+            return _mm256_set1_epi16(static_cast<short>(_Val));
+        }
+
+        static __m128i _Set_sse(const unsigned short _Val) noexcept {
+            return _mm_set1_epi16(static_cast<short>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi16(_Lhs, _Rhs);
+        }
+
+        static bool _Sse_available() noexcept {
+#ifdef _M_IX86
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+            return true;
+#endif // _M_IX86
+        }
+    };
+
+    struct _Find_traits_4 {
+        static __m256i _Set_avx(const unsigned long _Val) noexcept {
+            return _mm256_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m128i _Set_sse(const unsigned long _Val) noexcept {
+            return _mm_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi32(_Lhs, _Rhs);
+        }
+
+        static bool _Sse_available() noexcept {
+#ifdef _M_IX86
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+            return true;
+#endif // _M_IX86
+        }
+    };
+
+    struct _Find_traits_8 {
+        static __m256i _Set_avx(const unsigned long long _Val) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m128i _Set_sse(const unsigned long long _Val) noexcept {
+            return _mm_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpeq_epi64(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpeq_epi64(_Lhs, _Rhs); // SSE4.1
+        }
+
+        static bool _Sse_available() noexcept {
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42) != 0;
+        }
+    };
+
+    template <class _Traits, class _Ty>
+    const void* _Find_trivial(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Comparand = _Traits::_Set_avx(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & _Mask_32);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_First, static_cast<ptrdiff_t>(_Offset));
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+        if (_Byte_length(_First, _Last) >= 16 && _Traits::_Sse_available()) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & _Mask_16);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_First, static_cast<ptrdiff_t>(_Offset));
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        auto _Ptr = static_cast<const _Ty*>(_First);
+        while (_Ptr != _Last && *_Ptr != _Val) {
+            ++_Ptr;
+        }
+
+        return _Ptr;
+    }
+
+    template <class _Traits, class _Ty>
+    size_t _Count_trivial(const void* _First, const void* const _Last, const _Ty _Val) noexcept {
+        // _Result accumulates the number of matching bytes in the vectorized part, so it is divided by sizeof(_Ty)
+        // before the tail is counted; every processor that has AVX2 or SSE4.2 also has POPCNT
+        size_t _Result = 0;
+
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Comparand = _Traits::_Set_avx(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & _Mask_32);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+                _Result += _mm_popcnt_u32(static_cast<unsigned int>(_Bingo));
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+        if (_Byte_length(_First, _Last) >= 16 && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Val);
+            const void* _Stop_at     = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & _Mask_16);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+                _Result += _mm_popcnt_u32(static_cast<unsigned int>(_Bingo));
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        _Result /= sizeof(_Ty);
+
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr == _Val) {
+                ++_Result;
+            }
+        }
+
+        return _Result;
+    }
+} // unnamed namespace
+
+extern "C" {
+const void* __cdecl __std_find_trivial_1(
+    const void* const _First, const void* const _Last, const unsigned char _Val) noexcept {
+    return _Find_trivial<_Find_traits_1>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_find_trivial_2(
+    const void* const _First, const void* const _Last, const unsigned short _Val) noexcept {
+    return _Find_trivial<_Find_traits_2>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_find_trivial_4(
+    const void* const _First, const void* const _Last, const unsigned long _Val) noexcept {
+    return _Find_trivial<_Find_traits_4>(_First, _Last, _Val);
+}
+
+const void* __cdecl __std_find_trivial_8(
+    const void* const _First, const void* const _Last, const unsigned long long _Val) noexcept {
+    return _Find_trivial<_Find_traits_8>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_1(
+    const void* const _First, const void* const _Last, const unsigned char _Val) noexcept {
+    return _Count_trivial<_Find_traits_1>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_2(
+    const void* const _First, const void* const _Last, const unsigned short _Val) noexcept {
+    return _Count_trivial<_Find_traits_2>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_4(
+    const void* const _First, const void* const _Last, const unsigned long _Val) noexcept {
+    return _Count_trivial<_Find_traits_4>(_First, _Last, _Val);
+}
+
+__declspec(noalias) size_t __cdecl __std_count_trivial_8(
+    const void* const _First, const void* const _Last, const unsigned long long _Val) noexcept {
+    return _Count_trivial<_Find_traits_8>(_First, _Last, _Val);
+}
+
+struct _Min_max_element_t {
+    const void* _Min;
+    const void* _Max;
+};
+} // extern "C"
+
+namespace {
+    // The integer traits reuse the _Find_traits comparisons; the SSE min and max instructions for most element types
+    // arrived with SSE4.1, so the SSE paths of the reductions require SSE4.2 (which implies SSE4.1)
+    template <class _Find_traits>
+    struct _Minmax_traits_int : _Find_traits {
+        static constexpr bool _Has_unordered = false;
+
+        static bool _Sse_minmax_available() noexcept {
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42) != 0;
+        }
+    };
+
+    template <class _Ty>
+    struct _Minmax_traits;
+
+    template <>
+    struct _Minmax_traits<signed char> : _Minmax_traits_int<_Find_traits_1> {
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_min_epi8(_Lhs, _Rhs);
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_max_epi8(_Lhs, _Rhs);
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_min_epi8(_Lhs, _Rhs); // SSE4.1
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_max_epi8(_Lhs, _Rhs); // SSE4.1
+        }
+    };
+
+    template <>
+    struct _Minmax_traits<unsigned char> : _Minmax_traits_int<_Find_traits_1> {
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_min_epu8(_Lhs, _Rhs);
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_max_epu8(_Lhs, _Rhs);
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_min_epu8(_Lhs, _Rhs);
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_max_epu8(_Lhs, _Rhs);
+        }
+    };
+
+    template <>
+    struct _Minmax_traits<short> : _Minmax_traits_int<_Find_traits_2> {
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_min_epi16(_Lhs, _Rhs);
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_max_epi16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_min_epi16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_max_epi16(_Lhs, _Rhs);
+        }
+    };
+
+    template <>
+    struct _Minmax_traits<unsigned short> : _Minmax_traits_int<_Find_traits_2> {
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_min_epu16(_Lhs, _Rhs);
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_max_epu16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_min_epu16(_Lhs, _Rhs); // SSE4.1
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_max_epu16(_Lhs, _Rhs); // SSE4.1
+        }
+    };
+
+    template <>
+    struct _Minmax_traits<long> : _Minmax_traits_int<_Find_traits_4> {
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_min_epi32(_Lhs, _Rhs);
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_max_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_min_epi32(_Lhs, _Rhs); // SSE4.1
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_max_epi32(_Lhs, _Rhs); // SSE4.1
+        }
+    };
+
+    template <>
+    struct _Minmax_traits<unsigned long> : _Minmax_traits_int<_Find_traits_4> {
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_min_epu32(_Lhs, _Rhs);
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_max_epu32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_min_epu32(_Lhs, _Rhs); // SSE4.1
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_max_epu32(_Lhs, _Rhs); // SSE4.1
+        }
+    };
+
+    template <>
+    struct _Minmax_traits<long long> : _Minmax_traits_int<_Find_traits_8> {
+        // there are no 64-bit min and max instructions before AVX-512, so blend on the result of a comparison
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_blendv_epi8(_Lhs, _Rhs, _mm256_cmpgt_epi64(_Lhs, _Rhs));
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_blendv_epi8(_Lhs, _Rhs, _mm256_cmpgt_epi64(_Rhs, _Lhs));
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_blendv_epi8(_Lhs, _Rhs, _mm_cmpgt_epi64(_Lhs, _Rhs)); // SSE4.2
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_blendv_epi8(_Lhs, _Rhs, _mm_cmpgt_epi64(_Rhs, _Lhs)); // SSE4.2
+        }
+    };
+
+    template <>
+    struct _Minmax_traits<unsigned long long> : _Minmax_traits_int<_Find_traits_8> {
+        // flip the sign bits so that the signed comparison orders the values as unsigned
+        static __m256i _Greater_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            const __m256i _Sign = _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(_Lhs, _Sign), _mm256_xor_si256(_Rhs, _Sign));
+        }
+
+        static __m128i _Greater_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            const __m128i _Sign = _mm_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+            return _mm_cmpgt_epi64(_mm_xor_si128(_Lhs, _Sign), _mm_xor_si128(_Rhs, _Sign)); // SSE4.2
+        }
+
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_blendv_epi8(_Lhs, _Rhs, _Greater_avx(_Lhs, _Rhs));
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_blendv_epi8(_Lhs, _Rhs, _Greater_avx(_Rhs, _Lhs));
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_blendv_epi8(_Lhs, _Rhs, _Greater_sse(_Lhs, _Rhs));
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_blendv_epi8(_Lhs, _Rhs, _Greater_sse(_Rhs, _Lhs));
+        }
+    };
+
+    template <>
+    struct _Minmax_traits<float> {
+        // NaNs aren't ordered by less<>, so the reductions, whose results wouldn't match the scalar algorithms, report
+        // them instead
+        static constexpr bool _Has_unordered = true;
+
+        static __m256i _Set_avx(const float _Val) noexcept {
+            return _mm256_castps_si256(_mm256_set1_ps(_Val));
+        }
+
+        static __m128i _Set_sse(const float _Val) noexcept {
+            return _mm_castps_si128(_mm_set1_ps(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            // compares values, not bits, so that -0.0f and 0.0f are equal
+            return _mm256_castps_si256(
+                _mm256_cmp_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs), _CMP_EQ_OQ));
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+        }
+
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs)));
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(_Lhs), _mm256_castsi256_ps(_Rhs)));
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_castps_si128(_mm_min_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_castps_si128(_mm_max_ps(_mm_castsi128_ps(_Lhs), _mm_castsi128_ps(_Rhs)));
+        }
+
+        static __m256i _Unordered_avx(const __m256i _Data) noexcept {
+            const auto _Vals = _mm256_castsi256_ps(_Data);
+            return _mm256_castps_si256(_mm256_cmp_ps(_Vals, _Vals, _CMP_UNORD_Q));
+        }
+
+        static __m128i _Unordered_sse(const __m128i _Data) noexcept {
+            const auto _Vals = _mm_castsi128_ps(_Data);
+            return _mm_castps_si128(_mm_cmpunord_ps(_Vals, _Vals));
+        }
+
+        static bool _Sse_available() noexcept {
+#ifdef _M_IX86
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+            return true;
+#endif // _M_IX86
+        }
+
+        static bool _Sse_minmax_available() noexcept {
+            return _Sse_available();
+        }
+    };
+
+    template <>
+    struct _Minmax_traits<double> {
+        // NaNs aren't ordered by less<>, so the reductions, whose results wouldn't match the scalar algorithms, report
+        // them instead
+        static constexpr bool _Has_unordered = true;
+
+        static __m256i _Set_avx(const double _Val) noexcept {
+            return _mm256_castpd_si256(_mm256_set1_pd(_Val));
+        }
+
+        static __m128i _Set_sse(const double _Val) noexcept {
+            return _mm_castpd_si128(_mm_set1_pd(_Val));
+        }
+
+        static __m256i _Cmp_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            // compares values, not bits, so that -0.0 and 0.0 are equal
+            return _mm256_castpd_si256(
+                _mm256_cmp_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs), _CMP_EQ_OQ));
+        }
+
+        static __m128i _Cmp_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+        }
+
+        static __m256i _Min_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_castpd_si256(_mm256_min_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs)));
+        }
+
+        static __m256i _Max_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(_Lhs), _mm256_castsi256_pd(_Rhs)));
+        }
+
+        static __m128i _Min_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_castpd_si128(_mm_min_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+        }
+
+        static __m128i _Max_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_castpd_si128(_mm_max_pd(_mm_castsi128_pd(_Lhs), _mm_castsi128_pd(_Rhs)));
+        }
+
+        static __m256i _Unordered_avx(const __m256i _Data) noexcept {
+            const auto _Vals = _mm256_castsi256_pd(_Data);
+            return _mm256_castpd_si256(_mm256_cmp_pd(_Vals, _Vals, _CMP_UNORD_Q));
+        }
+
+        static __m128i _Unordered_sse(const __m128i _Data) noexcept {
+            const auto _Vals = _mm_castsi128_pd(_Data);
+            return _mm_castpd_si128(_mm_cmpunord_pd(_Vals, _Vals));
+        }
+
+        static bool _Sse_available() noexcept {
+#ifdef _M_IX86
+            return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+            return true;
+#endif // _M_IX86
+        }
+
+        static bool _Sse_minmax_available() noexcept {
+            return _Sse_available();
+        }
+    };
+
+    template <class _Ty, bool _Want_min, bool _Want_max>
+    bool _Minmax_values(const void* _First, const void* const _Last, _Ty& _Min_val, _Ty& _Max_val) noexcept {
+        // find the smallest and/or largest values in the nonempty range [_First, _Last); returns false, leaving the
+        // values unspecified, if the range contains a NaN
+        using _Traits = _Minmax_traits<_Ty>;
+        constexpr size_t _Lanes_avx = 32 / sizeof(_Ty);
+        constexpr size_t _Lanes_sse = 16 / sizeof(_Ty);
+
+        _Min_val = *static_cast<const _Ty*>(_First);
+        _Max_val = _Min_val;
+
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & _Mask_32);
+            __m256i _Cur_min   = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+            __m256i _Cur_max   = _Cur_min;
+            __m256i _Unordered = _mm256_setzero_si256();
+            if constexpr (_Traits::_Has_unordered) {
+                _Unordered = _Traits::_Unordered_avx(_Cur_min);
+            }
+
+            _Advance_bytes(_First, 32);
+            while (_First != _Stop_at) {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                if constexpr (_Want_min) {
+                    _Cur_min = _Traits::_Min_avx(_Cur_min, _Data);
+                }
+
+                if constexpr (_Want_max) {
+                    _Cur_max = _Traits::_Max_avx(_Cur_max, _Data);
+                }
+
+                if constexpr (_Traits::_Has_unordered) {
+                    _Unordered = _mm256_or_si256(_Unordered, _Traits::_Unordered_avx(_Data));
+                }
+
+                _Advance_bytes(_First, 32);
+            }
+
+            if (_mm256_movemask_epi8(_Unordered) != 0) {
+                return false;
+            }
+
+            _Ty _Lanes[_Lanes_avx];
+            if constexpr (_Want_min) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Lanes), _Cur_min);
+                for (size_t _Idx = 0; _Idx != _Lanes_avx; ++_Idx) {
+                    if (_Lanes[_Idx] < _Min_val) {
+                        _Min_val = _Lanes[_Idx];
+                    }
+                }
+            }
+
+            if constexpr (_Want_max) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Lanes), _Cur_max);
+                for (size_t _Idx = 0; _Idx != _Lanes_avx; ++_Idx) {
+                    if (_Max_val < _Lanes[_Idx]) {
+                        _Max_val = _Lanes[_Idx];
+                    }
+                }
+            }
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+        if (_Byte_length(_First, _Last) >= 16 && _Traits::_Sse_minmax_available()) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) & _Mask_16);
+            __m128i _Cur_min   = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+            __m128i _Cur_max   = _Cur_min;
+            __m128i _Unordered = _mm_setzero_si128();
+            if constexpr (_Traits::_Has_unordered) {
+                _Unordered = _Traits::_Unordered_sse(_Cur_min);
+            }
+
+            _Advance_bytes(_First, 16);
+            while (_First != _Stop_at) {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                if constexpr (_Want_min) {
+                    _Cur_min = _Traits::_Min_sse(_Cur_min, _Data);
+                }
+
+                if constexpr (_Want_max) {
+                    _Cur_max = _Traits::_Max_sse(_Cur_max, _Data);
+                }
+
+                if constexpr (_Traits::_Has_unordered) {
+                    _Unordered = _mm_or_si128(_Unordered, _Traits::_Unordered_sse(_Data));
+                }
+
+                _Advance_bytes(_First, 16);
+            }
+
+            if (_mm_movemask_epi8(_Unordered) != 0) {
+                return false;
+            }
+
+            _Ty _Lanes[_Lanes_sse];
+            if constexpr (_Want_min) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Lanes), _Cur_min);
+                for (size_t _Idx = 0; _Idx != _Lanes_sse; ++_Idx) {
+                    if (_Lanes[_Idx] < _Min_val) {
+                        _Min_val = _Lanes[_Idx];
+                    }
+                }
+            }
+
+            if constexpr (_Want_max) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Lanes), _Cur_max);
+                for (size_t _Idx = 0; _Idx != _Lanes_sse; ++_Idx) {
+                    if (_Max_val < _Lanes[_Idx]) {
+                        _Max_val = _Lanes[_Idx];
+                    }
+                }
+            }
+        }
+
+        for (auto _Ptr = static_cast<const _Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if constexpr (_Traits::_Has_unordered) {
+                if (*_Ptr != *_Ptr) {
+                    return false;
+                }
+            }
+
+            if (*_Ptr < _Min_val) {
+                _Min_val = *_Ptr;
+            }
+
+            if (_Max_val < *_Ptr) {
+                _Max_val = *_Ptr;
+            }
+        }
+
+        return true;
+    }
+
+    // the scalar algorithms of <algorithm>, for ranges whose NaNs make the vectorized results differ from them
+    template <class _Ty>
+    const void* _Min_element_scalar(const _Ty* _First, const _Ty* const _Last) noexcept {
+        const _Ty* _Found = _First;
+        while (++_First != _Last) {
+            if (*_First < *_Found) {
+                _Found = _First;
+            }
+        }
+
+        return _Found;
+    }
+
+    template <class _Ty>
+    const void* _Max_element_scalar(const _Ty* _First, const _Ty* const _Last) noexcept {
+        const _Ty* _Found = _First;
+        while (++_First != _Last) {
+            if (*_Found < *_First) {
+                _Found = _First;
+            }
+        }
+
+        return _Found;
+    }
+
+    template <class _Ty>
+    _Min_max_element_t _Minmax_element_scalar(const _Ty* _First, const _Ty* const _Last) noexcept {
+        const _Ty* _Found_min = _First;
+        const _Ty* _Found_max = _First;
+        while (++_First != _Last) { // process one or two elements
+            const _Ty* const _Next = _First + 1;
+            if (_Next == _Last) { // process last element
+                if (*_First < *_Found_min) {
+                    _Found_min = _First;
+                } else if (!(*_First < *_Found_max)) {
+                    _Found_max = _First;
+                }
+            } else { // process next two elements
+                if (*_Next < *_First) { // test _Next for new smallest
+                    if (*_Next < *_Found_min) {
+                        _Found_min = _Next;
+                    }
+                    if (!(*_First < *_Found_max)) {
+                        _Found_max = _First;
+                    }
+                } else { // test _First for new smallest
+                    if (*_First < *_Found_min) {
+                        _Found_min = _First;
+                    }
+                    if (!(*_Next < *_Found_max)) {
+                        _Found_max = _Next;
+                    }
+                }
+                _First = _Next;
+            }
+        }
+
+        return {_Found_min, _Found_max};
+    }
+
+    template <class _Traits, class _Ty>
+    const void* _Find_last_trivial(const void* const _First, const void* _Last, const _Ty _Val) noexcept {
+        // find the last element equal to _Val, or return _Last if there is none
+        const void* const _Real_last = _Last;
+
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Comparand = _Traits::_Set_avx(_Val);
+            const void* _Stop_at     = _Last;
+            _Advance_bytes(_Stop_at, -static_cast<ptrdiff_t>(_Byte_length(_First, _Last) & _Mask_32));
+            do {
+                _Advance_bytes(_Last, -32);
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_Last));
+                const int _Bingo    = _mm256_movemask_epi8(_Traits::_Cmp_avx(_Data, _Comparand));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanReverse(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_Last, static_cast<ptrdiff_t>(_Offset & ~(sizeof(_Ty) - 1)));
+                    return _Last;
+                }
+            } while (_Last != _Stop_at);
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+        if (_Byte_length(_First, _Last) >= 16 && _Traits::_Sse_available()) {
+            const __m128i _Comparand = _Traits::_Set_sse(_Val);
+            const void* _Stop_at     = _Last;
+            _Advance_bytes(_Stop_at, -static_cast<ptrdiff_t>(_Byte_length(_First, _Last) & _Mask_16));
+            do {
+                _Advance_bytes(_Last, -16);
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_Last));
+                const int _Bingo    = _mm_movemask_epi8(_Traits::_Cmp_sse(_Data, _Comparand));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanReverse(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_Last, static_cast<ptrdiff_t>(_Offset & ~(sizeof(_Ty) - 1)));
+                    return _Last;
+                }
+            } while (_Last != _Stop_at);
+        }
+
+        for (auto _Ptr = static_cast<const _Ty*>(_Last); _Ptr != _First;) {
+            if (*--_Ptr == _Val) {
+                return _Ptr;
+            }
+        }
+
+        return _Real_last;
+    }
+
+    template <class _Ty>
+    const void* _Min_element_impl(const void* const _First, const void* const _Last) noexcept {
+        // find the first smallest element: compute the smallest value, then search for it
+        if (_First == _Last) {
+            return _Last;
+        }
+
+        _Ty _Min_val;
+        _Ty _Max_val;
+        if (!_Minmax_values<_Ty, true, false>(_First, _Last, _Min_val, _Max_val)) {
+            return _Min_element_scalar(static_cast<const _Ty*>(_First), static_cast<const _Ty*>(_Last));
+        }
+
+        return _Find_trivial<_Minmax_traits<_Ty>>(_First, _Last, _Min_val);
+    }
+
+    template <class _Ty>
+    const void* _Max_element_impl(const void* const _First, const void* const _Last) noexcept {
+        // find the first largest element
+        if (_First == _Last) {
+            return _Last;
+        }
+
+        _Ty _Min_val;
+        _Ty _Max_val;
+        if (!_Minmax_values<_Ty, false, true>(_First, _Last, _Min_val, _Max_val)) {
+            return _Max_element_scalar(static_cast<const _Ty*>(_First), static_cast<const _Ty*>(_Last));
+        }
+
+        return _Find_trivial<_Minmax_traits<_Ty>>(_First, _Last, _Max_val);
+    }
+
+    template <class _Ty>
+    _Min_max_element_t _Minmax_element_impl(const void* const _First, const void* const _Last) noexcept {
+        // find the first smallest and the last largest elements, as minmax_element does
+        if (_First == _Last) {
+            return {_Last, _Last};
+        }
+
+        _Ty _Min_val;
+        _Ty _Max_val;
+        if (!_Minmax_values<_Ty, true, true>(_First, _Last, _Min_val, _Max_val)) {
+            return _Minmax_element_scalar(static_cast<const _Ty*>(_First), static_cast<const _Ty*>(_Last));
+        }
+
+        return {_Find_trivial<_Minmax_traits<_Ty>>(_First, _Last, _Min_val),
+            _Find_last_trivial<_Minmax_traits<_Ty>>(_First, _Last, _Max_val)};
+    }
+} // unnamed namespace
+
+extern "C" {
+const void* __cdecl __std_min_element_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Min_element_impl<signed char>(_First, _Last);
+    } else {
+        return _Min_element_impl<unsigned char>(_First, _Last);
+    }
+}
+
+const void* __cdecl __std_min_element_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Min_element_impl<short>(_First, _Last);
+    } else {
+        return _Min_element_impl<unsigned short>(_First, _Last);
+    }
+}
+
+const void* __cdecl __std_min_element_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Min_element_impl<long>(_First, _Last);
+    } else {
+        return _Min_element_impl<unsigned long>(_First, _Last);
+    }
+}
+
+const void* __cdecl __std_min_element_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Min_element_impl<long long>(_First, _Last);
+    } else {
+        return _Min_element_impl<unsigned long long>(_First, _Last);
+    }
+}
+
+const void* __cdecl __std_min_element_f(const void* const _First, const void* const _Last) noexcept {
+    return _Min_element_impl<float>(_First, _Last);
+}
+
+const void* __cdecl __std_min_element_d(const void* const _First, const void* const _Last) noexcept {
+    return _Min_element_impl<double>(_First, _Last);
+}
+
+const void* __cdecl __std_max_element_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Max_element_impl<signed char>(_First, _Last);
+    } else {
+        return _Max_element_impl<unsigned char>(_First, _Last);
+    }
+}
+
+const void* __cdecl __std_max_element_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Max_element_impl<short>(_First, _Last);
+    } else {
+        return _Max_element_impl<unsigned short>(_First, _Last);
+    }
+}
+
+const void* __cdecl __std_max_element_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Max_element_impl<long>(_First, _Last);
+    } else {
+        return _Max_element_impl<unsigned long>(_First, _Last);
+    }
+}
+
+const void* __cdecl __std_max_element_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Max_element_impl<long long>(_First, _Last);
+    } else {
+        return _Max_element_impl<unsigned long long>(_First, _Last);
+    }
+}
+
+const void* __cdecl __std_max_element_f(const void* const _First, const void* const _Last) noexcept {
+    return _Max_element_impl<float>(_First, _Last);
+}
+
+const void* __cdecl __std_max_element_d(const void* const _First, const void* const _Last) noexcept {
+    return _Max_element_impl<double>(_First, _Last);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Minmax_element_impl<signed char>(_First, _Last);
+    } else {
+        return _Minmax_element_impl<unsigned char>(_First, _Last);
+    }
+}
 
+_Min_max_element_t __cdecl __std_minmax_element_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Minmax_element_impl<short>(_First, _Last);
+    } else {
+        return _Minmax_element_impl<unsigned short>(_First, _Last);
+    }
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Minmax_element_impl<long>(_First, _Last);
+    } else {
+        return _Minmax_element_impl<unsigned long>(_First, _Last);
+    }
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    if (_Signed) {
+        return _Minmax_element_impl<long long>(_First, _Last);
+    } else {
+        return _Minmax_element_impl<unsigned long long>(_First, _Last);
+    }
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_f(const void* const _First, const void* const _Last) noexcept {
+    return _Minmax_element_impl<float>(_First, _Last);
+}
+
+_Min_max_element_t __cdecl __std_minmax_element_d(const void* const _First, const void* const _Last) noexcept {
+    return _Minmax_element_impl<double>(_First, _Last);
+}
+} // extern "C"
+
+namespace {
+    template <class _Ty>
+    size_t _Mismatch_impl(const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+        // returns the index of the first element at which the arrays differ, or _Count if they're equal;
+        // comparing bytes is enough because every element type using this is compared by its object representation
+        const size_t _Byte_count = _Count * sizeof(_Ty);
+        size_t _Result           = 0;
+
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Byte_count >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const size_t _Stop_at = _Byte_count & _Mask_32;
+            do {
+                const __m256i _Elem1 = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(static_cast<const unsigned char*>(_First1) + _Result));
+                const __m256i _Elem2 = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(static_cast<const unsigned char*>(_First2) + _Result));
+                const unsigned int _Bingo =
+                    ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_Elem1, _Elem2)));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return (_Result + _Offset) / sizeof(_Ty);
+                }
+
+                _Result += 32;
+            } while (_Result != _Stop_at);
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+#ifdef _M_IX86
+        const bool _Sse_available = _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+        constexpr bool _Sse_available = true;
+#endif // _M_IX86
+        if (_Byte_count - _Result >= 16 && _Sse_available) {
+            const size_t _Stop_at = _Result + ((_Byte_count - _Result) & _Mask_16);
+            do {
+                const __m128i _Elem1 = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(static_cast<const unsigned char*>(_First1) + _Result));
+                const __m128i _Elem2 = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(static_cast<const unsigned char*>(_First2) + _Result));
+                const unsigned int _Bingo =
+                    static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Elem1, _Elem2))) ^ 0xFFFFu;
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return (_Result + _Offset) / sizeof(_Ty);
+                }
+
+                _Result += 16;
+            } while (_Result != _Stop_at);
+        }
+
+        _Result /= sizeof(_Ty);
+
+        const auto _Ptr1 = static_cast<const _Ty*>(_First1);
+        const auto _Ptr2 = static_cast<const _Ty*>(_First2);
+        while (_Result != _Count && _Ptr1[_Result] == _Ptr2[_Result]) {
+            ++_Result;
+        }
+
+        return _Result;
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) size_t __cdecl __std_mismatch_1(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Mismatch_impl<unsigned char>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __cdecl __std_mismatch_2(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Mismatch_impl<unsigned short>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __cdecl __std_mismatch_4(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Mismatch_impl<unsigned long>(_First1, _First2, _Count);
+}
+
+__declspec(noalias) size_t __cdecl __std_mismatch_8(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Mismatch_impl<unsigned long long>(_First1, _First2, _Count);
+}
+} // extern "C"
+
+namespace {
+    template <class _Traits, class _Ty>
+    const void* _Find_first_of_broadcast(const void* _First1, const void* const _Last1, const _Ty* const _First2,
+        const _Ty* const _Last2) noexcept {
+        // compares each block of the haystack against every needle element in turn, so it is meant for small needles
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Byte_length(_First1, _Last1) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Byte_length(_First1, _Last1) & _Mask_32);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First1));
+                __m256i _Eq         = _mm256_setzero_si256();
+                for (auto _Ptr = _First2; _Ptr != _Last2; ++_Ptr) {
+                    _Eq = _mm256_or_si256(_Eq, _Traits::_Cmp_avx(_Data, _Traits::_Set_avx(*_Ptr)));
+                }
+
+                const int _Bingo = _mm256_movemask_epi8(_Eq);
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_First1, static_cast<ptrdiff_t>(_Offset));
+                    return _First1;
+                }
+
+                _Advance_bytes(_First1, 32);
+            } while (_First1 != _Stop_at);
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+        if (_Byte_length(_First1, _Last1) >= 16 && _Traits::_Sse_available()) {
+            const void* _Stop_at = _First1;
+            _Advance_bytes(_Stop_at, _Byte_length(_First1, _Last1) & _Mask_16);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First1));
+                __m128i _Eq         = _mm_setzero_si128();
+                for (auto _Ptr = _First2; _Ptr != _Last2; ++_Ptr) {
+                    _Eq = _mm_or_si128(_Eq, _Traits::_Cmp_sse(_Data, _Traits::_Set_sse(*_Ptr)));
+                }
+
+                const int _Bingo = _mm_movemask_epi8(_Eq);
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_First1, static_cast<ptrdiff_t>(_Offset));
+                    return _First1;
+                }
+
+                _Advance_bytes(_First1, 16);
+            } while (_First1 != _Stop_at);
+        }
+
+        auto _Ptr1 = static_cast<const _Ty*>(_First1);
+        for (; _Ptr1 != _Last1; ++_Ptr1) {
+            for (auto _Ptr2 = _First2; _Ptr2 != _Last2; ++_Ptr2) {
+                if (*_Ptr1 == *_Ptr2) {
+                    return _Ptr1;
+                }
+            }
+        }
+
+        return _Ptr1;
+    }
+
+    __m128i _Load_partial_sse(const void* const _Src, const size_t _Size_bytes) noexcept {
+        // loads _Size_bytes < 16 bytes without reading past the end of the source
+        alignas(16) unsigned char _Buf[16] = {};
+        for (size_t _Idx = 0; _Idx != _Size_bytes; ++_Idx) {
+            _Buf[_Idx] = static_cast<const unsigned char*>(_Src)[_Idx];
+        }
+
+        return _mm_load_si128(reinterpret_cast<const __m128i*>(_Buf));
+    }
+
+    template <class _Ty>
+    const void* _Find_first_of_sse42(const void* _First1, const void* const _Last1, const void* const _First2,
+        const void* const _Last2) noexcept {
+        // pcmpestri matches a block of the haystack against a block of up to 16 bytes of the needle
+        constexpr int _Op =
+            (sizeof(_Ty) == 1 ? _SIDD_UBYTE_OPS : _SIDD_UWORD_OPS) | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT;
+        constexpr int _Part_size_el = static_cast<int>(16 / sizeof(_Ty));
+
+        const size_t _Needle_length = _Byte_length(_First2, _Last2);
+        const bool _Single_part     = _Needle_length <= 16;
+        const __m128i _Needle_first = _Single_part ? _Load_partial_sse(_First2, _Needle_length)
+                                                   : _mm_loadu_si128(static_cast<const __m128i*>(_First2));
+
+        for (;;) {
+            const size_t _Hay_length = _Byte_length(_First1, _Last1);
+            if (_Hay_length == 0) {
+                return _First1;
+            }
+
+            const bool _Full_block = _Hay_length >= 16;
+            const __m128i _Data    = _Full_block ? _mm_loadu_si128(static_cast<const __m128i*>(_First1))
+                                                 : _Load_partial_sse(_First1, _Hay_length);
+            const int _Data_size   = _Full_block ? _Part_size_el : static_cast<int>(_Hay_length / sizeof(_Ty));
+
+            int _Found;
+            if (_Single_part) {
+                _Found = _mm_cmpestri(
+                    _Needle_first, static_cast<int>(_Needle_length / sizeof(_Ty)), _Data, _Data_size, _Op);
+            } else {
+                _Found = _mm_cmpestri(_Needle_first, _Part_size_el, _Data, _Data_size, _Op);
+
+                const void* _Needle_part = _First2;
+                _Advance_bytes(_Needle_part, 16);
+                // there is no point in looking for matches after the best one so far
+                while (_Found != 0 && _Needle_part != _Last2) {
+                    const size_t _Part_length = _Byte_length(_Needle_part, _Last2);
+                    int _Part_found;
+                    if (_Part_length >= 16) {
+                        const __m128i _Part = _mm_loadu_si128(static_cast<const __m128i*>(_Needle_part));
+                        _Part_found         = _mm_cmpestri(_Part, _Part_size_el, _Data, _Data_size, _Op);
+                        _Advance_bytes(_Needle_part, 16);
+                    } else {
+                        const __m128i _Part = _Load_partial_sse(_Needle_part, _Part_length);
+                        _Part_found         = _mm_cmpestri(
+                            _Part, static_cast<int>(_Part_length / sizeof(_Ty)), _Data, _Data_size, _Op);
+                        _Needle_part = _Last2;
+                    }
+
+                    if (_Part_found < _Found) {
+                        _Found = _Part_found;
+                    }
+                }
+            }
+
+            if (_Found < _Data_size) {
+                _Advance_bytes(_First1, static_cast<ptrdiff_t>(_Found) * static_cast<ptrdiff_t>(sizeof(_Ty)));
+                return _First1;
+            }
+
+            _Advance_bytes(_First1, _Data_size * static_cast<ptrdiff_t>(sizeof(_Ty)));
+        }
+    }
+
+    // The ASCII bitmap has one bit for each of the characters [0, 128), in a layout suitable for pshufb lookup:
+    // character _Ch is bit (_Ch >> 4) of byte (_Ch & 0xF). Characters outside [0, 128) are never members.
+    struct _Ascii_bitmap {
+        unsigned char _Rows[16];
+
+        _Ascii_bitmap(const void* const _Needle, const size_t _Needle_size, const size_t _Elem_size) noexcept
+            : _Rows() {
+            const auto _Bytes = static_cast<const unsigned char*>(_Needle);
+            for (size_t _Idx = 0; _Idx != _Needle_size; ++_Idx) {
+                // the caller guarantees that the needle is ASCII, so the low byte of every element is the character
+                const unsigned char _Ch = _Bytes[_Idx * _Elem_size];
+                _Rows[_Ch & 0xF] |= static_cast<unsigned char>(1 << (_Ch >> 4));
+            }
+        }
+
+        template <class _Ty>
+        bool _Test(const _Ty _Ch) const noexcept {
+            return _Ch < 128 && ((_Rows[_Ch & 0xF] >> (_Ch >> 4)) & 1) != 0;
+        }
+
+        __m128i _Load() const noexcept {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Rows));
+        }
+    };
+
+    template <class _Ty>
+    __m128i _Load_as_bytes_sse(const void* const _Src) noexcept {
+        // loads 16 elements, saturated to bytes; every element above 0xFF becomes 0xFF, which is not ASCII
+        if constexpr (sizeof(_Ty) == 1) {
+            return _mm_loadu_si128(static_cast<const __m128i*>(_Src));
+        } else if constexpr (sizeof(_Ty) == 2) {
+            const auto _Ptr     = static_cast<const __m128i*>(_Src);
+            const __m128i _Max  = _mm_set1_epi16(0xFF);
+            const __m128i _Val0 = _mm_min_epu16(_mm_loadu_si128(_Ptr), _Max);
+            const __m128i _Val1 = _mm_min_epu16(_mm_loadu_si128(_Ptr + 1), _Max);
+            return _mm_packus_epi16(_Val0, _Val1);
+        } else {
+            const auto _Ptr     = static_cast<const __m128i*>(_Src);
+            const __m128i _Max  = _mm_set1_epi32(0xFF);
+            const __m128i _Val0 = _mm_min_epu32(_mm_loadu_si128(_Ptr), _Max);
+            const __m128i _Val1 = _mm_min_epu32(_mm_loadu_si128(_Ptr + 1), _Max);
+            const __m128i _Val2 = _mm_min_epu32(_mm_loadu_si128(_Ptr + 2), _Max);
+            const __m128i _Val3 = _mm_min_epu32(_mm_loadu_si128(_Ptr + 3), _Max);
+            return _mm_packus_epi16(_mm_packus_epi32(_Val0, _Val1), _mm_packus_epi32(_Val2, _Val3));
+        }
+    }
+
+    int _Ascii_members_sse(const __m128i _Bitmap, const __m128i _Bytes) noexcept {
+        // returns a mask with bit i set when byte i is a member of _Bitmap
+        const __m128i _Bit_select = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i _Nibble     = _mm_set1_epi8(0xF);
+        const __m128i _Row        = _mm_shuffle_epi8(_Bitmap, _mm_and_si128(_Bytes, _Nibble));
+        const __m128i _Bit = _mm_shuffle_epi8(_Bit_select, _mm_and_si128(_mm_srli_epi16(_Bytes, 4), _Nibble));
+        const __m128i _Absent = _mm_cmpeq_epi8(_mm_and_si128(_Row, _Bit), _mm_setzero_si128());
+        return _mm_movemask_epi8(_Absent) ^ 0xFFFF;
+    }
+
+    template <class _Ty>
+    const void* _Find_first_of_ascii(const void* _First, const void* const _Last, const void* const _Needle,
+        const size_t _Needle_size, const bool _Member) noexcept {
+        // find the first element whose membership in the ASCII needle set is _Member, or return _Last
+        const _Ascii_bitmap _Bitmap(_Needle, _Needle_size, sizeof(_Ty));
+
+        constexpr size_t _Block_size = 16 * sizeof(_Ty);
+        if (_Byte_length(_First, _Last) >= _Block_size && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+            const __m128i _Rows  = _Bitmap._Load();
+            const int _Flip      = _Member ? 0 : 0xFFFF;
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, static_cast<ptrdiff_t>(_Byte_length(_First, _Last) / _Block_size * _Block_size));
+            do {
+                const int _Bingo = _Ascii_members_sse(_Rows, _Load_as_bytes_sse<_Ty>(_First)) ^ _Flip;
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_First, static_cast<ptrdiff_t>(_Offset * sizeof(_Ty)));
+                    return _First;
+                }
+
+                _Advance_bytes(_First, _Block_size);
+            } while (_First != _Stop_at);
+        }
+
+        auto _Ptr = static_cast<const _Ty*>(_First);
+        while (_Ptr != _Last && _Bitmap._Test(*_Ptr) != _Member) {
+            ++_Ptr;
+        }
+
+        return _Ptr;
+    }
+
+    template <class _Ty>
+    const void* _Find_last_of_ascii(const void* const _First, const void* _Last, const void* const _Needle,
+        const size_t _Needle_size, const bool _Member) noexcept {
+        // find the last element whose membership in the ASCII needle set is _Member, or return _Last if there is none
+        const void* const _Real_last = _Last;
+        const _Ascii_bitmap _Bitmap(_Needle, _Needle_size, sizeof(_Ty));
+
+        constexpr size_t _Block_size = 16 * sizeof(_Ty);
+        if (_Byte_length(_First, _Last) >= _Block_size && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+            const __m128i _Rows  = _Bitmap._Load();
+            const int _Flip      = _Member ? 0 : 0xFFFF;
+            const void* _Stop_at = _Last;
+            _Advance_bytes(_Stop_at, -static_cast<ptrdiff_t>(_Byte_length(_First, _Last) / _Block_size * _Block_size));
+            do {
+                _Advance_bytes(_Last, -static_cast<ptrdiff_t>(_Block_size));
+                const int _Bingo = _Ascii_members_sse(_Rows, _Load_as_bytes_sse<_Ty>(_Last)) ^ _Flip;
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanReverse(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_Last, static_cast<ptrdiff_t>(_Offset * sizeof(_Ty)));
+                    return _Last;
+                }
+            } while (_Last != _Stop_at);
+        }
+
+        auto _Ptr = static_cast<const _Ty*>(_Last);
+        while (_Ptr != _First) {
+            --_Ptr;
+            if (_Bitmap._Test(*_Ptr) == _Member) {
+                return _Ptr;
+            }
+        }
+
+        return _Real_last;
+    }
+} // unnamed namespace
+
+extern "C" {
+const void* __cdecl __std_find_first_of_trivial_1(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    if (_bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+        return _Find_first_of_sse42<unsigned char>(_First1, _Last1, _First2, _Last2);
+    }
+
+    return _Find_first_of_broadcast<_Find_traits_1>(_First1, _Last1, static_cast<const unsigned char*>(_First2),
+        static_cast<const unsigned char*>(_Last2));
+}
+
+const void* __cdecl __std_find_first_of_trivial_2(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    if (_bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42)) {
+        return _Find_first_of_sse42<unsigned short>(_First1, _Last1, _First2, _Last2);
+    }
+
+    return _Find_first_of_broadcast<_Find_traits_2>(_First1, _Last1, static_cast<const unsigned short*>(_First2),
+        static_cast<const unsigned short*>(_Last2));
+}
+
+const void* __cdecl __std_find_first_of_trivial_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Find_first_of_broadcast<_Find_traits_4>(_First1, _Last1, static_cast<const unsigned long*>(_First2),
+        static_cast<const unsigned long*>(_Last2));
+}
+
+const void* __cdecl __std_find_first_of_trivial_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Find_first_of_broadcast<_Find_traits_8>(_First1, _Last1,
+        static_cast<const unsigned long long*>(_First2), static_cast<const unsigned long long*>(_Last2));
+}
+
+const void* __cdecl __std_find_first_of_ascii_1(const void* const _First, const void* const _Last,
+    const void* const _Needle, const size_t _Needle_size, const bool _Member) noexcept {
+    return _Find_first_of_ascii<unsigned char>(_First, _Last, _Needle, _Needle_size, _Member);
+}
+
+const void* __cdecl __std_find_first_of_ascii_2(const void* const _First, const void* const _Last,
+    const void* const _Needle, const size_t _Needle_size, const bool _Member) noexcept {
+    return _Find_first_of_ascii<unsigned short>(_First, _Last, _Needle, _Needle_size, _Member);
+}
+
+const void* __cdecl __std_find_first_of_ascii_4(const void* const _First, const void* const _Last,
+    const void* const _Needle, const size_t _Needle_size, const bool _Member) noexcept {
+    return _Find_first_of_ascii<unsigned long>(_First, _Last, _Needle, _Needle_size, _Member);
+}
+
+const void* __cdecl __std_find_last_of_ascii_1(const void* const _First, const void* const _Last,
+    const void* const _Needle, const size_t _Needle_size, const bool _Member) noexcept {
+    return _Find_last_of_ascii<unsigned char>(_First, _Last, _Needle, _Needle_size, _Member);
+}
+
+const void* __cdecl __std_find_last_of_ascii_2(const void* const _First, const void* const _Last,
+    const void* const _Needle, const size_t _Needle_size, const bool _Member) noexcept {
+    return _Find_last_of_ascii<unsigned short>(_First, _Last, _Needle, _Needle_size, _Member);
+}
+
+const void* __cdecl __std_find_last_of_ascii_4(const void* const _First, const void* const _Last,
+    const void* const _Needle, const size_t _Needle_size, const bool _Member) noexcept {
+    return _Find_last_of_ascii<unsigned long>(_First, _Last, _Needle, _Needle_size, _Member);
+}
+} // extern "C"
+
+namespace {
+    template <class _Traits, class _Ty>
+    const void* _Search_impl(const void* const _First1, const void* const _Last1, const void* const _First2,
+        const void* const _Last2) noexcept {
+        // looks for blocks of candidate positions where both the first and the last needle elements match, then
+        // verifies the elements between them; this avoids the worst cases of testing every first element match
+        const size_t _Hay_size    = _Byte_length(_First1, _Last1) / sizeof(_Ty);
+        const size_t _Needle_size = _Byte_length(_First2, _Last2) / sizeof(_Ty);
+        if (_Needle_size == 0) {
+            return _First1;
+        }
+
+        if (_Needle_size > _Hay_size) {
+            return _Last1;
+        }
+
+        const auto _Hay           = static_cast<const _Ty*>(_First1);
+        const auto _Needle        = static_cast<const _Ty*>(_First2);
+        const _Ty _Needle_first   = _Needle[0];
+        const _Ty _Needle_last    = _Needle[_Needle_size - 1];
+        const size_t _Mid_size    = _Needle_size < 2 ? 0 : _Needle_size - 2;
+        const size_t _Possible    = _Hay_size - _Needle_size + 1; // number of candidate positions
+        const size_t _Last_offset = _Needle_size - 1;
+        size_t _Pos               = 0;
+
+        // _Bingo has sizeof(_Ty) bits for each candidate position of the block starting at _Pos
+        const auto _Check_candidates = [&](unsigned int _Bingo) noexcept -> const _Ty* {
+            while (_Bingo != 0) {
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, _Bingo);
+                const size_t _Candidate = _Pos + _Offset / sizeof(_Ty);
+                if (_Mismatch_impl<_Ty>(_Hay + _Candidate + 1, _Needle + 1, _Mid_size) == _Mid_size) {
+                    return _Hay + _Candidate;
+                }
+
+                _Bingo &= ~(((1U << sizeof(_Ty)) - 1) << (_Offset & ~(sizeof(_Ty) - 1)));
+            }
+
+            return nullptr;
+        };
+
+        constexpr size_t _Avx_block = 32 / sizeof(_Ty);
+        if (_Possible >= _Avx_block && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _First_val = _Traits::_Set_avx(_Needle_first);
+            const __m256i _Last_val  = _Traits::_Set_avx(_Needle_last);
+            do {
+                const __m256i _Data_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Hay + _Pos));
+                const __m256i _Data_last =
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Hay + _Pos + _Last_offset));
+                const __m256i _Eq = _mm256_and_si256(
+                    _Traits::_Cmp_avx(_Data_first, _First_val), _Traits::_Cmp_avx(_Data_last, _Last_val));
+                const auto _Found = _Check_candidates(static_cast<unsigned int>(_mm256_movemask_epi8(_Eq)));
+                if (_Found) {
+                    return _Found;
+                }
+
+                _Pos += _Avx_block;
+            } while (_Possible - _Pos >= _Avx_block);
+        }
+
+        constexpr size_t _Sse_block = 16 / sizeof(_Ty);
+        if (_Possible - _Pos >= _Sse_block && _Traits::_Sse_available()) {
+            const __m128i _First_val = _Traits::_Set_sse(_Needle_first);
+            const __m128i _Last_val  = _Traits::_Set_sse(_Needle_last);
+            do {
+                const __m128i _Data_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Hay + _Pos));
+                const __m128i _Data_last =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Hay + _Pos + _Last_offset));
+                const __m128i _Eq =
+                    _mm_and_si128(_Traits::_Cmp_sse(_Data_first, _First_val), _Traits::_Cmp_sse(_Data_last, _Last_val));
+                const auto _Found = _Check_candidates(static_cast<unsigned int>(_mm_movemask_epi8(_Eq)));
+                if (_Found) {
+                    return _Found;
+                }
+
+                _Pos += _Sse_block;
+            } while (_Possible - _Pos >= _Sse_block);
+        }
+
+        for (; _Pos != _Possible; ++_Pos) {
+            if (_Hay[_Pos] == _Needle_first && _Hay[_Pos + _Last_offset] == _Needle_last
+                && _Mismatch_impl<_Ty>(_Hay + _Pos + 1, _Needle + 1, _Mid_size) == _Mid_size) {
+                return _Hay + _Pos;
+            }
+        }
+
+        return _Last1;
+    }
+} // unnamed namespace
+
+extern "C" {
+const void* __cdecl __std_search_1(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Search_impl<_Find_traits_1, unsigned char>(_First1, _Last1, _First2, _Last2);
+}
+
+const void* __cdecl __std_search_2(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Search_impl<_Find_traits_2, unsigned short>(_First1, _Last1, _First2, _Last2);
+}
+
+const void* __cdecl __std_search_4(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Search_impl<_Find_traits_4, unsigned long>(_First1, _Last1, _First2, _Last2);
+}
+
+const void* __cdecl __std_search_8(
+    const void* const _First1, const void* const _Last1, const void* const _First2, const void* const _Last2) noexcept {
+    return _Search_impl<_Find_traits_8, unsigned long long>(_First1, _Last1, _First2, _Last2);
+}
+} // extern "C"
+
+namespace {
+    // For each mask of kept elements, the vpermd indices that move the kept elements to the front, lowest first.
+    // The 8-byte table moves pairs of 32-bit lanes.
+    struct _Remove_tables {
+        unsigned char _Shuf_4[256][8];
+        unsigned char _Shuf_8[16][8];
+
+        constexpr _Remove_tables() noexcept : _Shuf_4(), _Shuf_8() {
+            for (unsigned int _Mask = 0; _Mask != 256; ++_Mask) {
+                unsigned int _Out = 0;
+                for (unsigned int _Lane = 0; _Lane != 8; ++_Lane) {
+                    if ((_Mask & (1U << _Lane)) != 0) {
+                        _Shuf_4[_Mask][_Out++] = static_cast<unsigned char>(_Lane);
+                    }
+                }
+            }
+
+            for (unsigned int _Mask = 0; _Mask != 16; ++_Mask) {
+                unsigned int _Out = 0;
+                for (unsigned int _Lane = 0; _Lane != 4; ++_Lane) {
+                    if ((_Mask & (1U << _Lane)) != 0) {
+                        _Shuf_8[_Mask][_Out++] = static_cast<unsigned char>(_Lane * 2);
+                        _Shuf_8[_Mask][_Out++] = static_cast<unsigned char>(_Lane * 2 + 1);
+                    }
+                }
+            }
+        }
+    };
+
+    constexpr _Remove_tables _Remove_tables_v;
+
+    struct _Remove_traits_4 {
+        static constexpr size_t _Per_block = 8;
+
+        static unsigned int _Mask(const __m256i _Eq) noexcept {
+            return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_Eq)));
+        }
+
+        static __m256i _Pack(const __m256i _Data, const unsigned int _Keep) noexcept {
+            const __m256i _Shuf = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Remove_tables_v._Shuf_4[_Keep])));
+            return _mm256_permutevar8x32_epi32(_Data, _Shuf);
+        }
+
+        static __m256i _Replace_first(const __m256i _Data, const unsigned long _Val) noexcept {
+            return _mm256_blend_epi32(_Data, _mm256_set1_epi32(static_cast<int>(_Val)), 0x01);
+        }
+    };
+
+    struct _Remove_traits_8 {
+        static constexpr size_t _Per_block = 4;
+
+        static unsigned int _Mask(const __m256i _Eq) noexcept {
+            return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(_Eq)));
+        }
+
+        static __m256i _Pack(const __m256i _Data, const unsigned int _Keep) noexcept {
+            const __m256i _Shuf = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Remove_tables_v._Shuf_8[_Keep])));
+            return _mm256_permutevar8x32_epi32(_Data, _Shuf);
+        }
+
+        static __m256i _Replace_first(const __m256i _Data, const unsigned long long _Val) noexcept {
+            return _mm256_blend_epi32(_Data, _mm256_set1_epi64x(static_cast<long long>(_Val)), 0x03);
+        }
+    };
+
+    template <class _Traits, class _Find_traits, class _Ty>
+    void* _Remove_impl(void* const _First, void* const _Last, const _Ty _Val) noexcept {
+        // compacts the elements not equal to _Val to the front, returning the new end; each block is stored whole
+        // at the output position, which never passes the end of the block that was just loaded
+        auto _Src           = static_cast<_Ty*>(_First);
+        auto _Dest          = _Src;
+        const auto _Ptr_end = static_cast<_Ty*>(_Last);
+
+        constexpr unsigned int _All = (1U << _Traits::_Per_block) - 1;
+        if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Comparand = _Find_traits::_Set_avx(_Val);
+            const auto _Stop_at      = _Src + (_Byte_length(_First, _Last) >> 5 << 5) / sizeof(_Ty);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+                const unsigned int _Keep =
+                    _Traits::_Mask(_Find_traits::_Cmp_avx(_Data, _Comparand)) ^ _All;
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Traits::_Pack(_Data, _Keep));
+                _Dest += _mm_popcnt_u32(_Keep);
+                _Src += _Traits::_Per_block;
+            } while (_Src != _Stop_at);
+        }
+
+        for (; _Src != _Ptr_end; ++_Src) {
+            const _Ty _Elem = *_Src;
+            if (_Elem != _Val) {
+                *_Dest = _Elem;
+                ++_Dest;
+            }
+        }
+
+        return _Dest;
+    }
+
+    template <class _Traits, class _Find_traits, class _Ty>
+    void* _Unique_impl(void* const _First, void* const _Last) noexcept {
+        // compacts the elements not equal to their predecessor to the front, returning the new end
+        auto _Src           = static_cast<_Ty*>(_First);
+        const auto _Ptr_end = static_cast<_Ty*>(_Last);
+        if (_Src == _Ptr_end) {
+            return _Last;
+        }
+
+        _Ty _Prev  = *_Src; // the original value of _Src[-1], which the previous store may have overwritten
+        auto _Dest = ++_Src;
+
+        constexpr unsigned int _All = (1U << _Traits::_Per_block) - 1;
+        if (_Byte_length(_Src, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const auto _Stop_at = _Src + (_Byte_length(_Src, _Last) >> 5 << 5) / sizeof(_Ty);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+                const __m256i _Preceding =
+                    _Traits::_Replace_first(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src - 1)), _Prev);
+                const unsigned int _Keep = _Traits::_Mask(_Find_traits::_Cmp_avx(_Data, _Preceding)) ^ _All;
+                _Prev                    = _Src[_Traits::_Per_block - 1];
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Traits::_Pack(_Data, _Keep));
+                _Dest += _mm_popcnt_u32(_Keep);
+                _Src += _Traits::_Per_block;
+            } while (_Src != _Stop_at);
+        }
+
+        for (; _Src != _Ptr_end; ++_Src) {
+            const _Ty _Elem = *_Src;
+            if (_Elem != _Prev) {
+                *_Dest = _Elem;
+                ++_Dest;
+            }
+
+            _Prev = _Elem;
+        }
+
+        return _Dest;
+    }
+} // unnamed namespace
+
+extern "C" {
+void* __cdecl __std_remove_4(void* const _First, void* const _Last, const unsigned long _Val) noexcept {
+    return _Remove_impl<_Remove_traits_4, _Find_traits_4>(_First, _Last, _Val);
+}
+
+void* __cdecl __std_remove_8(void* const _First, void* const _Last, const unsigned long long _Val) noexcept {
+    return _Remove_impl<_Remove_traits_8, _Find_traits_8>(_First, _Last, _Val);
+}
+
+void* __cdecl __std_unique_4(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<_Remove_traits_4, _Find_traits_4, unsigned long>(_First, _Last);
+}
+
+void* __cdecl __std_unique_8(void* const _First, void* const _Last) noexcept {
+    return _Unique_impl<_Remove_traits_8, _Find_traits_8, unsigned long long>(_First, _Last);
+}
+} // extern "C"
+
+namespace {
+    // For each mask of elements that satisfy the predicate, the vpermd indices that move those elements to the front
+    // and the others to the back, each group in its original order. The 8-byte table moves pairs of 32-bit lanes.
+    struct _Partition_tables {
+        unsigned char _Shuf_4[256][8];
+        unsigned char _Shuf_8[16][8];
+
+        constexpr _Partition_tables() noexcept : _Shuf_4(), _Shuf_8() {
+            for (unsigned int _Mask = 0; _Mask != 256; ++_Mask) {
+                unsigned int _Out = 0;
+                for (unsigned int _Lane = 0; _Lane != 8; ++_Lane) {
+                    if ((_Mask & (1U << _Lane)) != 0) {
+                        _Shuf_4[_Mask][_Out++] = static_cast<unsigned char>(_Lane);
+                    }
+                }
+
+                for (unsigned int _Lane = 0; _Lane != 8; ++_Lane) {
+                    if ((_Mask & (1U << _Lane)) == 0) {
+                        _Shuf_4[_Mask][_Out++] = static_cast<unsigned char>(_Lane);
+                    }
+                }
+            }
+
+            for (unsigned int _Mask = 0; _Mask != 16; ++_Mask) {
+                unsigned int _Out = 0;
+                for (unsigned int _Lane = 0; _Lane != 4; ++_Lane) {
+                    if ((_Mask & (1U << _Lane)) != 0) {
+                        _Shuf_8[_Mask][_Out++] = static_cast<unsigned char>(_Lane * 2);
+                        _Shuf_8[_Mask][_Out++] = static_cast<unsigned char>(_Lane * 2 + 1);
+                    }
+                }
+
+                for (unsigned int _Lane = 0; _Lane != 4; ++_Lane) {
+                    if ((_Mask & (1U << _Lane)) == 0) {
+                        _Shuf_8[_Mask][_Out++] = static_cast<unsigned char>(_Lane * 2);
+                        _Shuf_8[_Mask][_Out++] = static_cast<unsigned char>(_Lane * 2 + 1);
+                    }
+                }
+            }
+        }
+    };
+
+    constexpr _Partition_tables _Partition_tables_v;
+
+    // _mm256_loadu_si256 at &_Prefix_lanes[8 - _Count] gives the vpmaskmovd mask that selects the first _Count lanes
+    constexpr int _Prefix_lanes[16] = {-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    struct _Partition_traits_4 {
+        static constexpr size_t _Per_block = 8;
+
+        static unsigned int _Mask(const __m256i _Lt) noexcept {
+            return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_Lt)));
+        }
+
+        static __m256i _Arrange(const __m256i _Data, const unsigned int _Mask) noexcept {
+            const __m256i _Shuf = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Partition_tables_v._Shuf_4[_Mask])));
+            return _mm256_permutevar8x32_epi32(_Data, _Shuf);
+        }
+    };
+
+    struct _Partition_traits_8 {
+        static constexpr size_t _Per_block = 4;
+
+        static unsigned int _Mask(const __m256i _Lt) noexcept {
+            return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(_Lt)));
+        }
+
+        static __m256i _Arrange(const __m256i _Data, const unsigned int _Mask) noexcept {
+            const __m256i _Shuf = _mm256_cvtepu8_epi32(
+                _mm_loadl_epi64(reinterpret_cast<const __m128i*>(_Partition_tables_v._Shuf_8[_Mask])));
+            return _mm256_permutevar8x32_epi32(_Data, _Shuf);
+        }
+    };
+
+    // The comparison traits give the lanes where _Left < _Right, as the scalar operator< on _Ty would.
+    struct _Partition_compare_i4 : _Partition_traits_4 {
+        using _Ty = int;
+
+        static __m256i _Set(const _Ty _Val) noexcept {
+            return _mm256_set1_epi32(_Val);
+        }
+
+        static __m256i _Less(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_cmpgt_epi32(_Right, _Left);
+        }
+    };
+
+    struct _Partition_compare_u4 : _Partition_traits_4 {
+        using _Ty = unsigned int;
+
+        static __m256i _Set(const _Ty _Val) noexcept {
+            return _mm256_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m256i _Less(const __m256i _Left, const __m256i _Right) noexcept {
+            const __m256i _Sign = _mm256_set1_epi32(static_cast<int>(0x8000'0000U));
+            return _mm256_cmpgt_epi32(_mm256_xor_si256(_Right, _Sign), _mm256_xor_si256(_Left, _Sign));
+        }
+    };
+
+    struct _Partition_compare_f : _Partition_traits_4 {
+        using _Ty = float;
+
+        static __m256i _Set(const _Ty _Val) noexcept {
+            return _mm256_castps_si256(_mm256_set1_ps(_Val));
+        }
+
+        static __m256i _Less(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_castps_si256(
+                _mm256_cmp_ps(_mm256_castsi256_ps(_Left), _mm256_castsi256_ps(_Right), _CMP_LT_OQ));
+        }
+    };
+
+    struct _Partition_compare_i8 : _Partition_traits_8 {
+        using _Ty = long long;
+
+        static __m256i _Set(const _Ty _Val) noexcept {
+            return _mm256_set1_epi64x(_Val);
+        }
+
+        static __m256i _Less(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_cmpgt_epi64(_Right, _Left);
+        }
+    };
+
+    struct _Partition_compare_u8 : _Partition_traits_8 {
+        using _Ty = unsigned long long;
+
+        static __m256i _Set(const _Ty _Val) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m256i _Less(const __m256i _Left, const __m256i _Right) noexcept {
+            const __m256i _Sign = _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(_Right, _Sign), _mm256_xor_si256(_Left, _Sign));
+        }
+    };
+
+    struct _Partition_compare_d : _Partition_traits_8 {
+        using _Ty = double;
+
+        static __m256i _Set(const _Ty _Val) noexcept {
+            return _mm256_castpd_si256(_mm256_set1_pd(_Val));
+        }
+
+        static __m256i _Less(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_castpd_si256(
+                _mm256_cmp_pd(_mm256_castsi256_pd(_Left), _mm256_castsi256_pd(_Right), _CMP_LT_OQ));
+        }
+    };
+
+    template <class _Traits, bool _Greater>
+    struct _Partition_pred { // tests _Elem < _Val, or _Val < _Elem when _Greater
+        using _Ty = typename _Traits::_Ty;
+
+        _Ty _Val;
+        __m256i _Bound;
+
+        explicit _Partition_pred(const _Ty _Val_) noexcept : _Val(_Val_), _Bound(_Traits::_Set(_Val_)) {}
+
+        bool operator()(const _Ty _Elem) const noexcept {
+            if constexpr (_Greater) {
+                return _Val < _Elem;
+            } else {
+                return _Elem < _Val;
+            }
+        }
+
+        unsigned int _Mask(const __m256i _Data) const noexcept {
+            if constexpr (_Greater) {
+                return _Traits::_Mask(_Traits::_Less(_Bound, _Data));
+            } else {
+                return _Traits::_Mask(_Traits::_Less(_Data, _Bound));
+            }
+        }
+    };
+
+    template <class _Traits, class _Pred>
+    void _Store_partitioned(const __m256i _Data, typename _Traits::_Ty*& _Left_out,
+        typename _Traits::_Ty*& _Right_out, const _Pred& _Pr) noexcept {
+        // write the elements of _Data that satisfy _Pr to the front of [_Left_out, _Right_out) and the others to the
+        // back; the first and last blocks of that range must be free
+        const unsigned int _Mask = _Pr._Mask(_Data);
+        const __m256i _Arranged  = _Traits::_Arrange(_Data, _Mask);
+        const size_t _True_count = _mm_popcnt_u32(_Mask);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Left_out), _Arranged);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Right_out - _Traits::_Per_block), _Arranged);
+        _Left_out += _True_count;
+        _Right_out -= _Traits::_Per_block - _True_count;
+    }
+
+    template <class _Traits, bool _Greater>
+    void* _Partition_impl(void* const _First, void* const _Last, const typename _Traits::_Ty _Val) noexcept {
+        // moves the elements that satisfy the predicate to the front, returning the end of them; the order within
+        // each group is unspecified
+        using _Ty                   = typename _Traits::_Ty;
+        constexpr size_t _Per_block = _Traits::_Per_block;
+        const _Partition_pred<_Traits, _Greater> _Pr(_Val);
+        auto _Left_out  = static_cast<_Ty*>(_First);
+        auto _Right_out = static_cast<_Ty*>(_Last);
+
+        if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            // Hold the first and last blocks in registers, which frees a block at each end. Then read each block
+            // from the end with less free space and write its two groups to the free space at both ends. Reading
+            // first makes a block of room at that end, and the other end already has a block of room, because the
+            // two ends together always have two blocks free.
+            auto _Left_in        = _Left_out + _Per_block;
+            auto _Right_in       = _Right_out - _Per_block;
+            const __m256i _Front = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Left_out));
+            const __m256i _Back  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Right_in));
+            while (static_cast<size_t>(_Right_in - _Left_in) >= _Per_block) {
+                __m256i _Data;
+                if (_Left_in - _Left_out <= _Right_out - _Right_in) {
+                    _Data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Left_in));
+                    _Left_in += _Per_block;
+                } else {
+                    _Right_in -= _Per_block;
+                    _Data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Right_in));
+                }
+
+                _Store_partitioned<_Traits>(_Data, _Left_out, _Right_out, _Pr);
+            }
+
+            // set aside the unread elements, so that [_Left_out, _Right_out) is free, then place them and the
+            // held blocks; the last block is stored twice at the same place
+            _Ty _Rest[_Per_block];
+            const size_t _Rest_count = static_cast<size_t>(_Right_in - _Left_in);
+            for (size_t _Idx = 0; _Idx != _Rest_count; ++_Idx) {
+                _Rest[_Idx] = _Left_in[_Idx];
+            }
+
+            for (size_t _Idx = 0; _Idx != _Rest_count; ++_Idx) {
+                if (_Pr(_Rest[_Idx])) {
+                    *_Left_out++ = _Rest[_Idx];
+                } else {
+                    *--_Right_out = _Rest[_Idx];
+                }
+            }
+
+            _Store_partitioned<_Traits>(_Front, _Left_out, _Right_out, _Pr);
+            _Store_partitioned<_Traits>(_Back, _Left_out, _Right_out, _Pr);
+            return _Left_out;
+        }
+
+        for (;;) { // same as the bidirectional partition in <algorithm>
+            for (;;) {
+                if (_Left_out == _Right_out) {
+                    return _Left_out;
+                }
+
+                if (!_Pr(*_Left_out)) {
+                    break;
+                }
+
+                ++_Left_out;
+            }
+
+            do {
+                --_Right_out;
+                if (_Left_out == _Right_out) {
+                    return _Left_out;
+                }
+            } while (!_Pr(*_Right_out));
+
+            const _Ty _Tmp = *_Left_out;
+            *_Left_out     = *_Right_out;
+            *_Right_out    = _Tmp;
+            ++_Left_out;
+        }
+    }
+
+    template <class _Traits, bool _Greater>
+    size_t _Partition_copy_impl(const void* const _First, const void* const _Last, void* const _Dest_true,
+        void* const _Dest_false, const typename _Traits::_Ty _Val) noexcept {
+        // copies the elements that satisfy the predicate to _Dest_true and the others to _Dest_false, each in their
+        // original order, returning how many satisfy it; _Dest_true may be _First, and otherwise the output ranges
+        // must not overlap the input. Only the written elements are stored to, using masked stores.
+        using _Ty                   = typename _Traits::_Ty;
+        constexpr size_t _Per_block = _Traits::_Per_block;
+        constexpr unsigned int _All = (1U << _Per_block) - 1;
+        constexpr size_t _Lanes_per = sizeof(_Ty) / 4;
+        const _Partition_pred<_Traits, _Greater> _Pr(_Val);
+        auto _Src           = static_cast<const _Ty*>(_First);
+        const auto _Src_end = static_cast<const _Ty*>(_Last);
+        auto _Out_true      = static_cast<_Ty*>(_Dest_true);
+        auto _Out_false     = static_cast<_Ty*>(_Dest_false);
+
+        if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const auto _Stop_at = _Src + (_Byte_length(_First, _Last) >> 5 << 5) / sizeof(_Ty);
+            do {
+                const __m256i _Data       = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+                const unsigned int _Mask  = _Pr._Mask(_Data);
+                const size_t _True_count  = _mm_popcnt_u32(_Mask);
+                const size_t _False_count = _Per_block - _True_count;
+                const __m256i _True_lanes = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(_Prefix_lanes + 8 - _True_count * _Lanes_per));
+                const __m256i _False_lanes = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(_Prefix_lanes + 8 - _False_count * _Lanes_per));
+                _mm256_maskstore_epi32(
+                    reinterpret_cast<int*>(_Out_true), _True_lanes, _Traits::_Arrange(_Data, _Mask));
+                _mm256_maskstore_epi32(
+                    reinterpret_cast<int*>(_Out_false), _False_lanes, _Traits::_Arrange(_Data, _Mask ^ _All));
+                _Out_true += _True_count;
+                _Out_false += _False_count;
+                _Src += _Per_block;
+            } while (_Src != _Stop_at);
+        }
+
+        for (; _Src != _Src_end; ++_Src) {
+            const _Ty _Elem = *_Src;
+            if (_Pr(_Elem)) {
+                *_Out_true = _Elem;
+                ++_Out_true;
+            } else {
+                *_Out_false = _Elem;
+                ++_Out_false;
+            }
+        }
+
+        return static_cast<size_t>(_Out_true - static_cast<_Ty*>(_Dest_true));
+    }
+
+    template <class _Traits>
+    void* _Partition_dispatch(void* const _First, void* const _Last, const typename _Traits::_Ty _Val,
+        const bool _Greater) noexcept {
+        if (_Greater) {
+            return _Partition_impl<_Traits, true>(_First, _Last, _Val);
+        } else {
+            return _Partition_impl<_Traits, false>(_First, _Last, _Val);
+        }
+    }
+
+    template <class _Traits>
+    size_t _Partition_copy_dispatch(const void* const _First, const void* const _Last, void* const _Dest_true,
+        void* const _Dest_false, const typename _Traits::_Ty _Val, const bool _Greater) noexcept {
+        if (_Greater) {
+            return _Partition_copy_impl<_Traits, true>(_First, _Last, _Dest_true, _Dest_false, _Val);
+        } else {
+            return _Partition_copy_impl<_Traits, false>(_First, _Last, _Dest_true, _Dest_false, _Val);
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+void* __cdecl __std_partition_4(void* const _First, void* const _Last, const unsigned long _Val, const bool _Signed,
+    const bool _Greater) noexcept {
+    if (_Signed) {
+        return _Partition_dispatch<_Partition_compare_i4>(_First, _Last, static_cast<int>(_Val), _Greater);
+    } else {
+        return _Partition_dispatch<_Partition_compare_u4>(_First, _Last, _Val, _Greater);
+    }
+}
+
+void* __cdecl __std_partition_8(void* const _First, void* const _Last, const unsigned long long _Val,
+    const bool _Signed, const bool _Greater) noexcept {
+    if (_Signed) {
+        return _Partition_dispatch<_Partition_compare_i8>(_First, _Last, static_cast<long long>(_Val), _Greater);
+    } else {
+        return _Partition_dispatch<_Partition_compare_u8>(_First, _Last, _Val, _Greater);
+    }
+}
+
+void* __cdecl __std_partition_f(void* const _First, void* const _Last, const float _Val, const bool _Greater) noexcept {
+    return _Partition_dispatch<_Partition_compare_f>(_First, _Last, _Val, _Greater);
+}
+
+void* __cdecl __std_partition_d(
+    void* const _First, void* const _Last, const double _Val, const bool _Greater) noexcept {
+    return _Partition_dispatch<_Partition_compare_d>(_First, _Last, _Val, _Greater);
+}
+
+size_t __cdecl __std_partition_copy_4(const void* const _First, const void* const _Last, void* const _Dest_true,
+    void* const _Dest_false, const unsigned long _Val, const bool _Signed, const bool _Greater) noexcept {
+    if (_Signed) {
+        return _Partition_copy_dispatch<_Partition_compare_i4>(
+            _First, _Last, _Dest_true, _Dest_false, static_cast<int>(_Val), _Greater);
+    } else {
+        return _Partition_copy_dispatch<_Partition_compare_u4>(_First, _Last, _Dest_true, _Dest_false, _Val, _Greater);
+    }
+}
+
+size_t __cdecl __std_partition_copy_8(const void* const _First, const void* const _Last, void* const _Dest_true,
+    void* const _Dest_false, const unsigned long long _Val, const bool _Signed, const bool _Greater) noexcept {
+    if (_Signed) {
+        return _Partition_copy_dispatch<_Partition_compare_i8>(
+            _First, _Last, _Dest_true, _Dest_false, static_cast<long long>(_Val), _Greater);
+    } else {
+        return _Partition_copy_dispatch<_Partition_compare_u8>(_First, _Last, _Dest_true, _Dest_false, _Val, _Greater);
+    }
+}
+
+size_t __cdecl __std_partition_copy_f(const void* const _First, const void* const _Last, void* const _Dest_true,
+    void* const _Dest_false, const float _Val, const bool _Greater) noexcept {
+    return _Partition_copy_dispatch<_Partition_compare_f>(_First, _Last, _Dest_true, _Dest_false, _Val, _Greater);
+}
+
+size_t __cdecl __std_partition_copy_d(const void* const _First, const void* const _Last, void* const _Dest_true,
+    void* const _Dest_false, const double _Val, const bool _Greater) noexcept {
+    return _Partition_copy_dispatch<_Partition_compare_d>(_First, _Last, _Dest_true, _Dest_false, _Val, _Greater);
+}
+} // extern "C"
+
+namespace {
+    size_t _Popcount_fallback(unsigned long _Val) noexcept {
+        _Val = _Val - ((_Val >> 1) & 0x55555555U);
+        _Val = (_Val & 0x33333333U) + ((_Val >> 2) & 0x33333333U);
+        _Val = (_Val + (_Val >> 4)) & 0x0F0F0F0FU;
+        return static_cast<size_t>((_Val * 0x01010101U) >> 24);
+    }
+
+    template <class _Elem>
+    void _Bitset_to_string_tail(_Elem* _Dest, const unsigned char* const _Src, const size_t _First_bit,
+        size_t _Last_bit, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+        // write the bits [_First_bit, _Last_bit) most significant first
+        while (_Last_bit != _First_bit) {
+            --_Last_bit;
+            *_Dest = ((_Src[_Last_bit >> 3] >> (_Last_bit & 7)) & 1) != 0 ? _Elem1 : _Elem0;
+            ++_Dest;
+        }
+    }
+
+    template <class _Elem>
+    bool _Bitset_from_string_tail(unsigned char* const _Dest, const _Elem* _Src, size_t _Last_bit,
+        const size_t _First_bit, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+        // read the bits [_First_bit, _Last_bit) most significant first; fail on an element that's neither
+        while (_Last_bit != _First_bit) {
+            --_Last_bit;
+            const _Elem _Ch = *_Src;
+            ++_Src;
+            if (_Ch == _Elem1) {
+                _Dest[_Last_bit >> 3] |= static_cast<unsigned char>(1 << (_Last_bit & 7));
+            } else if (_Ch != _Elem0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <class _Elem>
+    bool _Bitset_from_string_impl(void* const _Dest, const _Elem* const _Src, const size_t _Size_bytes,
+        const size_t _Size_bits, const size_t _Size_chars, const _Elem _Elem0, const _Elem _Elem1) noexcept {
+        // the first min(_Size_chars, _Size_bits) elements are the value, least significant last; the rest must be
+        // valid but are ignored
+        const size_t _Value_chars = _Size_chars < _Size_bits ? _Size_chars : _Size_bits;
+        for (size_t _Idx = _Value_chars; _Idx != _Size_chars; ++_Idx) {
+            if (_Src[_Idx] != _Elem0 && _Src[_Idx] != _Elem1) {
+                return false;
+            }
+        }
+
+        const auto _Dest_bytes = static_cast<unsigned char*>(_Dest);
+        for (size_t _Idx = 0; _Idx != _Size_bytes; ++_Idx) {
+            _Dest_bytes[_Idx] = 0;
+        }
+
+        constexpr size_t _Per_block = 32 / sizeof(_Elem);
+        size_t _Done_bits           = 0; // the low bits, read from the end of the value elements
+        if (_Value_chars >= _Per_block && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Reverse = sizeof(_Elem) == 1
+                                       ? _mm256_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, //
+                                           0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)
+                                       : _mm256_set_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, //
+                                           1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+            const __m256i _Px0 = sizeof(_Elem) == 1 ? _mm256_set1_epi8(static_cast<char>(_Elem0))
+                                                    : _mm256_set1_epi16(static_cast<short>(_Elem0));
+            const __m256i _Px1 = sizeof(_Elem) == 1 ? _mm256_set1_epi8(static_cast<char>(_Elem1))
+                                                    : _mm256_set1_epi16(static_cast<short>(_Elem1));
+            do {
+                // reverse the block so that the least significant bit comes first
+                const __m256i _Data = _mm256_shuffle_epi8(
+                    _mm256_permute4x64_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(
+                                                 _Src + _Value_chars - _Done_bits - _Per_block)),
+                        78),
+                    _Reverse);
+                __m256i _Is_one;
+                __m256i _Is_valid;
+                if constexpr (sizeof(_Elem) == 1) {
+                    _Is_one   = _mm256_cmpeq_epi8(_Data, _Px1);
+                    _Is_valid = _mm256_or_si256(_Is_one, _mm256_cmpeq_epi8(_Data, _Px0));
+                } else {
+                    _Is_one   = _mm256_cmpeq_epi16(_Data, _Px1);
+                    _Is_valid = _mm256_or_si256(_Is_one, _mm256_cmpeq_epi16(_Data, _Px0));
+                }
+
+                if (static_cast<unsigned int>(_mm256_movemask_epi8(_Is_valid)) != 0xFFFF'FFFFU) {
+                    return false;
+                }
+
+                if constexpr (sizeof(_Elem) == 1) {
+                    *reinterpret_cast<unsigned long*>(_Dest_bytes + (_Done_bits >> 3)) =
+                        static_cast<unsigned long>(_mm256_movemask_epi8(_Is_one));
+                } else {
+                    const __m128i _Packed =
+                        _mm_packs_epi16(_mm256_castsi256_si128(_Is_one), _mm256_extracti128_si256(_Is_one, 1));
+                    *reinterpret_cast<unsigned short*>(_Dest_bytes + (_Done_bits >> 3)) =
+                        static_cast<unsigned short>(_mm_movemask_epi8(_Packed));
+                }
+
+                _Done_bits += _Per_block;
+            } while (_Value_chars - _Done_bits >= _Per_block);
+        }
+
+        return _Bitset_from_string_tail(_Dest_bytes, _Src, _Value_chars, _Done_bits, _Elem0, _Elem1);
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) size_t __cdecl __std_bitset_count(const void* _First, const void* const _Last) noexcept {
+    size_t _Result = 0;
+    if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        // count the bits of each nibble with a vpshufb lookup, then sum the bytes with vpsadbw
+        const __m256i _Lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, //
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i _Low_nibble = _mm256_set1_epi8(0x0F);
+        __m256i _Sums             = _mm256_setzero_si256();
+        const void* _Stop_at      = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
+        do {
+            const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+            const __m256i _Low  = _mm256_shuffle_epi8(_Lookup, _mm256_and_si256(_Data, _Low_nibble));
+            const __m256i _High =
+                _mm256_shuffle_epi8(_Lookup, _mm256_and_si256(_mm256_srli_epi16(_Data, 4), _Low_nibble));
+            _Sums = _mm256_add_epi64(_Sums, _mm256_sad_epu8(_mm256_add_epi8(_Low, _High), _mm256_setzero_si256()));
+            _Advance_bytes(_First, 32);
+        } while (_First != _Stop_at);
+
+        const __m128i _Sums_128 = _mm_add_epi64(_mm256_castsi256_si128(_Sums), _mm256_extracti128_si256(_Sums, 1));
+#ifdef _M_IX86
+        _Result = static_cast<size_t>(_mm_cvtsi128_si32(_Sums_128)) + _mm_extract_epi32(_Sums_128, 2);
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+        _Result = static_cast<size_t>(_mm_cvtsi128_si64(_Sums_128)) + _mm_extract_epi64(_Sums_128, 1);
+#endif // _M_IX86
+    }
+
+    // popcnt is available whenever SSE4.2 is, as in <bit>
+    const bool _Have_popcnt = _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE42) != 0;
+    for (; _Byte_length(_First, _Last) >= 4; _Advance_bytes(_First, 4)) {
+        const unsigned long _Word = *static_cast<const unsigned long*>(_First);
+        _Result += _Have_popcnt ? _mm_popcnt_u32(_Word) : _Popcount_fallback(_Word);
+    }
+
+    for (; _First != _Last; _Advance_bytes(_First, 1)) {
+        _Result += _Popcount_fallback(*static_cast<const unsigned char*>(_First));
+    }
+
+    return _Result;
+}
+
+__declspec(noalias) void __cdecl __std_bitset_to_string_1(
+    char* _Dest, const void* const _Src, const size_t _Size_bits, const char _Elem0, const char _Elem1) noexcept {
+    const auto _Src_bytes = static_cast<const unsigned char*>(_Src);
+    size_t _Block_bits    = _Size_bits >> 5 << 5; // the bits below this are written in blocks of 32
+    _Bitset_to_string_tail(_Dest, _Src_bytes, _Block_bits, _Size_bits, _Elem0, _Elem1);
+    _Dest += _Size_bits - _Block_bits;
+
+    if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        // copy each of the 4 source bytes to the 8 output positions for its bits, most significant first,
+        // then test the bit selected for each position
+        const __m256i _Spread = _mm256_set_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, //
+            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+        const __m256i _Bit_select = _mm256_set_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, //
+            1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+        const __m256i _Px0 = _mm256_set1_epi8(_Elem0);
+        const __m256i _Px1 = _mm256_set1_epi8(_Elem1);
+        for (; _Block_bits != 0; _Block_bits -= 32) {
+            const unsigned long _Word = *reinterpret_cast<const unsigned long*>(_Src_bytes + ((_Block_bits - 32) >> 3));
+            const __m256i _Bytes      = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(_Word)), _Spread);
+            const __m256i _Is_one     = _mm256_cmpeq_epi8(_mm256_and_si256(_Bytes, _Bit_select), _Bit_select);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _mm256_blendv_epi8(_Px0, _Px1, _Is_one));
+            _Dest += 32;
+        }
+    }
+
+    _Bitset_to_string_tail(_Dest, _Src_bytes, 0, _Block_bits, _Elem0, _Elem1);
+}
+
+__declspec(noalias) void __cdecl __std_bitset_to_string_2(wchar_t* _Dest, const void* const _Src,
+    const size_t _Size_bits, const wchar_t _Elem0, const wchar_t _Elem1) noexcept {
+    const auto _Src_bytes = static_cast<const unsigned char*>(_Src);
+    size_t _Block_bits    = _Size_bits >> 4 << 4; // the bits below this are written in blocks of 16
+    _Bitset_to_string_tail(_Dest, _Src_bytes, _Block_bits, _Size_bits, _Elem0, _Elem1);
+    _Dest += _Size_bits - _Block_bits;
+
+    if (_bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        const __m256i _Bit_select = _mm256_set_epi16(1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, 8192,
+            16384, static_cast<short>(0x8000));
+        const __m256i _Px0 = _mm256_set1_epi16(static_cast<short>(_Elem0));
+        const __m256i _Px1 = _mm256_set1_epi16(static_cast<short>(_Elem1));
+        for (; _Block_bits != 0; _Block_bits -= 16) {
+            const unsigned short _Word =
+                *reinterpret_cast<const unsigned short*>(_Src_bytes + ((_Block_bits - 16) >> 3));
+            const __m256i _Is_one = _mm256_cmpeq_epi16(
+                _mm256_and_si256(_mm256_set1_epi16(static_cast<short>(_Word)), _Bit_select), _Bit_select);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _mm256_blendv_epi8(_Px0, _Px1, _Is_one));
+            _Dest += 16;
+        }
+    }
+
+    _Bitset_to_string_tail(_Dest, _Src_bytes, 0, _Block_bits, _Elem0, _Elem1);
+}
+
+__declspec(noalias) bool __cdecl __std_bitset_from_string_1(void* const _Dest, const char* const _Src,
+    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const char _Elem0,
+    const char _Elem1) noexcept {
+    return _Bitset_from_string_impl(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+}
+
+__declspec(noalias) bool __cdecl __std_bitset_from_string_2(void* const _Dest, const wchar_t* const _Src,
+    const size_t _Size_bytes, const size_t _Size_bits, const size_t _Size_chars, const wchar_t _Elem0,
+    const wchar_t _Elem1) noexcept {
+    return _Bitset_from_string_impl(_Dest, _Src, _Size_bytes, _Size_bits, _Size_chars, _Elem0, _Elem1);
+}
+} // extern "C"
+
+namespace {
+    // The dynamic_bitset operations combine each byte of _Dest with the same byte of _Src; blocks of every width lay
+    // out their bits in the same bytes, so the kernels needn't know the block type.
+    struct _Bitset_op_and {
+        template <class _Ty>
+        static _Ty _Apply(const _Ty _Left, const _Ty _Right) noexcept {
+            return static_cast<_Ty>(_Left & _Right);
+        }
+
+        static __m256i _Apply_avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_and_si256(_Left, _Right);
+        }
+
+        static __m512i _Apply_avx512(const __m512i _Left, const __m512i _Right) noexcept {
+            return _mm512_and_si512(_Left, _Right);
+        }
+    };
+
+    struct _Bitset_op_or {
+        template <class _Ty>
+        static _Ty _Apply(const _Ty _Left, const _Ty _Right) noexcept {
+            return static_cast<_Ty>(_Left | _Right);
+        }
+
+        static __m256i _Apply_avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_or_si256(_Left, _Right);
+        }
+
+        static __m512i _Apply_avx512(const __m512i _Left, const __m512i _Right) noexcept {
+            return _mm512_or_si512(_Left, _Right);
+        }
+    };
+
+    struct _Bitset_op_xor {
+        template <class _Ty>
+        static _Ty _Apply(const _Ty _Left, const _Ty _Right) noexcept {
+            return static_cast<_Ty>(_Left ^ _Right);
+        }
+
+        static __m256i _Apply_avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_xor_si256(_Left, _Right);
+        }
+
+        static __m512i _Apply_avx512(const __m512i _Left, const __m512i _Right) noexcept {
+            return _mm512_xor_si512(_Left, _Right);
+        }
+    };
+
+    struct _Bitset_op_andnot { // the bits of _Left that aren't in _Right
+        template <class _Ty>
+        static _Ty _Apply(const _Ty _Left, const _Ty _Right) noexcept {
+            return static_cast<_Ty>(_Left & ~_Right);
+        }
+
+        static __m256i _Apply_avx(const __m256i _Left, const __m256i _Right) noexcept {
+            return _mm256_andnot_si256(_Right, _Left);
+        }
+
+        static __m512i _Apply_avx512(const __m512i _Left, const __m512i _Right) noexcept {
+            return _mm512_andnot_si512(_Right, _Left);
+        }
+    };
+
+    template <class _Op>
+    void _Bitset_assign_op(void* _Dest, const void* _Src, const size_t _Size_bytes) noexcept {
+        const void* const _Last = static_cast<const unsigned char*>(_Dest) + _Size_bytes;
+        if (_Size_bytes >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+            const void* _Stop_at = _Dest;
+            _Advance_bytes(_Stop_at, _Size_bytes >> 6 << 6);
+            do {
+                const __m512i _Left  = _mm512_loadu_si512(_Dest);
+                const __m512i _Right = _mm512_loadu_si512(_Src);
+                _mm512_storeu_si512(_Dest, _Op::_Apply_avx512(_Left, _Right));
+                _Advance_bytes(_Dest, 64);
+                _Advance_bytes(_Src, 64);
+            } while (_Dest != _Stop_at);
+        }
+
+        if (_Byte_length(_Dest, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const void* _Stop_at = _Dest;
+            _Advance_bytes(_Stop_at, _Byte_length(_Dest, _Last) >> 5 << 5);
+            do {
+                const __m256i _Left  = _mm256_loadu_si256(static_cast<const __m256i*>(_Dest));
+                const __m256i _Right = _mm256_loadu_si256(static_cast<const __m256i*>(_Src));
+                _mm256_storeu_si256(static_cast<__m256i*>(_Dest), _Op::_Apply_avx(_Left, _Right));
+                _Advance_bytes(_Dest, 32);
+                _Advance_bytes(_Src, 32);
+            } while (_Dest != _Stop_at);
+        }
+
+        for (; _Byte_length(_Dest, _Last) >= 4; _Advance_bytes(_Dest, 4), _Advance_bytes(_Src, 4)) {
+            const auto _Dest_word = static_cast<unsigned long*>(_Dest);
+            *_Dest_word           = _Op::_Apply(*_Dest_word, *static_cast<const unsigned long*>(_Src));
+        }
+
+        for (; _Dest != _Last; _Advance_bytes(_Dest, 1), _Advance_bytes(_Src, 1)) {
+            const auto _Dest_byte = static_cast<unsigned char*>(_Dest);
+            *_Dest_byte           = _Op::_Apply(*_Dest_byte, *static_cast<const unsigned char*>(_Src));
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_bitset_and(
+    void* const _Dest, const void* const _Src, const size_t _Size_bytes) noexcept {
+    _Bitset_assign_op<_Bitset_op_and>(_Dest, _Src, _Size_bytes);
+}
+
+__declspec(noalias) void __cdecl __std_bitset_or(
+    void* const _Dest, const void* const _Src, const size_t _Size_bytes) noexcept {
+    _Bitset_assign_op<_Bitset_op_or>(_Dest, _Src, _Size_bytes);
+}
+
+__declspec(noalias) void __cdecl __std_bitset_xor(
+    void* const _Dest, const void* const _Src, const size_t _Size_bytes) noexcept {
+    _Bitset_assign_op<_Bitset_op_xor>(_Dest, _Src, _Size_bytes);
+}
+
+__declspec(noalias) void __cdecl __std_bitset_andnot(
+    void* const _Dest, const void* const _Src, const size_t _Size_bytes) noexcept {
+    _Bitset_assign_op<_Bitset_op_andnot>(_Dest, _Src, _Size_bytes);
+}
+
+__declspec(noalias) const void* __cdecl __std_bitset_find_nonzero(
+    const void* _First, const void* const _Last) noexcept {
+    // skip whole vectors of zero bytes, then find the nonzero byte in the vector that stopped the search
+    if (_Byte_length(_First, _Last) >= 64 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX512)) {
+        const void* _Stop_at = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 6 << 6);
+        do {
+            const __m512i _Data = _mm512_loadu_si512(_First);
+            if (_mm512_test_epi64_mask(_Data, _Data) != 0) {
+                break; // the AVX2 search below finds the byte within these 64
+            }
+
+            _Advance_bytes(_First, 64);
+        } while (_First != _Stop_at);
+    }
+
+    if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+        const void* _Stop_at = _First;
+        _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
+        do {
+            const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+            if (!_mm256_testz_si256(_Data, _Data)) {
+                const auto _Zero_bytes =
+                    static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_Data, _mm256_setzero_si256())));
+                unsigned long _Offset;
+                _BitScanForward(&_Offset, ~_Zero_bytes);
+                _Advance_bytes(_First, static_cast<ptrdiff_t>(_Offset));
+                return _First;
+            }
+
+            _Advance_bytes(_First, 32);
+        } while (_First != _Stop_at);
+    }
+
+    for (; _First != _Last; _Advance_bytes(_First, 1)) {
+        if (*static_cast<const unsigned char*>(_First) != 0) {
+            break;
+        }
+    }
+
+    return _First;
+}
+} // extern "C"
+
+namespace {
+    template <class _Find_traits, class _Ty>
+    void _Fill_impl(void* _First, void* const _Last, const _Ty _Val) noexcept {
+        // Above this size, which is well beyond the L2 cache, the stores would only evict data that's about to be used,
+        // so they bypass the cache.
+        constexpr size_t _Non_temporal_threshold = static_cast<size_t>(4) << 20;
+        if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Data = _Find_traits::_Set_avx(_Val);
+            if (_Byte_length(_First, _Last) >= _Non_temporal_threshold
+                && reinterpret_cast<size_t>(_First) % sizeof(_Ty) == 0) {
+                // the streaming stores need 32-byte alignment; store the unaligned head normally
+                _mm256_storeu_si256(static_cast<__m256i*>(_First), _Data);
+                _Advance_bytes(_First, 32 - (reinterpret_cast<size_t>(_First) & 31));
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
+                do {
+                    _mm256_stream_si256(static_cast<__m256i*>(_First), _Data);
+                    _Advance_bytes(_First, 32);
+                } while (_First != _Stop_at);
+                _mm_sfence();
+            } else {
+                const void* _Stop_at = _First;
+                _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
+                do {
+                    _mm256_storeu_si256(static_cast<__m256i*>(_First), _Data);
+                    _Advance_bytes(_First, 32);
+                } while (_First != _Stop_at);
+            }
+
+            if (_First != _Last) {
+                // the range is at least 32 bytes, so the remainder can be covered by the last whole vector
+                void* _Tail = _Last;
+                _Advance_bytes(_Tail, -32);
+                _mm256_storeu_si256(static_cast<__m256i*>(_Tail), _Data);
+            }
+
+            return;
+        }
+
+        if (_Byte_length(_First, _Last) >= 16
+#ifdef _M_IX86
+            && _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2)
+#endif // _M_IX86
+        ) {
+            const __m128i _Data  = _Find_traits::_Set_sse(_Val);
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 4 << 4);
+            do {
+                _mm_storeu_si128(static_cast<__m128i*>(_First), _Data);
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+
+            if (_First != _Last) {
+                void* _Tail = _Last;
+                _Advance_bytes(_Tail, -16);
+                _mm_storeu_si128(static_cast<__m128i*>(_Tail), _Data);
+            }
+
+            return;
+        }
+
+        for (auto _Ptr = static_cast<_Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            *_Ptr = _Val;
+        }
+    }
+
+    template <class _Find_traits, class _Ty>
+    void _Replace_impl(void* _First, void* const _Last, const _Ty _Old_val, const _Ty _New_val) noexcept {
+        // only blocks that contain a match are written back
+        if (_Byte_length(_First, _Last) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Comparand   = _Find_traits::_Set_avx(_Old_val);
+            const __m256i _Replacement = _Find_traits::_Set_avx(_New_val);
+            const void* _Stop_at       = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 5 << 5);
+            do {
+                const __m256i _Data = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const __m256i _Mask = _Find_traits::_Cmp_avx(_Data, _Comparand);
+                if (!_mm256_testz_si256(_Mask, _Mask)) {
+                    _mm256_storeu_si256(static_cast<__m256i*>(_First), _mm256_blendv_epi8(_Data, _Replacement, _Mask));
+                }
+
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+        }
+
+        if (_Byte_length(_First, _Last) >= 16 && _Find_traits::_Sse_available()) {
+            const __m128i _Comparand   = _Find_traits::_Set_sse(_Old_val);
+            const __m128i _Replacement = _Find_traits::_Set_sse(_New_val);
+            const void* _Stop_at       = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last) >> 4 << 4);
+            do {
+                const __m128i _Data = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const __m128i _Mask = _Find_traits::_Cmp_sse(_Data, _Comparand);
+                if (_mm_movemask_epi8(_Mask) != 0) {
+                    const __m128i _Result =
+                        _mm_or_si128(_mm_and_si128(_Mask, _Replacement), _mm_andnot_si128(_Mask, _Data));
+                    _mm_storeu_si128(static_cast<__m128i*>(_First), _Result);
+                }
+
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        for (auto _Ptr = static_cast<_Ty*>(_First); _Ptr != _Last; ++_Ptr) {
+            if (*_Ptr == _Old_val) {
+                *_Ptr = _New_val;
+            }
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_fill_2(
+    void* const _First, void* const _Last, const unsigned short _Val) noexcept {
+    _Fill_impl<_Find_traits_2>(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_fill_4(
+    void* const _First, void* const _Last, const unsigned long _Val) noexcept {
+    _Fill_impl<_Find_traits_4>(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_fill_8(
+    void* const _First, void* const _Last, const unsigned long long _Val) noexcept {
+    _Fill_impl<_Find_traits_8>(_First, _Last, _Val);
+}
+
+__declspec(noalias) void __cdecl __std_replace_1(
+    void* const _First, void* const _Last, const unsigned char _Old_val, const unsigned char _New_val) noexcept {
+    _Replace_impl<_Find_traits_1>(_First, _Last, _Old_val, _New_val);
+}
+
+__declspec(noalias) void __cdecl __std_replace_2(
+    void* const _First, void* const _Last, const unsigned short _Old_val, const unsigned short _New_val) noexcept {
+    _Replace_impl<_Find_traits_2>(_First, _Last, _Old_val, _New_val);
+}
+
+__declspec(noalias) void __cdecl __std_replace_4(
+    void* const _First, void* const _Last, const unsigned long _Old_val, const unsigned long _New_val) noexcept {
+    _Replace_impl<_Find_traits_4>(_First, _Last, _Old_val, _New_val);
+}
+
+__declspec(noalias) void __cdecl __std_replace_8(void* const _First, void* const _Last,
+    const unsigned long long _Old_val, const unsigned long long _New_val) noexcept {
+    _Replace_impl<_Find_traits_8>(_First, _Last, _Old_val, _New_val);
+}
+} // extern "C"
+
+namespace {
+    struct _Neighbor_traits_1 : _Find_traits_1 {
+        static __m256i _Sign_avx() noexcept {
+            return _mm256_set1_epi8(static_cast<char>(0x80));
+        }
+
+        static __m128i _Sign_sse() noexcept {
+            return _mm_set1_epi8(static_cast<char>(0x80));
+        }
+
+        static __m256i _Cmp_gt_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpgt_epi8(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_gt_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpgt_epi8(_Lhs, _Rhs);
+        }
+    };
+
+    struct _Neighbor_traits_2 : _Find_traits_2 {
+        static __m256i _Sign_avx() noexcept {
+            return _mm256_set1_epi16(static_cast<short>(0x8000));
+        }
+
+        static __m128i _Sign_sse() noexcept {
+            return _mm_set1_epi16(static_cast<short>(0x8000));
+        }
+
+        static __m256i _Cmp_gt_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpgt_epi16(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_gt_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpgt_epi16(_Lhs, _Rhs);
+        }
+    };
+
+    struct _Neighbor_traits_4 : _Find_traits_4 {
+        static __m256i _Sign_avx() noexcept {
+            return _mm256_set1_epi32(static_cast<int>(0x8000'0000UL));
+        }
+
+        static __m128i _Sign_sse() noexcept {
+            return _mm_set1_epi32(static_cast<int>(0x8000'0000UL));
+        }
+
+        static __m256i _Cmp_gt_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpgt_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_gt_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpgt_epi32(_Lhs, _Rhs);
+        }
+    };
+
+    struct _Neighbor_traits_8 : _Find_traits_8 {
+        static __m256i _Sign_avx() noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+        }
+
+        static __m128i _Sign_sse() noexcept {
+            return _mm_set1_epi64x(static_cast<long long>(0x8000'0000'0000'0000ULL));
+        }
+
+        static __m256i _Cmp_gt_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_cmpgt_epi64(_Lhs, _Rhs);
+        }
+
+        static __m128i _Cmp_gt_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_cmpgt_epi64(_Lhs, _Rhs); // SSE4.2
+        }
+    };
+
+    // The neighbor tests report a pair (_Cur, _Next) of adjacent elements; _Sse_available comes from the traits.
+    template <class _Traits, class _Ty>
+    struct _Neighbors_equal : _Traits {
+        static __m256i _Test_avx(const __m256i _Cur, const __m256i _Next) noexcept {
+            return _Traits::_Cmp_avx(_Cur, _Next);
+        }
+
+        static __m128i _Test_sse(const __m128i _Cur, const __m128i _Next) noexcept {
+            return _Traits::_Cmp_sse(_Cur, _Next);
+        }
+
+        static bool _Test(const _Ty _Cur, const _Ty _Next) noexcept {
+            return _Cur == _Next;
+        }
+    };
+
+    template <class _Traits, class _Ty>
+    struct _Neighbors_descending_signed : _Traits {
+        static __m256i _Test_avx(const __m256i _Cur, const __m256i _Next) noexcept {
+            return _Traits::_Cmp_gt_avx(_Cur, _Next);
+        }
+
+        static __m128i _Test_sse(const __m128i _Cur, const __m128i _Next) noexcept {
+            return _Traits::_Cmp_gt_sse(_Cur, _Next);
+        }
+
+        static bool _Test(const _Ty _Cur, const _Ty _Next) noexcept {
+            return _Next < _Cur;
+        }
+    };
+
+    template <class _Traits, class _Ty>
+    struct _Neighbors_descending_unsigned : _Traits {
+        // flipping the sign bits maps unsigned order onto the signed order of the comparison instructions
+        static __m256i _Test_avx(const __m256i _Cur, const __m256i _Next) noexcept {
+            const __m256i _Sign = _Traits::_Sign_avx();
+            return _Traits::_Cmp_gt_avx(_mm256_xor_si256(_Cur, _Sign), _mm256_xor_si256(_Next, _Sign));
+        }
+
+        static __m128i _Test_sse(const __m128i _Cur, const __m128i _Next) noexcept {
+            const __m128i _Sign = _Traits::_Sign_sse();
+            return _Traits::_Cmp_gt_sse(_mm_xor_si128(_Cur, _Sign), _mm_xor_si128(_Next, _Sign));
+        }
+
+        static bool _Test(const _Ty _Cur, const _Ty _Next) noexcept {
+            return _Next < _Cur;
+        }
+    };
+
+    template <class _Test, class _Ty>
+    const void* _Find_neighbors(const void* _First, const void* const _Last) noexcept {
+        // find the first element of [_First, _Last) that satisfies _Test together with its successor, or _Last;
+        // every block compares a vector load with the load one element further on
+        if (_Byte_length(_First, _Last) < 2 * sizeof(_Ty)) {
+            return _Last;
+        }
+
+        const void* _Last_pair = _Last; // the last element that has a successor is just before _Last_pair
+        _Advance_bytes(_Last_pair, -static_cast<ptrdiff_t>(sizeof(_Ty)));
+
+        constexpr size_t _Mask_32 = ~((static_cast<size_t>(1) << 5) - 1);
+        if (_Byte_length(_First, _Last_pair) >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last_pair) & _Mask_32);
+            do {
+                const void* _Next = _First;
+                _Advance_bytes(_Next, sizeof(_Ty));
+                const __m256i _Cur_data  = _mm256_loadu_si256(static_cast<const __m256i*>(_First));
+                const __m256i _Next_data = _mm256_loadu_si256(static_cast<const __m256i*>(_Next));
+                const int _Bingo         = _mm256_movemask_epi8(_Test::_Test_avx(_Cur_data, _Next_data));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_First, static_cast<ptrdiff_t>(_Offset));
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 32);
+            } while (_First != _Stop_at);
+        }
+
+        constexpr size_t _Mask_16 = ~((static_cast<size_t>(1) << 4) - 1);
+        if (_Byte_length(_First, _Last_pair) >= 16 && _Test::_Sse_available()) {
+            const void* _Stop_at = _First;
+            _Advance_bytes(_Stop_at, _Byte_length(_First, _Last_pair) & _Mask_16);
+            do {
+                const void* _Next = _First;
+                _Advance_bytes(_Next, sizeof(_Ty));
+                const __m128i _Cur_data  = _mm_loadu_si128(static_cast<const __m128i*>(_First));
+                const __m128i _Next_data = _mm_loadu_si128(static_cast<const __m128i*>(_Next));
+                const int _Bingo         = _mm_movemask_epi8(_Test::_Test_sse(_Cur_data, _Next_data));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, static_cast<unsigned long>(_Bingo));
+                    _Advance_bytes(_First, static_cast<ptrdiff_t>(_Offset));
+                    return _First;
+                }
+
+                _Advance_bytes(_First, 16);
+            } while (_First != _Stop_at);
+        }
+
+        auto _Ptr       = static_cast<const _Ty*>(_First);
+        const auto _End = static_cast<const _Ty*>(_Last_pair);
+        for (; _Ptr != _End; ++_Ptr) {
+            if (_Test::_Test(_Ptr[0], _Ptr[1])) {
+                return _Ptr;
+            }
+        }
+
+        return _Last;
+    }
+
+    template <class _Traits, class _Signed_ty, class _Unsigned_ty>
+    const void* _Is_sorted_until_impl(const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+        // the first descending pair ends the sorted prefix at its second element
+        const void* _Found;
+        if (_Signed) {
+            _Found = _Find_neighbors<_Neighbors_descending_signed<_Traits, _Signed_ty>, _Signed_ty>(_First, _Last);
+        } else {
+            _Found =
+                _Find_neighbors<_Neighbors_descending_unsigned<_Traits, _Unsigned_ty>, _Unsigned_ty>(_First, _Last);
+        }
+
+        if (_Found != _Last) {
+            _Advance_bytes(_Found, sizeof(_Signed_ty));
+        }
+
+        return _Found;
+    }
+} // unnamed namespace
+
+extern "C" {
+const void* __cdecl __std_adjacent_find_1(const void* const _First, const void* const _Last) noexcept {
+    return _Find_neighbors<_Neighbors_equal<_Find_traits_1, unsigned char>, unsigned char>(_First, _Last);
+}
+
+const void* __cdecl __std_adjacent_find_2(const void* const _First, const void* const _Last) noexcept {
+    return _Find_neighbors<_Neighbors_equal<_Find_traits_2, unsigned short>, unsigned short>(_First, _Last);
+}
+
+const void* __cdecl __std_adjacent_find_4(const void* const _First, const void* const _Last) noexcept {
+    return _Find_neighbors<_Neighbors_equal<_Find_traits_4, unsigned long>, unsigned long>(_First, _Last);
+}
+
+const void* __cdecl __std_adjacent_find_8(const void* const _First, const void* const _Last) noexcept {
+    return _Find_neighbors<_Neighbors_equal<_Find_traits_8, unsigned long long>, unsigned long long>(_First, _Last);
+}
+
+const void* __cdecl __std_is_sorted_until_1(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Is_sorted_until_impl<_Neighbor_traits_1, signed char, unsigned char>(_First, _Last, _Signed);
+}
+
+const void* __cdecl __std_is_sorted_until_2(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Is_sorted_until_impl<_Neighbor_traits_2, short, unsigned short>(_First, _Last, _Signed);
+}
+
+const void* __cdecl __std_is_sorted_until_4(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Is_sorted_until_impl<_Neighbor_traits_4, long, unsigned long>(_First, _Last, _Signed);
+}
+
+const void* __cdecl __std_is_sorted_until_8(
+    const void* const _First, const void* const _Last, const bool _Signed) noexcept {
+    return _Is_sorted_until_impl<_Neighbor_traits_8, long long, unsigned long long>(_First, _Last, _Signed);
+}
+} // extern "C"
+
+namespace {
+    struct _Mersenne_traits_4 {
+        static constexpr size_t _Lanes_avx = 8;
+        static constexpr size_t _Lanes_sse = 4;
+
+        static __m256i _Set_avx(const unsigned long _Val) noexcept {
+            return _mm256_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_sub_epi32(_Lhs, _Rhs);
+        }
+
+        static __m256i _Shl_avx(const __m256i _Val, const __m128i _Count) noexcept {
+            return _mm256_sll_epi32(_Val, _Count);
+        }
+
+        static __m256i _Shr_avx(const __m256i _Val, const __m128i _Count) noexcept {
+            return _mm256_srl_epi32(_Val, _Count);
+        }
+
+        static __m128i _Set_sse(const unsigned long _Val) noexcept {
+            return _mm_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m128i _Sub_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_sub_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Shl_sse(const __m128i _Val, const __m128i _Count) noexcept {
+            return _mm_sll_epi32(_Val, _Count);
+        }
+
+        static __m128i _Shr_sse(const __m128i _Val, const __m128i _Count) noexcept {
+            return _mm_srl_epi32(_Val, _Count);
+        }
+    };
+
+    struct _Mersenne_traits_8 {
+        static constexpr size_t _Lanes_avx = 4;
+        static constexpr size_t _Lanes_sse = 2;
+
+        static __m256i _Set_avx(const unsigned long long _Val) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m256i _Sub_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_sub_epi64(_Lhs, _Rhs);
+        }
+
+        static __m256i _Shl_avx(const __m256i _Val, const __m128i _Count) noexcept {
+            return _mm256_sll_epi64(_Val, _Count);
+        }
+
+        static __m256i _Shr_avx(const __m256i _Val, const __m128i _Count) noexcept {
+            return _mm256_srl_epi64(_Val, _Count);
+        }
+
+        static __m128i _Set_sse(const unsigned long long _Val) noexcept {
+            return _mm_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m128i _Sub_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_sub_epi64(_Lhs, _Rhs);
+        }
+
+        static __m128i _Shl_sse(const __m128i _Val, const __m128i _Count) noexcept {
+            return _mm_sll_epi64(_Val, _Count);
+        }
+
+        static __m128i _Shr_sse(const __m128i _Val, const __m128i _Count) noexcept {
+            return _mm_srl_epi64(_Val, _Count);
+        }
+    };
+
+    bool _Mersenne_sse2_available() noexcept {
+#ifdef _M_IX86
+        return _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+        return true;
+#endif // _M_IX86
+    }
+
+    template <class _Traits, class _Ty>
+    void _Mersenne_twist_impl(void* const _Dest, const void* const _Src, const void* const _Src_m,
+        const size_t _Count, const _Ty _Px, const _Ty _Hmsk) noexcept {
+        // x[i] = twist(x[i - n], x[i - n + 1]) ^ x[i - n + m], a vector of words at a time; every word of _Src_m that
+        // is also one of _Dest was written by an earlier vector, because it trails by at least _Lanes_avx words
+        const auto _Out        = static_cast<_Ty*>(_Dest);
+        const auto _In         = static_cast<const _Ty*>(_Src);
+        const auto _In_m       = static_cast<const _Ty*>(_Src_m);
+        const __m128i _One_bit = _mm_cvtsi32_si128(1);
+        size_t _Ix             = 0;
+        if (_Count >= _Traits::_Lanes_avx && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Upper = _Traits::_Set_avx(_Hmsk);
+            const __m256i _Xor   = _Traits::_Set_avx(_Px);
+            const __m256i _Low   = _Traits::_Set_avx(1);
+            const __m256i _Zero  = _mm256_setzero_si256();
+            for (; _Count - _Ix >= _Traits::_Lanes_avx; _Ix += _Traits::_Lanes_avx) {
+                const __m256i _Cur  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_In + _Ix));
+                const __m256i _Next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_In + _Ix + 1));
+                const __m256i _Far  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_In_m + _Ix));
+                const __m256i _Tmp =
+                    _mm256_or_si256(_mm256_and_si256(_Cur, _Upper), _mm256_andnot_si256(_Upper, _Next));
+                const __m256i _Odd  = _Traits::_Sub_avx(_Zero, _mm256_and_si256(_Tmp, _Low)); // all ones if odd
+                const __m256i _Res  = _mm256_xor_si256(
+                    _mm256_xor_si256(_Traits::_Shr_avx(_Tmp, _One_bit), _mm256_and_si256(_Odd, _Xor)), _Far);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out + _Ix), _Res);
+            }
+        }
+
+        if (_Count - _Ix >= _Traits::_Lanes_sse && _Mersenne_sse2_available()) {
+            const __m128i _Upper = _Traits::_Set_sse(_Hmsk);
+            const __m128i _Xor   = _Traits::_Set_sse(_Px);
+            const __m128i _Low   = _Traits::_Set_sse(1);
+            const __m128i _Zero  = _mm_setzero_si128();
+            for (; _Count - _Ix >= _Traits::_Lanes_sse; _Ix += _Traits::_Lanes_sse) {
+                const __m128i _Cur  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_In + _Ix));
+                const __m128i _Next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_In + _Ix + 1));
+                const __m128i _Far  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_In_m + _Ix));
+                const __m128i _Tmp  = _mm_or_si128(_mm_and_si128(_Cur, _Upper), _mm_andnot_si128(_Upper, _Next));
+                const __m128i _Odd  = _Traits::_Sub_sse(_Zero, _mm_and_si128(_Tmp, _Low)); // all ones if odd
+                const __m128i _Res  = _mm_xor_si128(
+                    _mm_xor_si128(_Traits::_Shr_sse(_Tmp, _One_bit), _mm_and_si128(_Odd, _Xor)), _Far);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out + _Ix), _Res);
+            }
+        }
+
+        for (; _Ix < _Count; ++_Ix) {
+            const _Ty _Tmp = (_In[_Ix] & _Hmsk) | (_In[_Ix + 1] & ~_Hmsk);
+            _Out[_Ix]      = (_Tmp >> 1) ^ (_Tmp & 1 ? _Px : 0) ^ _In_m[_Ix];
+        }
+    }
+
+    template <class _Traits, class _Ty>
+    void _Mersenne_temper_impl(void* const _Dest, const void* const _Src, const size_t _Count, const _Ty _Dx,
+        const _Ty _Bx, const _Ty _Cx, const int _Ux, const int _Sx, const int _Tx, const int _Lx) noexcept {
+        const auto _Out        = static_cast<_Ty*>(_Dest);
+        const auto _In         = static_cast<const _Ty*>(_Src);
+        const __m128i _Shift_u = _mm_cvtsi32_si128(_Ux);
+        const __m128i _Shift_s = _mm_cvtsi32_si128(_Sx);
+        const __m128i _Shift_t = _mm_cvtsi32_si128(_Tx);
+        const __m128i _Shift_l = _mm_cvtsi32_si128(_Lx);
+        size_t _Ix             = 0;
+        if (_Count >= _Traits::_Lanes_avx && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Mask_d = _Traits::_Set_avx(_Dx);
+            const __m256i _Mask_b = _Traits::_Set_avx(_Bx);
+            const __m256i _Mask_c = _Traits::_Set_avx(_Cx);
+            for (; _Count - _Ix >= _Traits::_Lanes_avx; _Ix += _Traits::_Lanes_avx) {
+                __m256i _Res = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_In + _Ix));
+                _Res         = _mm256_xor_si256(_Res, _mm256_and_si256(_Traits::_Shr_avx(_Res, _Shift_u), _Mask_d));
+                _Res         = _mm256_xor_si256(_Res, _mm256_and_si256(_Traits::_Shl_avx(_Res, _Shift_s), _Mask_b));
+                _Res         = _mm256_xor_si256(_Res, _mm256_and_si256(_Traits::_Shl_avx(_Res, _Shift_t), _Mask_c));
+                _Res         = _mm256_xor_si256(_Res, _Traits::_Shr_avx(_Res, _Shift_l));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Out + _Ix), _Res);
+            }
+        }
+
+        if (_Count - _Ix >= _Traits::_Lanes_sse && _Mersenne_sse2_available()) {
+            const __m128i _Mask_d = _Traits::_Set_sse(_Dx);
+            const __m128i _Mask_b = _Traits::_Set_sse(_Bx);
+            const __m128i _Mask_c = _Traits::_Set_sse(_Cx);
+            for (; _Count - _Ix >= _Traits::_Lanes_sse; _Ix += _Traits::_Lanes_sse) {
+                __m128i _Res = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_In + _Ix));
+                _Res         = _mm_xor_si128(_Res, _mm_and_si128(_Traits::_Shr_sse(_Res, _Shift_u), _Mask_d));
+                _Res         = _mm_xor_si128(_Res, _mm_and_si128(_Traits::_Shl_sse(_Res, _Shift_s), _Mask_b));
+                _Res         = _mm_xor_si128(_Res, _mm_and_si128(_Traits::_Shl_sse(_Res, _Shift_t), _Mask_c));
+                _Res         = _mm_xor_si128(_Res, _Traits::_Shr_sse(_Res, _Shift_l));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(_Out + _Ix), _Res);
+            }
+        }
+
+        for (; _Ix < _Count; ++_Ix) {
+            _Ty _Res = _In[_Ix];
+            _Res ^= (_Res >> _Ux) & _Dx;
+            _Res ^= (_Res << _Sx) & _Bx;
+            _Res ^= (_Res << _Tx) & _Cx;
+            _Res ^= _Res >> _Lx;
+            _Out[_Ix] = _Res;
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_mersenne_twist_4(void* const _Dest, const void* const _Src,
+    const void* const _Src_m, const size_t _Count, const unsigned long _Px, const unsigned long _Hmsk) noexcept {
+    _Mersenne_twist_impl<_Mersenne_traits_4>(_Dest, _Src, _Src_m, _Count, _Px, _Hmsk);
+}
+
+__declspec(noalias) void __cdecl __std_mersenne_twist_8(void* const _Dest, const void* const _Src,
+    const void* const _Src_m, const size_t _Count, const unsigned long long _Px,
+    const unsigned long long _Hmsk) noexcept {
+    _Mersenne_twist_impl<_Mersenne_traits_8>(_Dest, _Src, _Src_m, _Count, _Px, _Hmsk);
+}
+
+__declspec(noalias) void __cdecl __std_mersenne_temper_4(void* const _Dest, const void* const _Src,
+    const size_t _Count, const unsigned long _Dx, const unsigned long _Bx, const unsigned long _Cx, const int _Ux,
+    const int _Sx, const int _Tx, const int _Lx) noexcept {
+    _Mersenne_temper_impl<_Mersenne_traits_4>(_Dest, _Src, _Count, _Dx, _Bx, _Cx, _Ux, _Sx, _Tx, _Lx);
+}
+
+__declspec(noalias) void __cdecl __std_mersenne_temper_8(void* const _Dest, const void* const _Src,
+    const size_t _Count, const unsigned long long _Dx, const unsigned long long _Bx, const unsigned long long _Cx,
+    const int _Ux, const int _Sx, const int _Tx, const int _Lx) noexcept {
+    _Mersenne_temper_impl<_Mersenne_traits_8>(_Dest, _Src, _Count, _Dx, _Bx, _Cx, _Ux, _Sx, _Tx, _Lx);
+}
+} // extern "C"
+
+namespace {
+    void _Philox4x32_block(unsigned long* const _Out, unsigned long* const _Ctr, const unsigned long* const _Key,
+        const unsigned long* const _Consts, const size_t _Rounds) noexcept { // one block, then ++_Ctr
+        unsigned long _Val[4] = {_Ctr[0], _Ctr[1], _Ctr[2], _Ctr[3]};
+        unsigned long _Kx[2]  = {_Key[0], _Key[1]};
+        for (size_t _Round = 0; _Round < _Rounds; ++_Round) {
+            const unsigned long long _Prod0 = static_cast<unsigned long long>(_Consts[0]) * _Val[2];
+            const unsigned long long _Prod1 = static_cast<unsigned long long>(_Consts[2]) * _Val[0];
+            _Val[0]                         = static_cast<unsigned long>(_Prod0 >> 32) ^ _Kx[0] ^ _Val[1];
+            _Val[1]                         = static_cast<unsigned long>(_Prod0);
+            _Val[2]                         = static_cast<unsigned long>(_Prod1 >> 32) ^ _Kx[1] ^ _Val[3];
+            _Val[3]                         = static_cast<unsigned long>(_Prod1);
+            _Kx[0] += _Consts[1];
+            _Kx[1] += _Consts[3];
+        }
+
+        for (size_t _Ix = 0; _Ix < 4; ++_Ix) {
+            _Out[_Ix] = _Val[_Ix];
+        }
+
+        for (size_t _Ix = 0; _Ix < 4 && ++_Ctr[_Ix] == 0; ++_Ix) {
+        }
+    }
+
+    __m256i _Philox_mulhilo_avx(const __m256i _Val, const __m256i _Mul, __m256i& _Lo) noexcept {
+        // returns the high halves of the 8 products; _mm256_mul_epu32 multiplies the even lanes only
+        const __m256i _Even = _mm256_mul_epu32(_Val, _Mul);
+        const __m256i _Odd  = _mm256_mul_epu32(_mm256_srli_epi64(_Val, 32), _Mul);
+        _Lo                 = _mm256_blend_epi32(_Even, _mm256_slli_epi64(_Odd, 32), 0xAA);
+        return _mm256_blend_epi32(_mm256_srli_epi64(_Even, 32), _Odd, 0xAA);
+    }
+
+    void _Philox4x32_impl(unsigned long* _Out, size_t _Blocks, unsigned long* const _Ctr,
+        const unsigned long* const _Key, const unsigned long* const _Consts, const size_t _Rounds) noexcept {
+        // with AVX2, 8 blocks whose counters differ only in the lowest word are computed side by side, one word per
+        // vector; SSE2 has no gain over the scalar loop, which needs no shuffles to split the 64-bit products
+        if (_Blocks >= 8 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Mul0 = _mm256_set1_epi32(static_cast<int>(_Consts[0]));
+            const __m256i _Mul1 = _mm256_set1_epi32(static_cast<int>(_Consts[2]));
+            const __m256i _Step = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            while (_Blocks >= 8) {
+                if (_Ctr[0] >= 0xFFFFFFF8UL) { // the lowest word wraps within the next 8 blocks
+                    _Philox4x32_block(_Out, _Ctr, _Key, _Consts, _Rounds);
+                    _Out += 4;
+                    --_Blocks;
+                    continue;
+                }
+
+                __m256i _X0 = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(_Ctr[0])), _Step);
+                __m256i _X1 = _mm256_set1_epi32(static_cast<int>(_Ctr[1]));
+                __m256i _X2 = _mm256_set1_epi32(static_cast<int>(_Ctr[2]));
+                __m256i _X3 = _mm256_set1_epi32(static_cast<int>(_Ctr[3]));
+
+                unsigned long _Kx[2] = {_Key[0], _Key[1]};
+                for (size_t _Round = 0; _Round < _Rounds; ++_Round) {
+                    __m256i _Lo0;
+                    __m256i _Lo1;
+                    const __m256i _Hi0 = _Philox_mulhilo_avx(_X2, _Mul0, _Lo0);
+                    const __m256i _Hi1 = _Philox_mulhilo_avx(_X0, _Mul1, _Lo1);
+                    const __m256i _K0  = _mm256_set1_epi32(static_cast<int>(_Kx[0]));
+                    const __m256i _K1  = _mm256_set1_epi32(static_cast<int>(_Kx[1]));
+                    _X0                = _mm256_xor_si256(_mm256_xor_si256(_Hi0, _K0), _X1);
+                    _X1                = _Lo0;
+                    _X2                = _mm256_xor_si256(_mm256_xor_si256(_Hi1, _K1), _X3);
+                    _X3                = _Lo1;
+                    _Kx[0] += _Consts[1];
+                    _Kx[1] += _Consts[3];
+                }
+
+                // transpose to block order: _Out[4 * lane + word] = _Xword[lane]
+                const __m256i _T0 = _mm256_unpacklo_epi32(_X0, _X1);
+                const __m256i _T1 = _mm256_unpacklo_epi32(_X2, _X3);
+                const __m256i _T2 = _mm256_unpackhi_epi32(_X0, _X1);
+                const __m256i _T3 = _mm256_unpackhi_epi32(_X2, _X3);
+                const __m256i _U0 = _mm256_unpacklo_epi64(_T0, _T1); // lanes 0 and 4
+                const __m256i _U1 = _mm256_unpackhi_epi64(_T0, _T1); // lanes 1 and 5
+                const __m256i _U2 = _mm256_unpacklo_epi64(_T2, _T3); // lanes 2 and 6
+                const __m256i _U3 = _mm256_unpackhi_epi64(_T2, _T3); // lanes 3 and 7
+                const auto _Dest  = reinterpret_cast<__m256i*>(_Out);
+                _mm256_storeu_si256(_Dest, _mm256_permute2x128_si256(_U0, _U1, 0x20));
+                _mm256_storeu_si256(_Dest + 1, _mm256_permute2x128_si256(_U2, _U3, 0x20));
+                _mm256_storeu_si256(_Dest + 2, _mm256_permute2x128_si256(_U0, _U1, 0x31));
+                _mm256_storeu_si256(_Dest + 3, _mm256_permute2x128_si256(_U2, _U3, 0x31));
+
+                _Ctr[0] += 8;
+                _Out += 32;
+                _Blocks -= 8;
+            }
+        }
+
+        for (; _Blocks != 0; --_Blocks, _Out += 4) {
+            _Philox4x32_block(_Out, _Ctr, _Key, _Consts, _Rounds);
+        }
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_philox4x32(void* const _Dest, const size_t _Blocks, void* const _Counter,
+    const void* const _Key, const void* const _Consts, const size_t _Rounds) noexcept {
+    _Philox4x32_impl(static_cast<unsigned long*>(_Dest), _Blocks, static_cast<unsigned long*>(_Counter),
+        static_cast<const unsigned long*>(_Key), static_cast<const unsigned long*>(_Consts), _Rounds);
+}
+} // extern "C"
+
+namespace {
+    // Bytes in [_Low, _Low + 26) are found with one signed comparison: adding 0x80 - _Low moves that range to
+    // [-128, -102), and everything else lands at or above -102. The case bit 0x20 is then flipped in those lanes.
+    __m256i _Ascii_flip_case_avx(const __m256i _Val, const __m256i _Bias, const __m256i _Limit) noexcept {
+        const __m256i _In_range = _mm256_cmpgt_epi8(_Limit, _mm256_add_epi8(_Val, _Bias));
+        return _mm256_xor_si256(_Val, _mm256_and_si256(_In_range, _mm256_set1_epi8(0x20)));
+    }
+
+    __m128i _Ascii_flip_case_sse(const __m128i _Val, const __m128i _Bias, const __m128i _Limit) noexcept {
+        const __m128i _In_range = _mm_cmplt_epi8(_mm_add_epi8(_Val, _Bias), _Limit);
+        return _mm_xor_si128(_Val, _mm_and_si128(_In_range, _mm_set1_epi8(0x20)));
+    }
+
+    void _Ascii_flip_case_impl(unsigned char* _First, unsigned char* const _Last, const unsigned char _Low) noexcept {
+        // flips the case of every byte in [_Low, _Low + 26); _Low is 'A' to lower the range and 'a' to raise it
+        const char _Bias_val = static_cast<char>(0x80 - _Low);
+        if (_Last - _First >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Bias  = _mm256_set1_epi8(_Bias_val);
+            const __m256i _Limit = _mm256_set1_epi8(-128 + 26);
+            do {
+                const auto _Ptr = reinterpret_cast<__m256i*>(_First);
+                _mm256_storeu_si256(_Ptr, _Ascii_flip_case_avx(_mm256_loadu_si256(_Ptr), _Bias, _Limit));
+                _First += 32;
+            } while (_Last - _First >= 32);
+        }
+
+#ifdef _M_IX86
+        const bool _Sse_available = _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+        constexpr bool _Sse_available = true;
+#endif // _M_IX86
+        if (_Last - _First >= 16 && _Sse_available) {
+            const __m128i _Bias  = _mm_set1_epi8(_Bias_val);
+            const __m128i _Limit = _mm_set1_epi8(-128 + 26);
+            do {
+                const auto _Ptr = reinterpret_cast<__m128i*>(_First);
+                _mm_storeu_si128(_Ptr, _Ascii_flip_case_sse(_mm_loadu_si128(_Ptr), _Bias, _Limit));
+                _First += 16;
+            } while (_Last - _First >= 16);
+        }
+
+        for (; _First != _Last; ++_First) {
+            if (static_cast<unsigned char>(*_First - _Low) < 26) {
+                *_First ^= 0x20;
+            }
+        }
+    }
+
+    size_t _Ascii_imismatch_impl(
+        const unsigned char* const _First1, const unsigned char* const _First2, const size_t _Count) noexcept {
+        // returns the index of the first pair of bytes that differ after ASCII lowercasing, or _Count
+        size_t _Result = 0;
+        if (_Count >= 32 && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            const __m256i _Bias   = _mm256_set1_epi8(static_cast<char>(0x80 - 'A'));
+            const __m256i _Limit  = _mm256_set1_epi8(-128 + 26);
+            const size_t _Stop_at = _Count & ~static_cast<size_t>(31);
+            do {
+                const __m256i _Elem1 = _Ascii_flip_case_avx(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First1 + _Result)), _Bias, _Limit);
+                const __m256i _Elem2 = _Ascii_flip_case_avx(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_First2 + _Result)), _Bias, _Limit);
+                const unsigned int _Bingo =
+                    ~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_Elem1, _Elem2)));
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return _Result + _Offset;
+                }
+
+                _Result += 32;
+            } while (_Result != _Stop_at);
+        }
+
+#ifdef _M_IX86
+        const bool _Sse_available = _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+        constexpr bool _Sse_available = true;
+#endif // _M_IX86
+        if (_Count - _Result >= 16 && _Sse_available) {
+            const __m128i _Bias   = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+            const __m128i _Limit  = _mm_set1_epi8(-128 + 26);
+            const size_t _Stop_at = _Result + ((_Count - _Result) & ~static_cast<size_t>(15));
+            do {
+                const __m128i _Elem1 = _Ascii_flip_case_sse(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First1 + _Result)), _Bias, _Limit);
+                const __m128i _Elem2 = _Ascii_flip_case_sse(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(_First2 + _Result)), _Bias, _Limit);
+                const unsigned int _Bingo =
+                    static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_Elem1, _Elem2))) ^ 0xFFFFu;
+                if (_Bingo != 0) {
+                    unsigned long _Offset;
+                    _BitScanForward(&_Offset, _Bingo);
+                    return _Result + _Offset;
+                }
+
+                _Result += 16;
+            } while (_Result != _Stop_at);
+        }
+
+        for (; _Result != _Count; ++_Result) {
+            unsigned char _Val1 = _First1[_Result];
+            unsigned char _Val2 = _First2[_Result];
+            if (static_cast<unsigned char>(_Val1 - 'A') < 26) {
+                _Val1 ^= 0x20;
+            }
+
+            if (static_cast<unsigned char>(_Val2 - 'A') < 26) {
+                _Val2 ^= 0x20;
+            }
+
+            if (_Val1 != _Val2) {
+                break;
+            }
+        }
+
+        return _Result;
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) void __cdecl __std_ascii_tolower_1(void* const _First, void* const _Last) noexcept {
+    _Ascii_flip_case_impl(static_cast<unsigned char*>(_First), static_cast<unsigned char*>(_Last), 'A');
+}
+
+__declspec(noalias) void __cdecl __std_ascii_toupper_1(void* const _First, void* const _Last) noexcept {
+    _Ascii_flip_case_impl(static_cast<unsigned char*>(_First), static_cast<unsigned char*>(_Last), 'a');
+}
+
+__declspec(noalias) size_t __cdecl __std_ascii_imismatch_1(
+    const void* const _First1, const void* const _First2, const size_t _Count) noexcept {
+    return _Ascii_imismatch_impl(
+        static_cast<const unsigned char*>(_First1), static_cast<const unsigned char*>(_First2), _Count);
+}
+} // extern "C"
+
+namespace {
+    // Prefix sums a vector at a time: log2(lanes) shifted additions give the sums within a vector, then the running
+    // total of the vectors before it is added to every lane, so each vector waits on the last only for that addition.
+    // Lanes shifted in by the floating-point traits hold -0.0, which unlike 0.0 leaves every sum, even -0.0, unchanged.
+    struct _Scan_traits_4 {
+        using _Ty                          = unsigned long;
+        static constexpr size_t _Lanes_avx = 8;
+        static constexpr size_t _Lanes_sse = 4;
+
+        static __m256i _Load_avx(const _Ty* const _Src) noexcept {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+        }
+
+        static void _Store_avx(_Ty* const _Dest, const __m256i _Val) noexcept {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+        }
+
+        static __m256i _Set_avx(const _Ty _Val) noexcept {
+            return _mm256_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m256i _Add_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_add_epi32(_Lhs, _Rhs);
+        }
+
+        static __m256i _Prefix_avx(__m256i _Val) noexcept {
+            _Val = _mm256_add_epi32(_Val, _mm256_slli_si256(_Val, 4));
+            _Val = _mm256_add_epi32(_Val, _mm256_slli_si256(_Val, 8));
+            // the total of the low half into every lane of the high half
+            return _mm256_add_epi32(_Val, _mm256_shuffle_epi32(_mm256_permute2x128_si256(_Val, _Val, 0x08), 0xFF));
+        }
+
+        static __m256i _Shift_avx(const __m256i _Val) noexcept { // one lane up, for exclusive sums
+            const __m256i _Rotated = _mm256_permutevar8x32_epi32(_Val, _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6));
+            return _mm256_blend_epi32(_Rotated, _mm256_setzero_si256(), 0x01);
+        }
+
+        static __m256i _Broadcast_last_avx(const __m256i _Val) noexcept {
+            return _mm256_permutevar8x32_epi32(_Val, _mm256_set1_epi32(7));
+        }
+
+        static __m128i _Load_sse(const _Ty* const _Src) noexcept {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+        }
+
+        static void _Store_sse(_Ty* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+        }
+
+        static __m128i _Set_sse(const _Ty _Val) noexcept {
+            return _mm_set1_epi32(static_cast<int>(_Val));
+        }
+
+        static __m128i _Add_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_add_epi32(_Lhs, _Rhs);
+        }
+
+        static __m128i _Prefix_sse(__m128i _Val) noexcept {
+            _Val = _mm_add_epi32(_Val, _mm_slli_si128(_Val, 4));
+            return _mm_add_epi32(_Val, _mm_slli_si128(_Val, 8));
+        }
+
+        static __m128i _Shift_sse(const __m128i _Val) noexcept {
+            return _mm_slli_si128(_Val, 4);
+        }
+
+        static __m128i _Broadcast_last_sse(const __m128i _Val) noexcept {
+            return _mm_shuffle_epi32(_Val, 0xFF);
+        }
+    };
+
+    struct _Scan_traits_8 {
+        using _Ty                          = unsigned long long;
+        static constexpr size_t _Lanes_avx = 4;
+        static constexpr size_t _Lanes_sse = 2;
+
+        static __m256i _Load_avx(const _Ty* const _Src) noexcept {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_Src));
+        }
+
+        static void _Store_avx(_Ty* const _Dest, const __m256i _Val) noexcept {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(_Dest), _Val);
+        }
+
+        static __m256i _Set_avx(const _Ty _Val) noexcept {
+            return _mm256_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m256i _Add_avx(const __m256i _Lhs, const __m256i _Rhs) noexcept {
+            return _mm256_add_epi64(_Lhs, _Rhs);
+        }
+
+        static __m256i _Prefix_avx(__m256i _Val) noexcept {
+            _Val = _mm256_add_epi64(_Val, _mm256_slli_si256(_Val, 8));
+            // the total of the low half into both lanes of the high half
+            const __m256i _Low_half = _mm256_permute2x128_si256(_Val, _Val, 0x08);
+            return _mm256_add_epi64(_Val, _mm256_unpackhi_epi64(_Low_half, _Low_half));
+        }
+
+        static __m256i _Shift_avx(const __m256i _Val) noexcept {
+            return _mm256_blend_epi32(_mm256_permute4x64_epi64(_Val, 0x93), _mm256_setzero_si256(), 0x03);
+        }
+
+        static __m256i _Broadcast_last_avx(const __m256i _Val) noexcept {
+            return _mm256_permute4x64_epi64(_Val, 0xFF);
+        }
+
+        static __m128i _Load_sse(const _Ty* const _Src) noexcept {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(_Src));
+        }
+
+        static void _Store_sse(_Ty* const _Dest, const __m128i _Val) noexcept {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(_Dest), _Val);
+        }
+
+        static __m128i _Set_sse(const _Ty _Val) noexcept {
+            return _mm_set1_epi64x(static_cast<long long>(_Val));
+        }
+
+        static __m128i _Add_sse(const __m128i _Lhs, const __m128i _Rhs) noexcept {
+            return _mm_add_epi64(_Lhs, _Rhs);
+        }
+
+        static __m128i _Prefix_sse(const __m128i _Val) noexcept {
+            return _mm_add_epi64(_Val, _mm_slli_si128(_Val, 8));
+        }
+
+        static __m128i _Shift_sse(const __m128i _Val) noexcept {
+            return _mm_slli_si128(_Val, 8);
+        }
+
+        static __m128i _Broadcast_last_sse(const __m128i _Val) noexcept {
+            return _mm_unpackhi_epi64(_Val, _Val);
+        }
+    };
+
+    struct _Scan_traits_f {
+        using _Ty                          = float;
+        static constexpr size_t _Lanes_avx = 8;
+        static constexpr size_t _Lanes_sse = 4;
+
+        static __m256 _Load_avx(const _Ty* const _Src) noexcept {
+            return _mm256_loadu_ps(_Src);
+        }
+
+        static void _Store_avx(_Ty* const _Dest, const __m256 _Val) noexcept {
+            _mm256_storeu_ps(_Dest, _Val);
+        }
+
+        static __m256 _Set_avx(const _Ty _Val) noexcept {
+            return _mm256_set1_ps(_Val);
+        }
+
+        static __m256 _Add_avx(const __m256 _Lhs, const __m256 _Rhs) noexcept {
+            return _mm256_add_ps(_Lhs, _Rhs);
+        }
+
+        static __m256 _Prefix_avx(__m256 _Val) noexcept {
+            const float _Nz         = -0.0f;
+            const __m256 _Shifted_1 = _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(_Val), 4));
+            _Val = _mm256_add_ps(_Val, _mm256_or_ps(_Shifted_1, _mm256_setr_ps(_Nz, 0, 0, 0, _Nz, 0, 0, 0)));
+            const __m256 _Shifted_2 = _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(_Val), 8));
+            _Val = _mm256_add_ps(_Val, _mm256_or_ps(_Shifted_2, _mm256_setr_ps(_Nz, _Nz, 0, 0, _Nz, _Nz, 0, 0)));
+            // the total of the low half into every lane of the high half
+            const __m256 _Low_total = _mm256_permute_ps(_mm256_permute2f128_ps(_Val, _Val, 0x08), 0xFF);
+            return _mm256_add_ps(_Val, _mm256_or_ps(_Low_total, _mm256_setr_ps(_Nz, _Nz, _Nz, _Nz, 0, 0, 0, 0)));
+        }
+
+        static __m256 _Shift_avx(const __m256 _Val) noexcept {
+            const __m256 _Rotated = _mm256_permutevar8x32_ps(_Val, _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6));
+            return _mm256_blend_ps(_Rotated, _mm256_set1_ps(-0.0f), 0x01);
+        }
+
+        static __m256 _Broadcast_last_avx(const __m256 _Val) noexcept {
+            return _mm256_permutevar8x32_ps(_Val, _mm256_set1_epi32(7));
+        }
+
+        static __m128 _Load_sse(const _Ty* const _Src) noexcept {
+            return _mm_loadu_ps(_Src);
+        }
+
+        static void _Store_sse(_Ty* const _Dest, const __m128 _Val) noexcept {
+            _mm_storeu_ps(_Dest, _Val);
+        }
+
+        static __m128 _Set_sse(const _Ty _Val) noexcept {
+            return _mm_set1_ps(_Val);
+        }
+
+        static __m128 _Add_sse(const __m128 _Lhs, const __m128 _Rhs) noexcept {
+            return _mm_add_ps(_Lhs, _Rhs);
+        }
+
+        static __m128 _Prefix_sse(__m128 _Val) noexcept {
+            _Val                    = _mm_add_ps(_Val, _Shift_sse(_Val));
+            const __m128 _Shifted_2 = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(_Val), 8));
+            return _mm_add_ps(_Val, _mm_or_ps(_Shifted_2, _mm_setr_ps(-0.0f, -0.0f, 0, 0)));
+        }
+
+        static __m128 _Shift_sse(const __m128 _Val) noexcept {
+            return _mm_or_ps(
+                _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(_Val), 4)), _mm_setr_ps(-0.0f, 0, 0, 0));
+        }
+
+        static __m128 _Broadcast_last_sse(const __m128 _Val) noexcept {
+            return _mm_shuffle_ps(_Val, _Val, 0xFF);
+        }
+    };
+
+    struct _Scan_traits_d {
+        using _Ty                          = double;
+        static constexpr size_t _Lanes_avx = 4;
+        static constexpr size_t _Lanes_sse = 2;
+
+        static __m256d _Load_avx(const _Ty* const _Src) noexcept {
+            return _mm256_loadu_pd(_Src);
+        }
+
+        static void _Store_avx(_Ty* const _Dest, const __m256d _Val) noexcept {
+            _mm256_storeu_pd(_Dest, _Val);
+        }
+
+        static __m256d _Set_avx(const _Ty _Val) noexcept {
+            return _mm256_set1_pd(_Val);
+        }
+
+        static __m256d _Add_avx(const __m256d _Lhs, const __m256d _Rhs) noexcept {
+            return _mm256_add_pd(_Lhs, _Rhs);
+        }
+
+        static __m256d _Prefix_avx(__m256d _Val) noexcept {
+            const __m256d _Shifted = _mm256_castsi256_pd(_mm256_slli_si256(_mm256_castpd_si256(_Val), 8));
+            _Val                   = _mm256_add_pd(_Val, _mm256_or_pd(_Shifted, _mm256_setr_pd(-0.0, 0, -0.0, 0)));
+            // the total of the low half into both lanes of the high half
+            const __m256d _Low_total = _mm256_permute_pd(_mm256_permute2f128_pd(_Val, _Val, 0x08), 0xF);
+            return _mm256_add_pd(_Val, _mm256_or_pd(_Low_total, _mm256_setr_pd(-0.0, -0.0, 0, 0)));
+        }
+
+        static __m256d _Shift_avx(const __m256d _Val) noexcept {
+            return _mm256_blend_pd(_mm256_permute4x64_pd(_Val, 0x93), _mm256_set1_pd(-0.0), 0x1);
+        }
+
+        static __m256d _Broadcast_last_avx(const __m256d _Val) noexcept {
+            return _mm256_permute4x64_pd(_Val, 0xFF);
+        }
+
+        static __m128d _Load_sse(const _Ty* const _Src) noexcept {
+            return _mm_loadu_pd(_Src);
+        }
+
+        static void _Store_sse(_Ty* const _Dest, const __m128d _Val) noexcept {
+            _mm_storeu_pd(_Dest, _Val);
+        }
+
+        static __m128d _Set_sse(const _Ty _Val) noexcept {
+            return _mm_set1_pd(_Val);
+        }
+
+        static __m128d _Add_sse(const __m128d _Lhs, const __m128d _Rhs) noexcept {
+            return _mm_add_pd(_Lhs, _Rhs);
+        }
+
+        static __m128d _Prefix_sse(const __m128d _Val) noexcept {
+            return _mm_add_pd(_Val, _Shift_sse(_Val));
+        }
+
+        static __m128d _Shift_sse(const __m128d _Val) noexcept {
+            return _mm_or_pd(_mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(_Val), 8)), _mm_setr_pd(-0.0, 0));
+        }
+
+        static __m128d _Broadcast_last_sse(const __m128d _Val) noexcept {
+            return _mm_unpackhi_pd(_Val, _Val);
+        }
+    };
+
+    template <class _Traits, class _Ty = typename _Traits::_Ty>
+    _Ty _Scan_plus_impl(const void* const _First, const void* const _Last, void* const _Dest, _Ty _Val,
+        const bool _Exclusive) noexcept {
+        // writes the running sums of [_First, _Last) from _Val to _Dest, which may be _First; returns the total
+        const auto _In      = static_cast<const _Ty*>(_First);
+        const auto _Out     = static_cast<_Ty*>(_Dest);
+        const size_t _Count = static_cast<size_t>(static_cast<const _Ty*>(_Last) - _In);
+        size_t _Ix          = 0;
+        if (_Count >= _Traits::_Lanes_avx && _bittest(&__isa_enabled, __ISA_AVAILABLE_AVX2)) {
+            auto _Carry = _Traits::_Set_avx(_Val);
+            for (; _Count - _Ix >= _Traits::_Lanes_avx; _Ix += _Traits::_Lanes_avx) {
+                const auto _Sums = _Traits::_Prefix_avx(_Traits::_Load_avx(_In + _Ix));
+                _Traits::_Store_avx(
+                    _Out + _Ix, _Traits::_Add_avx(_Carry, _Exclusive ? _Traits::_Shift_avx(_Sums) : _Sums));
+                _Carry = _Traits::_Add_avx(_Carry, _Traits::_Broadcast_last_avx(_Sums));
+            }
+
+            _Ty _Lanes[_Traits::_Lanes_avx];
+            _Traits::_Store_avx(_Lanes, _Carry);
+            _Val = _Lanes[0];
+        }
+
+#ifdef _M_IX86
+        const bool _Sse_available = _bittest(&__isa_enabled, __ISA_AVAILABLE_SSE2) != 0;
+#else // ^^^ _M_IX86 / !_M_IX86 vvv
+        constexpr bool _Sse_available = true;
+#endif // _M_IX86
+        if (_Count - _Ix >= _Traits::_Lanes_sse && _Sse_available) {
+            auto _Carry = _Traits::_Set_sse(_Val);
+            for (; _Count - _Ix >= _Traits::_Lanes_sse; _Ix += _Traits::_Lanes_sse) {
+                const auto _Sums = _Traits::_Prefix_sse(_Traits::_Load_sse(_In + _Ix));
+                _Traits::_Store_sse(
+                    _Out + _Ix, _Traits::_Add_sse(_Carry, _Exclusive ? _Traits::_Shift_sse(_Sums) : _Sums));
+                _Carry = _Traits::_Add_sse(_Carry, _Traits::_Broadcast_last_sse(_Sums));
+            }
+
+            _Ty _Lanes[_Traits::_Lanes_sse];
+            _Traits::_Store_sse(_Lanes, _Carry);
+            _Val = _Lanes[0];
+        }
+
+        for (; _Ix < _Count; ++_Ix) {
+            const _Ty _Elem = _In[_Ix];
+            if (_Exclusive) {
+                _Out[_Ix] = _Val;
+                _Val += _Elem;
+            } else {
+                _Val += _Elem;
+                _Out[_Ix] = _Val;
+            }
+        }
+
+        return _Val;
+    }
+} // unnamed namespace
+
+extern "C" {
+__declspec(noalias) unsigned long __cdecl __std_inclusive_scan_plus_4(const void* const _First,
+    const void* const _Last, void* const _Dest, const unsigned long _Val, const bool _Exclusive) noexcept {
+    return _Scan_plus_impl<_Scan_traits_4>(_First, _Last, _Dest, _Val, _Exclusive);
+}
+
+__declspec(noalias) unsigned long long __cdecl __std_inclusive_scan_plus_8(const void* const _First,
+    const void* const _Last, void* const _Dest, const unsigned long long _Val, const bool _Exclusive) noexcept {
+    return _Scan_plus_impl<_Scan_traits_8>(_First, _Last, _Dest, _Val, _Exclusive);
+}
+
+__declspec(noalias) float __cdecl __std_inclusive_scan_plus_f(const void* const _First, const void* const _Last,
+    void* const _Dest, const float _Val, const bool _Exclusive) noexcept {
+    return _Scan_plus_impl<_Scan_traits_f>(_First, _Last, _Dest, _Val, _Exclusive);
+}
+
+__declspec(noalias) double __cdecl __std_inclusive_scan_plus_d(const void* const _First, const void* const _Last,
+    void* const _Dest, const double _Val, const bool _Exclusive) noexcept {
+    return _Scan_plus_impl<_Scan_traits_d>(_First, _Last, _Dest, _Val, _Exclusive);
+}
 } // extern "C"
 
 #endif // (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_CEE_PURE)
@@ -0,0 +1,21 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// support for <wall_clock>
+
+#include <internal_shared.h>
+
+namespace {
+    constexpr long long _Epoch = 0x19DB1DED53E8000LL; // 1970-01-01 in FILETIME ticks, as in xtime.cpp
+} // unnamed namespace
+
+extern "C" {
+
+_NODISCARD long long __stdcall __std_coarse_system_time_ticks() noexcept {
+    // 100-nanosecond intervals since 1970, updated once per system timer tick; reads the shared user data page instead
+    // of querying the hardware like GetSystemTimePreciseAsFileTime
+    FILETIME _Ft;
+    GetSystemTimeAsFileTime(&_Ft);
+    return ((static_cast<long long>(_Ft.dwHighDateTime)) << 32) + static_cast<long long>(_Ft.dwLowDateTime) - _Epoch;
+}
+} // extern "C"
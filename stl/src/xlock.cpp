@@ -8,8 +8,11 @@
 #include <locale.h>
 #include <stdlib.h>
 
+#include "sync_stats.hpp"
 #include "xmtx.hpp"
 
+_STD atomic<const _Sync_stats_hooks*> _Sync_stats_found{nullptr};
+
 _STD_BEGIN
 
 constexpr int _Max_lock = 8; // must be power of two
@@ -20,6 +23,33 @@ constexpr int _Max_lock = 8; // must be power of two
 static _Rmtx mtx[_Max_lock];
 static long init = -1;
 
+static void _Find_sync_stats(const void* const _Owner) noexcept {
+    // the atomic wait satellite holds an _Init_locks; when _Owner is that one, make its counters reachable from here
+#ifdef CRTDLL2
+#ifdef _CRT_APP
+    (void) _Owner; // GetModuleHandleExW isn't available to apps, so their _Lockit and mutexes go uncounted
+#else // ^^^ _CRT_APP ^^^ // vvv !_CRT_APP vvv
+    HMODULE _Module;
+    if (!GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+            static_cast<LPCWSTR>(_Owner), &_Module)) {
+        return;
+    }
+
+    const auto _Get_hooks =
+        reinterpret_cast<decltype(&__std_sync_stats_hooks)>(GetProcAddress(_Module, "__std_sync_stats_hooks"));
+    // the counters must stay loaded for as long as any lock might use them
+    if (_Get_hooks
+        && GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_PIN,
+            static_cast<LPCWSTR>(_Owner), &_Module)) {
+        _Sync_stats_found.store(_Get_hooks(), memory_order_release);
+    }
+#endif // _CRT_APP
+#else // ^^^ CRTDLL2 ^^^ // vvv !CRTDLL2 vvv
+    (void) _Owner; // the counters are linked in with the rest of the library
+    _Sync_stats_found.store(__std_sync_stats_hooks(), memory_order_release);
+#endif // CRTDLL2
+}
+
 #if !defined(MRTDLL)
 
 __thiscall _Init_locks::_Init_locks() noexcept { // initialize locks
@@ -28,6 +58,8 @@ __thiscall _Init_locks::_Init_locks() noexcept { // initialize locks
             _Mtxinit(&elem);
         }
     }
+
+    _Find_sync_stats(this);
 }
 
 __thiscall _Init_locks::~_Init_locks() noexcept { // clean up locks
@@ -58,21 +90,48 @@ void __cdecl _Init_locks::_Init_locks_dtor(_Init_locks*) noexcept { // clean up
 
 static _Init_locks initlocks;
 
+static void _Lock_kind(const int kind) noexcept { // lock mtx[kind], counting contention if sync stats are enabled
+    const auto _Stats = _Sync_stats_if_enabled();
+    if (!_Stats) {
+        _Mtxlock(&mtx[kind]);
+    } else if (TryEnterCriticalSection(&mtx[kind])) {
+#ifdef _M_CEE
+        System::Threading::Thread::BeginThreadAffinity();
+#endif // _M_CEE
+        _Stats->_Lockit(kind, 0);
+    } else {
+        const long long _Wait_start = _Sync_stats_now();
+        _Mtxlock(&mtx[kind]);
+        _Stats->_Lockit(kind, _Wait_start);
+    }
+}
+
+static void _Lock_locales_counted() noexcept { // lock the CRT's locale lock, timing it if sync stats are enabled
+    const auto _Stats = _Sync_stats_if_enabled();
+    if (!_Stats) {
+        _lock_locales();
+    } else {
+        const long long _Start = _Sync_stats_now();
+        _lock_locales();
+        _Stats->_Lockit_timed(_LOCK_LOCALE, _Start);
+    }
+}
+
 #if !defined(MRTDLL)
 
 __thiscall _Lockit::_Lockit() noexcept : _Locktype(0) { // lock default mutex
     if (_Locktype == _LOCK_LOCALE) {
-        _lock_locales();
+        _Lock_locales_counted();
     } else {
-        _Mtxlock(&mtx[0]);
+        _Lock_kind(0);
     }
 }
 
 __thiscall _Lockit::_Lockit(int kind) noexcept : _Locktype(kind) { // lock the mutex
     if (_Locktype == _LOCK_LOCALE) {
-        _lock_locales();
+        _Lock_locales_counted();
     } else if (_Locktype < _Max_lock) {
-        _Mtxlock(&mtx[_Locktype]);
+        _Lock_kind(_Locktype);
     }
 }
 
@@ -87,15 +146,15 @@ __thiscall _Lockit::~_Lockit() noexcept { // unlock the mutex
 #endif
 
 void __cdecl _Lockit::_Lockit_ctor(_Lockit*) noexcept { // lock default mutex
-    _Mtxlock(&mtx[0]);
+    _Lock_kind(0);
 }
 
 void __cdecl _Lockit::_Lockit_ctor(_Lockit* _This, int kind) noexcept { // lock the mutex
     if (kind == _LOCK_LOCALE) {
-        _lock_locales();
+        _Lock_locales_counted();
     } else {
         _This->_Locktype = kind & (_Max_lock - 1);
-        _Mtxlock(&mtx[_This->_Locktype]);
+        _Lock_kind(_This->_Locktype);
     }
 }
 
@@ -106,9 +165,9 @@ void __cdecl _Lockit::_Lockit_dtor(_Lockit* _This) noexcept { // unlock the mute
 _RELIABILITY_CONTRACT
 void __cdecl _Lockit::_Lockit_ctor(int kind) noexcept { // lock the mutex
     if (kind == _LOCK_LOCALE) {
-        _lock_locales();
+        _Lock_locales_counted();
     } else {
-        _Mtxlock(&mtx[kind & (_Max_lock - 1)]);
+        _Lock_kind(kind & (_Max_lock - 1));
     }
 }
 
@@ -123,7 +182,7 @@ void __cdecl _Lockit::_Lockit_dtor(int kind) noexcept { // unlock the mutex
 
 _EXTERN_C
 void _Lock_at_thread_exit_mutex() { // lock the at-thread-exit mutex
-    _Mtxlock(&mtx[_LOCK_AT_THREAD_EXIT]);
+    _Lock_kind(_LOCK_AT_THREAD_EXIT);
 }
 void _Unlock_at_thread_exit_mutex() { // unlock the at-thread-exit mutex
     _Mtxunlock(&mtx[_LOCK_AT_THREAD_EXIT]);
@@ -90,8 +90,8 @@ void _Cnd_do_broadcast_at_thread_exit() { // notify condition variables waiting
     while (block != nullptr) { // loop through list of blocks
         for (int i = 0; block->num_used != 0 && i < _Nitems; ++i) {
             if (block->data[i].mtx != nullptr && block->data[i].id._Id == currentThreadId) { // notify and release slot
-                if (block->data[i].res) {
-                    *block->data[i].res = 1;
+                if (block->data[i].res) { // interlocked, as <future> reads it without the mutex
+                    (void) _InterlockedExchange(reinterpret_cast<volatile long*>(block->data[i].res), 1);
                 }
                 _Mtx_unlock(block->data[i].mtx);
                 _Cnd_broadcast(block->data[i].cnd);
@@ -2,16 +2,19 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <assert.h>
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <future>
 #include <memory>
+#include <stdexcept>
 #include <stdlib.h>
 #include <string>
 #include <system_error>
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 using namespace std;
 using namespace std::placeholders;
@@ -266,6 +269,76 @@ void test_shared_future_noexcept_copy() {
     test_shared_future_noexcept_copy_impl<void>();
 }
 
+// launch::async runs tasks on the thread pool; results published there are read without the state's mutex
+void test_async_on_thread_pool() {
+    {
+        atomic<int> started{0};
+        vector<future<int>> futures;
+        for (int i = 0; i < 200; ++i) {
+            futures.push_back(async(launch::async, [&started, i] {
+                started.fetch_add(1);
+                return i * 2;
+            }));
+        }
+
+        for (int i = 0; i < 200; ++i) {
+            assert(futures[static_cast<size_t>(i)].get() == i * 2);
+            assert(!futures[static_cast<size_t>(i)].valid());
+        }
+
+        assert(started.load() == 200);
+    }
+
+    {
+        future<string> f = async(launch::async, [] { return string("meow"); });
+        f.wait();
+        assert(f.wait_for(chrono::seconds(0)) == future_status::ready);
+        assert(f.wait_until(chrono::steady_clock::now()) == future_status::ready);
+        assert(f.get() == "meow");
+    }
+
+    {
+        shared_future<int> f = async(launch::async, [] { return 1729; }).share();
+        assert(f.get() == 1729);
+        assert(f.get() == 1729); // already ready; shared_future may be read repeatedly
+    }
+
+    {
+        int i                  = 0;
+        future<int&> ref_fut   = async(launch::async, [&i]() -> int& { return i; });
+        future<void> void_fut  = async(launch::async, [&i] { i = 5; });
+        future<int> throws_fut = async(launch::async, []() -> int { throw runtime_error("woof"); });
+        assert(&ref_fut.get() == &i);
+        void_fut.get();
+        assert(i == 5);
+
+        try {
+            (void) throws_fut.get();
+            assert(false);
+        } catch (const runtime_error& e) {
+            assert(string(e.what()) == "woof");
+        }
+    }
+
+    {
+        atomic<bool> done{false};
+        {
+            auto f = async(launch::async, [&done] {
+                this_thread::sleep_for(chrono::milliseconds(20));
+                done = true;
+            });
+        } // the future's destructor waits for the task
+
+        assert(done.load());
+    }
+
+    {
+        auto ptr      = make_unique<int>(11); // the callable is moved into the task
+        future<int> f = async(launch::async, [p = move(ptr)] { return *p; });
+        assert(f.get() == 11);
+    }
+}
+
 struct use_async_in_a_global_tester {
     use_async_in_a_global_tester() {
         assert(async([] { return 42; }).get() == 42);
@@ -284,4 +357,5 @@ int main() {
     test_VSO_115515();
     test_VSO_272761();
     test_shared_future_noexcept_copy();
+    test_async_on_thread_pool();
 }
@@ -266,6 +266,29 @@ void run_tests() {
         call_once(flag, lambda, n);
         VERIFY(n == 1729);
     }
+
+    // Test concurrent calls: every caller that returns sees the initialization, and later calls don't invoke their
+    // callables.
+    for (int round = 0; round < 20; ++round) {
+        once_flag flag;
+        long value = 0;
+        vector<thread> v;
+
+        for (int n = 0; n < 4; ++n) {
+            v.emplace_back([&] {
+                for (int i = 0; i < 100; ++i) {
+                    call_once(flag, [&] { value = 1729; });
+                    VERIFY(value == 1729);
+                }
+            });
+        }
+
+        for (auto& t : v) {
+            t.join();
+        }
+
+        call_once(flag, [] { VERIFY(false); });
+    }
 }
 
 int main() {
@@ -3,6 +3,9 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <functional>
+#include <stddef.h>
+#include <utility>
 #include <vector>
 
 using namespace std;
@@ -96,6 +99,175 @@ bool test_fill() {
     return true;
 }
 
+vector<bool> make_pattern(const size_t length, unsigned int seed) {
+    vector<bool> result(length);
+    for (size_t i = 0; i < length; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        result[i] = ((seed >> 16) & 1) != 0;
+    }
+
+    return result;
+}
+
+// sizes and offsets around block boundaries, for ranges of one or several blocks
+constexpr size_t interesting_offsets[] = {0, 1, 5, 31, 32, 33, 63, 64, 70};
+constexpr size_t interesting_lengths[] = {0, 1, 2, 15, 31, 32, 33, 64, 65, 3 * blockSize + 7, 5 * blockSize};
+constexpr size_t pattern_length        = 8 * blockSize;
+
+template <class T>
+void test_find_count_value(const vector<bool>& v, const size_t first, const size_t last, const T val) {
+    const auto b = v.begin();
+
+    size_t expected_find  = last;
+    size_t expected_count = 0;
+    for (size_t i = first; i < last; ++i) {
+        if (v[i] == val) {
+            if (expected_find == last) {
+                expected_find = i;
+            }
+
+            ++expected_count;
+        }
+    }
+
+    assert(find(b + first, b + last, val) == b + expected_find);
+    assert(count(b + first, b + last, val) == static_cast<ptrdiff_t>(expected_count));
+}
+
+bool test_find_count() {
+    for (const unsigned int seed : {1u, 2u}) {
+        vector<bool> v = make_pattern(pattern_length, seed);
+        for (const size_t first : interesting_offsets) {
+            for (const size_t length : interesting_lengths) {
+                const size_t last = first + length;
+                test_find_count_value(v, first, last, true);
+                test_find_count_value(v, first, last, false);
+                test_find_count_value(v, first, last, 0.0);
+                test_find_count_value(v, first, last, 1.0);
+                test_find_count_value(v, first, last, 0.5);
+            }
+        }
+    }
+
+    // a lone set bit far from the start, as in a sparse bitmap
+    vector<bool> sparse(10 * blockSize + 3);
+    sparse[9 * blockSize + 17] = true;
+    assert(find(sparse.begin(), sparse.end(), true) == sparse.begin() + (9 * blockSize + 17));
+    assert(find(sparse.cbegin() + 1, sparse.cend(), true) == sparse.cbegin() + (9 * blockSize + 17));
+    assert(count(sparse.begin(), sparse.end(), true) == 1);
+    assert(count(sparse.cbegin(), sparse.cend(), false) == static_cast<ptrdiff_t>(sparse.size() - 1));
+    return true;
+}
+
+bool test_copy() {
+    const vector<bool> source = make_pattern(pattern_length, 3);
+    for (const size_t src_off : interesting_offsets) {
+        for (const size_t dest_off : interesting_offsets) {
+            for (const size_t length : interesting_lengths) {
+                vector<bool> expected = make_pattern(pattern_length, 4);
+                for (size_t i = 0; i < length; ++i) {
+                    expected[dest_off + i] = source[src_off + i];
+                }
+
+                vector<bool> dest = make_pattern(pattern_length, 4);
+                const auto src_first = source.begin() + static_cast<ptrdiff_t>(src_off);
+                const auto src_last  = src_first + static_cast<ptrdiff_t>(length);
+                const auto dest_it   = dest.begin() + static_cast<ptrdiff_t>(dest_off);
+                assert(copy(src_first, src_last, dest_it) == dest_it + static_cast<ptrdiff_t>(length));
+                assert(dest == expected);
+
+                dest                 = make_pattern(pattern_length, 4);
+                const auto dest_last = dest.begin() + static_cast<ptrdiff_t>(dest_off + length);
+                assert(copy_backward(src_first, src_last, dest_last) == dest_last - static_cast<ptrdiff_t>(length));
+                assert(dest == expected);
+            }
+        }
+    }
+
+    // overlapping ranges, as used by erase and insert
+    for (const size_t from : interesting_offsets) {
+        for (const size_t to : interesting_offsets) {
+            for (const size_t length : interesting_lengths) {
+                vector<bool> model = make_pattern(pattern_length, 5);
+                vector<bool> v     = model;
+                const auto b       = v.begin();
+                if (to <= from) {
+                    for (size_t i = 0; i < length; ++i) {
+                        model[to + i] = model[from + i];
+                    }
+
+                    copy(b + static_cast<ptrdiff_t>(from), b + static_cast<ptrdiff_t>(from + length),
+                        b + static_cast<ptrdiff_t>(to));
+                } else {
+                    for (size_t i = length; i-- > 0;) {
+                        model[to + i] = model[from + i];
+                    }
+
+                    copy_backward(b + static_cast<ptrdiff_t>(from), b + static_cast<ptrdiff_t>(from + length),
+                        b + static_cast<ptrdiff_t>(to + length));
+                }
+
+                assert(v == model);
+            }
+        }
+    }
+
+    vector<bool> v = make_pattern(pattern_length, 6);
+    vector<char> model;
+    for (const bool b : v) {
+        model.push_back(b);
+    }
+
+    v.erase(v.begin() + 3, v.begin() + 70);
+    model.erase(model.begin() + 3, model.begin() + 70);
+    v.insert(v.begin() + 5, 40, true);
+    model.insert(model.begin() + 5, 40, true);
+    assert(v.size() == model.size());
+    for (size_t i = 0; i < v.size(); ++i) {
+        assert(v[i] == (model[i] != 0));
+    }
+
+    return true;
+}
+
+bool test_equal_mismatch() {
+    for (const size_t off1 : interesting_offsets) {
+        for (const size_t off2 : interesting_offsets) {
+            for (const size_t length : interesting_lengths) {
+                const vector<bool> pattern = make_pattern(length, 7);
+                vector<bool> left          = make_pattern(pattern_length, 8);
+                vector<bool> right         = make_pattern(pattern_length, 9);
+                const auto left_first      = left.begin() + static_cast<ptrdiff_t>(off1);
+                const auto left_last       = left_first + static_cast<ptrdiff_t>(length);
+                const auto right_first     = right.begin() + static_cast<ptrdiff_t>(off2);
+                for (size_t i = 0; i < length; ++i) {
+                    left[off1 + i]  = pattern[i];
+                    right[off2 + i] = pattern[i];
+                }
+
+                assert(equal(left_first, left_last, right_first));
+                assert(equal(left_first, left_last, right.cbegin() + static_cast<ptrdiff_t>(off2), equal_to<bool>{}));
+                const auto right_last = right_first + static_cast<ptrdiff_t>(length);
+                assert(mismatch(left_first, left_last, right_first) == make_pair(left_last, right_last));
+
+                for (size_t flip = 0; flip < length; flip += 13) {
+                    right[off2 + flip] = !right[off2 + flip];
+                    assert(!equal(left_first, left_last, right_first));
+                    const auto mismatched = mismatch(left_first, left_last, right_first);
+                    assert(mismatched.first == left_first + static_cast<ptrdiff_t>(flip));
+                    assert(mismatched.second == right_first + static_cast<ptrdiff_t>(flip));
+                    right[off2 + flip] = !right[off2 + flip];
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 int main() {
     test_fill();
+    test_find_count();
+    test_copy();
+    test_equal_mismatch();
 }
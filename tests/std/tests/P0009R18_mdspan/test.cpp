@@ -0,0 +1,241 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <mdspan>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using E23  = extents<int, 2, 3>;
+using E2d  = extents<int, 2, dynamic_extent>;
+using Edd  = dextents<int, 2>;
+using E234 = extents<int, 2, 3, 4>;
+
+STATIC_ASSERT(E23::rank() == 2 && E23::rank_dynamic() == 0);
+STATIC_ASSERT(E2d::rank() == 2 && E2d::rank_dynamic() == 1);
+STATIC_ASSERT(is_same_v<Edd, extents<int, dynamic_extent, dynamic_extent>>);
+STATIC_ASSERT(is_same_v<decltype(extents(1, 2, 3)), dextents<size_t, 3>>);
+STATIC_ASSERT(sizeof(E23) == 1); // static extents take no space
+STATIC_ASSERT(sizeof(E2d) == sizeof(int));
+
+STATIC_ASSERT(is_convertible_v<E23, Edd>);
+STATIC_ASSERT(!is_convertible_v<Edd, E23>);
+STATIC_ASSERT(is_constructible_v<E23, Edd>);
+STATIC_ASSERT(!is_constructible_v<E23, extents<int, 2, 4>>);
+
+STATIC_ASSERT(layout_right::mapping<E23>::is_always_exhaustive());
+STATIC_ASSERT(!layout_stride::mapping<E23>::is_always_exhaustive());
+STATIC_ASSERT(is_convertible_v<layout_right::mapping<E23>, layout_stride::mapping<E23>>);
+STATIC_ASSERT(!is_convertible_v<layout_stride::mapping<E23>, layout_right::mapping<E23>>);
+
+constexpr bool test_extents() {
+    const E2d e{3};
+    assert(e.extent(0) == 2 && e.extent(1) == 3);
+    assert(E2d::static_extent(1) == dynamic_extent);
+
+    const Edd d = e;
+    assert(d == e && d.extent(0) == 2);
+    assert((Edd(array{4, 5}).extent(1) == 5));
+    assert(E2d(2, 7) == Edd(2, 7));
+    assert(E23{} != Edd(2, 4));
+    assert((E23{} != extents<int, 2>{}));
+    return true;
+}
+
+constexpr bool test_layouts() {
+    const layout_right::mapping<E234> right;
+    assert(right(1, 2, 3) == 1 * 12 + 2 * 4 + 3);
+    assert(right.stride(0) == 12 && right.stride(2) == 1);
+    assert(right.required_span_size() == 24);
+
+    const layout_left::mapping<E234> left;
+    assert(left(1, 2, 3) == 1 + 2 * 2 + 3 * 6);
+    assert(left.stride(0) == 1 && left.stride(2) == 6);
+
+    const layout_stride::mapping<Edd> strided{Edd(2, 3), array{1, 4}};
+    assert(strided(1, 2) == 9);
+    assert(strided.required_span_size() == 10);
+    assert(!strided.is_exhaustive());
+    assert((layout_stride::mapping<Edd>(Edd(2, 3), array{1, 2}).is_exhaustive()));
+
+    const layout_stride::mapping<E234> from_right = right;
+    assert(from_right == right);
+    assert(from_right != left);
+    assert(layout_right::mapping<E234>(from_right) == right);
+
+    const layout_left::mapping<extents<int, 5>> left1;
+    const layout_right::mapping<extents<int, 5>> right1 = left1;
+    assert(right1(4) == 4);
+    return true;
+}
+
+constexpr bool test_mdspan() {
+    int storage[24]{};
+    for (int i = 0; i < 24; ++i) {
+        storage[i] = i;
+    }
+
+    mdspan m(storage, 2, 3, 4);
+    STATIC_ASSERT(is_same_v<decltype(m), mdspan<int, dextents<size_t, 3>>>);
+    assert(m.size() == 24 && !m.empty());
+    assert(m.extent(2) == 4 && m.stride(0) == 12);
+    assert((m[array{1, 2, 3}] == 23));
+    const size_t idx[] = {1, 0, 2};
+    assert((m[span{idx}] == 14));
+#ifdef __cpp_multidimensional_subscript
+    assert((m[1, 2, 3] == 23));
+#endif // __cpp_multidimensional_subscript
+
+    mdspan<int, E234, layout_left> column_major(storage);
+    assert((column_major[array{1, 2, 3}] == 1 + 2 * 2 + 3 * 6));
+
+    mdspan<const int, Edd, layout_stride> view = mdspan<int, E23>(storage);
+    assert((view[array{1, 1}] == 4));
+    assert(view.is_strided() && view.is_unique());
+
+    mdspan vec(storage);
+    STATIC_ASSERT(is_same_v<decltype(vec), mdspan<int, extents<size_t, 24>>>);
+    assert(vec[5] == 5);
+
+    mdspan<int, Edd> empty_span(storage, 0, 3);
+    assert(empty_span.empty() && empty_span.size() == 0);
+
+    mdspan<int, Edd> other;
+    swap(other, empty_span);
+    assert(other.extent(1) == 3 && empty_span.data_handle() == nullptr);
+    return true;
+}
+
+constexpr bool test_submdspan() {
+    int storage[24]{};
+    for (int i = 0; i < 24; ++i) {
+        storage[i] = i;
+    }
+
+    mdspan<int, E234> m(storage);
+
+    // rows of a row-major array stay row-major
+    auto row = submdspan(m, 1, 2, full_extent);
+    STATIC_ASSERT(is_same_v<decltype(row)::layout_type, layout_right>);
+    STATIC_ASSERT(is_same_v<decltype(row)::extents_type, extents<int, 4>>);
+    assert(row.data_handle() == storage + 20 && row[3] == 23);
+
+    auto plane = submdspan(m, 1, full_extent, pair{1, 3});
+    STATIC_ASSERT(is_same_v<decltype(plane)::layout_type, layout_stride>);
+    assert(plane.extent(0) == 3 && plane.extent(1) == 2);
+    assert((plane[array{2, 1}] == 12 + 8 + 2));
+
+    auto block = submdspan(m, pair{0, 2}, full_extent, full_extent);
+    STATIC_ASSERT(is_same_v<decltype(block)::layout_type, layout_right>);
+    STATIC_ASSERT(is_same_v<decltype(block)::extents_type, extents<int, dynamic_extent, 3, 4>>);
+
+    const strided_slice<int, int, int> odd{.offset = 1, .extent = 3, .stride = 2};
+    auto every_other = submdspan(m, full_extent, 0, odd);
+    STATIC_ASSERT(is_same_v<decltype(every_other)::layout_type, layout_stride>);
+    assert(every_other.extent(1) == 2 && every_other.stride(1) == 2);
+    assert((every_other[array{1, 1}] == 12 + 3));
+
+    mdspan<int, E234, layout_left> column_major(storage);
+    auto column = submdspan(column_major, full_extent, 1, 2);
+    STATIC_ASSERT(is_same_v<decltype(column)::layout_type, layout_left>);
+    assert(column.data_handle() == storage + 2 + 12 && column[1] == 15);
+
+    // a slice that starts at the end selects nothing, and mustn't point past the original elements
+    auto nothing = submdspan(m, pair{2, 2}, full_extent, full_extent);
+    assert(nothing.empty() && nothing.data_handle() == storage + 24);
+
+    const auto sub = submdspan_extents(E234{}, full_extent, pair{1, 2}, 3);
+    STATIC_ASSERT(is_same_v<remove_const_t<decltype(sub)>, extents<int, 2, dynamic_extent>>);
+    assert(sub.extent(1) == 1);
+    return true;
+}
+
+using tiled = stdext::layout_tiled<2, 3>;
+
+constexpr bool test_layout_tiled() {
+    // a 3 x 4 matrix in 2 x 3 tiles; the last tiles of each row and column are padded
+    const tiled::mapping<Edd> map(Edd(3, 4));
+    assert(map.required_span_size() == 4 * 6);
+    assert(map(0, 0) == 0 && map(0, 2) == 2 && map(1, 0) == 3);
+    assert(map(0, 3) == 6 && map(1, 3) == 9);
+    assert(map(2, 0) == 12 && map(2, 3) == 18);
+    assert(!map.is_exhaustive());
+    assert(tiled::mapping<E23>{}.is_exhaustive());
+    assert(!tiled::mapping<E23>::is_always_strided());
+    return true;
+}
+
+template <class Layout, class Extents>
+vector<int> visit_order(const typename Layout::template mapping<Extents>& map) {
+    vector<int> storage(static_cast<size_t>(map.required_span_size()), -1);
+    mdspan<int, Extents, Layout> m(storage.data(), map);
+    int next = 0;
+    stdext::tiled_for_each(m, [&](int& elem) { elem = next++; });
+    return storage;
+}
+
+void test_tiled_for_each() {
+    // every layout is visited in memory order
+    assert((visit_order<layout_right, E23>({}) == vector<int>{0, 1, 2, 3, 4, 5}));
+    assert((visit_order<layout_left, E23>({}) == vector<int>{0, 1, 2, 3, 4, 5}));
+    assert((visit_order<layout_stride, E23>({E23{}, array{1, 2}}) == vector<int>{0, 1, 2, 3, 4, 5}));
+    assert((visit_order<tiled, Edd>(Edd(3, 4))
+            == vector<int>{0, 1, 2, 3, 4, 5, 6, -1, -1, 7, -1, -1, 8, 9, 10, -1, -1, -1, 11, -1, -1, -1, -1, -1}));
+
+    int visits = 0;
+    int storage[1]{};
+    stdext::tiled_for_each(mdspan<int, Edd>(storage, 0, 5), [&](int&) { ++visits; });
+    assert(visits == 0);
+}
+
+void test_tiled_transform() {
+    // transposing walks both operands in tiles, and large enough extents span several tiles
+    constexpr int rows = 70;
+    constexpr int cols = 45;
+    vector<int> source(rows * cols);
+    for (size_t i = 0; i < source.size(); ++i) {
+        source[i] = static_cast<int>(i);
+    }
+
+    vector<int> dest(rows * cols);
+    const mdspan<const int, Edd> in(source.data(), rows, cols);
+    const mdspan<int, Edd, layout_left> out(dest.data(), rows, cols);
+    stdext::tiled_transform(in, out, [](int value) { return value * 2; });
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            assert(dest[static_cast<size_t>(col * rows + row)] == 2 * (row * cols + col));
+        }
+    }
+
+    vector<int> tiled_dest(static_cast<size_t>(tiled::mapping<Edd>(Edd(rows, cols)).required_span_size()));
+    const mdspan<int, Edd, tiled> tiled_out(tiled_dest.data(), tiled::mapping<Edd>(Edd(rows, cols)));
+    stdext::tiled_transform(in, tiled_out, [](int value) { return value; });
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            assert((tiled_out[array{row, col}] == row * cols + col));
+        }
+    }
+}
+
+int main() {
+    test_extents();
+    STATIC_ASSERT(test_extents());
+    test_layouts();
+    STATIC_ASSERT(test_layouts());
+    test_mdspan();
+    STATIC_ASSERT(test_mdspan());
+    test_submdspan();
+    STATIC_ASSERT(test_submdspan());
+    test_layout_tiled();
+    STATIC_ASSERT(test_layout_tiled());
+    test_tiled_for_each();
+    test_tiled_transform();
+}
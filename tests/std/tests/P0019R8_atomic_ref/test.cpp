@@ -0,0 +1,176 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+struct large {
+    int values[5];
+};
+
+STATIC_ASSERT(is_same_v<atomic_ref<int>::value_type, int>);
+STATIC_ASSERT(is_same_v<atomic_ref<int>::difference_type, int>);
+STATIC_ASSERT(is_same_v<atomic_ref<double>::difference_type, double>);
+STATIC_ASSERT(is_same_v<atomic_ref<int*>::difference_type, ptrdiff_t>);
+STATIC_ASSERT(is_trivially_copy_constructible_v<atomic_ref<int>>);
+STATIC_ASSERT(!is_copy_assignable_v<atomic_ref<int>>);
+STATIC_ASSERT(!is_default_constructible_v<atomic_ref<int>>);
+STATIC_ASSERT(atomic_ref<int>::is_always_lock_free);
+STATIC_ASSERT(atomic_ref<long long>::required_alignment == sizeof(long long));
+STATIC_ASSERT(!atomic_ref<large>::is_always_lock_free);
+STATIC_ASSERT(atomic_ref<large>::required_alignment == alignof(large));
+
+template <class Integral>
+void test_integral() {
+    alignas(atomic_ref<Integral>::required_alignment) Integral value = 10;
+    const atomic_ref<Integral> ref(value);
+    assert(ref.is_lock_free());
+    assert(ref.load() == 10);
+    assert(ref.fetch_add(5) == 10);
+    assert(ref.fetch_sub(3, memory_order_relaxed) == 15);
+    assert((ref += 8) == 20);
+    assert((ref -= 4) == 16);
+    assert(ref++ == 16);
+    assert(++ref == 18);
+    assert(ref-- == 18);
+    assert(--ref == 16);
+    assert(ref.fetch_and(0x1C) == 16);
+    assert(ref.fetch_or(0x03) == 16);
+    assert(ref.fetch_xor(0x01) == 19);
+    assert((ref &= 0x1E) == 18);
+    assert((ref |= 0x01) == 19);
+    assert((ref ^= 0x03) == 16);
+    assert(value == 16);
+
+    ref = 42;
+    assert(value == 42);
+    assert(ref.exchange(7) == 42);
+
+    Integral expected = 6;
+    assert(!ref.compare_exchange_strong(expected, 9));
+    assert(expected == 7);
+    assert(ref.compare_exchange_weak(expected, 9, memory_order_acq_rel, memory_order_acquire));
+    assert(static_cast<Integral>(ref) == 9);
+
+    const atomic_ref<Integral> copy = ref; // refers to the same object
+    copy.store(11);
+    assert(ref.load(memory_order_acquire) == 11);
+}
+
+template <class Floating>
+void test_floating() {
+    alignas(atomic_ref<Floating>::required_alignment) Floating value = 1.5f;
+    const atomic_ref<Floating> ref(value);
+    assert(ref.fetch_add(2.0f) == 1.5f);
+    assert(ref.fetch_sub(0.5f) == 3.5f);
+    assert((ref += 1.0f) == 4.0f);
+    assert((ref -= 2.0f) == 2.0f);
+    assert(value == 2.0f);
+
+    // each increment adds an integer, so the sum is exact however the threads interleave
+    constexpr int thread_count = 4;
+    constexpr int iterations   = 10000;
+    alignas(atomic_ref<Floating>::required_alignment) Floating cells[3]{};
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&cells] {
+            for (int j = 0; j < iterations; ++j) {
+                atomic_ref<Floating>(cells[j % 3]).fetch_add(1.0f, memory_order_relaxed);
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(cells[0] + cells[1] + cells[2] == static_cast<Floating>(thread_count * iterations));
+}
+
+void test_pointer() {
+    int array[10]{};
+    int* ptr = array;
+    const atomic_ref<int*> ref(ptr);
+    assert(ref.fetch_add(3) == array);
+    assert(ref.fetch_sub(1) == array + 3);
+    assert((ref += 4) == array + 6);
+    assert((ref -= 2) == array + 4);
+    assert(ref++ == array + 4);
+    assert(--ref == array + 4);
+    assert(ptr == array + 4);
+}
+
+void test_large() {
+    // not lock-free; every atomic_ref to an object shares one lock, so concurrent updates of both halves stay paired
+    large value{};
+    assert(!atomic_ref<large>(value).is_lock_free());
+
+    constexpr int thread_count = 4;
+    constexpr int iterations   = 2000;
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&value] {
+            const atomic_ref<large> ref(value);
+            for (int j = 0; j < iterations; ++j) {
+                large expected = ref.load();
+                large desired{};
+                do {
+                    assert(expected.values[0] == expected.values[4]);
+                    desired = expected;
+                    ++desired.values[0];
+                    ++desired.values[4];
+                } while (!ref.compare_exchange_weak(expected, desired));
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(value.values[0] == thread_count * iterations);
+    assert(value.values[4] == thread_count * iterations);
+
+    const atomic_ref<large> ref(value);
+    const large replacement{{1, 2, 3, 4, 5}};
+    const large previous = ref.exchange(replacement);
+    assert(previous.values[0] == thread_count * iterations);
+    assert(memcmp(&value, &replacement, sizeof(large)) == 0);
+}
+
+template <class T>
+void test_wait(const T initial, const T changed) {
+    alignas(atomic_ref<T>::required_alignment) T value = initial;
+    thread waiter([&value, initial] { atomic_ref<T>(value).wait(initial); });
+
+    const atomic_ref<T> ref(value);
+    ref.store(changed);
+    ref.notify_all();
+    waiter.join();
+
+    ref.wait(initial); // returns at once, since the value differs
+    ref.notify_one();
+}
+
+int main() {
+    test_integral<signed char>();
+    test_integral<unsigned short>();
+    test_integral<int>();
+    test_integral<long long>();
+    test_floating<float>();
+    test_floating<double>();
+    test_pointer();
+    test_large();
+    test_wait<int>(0, 1);
+    test_wait<double>(0.0, 1.0);
+    test_wait<large>(large{}, large{{1}});
+}
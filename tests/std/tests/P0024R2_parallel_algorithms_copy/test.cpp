@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+#include <execution>
+#include <iterator>
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// large enough to be split into chunks of several megabytes on machines with a few cores
+constexpr size_t large_bytes = size_t{24} << 20;
+
+template <class T>
+vector<T> iota_vector(const size_t count) {
+    vector<T> result(count);
+    for (size_t idx = 0; idx < count; ++idx) {
+        result[idx] = static_cast<T>(idx * 7 + 3);
+    }
+
+    return result;
+}
+
+template <class T>
+void test_case_copy(const size_t testSize) {
+    const auto source = iota_vector<T>(testSize);
+
+    vector<T> actual(testSize);
+    assert(copy(par, source.begin(), source.end(), actual.begin()) == actual.end());
+    assert(actual == source);
+
+    vector<T> actual_n(testSize);
+    assert(copy_n(par, source.begin(), testSize, actual_n.begin()) == actual_n.end());
+    assert(actual_n == source);
+
+    vector<T> moved(testSize);
+    auto movable = source;
+    assert(move(par, movable.begin(), movable.end(), moved.begin()) == moved.end());
+    assert(moved == source);
+
+    vector<T> from_move_iterators(testSize);
+    assert(copy(par, make_move_iterator(movable.begin()), make_move_iterator(movable.end()),
+               from_move_iterators.begin())
+           == from_move_iterators.end());
+    assert(from_move_iterators == source);
+}
+
+template <class T>
+void test_case_fill(const size_t testSize) {
+    vector<T> actual(testSize);
+    fill(par, actual.begin(), actual.end(), static_cast<T>(42));
+    assert(count(actual.begin(), actual.end(), static_cast<T>(42)) == static_cast<ptrdiff_t>(testSize));
+
+    assert(fill_n(par, actual.begin(), testSize, static_cast<T>(17)) == actual.end());
+    assert(count(actual.begin(), actual.end(), static_cast<T>(17)) == static_cast<ptrdiff_t>(testSize));
+}
+
+void test_case_uninitialized(const size_t testSize) {
+    const auto source = iota_vector<int>(testSize);
+    allocator<int> al;
+    int* const storage = al.allocate(testSize + 1);
+    assert(uninitialized_copy(par, source.begin(), source.end(), storage) == storage + testSize);
+    assert(equal(source.begin(), source.end(), storage));
+
+    uninitialized_fill(par, storage, storage + testSize, 5);
+    assert(all_of(storage, storage + testSize, [](const int i) { return i == 5; }));
+
+    destroy(par, storage, storage + testSize);
+    al.deallocate(storage, testSize + 1);
+}
+
+void test_large_unaligned() { // chunks start and end in the middle of cache lines
+    vector<char> source(large_bytes + 3);
+    for (size_t idx = 0; idx < source.size(); ++idx) {
+        source[idx] = static_cast<char>(idx % 251);
+    }
+
+    vector<char> dest(large_bytes + 3, 'x');
+    assert(copy(par, source.begin() + 1, source.end() - 1, dest.begin() + 2) == dest.end());
+    assert(dest[0] == 'x' && dest[1] == 'x');
+    assert(equal(source.begin() + 1, source.end() - 1, dest.begin() + 2));
+
+    fill(par, dest.begin() + 1, dest.end() - 1, 'y');
+    assert(dest.front() == 'x' && dest.back() == 'x');
+    assert(count(dest.begin(), dest.end(), 'y') == static_cast<ptrdiff_t>(dest.size() - 2));
+}
+
+void test_large() {
+    test_case_copy<char>(large_bytes);
+    test_case_copy<int>(large_bytes / sizeof(int));
+    test_case_copy<double>(large_bytes / sizeof(double));
+    test_case_fill<unsigned char>(large_bytes);
+    test_case_fill<short>(large_bytes / sizeof(short));
+    test_case_fill<long long>(large_bytes / sizeof(long long));
+    test_case_fill<double>(large_bytes / sizeof(double));
+    test_case_uninitialized(large_bytes / sizeof(int));
+    test_large_unaligned();
+}
+
+struct counted { // not trivially destructible, so destroy(par, ...) runs the destructors
+    static atomic<size_t> destroyed;
+
+    int value = 0;
+
+    ~counted() {
+        ++destroyed;
+    }
+};
+
+atomic<size_t> counted::destroyed{0};
+
+void test_not_trivial() { // elementwise copies and destructors take the serial or for_each paths
+    const vector<string> source(1000, string(40, 'a'));
+    vector<string> dest(1000);
+    copy(par, source.begin(), source.end(), dest.begin());
+    assert(dest == source);
+    fill(par, dest.begin(), dest.end(), string(40, 'b'));
+    assert(count(dest.begin(), dest.end(), string(40, 'b')) == 1000);
+
+    allocator<counted> al;
+    counted* const storage = al.allocate(1000);
+    uninitialized_fill(par, storage, storage + 1000, counted{});
+    counted::destroyed = 0;
+    destroy(par, storage, storage + 1000);
+    assert(counted::destroyed == 1000);
+    al.deallocate(storage, 1000);
+}
+
+int main() {
+    parallel_test_case(test_case_copy<char>);
+    parallel_test_case(test_case_copy<int>);
+    parallel_test_case(test_case_fill<char>);
+    parallel_test_case(test_case_fill<int>);
+    parallel_test_case(test_case_uninitialized);
+    test_large();
+    test_not_trivial();
+}
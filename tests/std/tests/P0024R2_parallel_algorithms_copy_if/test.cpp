@@ -0,0 +1,54 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto is_even = [](unsigned int i) { return (i & 0x1u) == 0; };
+
+template <template <class...> class Container>
+void test_case_copy_if_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> input(testSize);
+    vector<unsigned int> expected(testSize);
+    vector<unsigned int> actual(testSize);
+    vector<unsigned int> expectedFalses(testSize);
+    vector<unsigned int> actualFalses(testSize);
+    for (const unsigned int range : {2U, 5U, 0xFFFFFFFFU}) {
+        generate(input.begin(), input.end(), [&] { return gen() % range; });
+
+        const auto serialResult   = copy_if(input.begin(), input.end(), expected.begin(), is_even);
+        const auto parallelResult = copy_if(par, input.begin(), input.end(), actual.begin(), is_even);
+        assert(equal(expected.begin(), serialResult, actual.begin(), parallelResult));
+
+        const auto serialPartition =
+            partition_copy(input.begin(), input.end(), expected.begin(), expectedFalses.begin(), is_even);
+        const auto parallelPartition =
+            partition_copy(par, input.begin(), input.end(), actual.begin(), actualFalses.begin(), is_even);
+        assert(equal(expected.begin(), serialPartition.first, actual.begin(), parallelPartition.first));
+        assert(equal(expectedFalses.begin(), serialPartition.second, actualFalses.begin(), parallelPartition.second));
+
+        // output to a forward iterator as well
+        list<unsigned int> listOutput(testSize);
+        const auto listResult = copy_if(par, input.begin(), input.end(), listOutput.begin(), is_even);
+        assert(equal(expected.begin(), serialResult, listOutput.begin(), listResult));
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_copy_if_parallel<forward_list>, gen);
+    parallel_test_case(test_case_copy_if_parallel<list>, gen);
+    parallel_test_case(test_case_copy_if_parallel<vector>, gen);
+}
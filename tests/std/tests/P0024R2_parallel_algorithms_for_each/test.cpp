@@ -1,6 +1,11 @@
 // Copyright (c) Microsoft Corporation.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+// observe the chunk reports of the parallel algorithms
+template <class Report>
+void record_chunk_report(const Report& report);
+#define _STL_REPORT_PARALLEL_CHUNKS(_Report) record_chunk_report(_Report)
+
 #include <algorithm>
 #include <assert.h>
 #include <atomic>
@@ -8,6 +13,9 @@
 #include <forward_list>
 #include <iterator>
 #include <list>
+#include <mutex>
+#include <set>
+#include <thread>
 #include <vector>
 
 #include <parallel_algorithms_utilities.hpp>
@@ -47,6 +55,104 @@ const auto call_only_once = [](atomic<bool>& b) { assert(!b.exchange(true)); };
 
 const auto atomic_identity = [](atomic<bool>& b) { return b.load(); };
 
+size_t g_workStealingReports = 0;
+size_t g_lastReportChunks    = 0;
+template <class Report>
+void record_chunk_report(const Report& report) {
+    g_lastReportChunks = report._Chunks;
+    assert(report._Participants <= report._Chunks);
+    assert(report._Max_chunks <= report._Chunks);
+    assert(report._Steals <= report._Chunks);
+    assert(report._Work_stealing || report._Steals == 0);
+    if (report._Work_stealing) {
+        ++g_workStealingReports;
+    }
+}
+
+void test_case_for_each_skewed() {
+    // the first elements are far more expensive than the rest; each element must still be visited exactly once
+    vector<atomic<bool>> c(10'000);
+    atomic<bool>* const first = c.data();
+    const size_t reports      = g_workStealingReports;
+    for_each(par, c.begin(), c.end(), [first](atomic<bool>& b) {
+        if (&b - first < 16) {
+            volatile unsigned int spin = 0;
+            while (spin < 1'000'000u) {
+                spin = spin + 1;
+            }
+        }
+
+        call_only_once(b);
+    });
+    assert(all_of(c.begin(), c.end(), atomic_identity));
+    assert((g_workStealingReports == reports + 1) == (thread::hardware_concurrency() > 1));
+}
+
+void test_case_for_each_max_threads() {
+    // with a cap of 2 threads, at most one thread pool thread joins the calling thread
+    execution::_Set_parallel_environment(nullptr, 2);
+    mutex mtx;
+    set<thread::id> ids;
+    vector<atomic<bool>> c(10'000);
+    for_each(par, c.begin(), c.end(), [&](atomic<bool>& b) {
+        call_only_once(b);
+        lock_guard<mutex> lck(mtx);
+        ids.insert(this_thread::get_id());
+    });
+    execution::_Set_parallel_environment(nullptr);
+    assert(all_of(c.begin(), c.end(), atomic_identity));
+    assert(ids.size() <= 2);
+}
+
+static_assert(is_execution_policy_v<decltype(par._With_grain(1000))>);
+static_assert(is_execution_policy_v<decltype(par_unseq._With_min_parallel_size(1000)._With_max_threads(2))>);
+
+template <template <class...> class Container>
+void test_case_for_each_hints() {
+    const bool parallel = thread::hardware_concurrency() > 1;
+    Container<atomic<bool>> c(10'000);
+    mutex mtx;
+    set<thread::id> ids;
+    const auto record_thread = [&](atomic<bool>& b) {
+        call_only_once(b);
+        lock_guard<mutex> lck(mtx);
+        ids.insert(this_thread::get_id());
+    };
+
+    // chunks of at least 1000 elements
+    g_lastReportChunks = 0;
+    for_each(par._With_grain(1000), c.begin(), c.end(), call_only_once);
+    assert(all_of(c.begin(), c.end(), atomic_identity));
+    assert(g_lastReportChunks <= 10);
+    assert((g_lastReportChunks != 0) == parallel);
+    assert(__std_parallel_algorithms_grain() == 0);
+
+    // at most one thread pool thread joins the calling thread
+    for (auto& b : c) {
+        b.store(false);
+    }
+
+    for_each(par._With_grain(10)._With_max_threads(2), c.begin(), c.end(), record_thread);
+    assert(all_of(c.begin(), c.end(), atomic_identity));
+    assert(ids.size() <= 2);
+
+    // too small to parallelize
+    for (auto& b : c) {
+        b.store(false);
+    }
+
+    ids.clear();
+    for_each(par_unseq._With_min_parallel_size(10'001), c.begin(), c.end(), record_thread);
+    assert(all_of(c.begin(), c.end(), atomic_identity));
+    assert(ids.size() == 1 && *ids.begin() == this_thread::get_id());
+    assert(__std_parallel_algorithms_hw_threads() == thread::hardware_concurrency());
+
+    // the hints only decide how the work is partitioned
+    vector<int> v(10'000);
+    for_each_n(par._With_min_parallel_size(5'000)._With_grain(64), v.begin(), v.size(), [](int& x) { x = 42; });
+    assert(all_of(v.begin(), v.end(), [](int x) { return x == 42; }));
+}
+
 template <template <class...> class Container>
 struct test_case_for_each_parallel {
     template <typename ExecutionPolicy>
@@ -70,6 +176,11 @@ struct test_case_for_each_n_parallel {
 
 int main() {
     test_case_for_each_n();
+    test_case_for_each_skewed();
+    test_case_for_each_max_threads();
+    test_case_for_each_hints<forward_list>();
+    test_case_for_each_hints<list>();
+    test_case_for_each_hints<vector>();
     parallel_test_case(test_case_for_each_parallel<forward_list>{}, par);
     parallel_test_case(test_case_for_each_parallel<list>{}, par);
     parallel_test_case(test_case_for_each_parallel<vector>{}, par);
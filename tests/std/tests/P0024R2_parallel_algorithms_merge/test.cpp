@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+// first is the key, second records which input range the element came from, to check stability
+using element = pair<unsigned int, unsigned int>;
+
+const auto key_less = [](const element& lhs, const element& rhs) { return lhs.first < rhs.first; };
+
+vector<element> make_sorted_input(
+    const size_t testSize, const unsigned int source, const unsigned int keys, mt19937& gen) {
+    vector<element> result(testSize);
+    for (auto& e : result) {
+        e = {static_cast<unsigned int>(gen() % keys), source};
+    }
+
+    sort(result.begin(), result.end());
+    return result;
+}
+
+template <class ExPo>
+void test_merge_inputs(const ExPo& exec, const vector<element>& input1, const vector<element>& input2) {
+    vector<element> expected(input1.size() + input2.size());
+    merge(input1.begin(), input1.end(), input2.begin(), input2.end(), expected.begin(), key_less);
+
+    vector<element> actual(expected.size());
+    assert(merge(exec, input1.begin(), input1.end(), input2.begin(), input2.end(), actual.begin(), key_less)
+           == actual.end());
+    assert(actual == expected);
+
+    vector<element> inplace(input1);
+    inplace.insert(inplace.end(), input2.begin(), input2.end());
+    const auto mid = inplace.begin() + static_cast<ptrdiff_t>(input1.size());
+    inplace_merge(exec, inplace.begin(), mid, inplace.end(), key_less);
+    assert(inplace == expected);
+
+    list<element> inplaceList(input1.begin(), input1.end());
+    const auto listMid = inplaceList.insert(inplaceList.end(), input2.begin(), input2.end());
+    inplace_merge(exec, inplaceList.begin(), listMid, inplaceList.end(), key_less);
+    assert(equal(inplaceList.begin(), inplaceList.end(), expected.begin(), expected.end()));
+
+    list<element> outList(expected.size());
+    assert(merge(exec, input1.begin(), input1.end(), input2.begin(), input2.end(), outList.begin(), key_less)
+           == outList.end());
+    assert(equal(outList.begin(), outList.end(), expected.begin(), expected.end()));
+}
+
+void test_case_merge_parallel(const size_t testSize, mt19937& gen) {
+    for (const unsigned int keys : {4U, 1000000U}) {
+        const auto input1 = make_sorted_input(testSize, 1, keys, gen);
+        const auto input2 = make_sorted_input(testSize / 2, 2, keys, gen);
+        test_merge_inputs(par, input1, input2);
+        test_merge_inputs(par, input2, input1);
+        test_merge_inputs(par_unseq, input1, vector<element>{});
+    }
+}
+
+void test_case_merge_large(mt19937& gen) {
+    // large enough to take the buffered parallel inplace_merge path
+    const auto input1 = make_sorted_input(100'000, 1, 50'000, gen);
+    const auto input2 = make_sorted_input(70'000, 2, 50'000, gen);
+    test_merge_inputs(par, input1, input2);
+    test_merge_inputs(par_unseq, input2, input1);
+
+    // ranges already in order
+    const auto low  = make_sorted_input(40'000, 1, 1, gen);
+    const auto high = make_sorted_input(40'000, 2, 1, gen);
+    test_merge_inputs(par, low, high);
+}
+
+void test_inplace_merge_move_only() {
+    vector<unique_ptr<unsigned int>> v;
+    for (unsigned int i = 0; i < 20'000; i += 2) {
+        v.push_back(make_unique<unsigned int>(i));
+    }
+
+    for (unsigned int i = 1; i < 20'000; i += 2) {
+        v.push_back(make_unique<unsigned int>(i));
+    }
+
+    inplace_merge(par, v.begin(), v.begin() + 10'000, v.end(),
+        [](const unique_ptr<unsigned int>& lhs, const unique_ptr<unsigned int>& rhs) { return *lhs < *rhs; });
+    for (unsigned int i = 0; i < 20'000; ++i) {
+        assert(*v[i] == i);
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_merge_parallel, gen);
+    test_case_merge_large(gen);
+    test_inplace_merge_move_only();
+}
@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+void assert_nth_element(const vector<unsigned int>& original, const vector<unsigned int>& actual, const size_t nth) {
+    auto expected = original;
+    sort(expected.begin(), expected.end());
+    assert(is_permutation(original.begin(), original.end(), actual.begin(), actual.end()));
+    if (nth == actual.size()) {
+        return;
+    }
+
+    assert(actual[nth] == expected[nth]);
+    assert(all_of(actual.begin(), actual.begin() + static_cast<ptrdiff_t>(nth),
+        [&](unsigned int x) { return x <= actual[nth]; }));
+    assert(all_of(actual.begin() + static_cast<ptrdiff_t>(nth), actual.end(),
+        [&](unsigned int x) { return x >= actual[nth]; }));
+}
+
+void assert_partial_sort(const vector<unsigned int>& original, const vector<unsigned int>& actual, const size_t mid) {
+    auto expected = original;
+    sort(expected.begin(), expected.end());
+    assert(is_permutation(original.begin(), original.end(), actual.begin(), actual.end()));
+    assert(equal(actual.begin(), actual.begin() + static_cast<ptrdiff_t>(mid), expected.begin()));
+}
+
+template <class ExPo>
+void test_selection(const ExPo& exec, const vector<unsigned int>& original) {
+    const size_t testSize = original.size();
+    const size_t positions[] = {0, testSize / 4, testSize / 2, testSize - testSize / 4, testSize};
+    for (const size_t pos : positions) {
+        auto tmp = original;
+        nth_element(exec, tmp.begin(), tmp.begin() + static_cast<ptrdiff_t>(pos), tmp.end());
+        assert_nth_element(original, tmp, pos);
+
+        tmp = original;
+        nth_element(exec, tmp.begin(), tmp.begin() + static_cast<ptrdiff_t>(pos), tmp.end(), greater<>{});
+        reverse(tmp.begin(), tmp.end());
+        if (pos != testSize) {
+            assert_nth_element(original, tmp, testSize - 1 - pos);
+        }
+
+        tmp = original;
+        partial_sort(exec, tmp.begin(), tmp.begin() + static_cast<ptrdiff_t>(pos), tmp.end());
+        assert_partial_sort(original, tmp, pos);
+
+        tmp = original;
+        partial_sort(exec, tmp.begin(), tmp.begin() + static_cast<ptrdiff_t>(pos), tmp.end(), less<>{});
+        assert_partial_sort(original, tmp, pos);
+    }
+}
+
+void test_case_nth_element_parallel(const size_t testSize, mt19937& gen) {
+    vector<unsigned int> original(testSize);
+    generate(original.begin(), original.end(), ref(gen));
+    test_selection(par, original);
+    test_selection(par_unseq, original);
+}
+
+void test_case_nth_element_large(mt19937& gen) {
+    // large enough that the parallel partitioning steps actually run
+    constexpr size_t testSize = 200'000;
+    vector<unsigned int> original(testSize);
+
+    generate(original.begin(), original.end(), ref(gen));
+    test_selection(par, original);
+
+    // many elements equivalent to the pivot
+    uniform_int_distribution<unsigned int> dist(0, 3);
+    generate(original.begin(), original.end(), [&] { return dist(gen); });
+    test_selection(par, original);
+
+    fill(original.begin(), original.end(), 42U);
+    test_selection(par, original);
+
+    iota(original.begin(), original.end(), 0U);
+    test_selection(par, original);
+    reverse(original.begin(), original.end());
+    test_selection(par_unseq, original);
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_nth_element_parallel, gen);
+    test_case_nth_element_large(gen);
+}
@@ -37,6 +37,11 @@ void test_case_reduce(const size_t testSize, mt19937& gen) {
     assert(correct == reduce(b, e, 42U, add_a_different_way));
     assert(correct == reduce(seq, b, e, 42U, add_a_different_way));
     assert(correct == reduce(par, b, e, 42U, add_a_different_way));
+    // the unsequenced policies reduce in interleaved lanes
+    assert(correct == reduce(par_unseq, b, e, 42U, add_a_different_way));
+#if _HAS_CXX20
+    assert(correct == reduce(unseq, b, e, 42U, add_a_different_way));
+#endif // _HAS_CXX20
 }
 
 vector<unique_ptr<vector<unsigned int>>> get_move_only_test_data(const size_t testSize) {
@@ -68,6 +73,43 @@ void test_case_move_only(ExPo&& exec, const size_t testSize) {
     }
 }
 
+template <class ExPo>
+void test_case_move_only_ordered(ExPo&& exec, const size_t testSize) {
+    // a deterministic reduction combines the chunks in order, so even a noncommutative operation keeps the order
+    auto testData                           = get_move_only_test_data(testSize);
+    unique_ptr<vector<unsigned int>> result = reduce(forward<ExPo>(exec), make_move_iterator(testData.begin()),
+        make_move_iterator(testData.end()), make_unique<vector<unsigned int>>(),
+        [](unique_ptr<vector<unsigned int>> lhs, unique_ptr<vector<unsigned int>> rhs) {
+            lhs->insert(lhs->end(), rhs->begin(), rhs->end());
+            return lhs;
+        });
+
+    assert(result->size() == testSize);
+    for (size_t idx = 0; idx < testSize; ++idx) {
+        assert((*result)[idx] == idx);
+    }
+}
+
+void test_case_reduce_deterministic(const size_t testSize, mt19937& gen) {
+    vector<double> c(testSize);
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    generate(c.begin(), c.end(), [&] { return dist(gen); });
+    const auto deterministic = par._With_deterministic_reduction();
+    const double expected    = reduce(deterministic, c.begin(), c.end(), 0.5);
+    assert(reduce(deterministic, c.begin(), c.end(), 0.5) == expected);
+    assert(reduce(deterministic._With_max_threads(1), c.begin(), c.end(), 0.5) == expected);
+    assert(reduce(par_unseq._With_max_threads(3)._With_deterministic_reduction(), c.begin(), c.end(), 0.5) == expected);
+}
+
+void test_case_reduce_compensated() {
+    // 1e16 + 1 rounds back to 1e16, so a plain sum loses every 1.0
+    vector<double> c(10'000, 1.0);
+    c.front() = 1e16;
+    c.back()  = -1e16;
+    assert(reduce(par._With_compensated_summation(), c.begin(), c.end()) == 9'998.0);
+    assert(reduce(par._With_compensated_summation(), c.begin(), c.end(), 2.0, plus<double>{}) == 10'000.0);
+}
+
 void test_case_incorrect_special_case_reasoning() {
     unsigned char a[] = {128, 128};
     // 128 + 128 mod 256 == 0, but Usual Arithmetic Conversions would say 256
@@ -79,5 +121,15 @@ int main() {
     parallel_test_case(test_case_reduce, gen);
     parallel_test_case([](const size_t testSize) { test_case_move_only(seq, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only(par, testSize); });
+    parallel_test_case([](const size_t testSize) { test_case_move_only(par_unseq, testSize); });
+#if _HAS_CXX20
+    parallel_test_case([](const size_t testSize) { test_case_move_only(unseq, testSize); });
+#endif // _HAS_CXX20
+    parallel_test_case(test_case_reduce_deterministic, gen);
+    test_case_reduce_compensated();
+    parallel_test_case(
+        [](const size_t testSize) { test_case_move_only_ordered(par._With_deterministic_reduction(), testSize); });
+    parallel_test_case(
+        [](const size_t testSize) { test_case_move_only_ordered(par._With_compensated_summation(), testSize); });
     test_case_incorrect_special_case_reasoning();
 }
@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+template <template <class...> class Container>
+void test_case_set_union_parallel(const size_t testSize, mt19937& gen) {
+    for (const unsigned int range : {2U, 10U, 0xFFFFFFFFU}) {
+        vector<unsigned int> source1(testSize);
+        vector<unsigned int> source2(testSize / 2 + 1);
+        generate(source1.begin(), source1.end(), [&] { return gen() % range; });
+        generate(source2.begin(), source2.end(), [&] { return gen() % range; });
+        sort(source1.begin(), source1.end());
+        sort(source2.begin(), source2.end());
+        const Container<unsigned int> input1(source1.begin(), source1.end());
+        const Container<unsigned int> input2(source2.begin(), source2.end());
+
+        vector<unsigned int> expected(source1.size() + source2.size());
+        Container<unsigned int> actual(source1.size() + source2.size());
+
+        auto serialResult = set_union(input1.begin(), input1.end(), input2.begin(), input2.end(), expected.begin());
+        auto parallelResult =
+            set_union(par, input1.begin(), input1.end(), input2.begin(), input2.end(), actual.begin());
+        assert(equal(expected.begin(), serialResult, actual.begin(), parallelResult));
+
+        serialResult = set_symmetric_difference(
+            input1.begin(), input1.end(), input2.begin(), input2.end(), expected.begin());
+        parallelResult = set_symmetric_difference(
+            par, input1.begin(), input1.end(), input2.begin(), input2.end(), actual.begin());
+        assert(equal(expected.begin(), serialResult, actual.begin(), parallelResult));
+
+        // ranges of different lengths assigned the other way around
+        serialResult = set_union(input2.begin(), input2.end(), input1.begin(), input1.end(), expected.begin());
+        parallelResult =
+            set_union(par, input2.begin(), input2.end(), input1.begin(), input1.end(), actual.begin(), less<>{});
+        assert(equal(expected.begin(), serialResult, actual.begin(), parallelResult));
+
+        assert(includes(input1.begin(), input1.end(), input2.begin(), input2.end())
+               == includes(par, input1.begin(), input1.end(), input2.begin(), input2.end()));
+        assert(includes(par, input1.begin(), input1.end(), input1.begin(), input1.end()));
+
+        // every other element is contained; a value past the generated ones is not
+        vector<unsigned int> subset;
+        for (size_t idx = 0; idx < source1.size(); idx += 2) {
+            subset.push_back(source1[idx]);
+        }
+
+        assert(includes(par, input1.begin(), input1.end(), subset.begin(), subset.end(), less<>{}));
+        subset.push_back(range);
+        assert(!includes(par, input1.begin(), input1.end(), subset.begin(), subset.end()));
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_set_union_parallel<forward_list>, gen);
+    parallel_test_case(test_case_set_union_parallel<list>, gen);
+    parallel_test_case(test_case_set_union_parallel<vector>, gen);
+}
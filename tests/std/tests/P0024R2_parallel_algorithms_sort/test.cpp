@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <assert.h>
 #include <execution>
+#include <functional>
 #include <numeric>
 #include <random>
 #include <vector>
@@ -35,9 +36,45 @@ void test_case_sort_parallel(const size_t testSize, mt19937& gen) {
     assert(is_sorted(c.begin(), c.end()));
 }
 
+template <class T, class Fx>
+void test_case_sort_parallel_arithmetic(mt19937& gen, Fx generator) {
+    // large enough to take the radix sort path for arithmetic keys
+    vector<T> input(100'000);
+    generate(input.begin(), input.end(), [&] { return static_cast<T>(generator(gen)); });
+
+    auto expected = input;
+    auto actual   = input;
+    sort(expected.begin(), expected.end());
+    sort(par, actual.begin(), actual.end());
+    assert(actual == expected);
+
+    actual = input;
+    sort(par, actual.begin(), actual.end(), less<T>{});
+    assert(actual == expected);
+
+    sort(expected.begin(), expected.end(), greater<>{});
+    actual = input;
+    sort(par, actual.begin(), actual.end(), greater<>{});
+    assert(actual == expected);
+}
+
 int main() {
     mt19937 gen(1729);
 
     test_case_sort_parallel_special_cases();
     parallel_test_case(test_case_sort_parallel, gen);
+
+    test_case_sort_parallel_arithmetic<unsigned int>(gen, [](mt19937& urbg) { return urbg(); });
+    test_case_sort_parallel_arithmetic<int>(gen, [](mt19937& urbg) { return static_cast<int>(urbg()); });
+    test_case_sort_parallel_arithmetic<short>(gen, [](mt19937& urbg) { return static_cast<short>(urbg()); });
+    test_case_sort_parallel_arithmetic<signed char>(gen, [](mt19937& urbg) { return urbg() % 256 - 128; });
+    test_case_sort_parallel_arithmetic<long long>(gen, [](mt19937& urbg) { return urbg() % 1000 - 500LL; });
+    test_case_sort_parallel_arithmetic<unsigned long long>(
+        gen, [](mt19937& urbg) { return (static_cast<unsigned long long>(urbg()) << 32) | urbg(); });
+    test_case_sort_parallel_arithmetic<float>(
+        gen, [](mt19937& urbg) { return uniform_real_distribution<float>{-1e6f, 1e6f}(urbg); });
+    test_case_sort_parallel_arithmetic<double>(gen, [](mt19937& urbg) {
+        const double special[] = {-0.0, 0.0, -1e300, 1e300, 1.5, -1.5};
+        return urbg() % 2 == 0 ? special[urbg() % 6] : normal_distribution<double>{}(urbg);
+    });
 }
@@ -3,8 +3,10 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <atomic>
 #include <execution>
 #include <list>
+#include <memory_resource>
 #include <random>
 #include <vector>
 
@@ -82,6 +84,55 @@ void test_case_stable_sort_parallel_vector(const size_t testSize, mt19937& gen)
     assert_stable_sort_cmpTens_test_case(c.begin(), c.end());
 }
 
+class counting_resource : public pmr::memory_resource {
+public:
+    atomic<size_t> allocations{0};
+    atomic<size_t> bytes_in_use{0};
+
+private:
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        void* const result = pmr::new_delete_resource()->allocate(bytes, align);
+        ++allocations;
+        bytes_in_use += bytes;
+        return result;
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        bytes_in_use -= bytes;
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const memory_resource& that) const noexcept override {
+        return this == &that;
+    }
+};
+
+void test_case_stable_sort_scratch_resource(mt19937& gen) {
+    counting_resource res;
+    auto c = get_test_case_vector(10'000, gen);
+    stable_sort(par._With_scratch_resource(&res), c.begin(), c.end(), cmpTens);
+    assert_stable_sort_cmpTens_test_case(c.begin(), c.end());
+    assert(res.allocations != 0);
+    assert(res.bytes_in_use == 0);
+
+    counting_resource threadRes;
+    assert(_Set_scratch_resource(&threadRes) == nullptr);
+    c = get_test_case_vector(10'000, gen);
+    stable_sort(par, c.begin(), c.end(), cmpTens);
+    assert_stable_sort_cmpTens_test_case(c.begin(), c.end());
+    assert(threadRes.allocations != 0);
+    assert(threadRes.bytes_in_use == 0);
+
+    // a resource named by the policy wins over the thread's, which is back in effect afterwards
+    const size_t threadAllocations = threadRes.allocations;
+    c = get_test_case_vector(10'000, gen);
+    stable_sort(par_unseq._With_scratch_resource(&res), c.begin(), c.end(), cmpTens);
+    assert_stable_sort_cmpTens_test_case(c.begin(), c.end());
+    assert(threadRes.allocations == threadAllocations);
+    assert(_Set_scratch_resource(nullptr) == &threadRes);
+    assert(res.bytes_in_use == 0);
+}
+
 int main() {
     mt19937 gen(1729);
 
@@ -89,4 +140,5 @@ int main() {
     test_case_stable_sort_parallel_special_cases<vector>();
     parallel_test_case(test_case_stable_sort_parallel_list, gen);
     parallel_test_case(test_case_stable_sort_parallel_vector, gen);
+    test_case_stable_sort_scratch_resource(gen);
 }
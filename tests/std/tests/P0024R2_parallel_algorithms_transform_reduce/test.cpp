@@ -46,6 +46,14 @@ void test_case_transform_reduce_binary(const size_t testSize, mt19937& gen) {
     assert(correct
            == transform_reduce(
                par, inputBegin, inputEnd, resultsBegin, 42U, add_a_different_way, multiply_a_different_way));
+    assert(correct
+           == transform_reduce(
+               par_unseq, inputBegin, inputEnd, resultsBegin, 42U, add_a_different_way, multiply_a_different_way));
+#if _HAS_CXX20
+    assert(correct
+           == transform_reduce(
+               unseq, inputBegin, inputEnd, resultsBegin, 42U, add_a_different_way, multiply_a_different_way));
+#endif // _HAS_CXX20
 }
 
 const auto times_ten = [](unsigned int a) { return a * 10; };
@@ -67,6 +75,10 @@ void test_case_transform_reduce(const size_t testSize, mt19937& gen) {
     assert(correct == transform_reduce(b, e, 42U, plus<>{}, times_ten));
     assert(correct == transform_reduce(seq, b, e, 42U, plus<>{}, times_ten));
     assert(correct == transform_reduce(par, b, e, 42U, plus<>{}, times_ten));
+    assert(correct == transform_reduce(par_unseq, b, e, 42U, plus<>{}, times_ten));
+#if _HAS_CXX20
+    assert(correct == transform_reduce(unseq, b, e, 42U, plus<>{}, times_ten));
+#endif // _HAS_CXX20
 }
 
 vector<unique_ptr<vector<unsigned int>>> get_move_only_test_data(const size_t testSize) {
@@ -132,6 +144,35 @@ void test_case_move_only(ExPo&& exec, const size_t testSize) {
     }
 }
 
+void test_case_transform_reduce_deterministic(const size_t testSize, mt19937& gen) {
+    vector<double> a(testSize);
+    vector<double> b(testSize);
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    generate(a.begin(), a.end(), [&] { return dist(gen); });
+    generate(b.begin(), b.end(), [&] { return dist(gen); });
+    const auto deterministic = par._With_deterministic_reduction();
+    const auto single_thread = deterministic._With_max_threads(1);
+    const double expected    = transform_reduce(deterministic, a.begin(), a.end(), b.begin(), 0.0);
+    assert(transform_reduce(deterministic, a.begin(), a.end(), b.begin(), 0.0) == expected);
+    assert(transform_reduce(single_thread, a.begin(), a.end(), b.begin(), 0.0) == expected);
+
+    const auto square            = [](double x) { return x * x; };
+    const double expectedSquares = transform_reduce(deterministic, a.begin(), a.end(), 0.0, plus<>{}, square);
+    assert(transform_reduce(deterministic, a.begin(), a.end(), 0.0, plus<>{}, square) == expectedSquares);
+    assert(transform_reduce(single_thread, a.begin(), a.end(), 0.0, plus<>{}, square) == expectedSquares);
+}
+
+void test_case_transform_reduce_compensated() {
+    // 1e16 + 1 rounds back to 1e16, so a plain sum loses every 1.0
+    vector<double> a(10'000, 1.0);
+    a.front() = 1e16;
+    a.back()  = -1e16;
+    const vector<double> b(a.size(), 2.0);
+    const auto compensated = par._With_compensated_summation();
+    assert(transform_reduce(compensated, a.begin(), a.end(), b.begin(), 0.0) == 19'996.0);
+    assert(transform_reduce(compensated, a.begin(), a.end(), 0.0, plus<>{}, negate<>{}) == -9'998.0);
+}
+
 void test_case_incorrect_special_case_reasoning() {
     unsigned char a[] = {64, 1};
     unsigned char b[] = {64, 1};
@@ -150,7 +191,11 @@ int main() {
     parallel_test_case(test_case_transform_reduce, gen);
     parallel_test_case([](const size_t testSize) { test_case_move_only_binary(seq, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only_binary(par, testSize); });
+    parallel_test_case([](const size_t testSize) { test_case_move_only_binary(par_unseq, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only(seq, testSize); });
     parallel_test_case([](const size_t testSize) { test_case_move_only(par, testSize); });
+    parallel_test_case([](const size_t testSize) { test_case_move_only(par_unseq, testSize); });
+    parallel_test_case(test_case_transform_reduce_deterministic, gen);
+    test_case_transform_reduce_compensated();
     test_case_incorrect_special_case_reasoning();
 }
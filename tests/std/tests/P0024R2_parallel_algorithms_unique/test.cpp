@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <execution>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <vector>
+
+#include <parallel_algorithms_utilities.hpp>
+
+using namespace std;
+using namespace std::execution;
+
+const auto same_parity = [](unsigned int lhs, unsigned int rhs) { return ((lhs ^ rhs) & 0x1u) == 0; };
+
+template <template <class...> class Container>
+void test_case_unique_copy_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> input(testSize);
+    vector<unsigned int> expected(testSize);
+    vector<unsigned int> actual(testSize);
+    for (const unsigned int range : {2U, 5U, 0xFFFFFFFFU}) {
+        generate(input.begin(), input.end(), [&] { return gen() % range; });
+
+        auto serialResult   = unique_copy(input.begin(), input.end(), expected.begin());
+        auto parallelResult = unique_copy(par, input.begin(), input.end(), actual.begin());
+        assert(equal(expected.begin(), serialResult, actual.begin(), parallelResult));
+
+        serialResult   = unique_copy(input.begin(), input.end(), expected.begin(), same_parity);
+        parallelResult = unique_copy(par, input.begin(), input.end(), actual.begin(), same_parity);
+        assert(equal(expected.begin(), serialResult, actual.begin(), parallelResult));
+
+        // output to a forward iterator as well
+        forward_list<unsigned int> listOutput(testSize);
+        const auto listResult = unique_copy(par, input.begin(), input.end(), listOutput.begin());
+        serialResult          = unique_copy(input.begin(), input.end(), expected.begin());
+        assert(equal(expected.begin(), serialResult, listOutput.begin(), listResult));
+    }
+}
+
+template <template <class...> class Container>
+void test_case_unique_parallel(const size_t testSize, mt19937& gen) {
+    Container<unsigned int> expected(testSize);
+    for (const unsigned int range : {1U, 2U, 5U, 0xFFFFFFFFU}) {
+        generate(expected.begin(), expected.end(), [&] { return gen() % range; });
+        auto actual               = expected;
+        const auto serialResult   = unique(expected.begin(), expected.end());
+        const auto parallelResult = unique(par, actual.begin(), actual.end());
+        assert(equal(expected.begin(), serialResult, actual.begin(), parallelResult));
+    }
+}
+
+void test_case_unique_large() {
+    // runs of duplicates crossing many chunk boundaries
+    vector<unsigned int> expected(100'000);
+    for (const size_t runs : {1U, 3U, 1000U, 100'000U}) {
+        for (size_t i = 0; i < expected.size(); ++i) {
+            expected[i] = static_cast<unsigned int>(i * runs / expected.size());
+        }
+
+        const auto original       = expected;
+        auto actual               = expected;
+        const auto serialResult   = unique(expected.begin(), expected.end());
+        const auto parallelResult = unique(par, actual.begin(), actual.end());
+        assert(equal(expected.begin(), serialResult, actual.begin(), parallelResult));
+
+        vector<unsigned int> copied(original.size());
+        assert(equal(expected.begin(), serialResult, copied.begin(),
+            unique_copy(par, original.begin(), original.end(), copied.begin())));
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    parallel_test_case(test_case_unique_copy_parallel<forward_list>, gen);
+    parallel_test_case(test_case_unique_copy_parallel<list>, gen);
+    parallel_test_case(test_case_unique_copy_parallel<vector>, gen);
+    parallel_test_case(test_case_unique_parallel<forward_list>, gen);
+    parallel_test_case(test_case_unique_parallel<list>, gen);
+    parallel_test_case(test_case_unique_parallel<vector>, gen);
+    test_case_unique_large();
+}
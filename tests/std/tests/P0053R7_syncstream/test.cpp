@@ -0,0 +1,160 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <syncstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// a stream buffer that records how often it is synchronized
+struct counting_buf : stringbuf {
+    int syncs = 0;
+
+    int sync() override {
+        ++syncs;
+        return stringbuf::sync();
+    }
+};
+
+void test_buffering() {
+    ostringstream out;
+    {
+        osyncstream sync_out(out);
+        assert(sync_out.get_wrapped() == out.rdbuf());
+        assert(sync_out.rdbuf()->get_wrapped() == out.rdbuf());
+
+        sync_out << "hello" << 42;
+        assert(out.str().empty());
+        sync_out.emit();
+        assert(sync_out.good());
+        assert(out.str() == "hello42");
+
+        sync_out << ' ' << string(1000, 'x'); // grows the buffer several times
+        assert(out.str() == "hello42");
+    }
+
+    assert(out.str() == "hello42 " + string(1000, 'x'));
+}
+
+void test_sync() {
+    counting_buf dest;
+    {
+        syncbuf buf(&dest);
+        ostream os(&buf);
+        os << "meow" << flush;
+        assert(dest.str().empty());
+        assert(dest.syncs == 0);
+
+        assert(buf.emit());
+        assert(dest.str() == "meow");
+        assert(dest.syncs == 1);
+
+        os << "purr";
+        assert(buf.emit());
+        assert(dest.str() == "meowpurr");
+        assert(dest.syncs == 1); // no flush was requested since the last emit
+
+        buf.set_emit_on_sync(true);
+        os << "hiss" << flush;
+        assert(dest.str() == "meowpurrhiss");
+        assert(dest.syncs == 2);
+    }
+
+    assert(dest.syncs == 2);
+}
+
+void test_no_wrapped() {
+    syncbuf buf;
+    assert(buf.get_wrapped() == nullptr);
+    assert(!buf.emit());
+
+    osyncstream sync_out(static_cast<streambuf*>(nullptr));
+    sync_out << "lost";
+    sync_out.emit();
+    assert(sync_out.bad());
+}
+
+void test_move() {
+    ostringstream out;
+    osyncstream first(out);
+    first << "abc";
+
+    osyncstream second(move(first));
+    assert(first.get_wrapped() == nullptr);
+    assert(second.get_wrapped() == out.rdbuf());
+    second << "def";
+    second.emit();
+    assert(out.str() == "abcdef");
+
+    ostringstream other;
+    osyncstream third(other);
+    third << "ghi";
+    third = move(second); // emits "ghi" into other first
+    assert(other.str() == "ghi");
+    assert(third.get_wrapped() == out.rdbuf());
+    third << "jkl";
+    third.emit();
+    assert(out.str() == "abcdefjkl");
+
+    syncbuf buf_a(out.rdbuf());
+    syncbuf buf_b;
+    swap(buf_a, buf_b);
+    assert(buf_a.get_wrapped() == nullptr);
+    assert(buf_b.get_wrapped() == out.rdbuf());
+}
+
+void test_threads() {
+    constexpr int thread_count = 4;
+    constexpr int line_count   = 200;
+    const string line          = "the quick brown fox jumps over the lazy dog";
+
+    ostringstream out;
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&out, &line, i] {
+            for (int j = 0; j < line_count; ++j) {
+                osyncstream(out) << i << ' ' << line << '\n';
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    istringstream in(out.str());
+    string text;
+    int count = 0;
+    for (int id; in >> id && getline(in, text); ++count) {
+        assert(0 <= id && id < thread_count);
+        assert(text == ' ' + line);
+    }
+
+    assert(count == thread_count * line_count);
+}
+
+void test_wide() {
+    wostringstream out;
+    {
+        wosyncstream sync_out(out);
+        sync_out << L"wide " << 1.5;
+        assert(out.str().empty());
+    }
+
+    assert(out.str() == L"wide 1.5");
+}
+
+int main() {
+    test_buffering();
+    test_sync();
+    test_no_wrapped();
+    test_move();
+    test_threads();
+    test_wide();
+}
@@ -1128,6 +1128,22 @@ inline constexpr DoubleFromCharsTestCase double_from_chars_test_cases[] = {
      "0000000000000000000000000000000001p+1023",
         chars_format::hex, 1023, errc{}, 0x1.fffffffffffffp+1023},
 
+    // Clinger fast path and Eisel-Lemire boundaries
+    {"9007199254740992", chars_format::general, 16, errc{}, 0x1p+53}, // exact, largest Clinger mantissa
+    {"9007199254740993", chars_format::general, 16, errc{}, 0x1p+53}, // midpoint, round down to even
+    {"9007199254740995", chars_format::general, 16, errc{}, 0x1.0000000000002p+53}, // midpoint, round up to even
+    {"9007199254740993.0000000000000000001", chars_format::general, 36, errc{},
+        0x1.0000000000001p+53}, // above midpoint in the 20th digit, round up
+    {"1e22", chars_format::general, 4, errc{}, 0x1.0f0cf064dd592p+73}, // largest exact power of ten
+    {"1e23", chars_format::general, 4, errc{}, 0x1.52d02c7e14af6p+76}, // inexact power of ten
+    {"123456789e-22", chars_format::general, 13, errc{}, 0x1.bcccca1f70d61p-47}, // division by an exact power of ten
+    {"2.2250738585072014e-308", chars_format::general, 23, errc{}, 0x1p-1022}, // smallest normal
+    {"2.2250738585072011e-308", chars_format::general, 23, errc{}, 0x0.fffffffffffffp-1022}, // largest denormal
+    {"4.9406564584124654e-324", chars_format::general, 23, errc{}, 0x0.0000000000001p-1022}, // smallest denormal
+    {"1.7976931348623157e308", chars_format::general, 22, errc{}, 0x1.fffffffffffffp+1023}, // largest finite
+    {"0.30000000000000000000000000000000001", chars_format::general, 37, errc{}, 0x1.3333333333333p-2},
+    {"12345678901234567890123456789", chars_format::general, 29, errc{}, 0x1.3f20d99235f65p+93},
+
     // VSO-733765 "<charconv>: [Feedback] double std::from_chars behavior on exponent out of range"
     // LWG-3081 "Floating point from_chars API does not distinguish between overflow and underflow"
     // These test cases exercise every overflow/underflow codepath.
@@ -121,6 +121,18 @@ inline constexpr FloatFromCharsTestCase float_from_chars_test_cases[] = {
      "2222222222222222222e-45",
         chars_format::scientific, 1006, errc{}, 0x0.000004p-126f},
 
+    // Clinger fast path and Eisel-Lemire boundaries
+    {"16777216", chars_format::general, 8, errc{}, 0x1p+24f}, // exact, largest Clinger mantissa
+    {"16777217", chars_format::general, 8, errc{}, 0x1p+24f}, // midpoint, round down to even
+    {"16777219", chars_format::general, 8, errc{}, 0x1.000004p+24f}, // midpoint, round up to even
+    {"16777217.00000000000000000001", chars_format::general, 29, errc{},
+        0x1.000002p+24f}, // above midpoint in the 20th digit, round up
+    {"1e10", chars_format::general, 4, errc{}, 0x1.2a05f2p+33f}, // largest exact power of ten
+    {"1e11", chars_format::general, 4, errc{}, 0x1.74876ep+36f}, // inexact power of ten
+    {"1.17549435e-38", chars_format::general, 14, errc{}, 0x1p-126f}, // smallest normal
+    {"3.4028234e38", chars_format::general, 12, errc{}, 0x1.fffffep+127f}, // largest finite
+    {"0.1000000000000000000000000001", chars_format::general, 30, errc{}, 0x1.99999ap-4f},
+
     // VSO-733765 "<charconv>: [Feedback] double std::from_chars behavior on exponent out of range"
     // LWG-3081 "Floating point from_chars API does not distinguish between overflow and underflow"
     // These test cases exercise every overflow/underflow codepath.
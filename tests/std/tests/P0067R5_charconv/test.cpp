@@ -522,6 +522,34 @@ void test_integer_from_chars() {
         test_from_chars<T>("-0x1729", 16, 2, errc{}, static_cast<T>(0)); // reads "-0", stops at 'x'
         test_from_chars<T>("-0X1729", 16, 2, errc{}, static_cast<T>(0)); // reads "-0", stops at 'X'
     }
+
+    // Test base 10 limits and stopping within a chunk; eight digits are converted at a time.
+    const string max_str = to_string(numeric_limits<T>::max());
+    string above_max_str = max_str;
+    ++above_max_str.back(); // the maximum of every integer type ends in a digit less than 9
+    test_from_chars<T>(max_str, 10, max_str.size(), errc{}, numeric_limits<T>::max());
+    test_from_chars<T>(string(30, '0') + max_str, 10, 30 + max_str.size(), errc{}, numeric_limits<T>::max());
+    test_from_chars<T>(above_max_str, 10, above_max_str.size(), out_ran);
+    test_from_chars<T>(max_str + "0@", 10, max_str.size() + 1, out_ran);
+
+    if constexpr (is_signed_v<T>) {
+        const string min_str = to_string(numeric_limits<T>::min());
+        string below_min_str = min_str;
+        ++below_min_str.back(); // the minimum of every signed integer type ends in 8
+        test_from_chars<T>(min_str, 10, min_str.size(), errc{}, numeric_limits<T>::min());
+        test_from_chars<T>(below_min_str, 10, below_min_str.size(), out_ran);
+    }
+
+    if constexpr (sizeof(T) >= 4) {
+        test_from_chars<T>("1234567@89", 10, 7, errc{}, static_cast<T>(1234567));
+        test_from_chars<T>("12345678@9", 10, 8, errc{}, static_cast<T>(12345678));
+        test_from_chars<T>("123456789@", 10, 9, errc{}, static_cast<T>(123456789));
+    }
+
+    if constexpr (sizeof(T) >= 8) {
+        test_from_chars<T>("1234567890123456:7", 10, 16, errc{}, static_cast<T>(1234567890123456));
+        test_from_chars<T>("12345678901234567/", 10, 17, errc{}, static_cast<T>(12345678901234567));
+    }
 }
 
 template <typename T>
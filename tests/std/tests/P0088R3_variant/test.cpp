@@ -6598,8 +6598,47 @@ namespace msvc {
             }
         }
 
+        template <class Seq>
+        struct tag_variant_;
+        template <std::size_t... Is>
+        struct tag_variant_<std::index_sequence<Is...>> {
+            using type = std::variant<std::integral_constant<std::size_t, Is>...>;
+        };
+        template <std::size_t N>
+        using tag_variant = typename tag_variant_<std::make_index_sequence<N>>::type;
+
+        template <std::size_t N1, std::size_t N2, std::size_t N3, std::size_t I>
+        void test_multi_dispatch_one() {
+            constexpr std::size_t i1 = I / (N2 * N3);
+            constexpr std::size_t i2 = I / N3 % N2;
+            constexpr std::size_t i3 = I % N3;
+            const tag_variant<N1> v1{std::in_place_index<i1>};
+            const tag_variant<N2> v2{std::in_place_index<i2>};
+            const tag_variant<N3> v3{std::in_place_index<i3>};
+            auto visitor = [](auto a, auto b, auto c) -> std::size_t { return a * 10000 + b * 100 + c; };
+            assert(std::visit(visitor, v1, v2, v3) == i1 * 10000 + i2 * 100 + i3);
+        }
+
+        template <std::size_t N1, std::size_t N2, std::size_t N3, std::size_t... Is>
+        void test_multi_dispatch(std::index_sequence<Is...>) {
+            (test_multi_dispatch_one<N1, N2, N3, Is>(), ...);
+        }
+
+        template <std::size_t N1, std::size_t N2, std::size_t N3>
+        void test_multi_dispatch() {
+            // Validate that every combination of alternatives reaches the visitor with the matching indices
+            test_multi_dispatch<N1, N2, N3>(std::make_index_sequence<N1 * N2 * N3>{});
+        }
+
         void run_test() {
             test_immobile_function();
+
+            // (N1 + 1) * (N2 + 1) * (N3 + 1) total states select the switch strategies and the dispatch table
+            test_multi_dispatch<1, 1, 1>();
+            test_multi_dispatch<3, 1, 2>();
+            test_multi_dispatch<2, 4, 3>();
+            test_multi_dispatch<5, 4, 6>();
+            test_multi_dispatch<9, 1, 40>();
         }
     } // namespace visit
 
@@ -1407,6 +1407,32 @@ void test_directory_iterator_common_parts(const string_view typeName) {
 
 void test_directory_iterator() {
     test_directory_iterator_common_parts<directory_iterator>("directory_iterator"sv);
+
+    {
+        // enough entries with long names that enumeration reads several batches of directory records
+        const test_temp_directory manyFiles("directory_iterator many files"sv);
+        constexpr int fileCount = 1500;
+        const wstring prefix(60, L'x');
+        for (int i = 0; i < fileCount; ++i) {
+            create_file_containing(manyFiles.directoryPath / (prefix + to_wstring(i)), prefix.c_str() + i % 60);
+        }
+
+        vector<bool> seen(fileCount);
+        int count = 0;
+        for (const auto& entry : directory_iterator(manyFiles.directoryPath)) {
+            const wstring name = entry.path().filename().native();
+            EXPECT(name.compare(0, prefix.size(), prefix) == 0);
+            const int index = stoi(name.substr(prefix.size()));
+            EXPECT(!seen[static_cast<size_t>(index)]);
+            seen[static_cast<size_t>(index)] = true;
+            ++count;
+
+            EXPECT(entry.is_regular_file());
+            EXPECT(entry.file_size() == static_cast<uintmax_t>(60 - index % 60));
+        }
+
+        EXPECT(count == fileCount);
+    }
 }
 
 void test_recursive_directory_iterator() {
@@ -17,6 +17,7 @@
 #include <regex>
 #include <set>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -1388,6 +1389,66 @@ namespace {
 #endif // _M_CEE
             }
         } // namespace is_equal
+
+#ifndef _M_CEE
+        namespace synchronized_threads {
+            void test() {
+                // many threads allocating and freeing blocks, some of them freed by a different thread than the
+                // one that allocated them
+                recording_resource rr;
+                {
+                    std::pmr::synchronized_pool_resource spr{{0_zu, 256_zu}, &rr};
+                    constexpr int thread_count = 8;
+                    constexpr int block_count  = 2000;
+                    std::vector<std::vector<unsigned char*>> blocks(thread_count);
+
+                    auto const fill = [&](int const t) {
+                        for (int i = 0; i < block_count; ++i) {
+                            auto const size = static_cast<std::size_t>(i % 300 + 1);
+                            auto const p    = static_cast<unsigned char*>(spr.allocate(size, alignof(int)));
+                            std::fill_n(p, size, static_cast<unsigned char>(t));
+                            blocks[static_cast<std::size_t>(t)].push_back(p);
+                        }
+                    };
+
+                    auto const drain = [&](int const t) {
+                        auto& mine = blocks[static_cast<std::size_t>(t)];
+                        for (int i = 0; i < block_count; ++i) {
+                            auto const size = static_cast<std::size_t>(i % 300 + 1);
+                            auto const p    = mine[static_cast<std::size_t>(i)];
+                            CHECK(std::all_of(p, p + size, [t](unsigned char c) { return c == t; }));
+                            spr.deallocate(p, size, alignof(int));
+                        }
+                        mine.clear();
+                    };
+
+                    for (int round = 0; round < 3; ++round) {
+                        std::vector<std::thread> threads;
+                        for (int t = 0; t < thread_count; ++t) {
+                            threads.emplace_back(fill, t);
+                        }
+                        for (auto& th : threads) {
+                            th.join();
+                        }
+
+                        threads.clear();
+                        for (int t = 0; t < thread_count; ++t) {
+                            // each thread frees the blocks of its neighbor
+                            threads.emplace_back([&, t] { drain((t + round + 1) % thread_count); });
+                        }
+                        for (auto& th : threads) {
+                            th.join();
+                        }
+                    }
+
+                    spr.release();
+                    CHECK(rr.allocations_.size() <= 2); // at most the container proxy and the thread caches
+                    spr.deallocate(spr.allocate(42, 1), 42, 1);
+                }
+                CHECK(rr.allocations_.empty());
+            }
+        } // namespace synchronized_threads
+#endif // _M_CEE
     } // namespace pool
 
     namespace containers {
@@ -1463,6 +1524,9 @@ int main() {
     pool::options::test();
     pool::is_equal::test();
     pool::allocate_deallocate::test();
+#ifndef _M_CEE
+    pool::synchronized_threads::test();
+#endif // _M_CEE
 
     containers::test();
 }
@@ -0,0 +1,337 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::inplace_function;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+int g_allocations = 0;
+
+void* operator new(size_t size) {
+    void* const p = ::operator new(size, nothrow);
+    if (!p) {
+        throw bad_alloc{};
+    }
+
+    return p;
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    ++g_allocations;
+    return malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* ptr) noexcept {
+    ::operator delete(ptr, nothrow);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    ::operator delete(ptr, nothrow);
+}
+
+void operator delete(void* ptr, const nothrow_t&) noexcept {
+    free(ptr);
+}
+
+STATIC_ASSERT(!is_copy_constructible_v<move_only_function<void()>>);
+STATIC_ASSERT(!is_copy_assignable_v<move_only_function<void()>>);
+STATIC_ASSERT(is_nothrow_move_constructible_v<move_only_function<void()>>);
+STATIC_ASSERT(is_nothrow_move_assignable_v<move_only_function<void()>>);
+STATIC_ASSERT(is_same_v<move_only_function<int(char) const noexcept>::result_type, int>);
+
+struct mutable_callable {
+    int operator()() {
+        return 1;
+    }
+};
+
+struct const_callable {
+    int operator()() const {
+        return 2;
+    }
+};
+
+struct rvalue_callable {
+    int operator()() && {
+        return 3;
+    }
+};
+
+struct noexcept_callable {
+    int operator()() const noexcept {
+        return 4;
+    }
+};
+
+// the qualifiers of the signature constrain which callable objects are accepted
+STATIC_ASSERT(is_constructible_v<move_only_function<int()>, mutable_callable>);
+STATIC_ASSERT(!is_constructible_v<move_only_function<int() const>, mutable_callable>);
+STATIC_ASSERT(is_constructible_v<move_only_function<int() const>, const_callable>);
+STATIC_ASSERT(!is_constructible_v<move_only_function<int()>, rvalue_callable>);
+STATIC_ASSERT(is_constructible_v<move_only_function<int() &&>, rvalue_callable>);
+STATIC_ASSERT(!is_constructible_v<move_only_function<int() noexcept>, const_callable>);
+STATIC_ASSERT(is_constructible_v<move_only_function<int() const& noexcept>, noexcept_callable>);
+STATIC_ASSERT(!is_constructible_v<move_only_function<int()>, int>);
+STATIC_ASSERT(!is_constructible_v<inplace_function<int() const>, mutable_callable>);
+
+// and the qualifiers of the call operator follow the signature
+STATIC_ASSERT(is_invocable_v<move_only_function<int()>&>);
+STATIC_ASSERT(!is_invocable_v<const move_only_function<int()>&>);
+STATIC_ASSERT(is_invocable_v<const move_only_function<int() const>&>);
+STATIC_ASSERT(is_invocable_v<move_only_function<int() &&>>);
+STATIC_ASSERT(!is_invocable_v<move_only_function<int() &&>&>);
+STATIC_ASSERT(is_nothrow_invocable_v<move_only_function<int() noexcept>&>);
+STATIC_ASSERT(!is_nothrow_invocable_v<move_only_function<int()>&>);
+
+int add(const int x, const int y) {
+    return x + y;
+}
+
+struct point {
+    int x;
+
+    int get() const {
+        return x;
+    }
+};
+
+void test_basic_calls() {
+    move_only_function<int(int, int)> f = add;
+    assert(f);
+    assert(f(1, 2) == 3);
+
+    move_only_function<int(const point&) const> member = &point::get;
+    assert(member(point{5}) == 5);
+
+    move_only_function<int() &&> rvalue_only = rvalue_callable{};
+    assert(move(rvalue_only)() == 3);
+
+    move_only_function<int() const noexcept> nothrow = noexcept_callable{};
+    assert(nothrow() == 4);
+
+    move_only_function<void(int&)> increment = [](int& x) { ++x; };
+    int value = 41;
+    increment(value);
+    assert(value == 42);
+
+    // results that are discarded or converted
+    move_only_function<void()> discard = [] { return 1729; };
+    discard();
+    move_only_function<long()> convert = [] { return 7; };
+    assert(convert() == 7L);
+}
+
+void test_move_only_callables() {
+    auto ptr = make_unique<int>(10);
+    move_only_function<int()> f([p = move(ptr)] { return *p; });
+    assert(f() == 10);
+
+    move_only_function<int()> g = move(f);
+    assert(!f);
+    assert(g() == 10);
+
+    f = move(g);
+    assert(f() == 10);
+    assert(g == nullptr);
+
+    // passing arguments by value moves them in
+    move_only_function<int(unique_ptr<int>)> consume = [](unique_ptr<int> p) { return *p; };
+    assert(consume(make_unique<int>(20)) == 20);
+}
+
+void test_empty_targets() {
+    move_only_function<int(int, int)> f;
+    assert(!f);
+    assert(f == nullptr);
+
+    int (*null_function)(int, int) = nullptr;
+    f                              = null_function;
+    assert(!f);
+
+    int (point::*null_member)() const = nullptr;
+    move_only_function<int(const point&) const> g(null_member);
+    assert(!g);
+
+    move_only_function<int(int, int)> empty;
+    move_only_function<long(int, int)> wraps_empty(move(empty));
+    assert(!wraps_empty);
+
+    f = add;
+    assert(f != nullptr);
+    f = nullptr;
+    assert(!f);
+}
+
+struct big_callable {
+    int values[100];
+
+    int operator()() const {
+        return values[0] + values[99];
+    }
+};
+
+struct aggregate_like {
+    vector<int> values;
+    int scale;
+
+    aggregate_like(initializer_list<int> list, const int s) : values(list), scale(s) {}
+
+    int operator()() const {
+        return static_cast<int>(values.size()) * scale;
+    }
+};
+
+void test_storage() {
+    // a typical task: a shared_ptr and a few integers must not allocate
+    const auto shared = make_shared<int>(3);
+    const int a = 4;
+    const int b = 5;
+    const long long c = 6;
+    g_allocations = 0;
+    move_only_function<long long()> task = [shared, a, b, c] { return *shared + a + b + c; };
+    move_only_function<long long()> moved = move(task);
+    assert(moved() == 18);
+    assert(g_allocations == 0);
+
+    big_callable big{};
+    big.values[0]  = 1;
+    big.values[99] = 2;
+    move_only_function<int() const> large(big);
+    assert(g_allocations == 1);
+    move_only_function<int() const> large_moved(move(large));
+    assert(g_allocations == 1); // moving a heap-stored callable transfers the pointer
+    assert(large_moved() == 3);
+
+    move_only_function<int() const> in_place(in_place_type<aggregate_like>, {1, 2, 3}, 10);
+    assert(in_place() == 30);
+    move_only_function<int() const> in_place_big(in_place_type<big_callable>);
+    (void) in_place_big();
+}
+
+void test_swap() {
+    move_only_function<string()> small = [] { return string("small"); };
+    const string long_text(100, 'x');
+    move_only_function<string()> large = [long_text, padding = big_callable{}] { return long_text; };
+    move_only_function<string()> empty;
+
+    small.swap(large);
+    assert(small() == long_text);
+    assert(large() == "small");
+
+    swap(large, empty);
+    assert(!large);
+    assert(empty() == "small");
+
+    swap(small, empty);
+    swap(small, empty);
+    assert(small() == long_text);
+    assert(empty() == "small");
+}
+
+struct counted {
+    static int live;
+
+    counted() {
+        ++live;
+    }
+
+    counted(const counted&) {
+        ++live;
+    }
+
+    counted(counted&&) noexcept {
+        ++live;
+    }
+
+    ~counted() {
+        --live;
+    }
+
+    void operator()() const {}
+};
+
+int counted::live = 0;
+
+struct large_counted : counted {
+    char padding[200];
+};
+
+void test_lifetimes() {
+    {
+        move_only_function<void()> small{counted{}};
+        move_only_function<void()> large{large_counted{}};
+        assert(counted::live == 2);
+
+        move_only_function<void()> other = move(small);
+        assert(counted::live == 2);
+        swap(other, large);
+        assert(counted::live == 2);
+
+        large = nullptr;
+        assert(counted::live == 1);
+        other = counted{};
+        assert(counted::live == 1);
+    }
+    assert(counted::live == 0);
+}
+
+void test_inplace_function() {
+    STATIC_ASSERT(inplace_function<void(), 128>::capacity == 128);
+    STATIC_ASSERT(is_nothrow_move_constructible_v<inplace_function<void(), 128>>);
+
+    g_allocations = 0;
+    {
+        vector<inplace_function<int(int), 512>> queue;
+        queue.reserve(10);
+        const int before = g_allocations;
+        for (int i = 0; i < 10; ++i) {
+            big_callable captured{};
+            captured.values[0] = i;
+            queue.emplace_back([captured](int x) { return captured.values[0] + captured.values[1] + x; });
+        }
+
+        assert(g_allocations == before); // the 400-byte captures are stored inside the wrappers
+
+        int sum = 0;
+        for (auto& task : queue) {
+            sum += task(1);
+        }
+
+        assert(sum == 55);
+    }
+
+    inplace_function<int(int, int)> f = add;
+    inplace_function<int(int, int)> g;
+    swap(f, g);
+    assert(!f);
+    assert(g(2, 3) == 5);
+
+    inplace_function<int(int, int)> empty;
+    inplace_function<int(int, int)> wraps_empty = move(empty);
+    assert(wraps_empty == nullptr);
+
+    inplace_function<int() const> in_place(in_place_type<const_callable>);
+    assert(in_place() == 2);
+}
+
+int main() {
+    test_basic_calls();
+    test_move_only_callables();
+    test_empty_targets();
+    test_storage();
+    test_swap();
+    test_lifetimes();
+    test_inplace_function();
+}
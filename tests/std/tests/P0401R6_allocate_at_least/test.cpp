@@ -0,0 +1,218 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <memory>
+#include <memory_resource>
+#include <pooled_allocator>
+#include <stddef.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(is_same_v<decltype(allocator<int>{}.allocate_at_least(1)), allocation_result<int*>>);
+STATIC_ASSERT(is_same_v<decltype(allocator_traits<allocator<int>>::allocate_at_least(declval<allocator<int>&>(), 1)),
+    allocation_result<int*, size_t>>);
+STATIC_ASSERT(is_same_v<decltype(allocate_at_least(declval<allocator<int>&>(), 1)), allocation_result<int*>>);
+
+constexpr size_t granule = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+// an allocator without allocate_at_least
+template <class T>
+struct exact_allocator {
+    using value_type = T;
+
+    exact_allocator() = default;
+    template <class U>
+    exact_allocator(const exact_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const exact_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const exact_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+// an allocator that rounds every request up to a power of 2, and checks that deallocate() gets the rounded count
+template <class T>
+struct power_of_2_allocator {
+    using value_type = T;
+
+    static size_t allocations;
+    static size_t outstanding;
+
+    power_of_2_allocator() = default;
+    template <class U>
+    power_of_2_allocator(const power_of_2_allocator<U>&) noexcept {}
+
+    static size_t round(const size_t n) {
+        size_t result = 1;
+        while (result < n) {
+            result *= 2;
+        }
+
+        return result;
+    }
+
+    T* allocate(const size_t n) {
+        ++allocations;
+        ++outstanding;
+        return allocator<T>{}.allocate(n);
+    }
+
+    allocation_result<T*> allocate_at_least(const size_t n) {
+        const size_t rounded = round(n);
+        return {allocate(rounded), rounded};
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        assert(round(n) == n);
+        --outstanding;
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const power_of_2_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const power_of_2_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+template <class T>
+size_t power_of_2_allocator<T>::allocations = 0;
+template <class T>
+size_t power_of_2_allocator<T>::outstanding = 0;
+
+void test_std_allocator() {
+    allocator<char> al;
+    for (size_t n = 1; n < 100; ++n) {
+        const auto result = al.allocate_at_least(n);
+        assert(result.ptr != nullptr);
+        assert(result.count >= n);
+        assert(result.count < n + granule);
+        assert(result.count % granule == 0);
+        al.deallocate(result.ptr, result.count);
+    }
+
+    struct big {
+        char bytes[granule * 3 + 1];
+    };
+
+    allocator<big> big_al;
+    const auto big_result = allocator_traits<allocator<big>>::allocate_at_least(big_al, 3);
+    assert(big_result.count == 3);
+    big_al.deallocate(big_result.ptr, big_result.count);
+}
+
+void test_traits_fallback() {
+    exact_allocator<int> al;
+    const auto result = allocator_traits<exact_allocator<int>>::allocate_at_least(al, 7);
+    assert(result.count == 7);
+    al.deallocate(result.ptr, result.count);
+}
+
+void test_free_function() {
+    power_of_2_allocator<int> rounding_al;
+    const auto rounded = allocate_at_least(rounding_al, 5);
+    assert(rounded.count == 8);
+    rounding_al.deallocate(rounded.ptr, rounded.count);
+
+    exact_allocator<int> exact_al;
+    const auto exact = allocate_at_least(exact_al, 5);
+    assert(exact.count == 5);
+    exact_al.deallocate(exact.ptr, exact.count);
+}
+
+void test_vector_growth() {
+    using alloc = power_of_2_allocator<int>;
+    {
+        vector<int, alloc> v;
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(i);
+            assert(alloc::round(v.capacity()) == v.capacity());
+        }
+
+        assert(alloc::allocations == 11); // 1, 2, 4, ..., 1024
+        v.insert(v.begin(), 100, 0);
+        v.resize(3000);
+        v.emplace(v.begin(), 0);
+        assert(alloc::round(v.capacity()) == v.capacity());
+    }
+    assert(alloc::outstanding == 0);
+
+    vector<char> chars;
+    for (int i = 0; i < 1000; ++i) {
+        chars.push_back('x');
+        assert(chars.capacity() % granule == 0);
+    }
+}
+
+void test_string_growth() {
+    using alloc = power_of_2_allocator<char>;
+    {
+        basic_string<char, char_traits<char>, alloc> s;
+        for (int i = 0; i < 1000; ++i) {
+            s.push_back('x');
+            assert(s.capacity() < 16 || alloc::round(s.capacity() + 1) == s.capacity() + 1);
+        }
+
+        s.append(3000, 'y');
+        assert(alloc::round(s.capacity() + 1) == s.capacity() + 1);
+        assert(s.size() == 4000);
+    }
+    assert(power_of_2_allocator<char>::outstanding == 0);
+}
+
+void test_pooled_allocator() {
+    stdext::pooled_allocator<int> al;
+    for (size_t n = 1; n < 200; ++n) {
+        const auto result = al.allocate_at_least(n);
+        assert(result.count >= n);
+        const size_t block = result.count * sizeof(int) + sizeof(void*); // blocks end with a pointer
+        assert((block & (block - 1)) == 0);
+        al.deallocate(result.ptr, result.count);
+    }
+
+    size_t smallest_block = 1;
+    while (smallest_block < sizeof(int) + sizeof(void*)) {
+        smallest_block *= 2;
+    }
+
+    vector<int, stdext::pooled_allocator<int>> v(al);
+    v.push_back(1);
+    assert(v.capacity() == (smallest_block - sizeof(void*)) / sizeof(int));
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(i);
+    }
+
+    assert(v.size() == 10001);
+}
+
+int main() {
+    test_std_allocator();
+    test_traits_fallback();
+    test_free_function();
+    test_vector_growth();
+    test_string_growth();
+    test_pooled_allocator();
+}
@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+using namespace std;
+
+const string long_text(200, 'x'); // too long for the small string buffer
+
+void test_view() {
+    ostringstream os;
+    assert(os.view().empty());
+    os << "meow " << 42;
+    assert(os.view() == "meow 42");
+    assert(os.str() == "meow 42");
+
+    os.seekp(0);
+    os << "purr";
+    assert(os.view() == "purr 42"); // up to the high-water mark
+
+    istringstream is("hiss");
+    assert(is.view() == "hiss");
+    char c;
+    is >> c;
+    assert(is.view() == "hiss"); // the whole sequence, not the unread part
+
+    stringbuf buf(ios_base::in); // no character array yet
+    assert(buf.view().empty());
+}
+
+void test_str_rvalue() {
+    ostringstream os;
+    os << long_text;
+    const char* const data = os.view().data();
+
+    string moved = move(os).str();
+    assert(moved == long_text);
+    assert(moved.data() == data); // no copy
+    assert(os.view().empty());
+
+    os << "again";
+    assert(os.view() == "again");
+
+    ostringstream small;
+    small << "abc";
+    assert(move(small).str() == "abc");
+    assert(small.view().empty());
+
+    stringstream ss("text");
+    assert(move(ss).str() == "text");
+    assert(ss.str().empty());
+}
+
+void test_str_from_rvalue() {
+    string storage;
+    storage.reserve(1000);
+    const char* const data = storage.data();
+
+    ostringstream os;
+    os.str(move(storage));
+    os << "abc";
+    assert(os.view() == "abc");
+    assert(os.view().data() == data); // reused the string's capacity
+
+    // round trip: the same allocation serves every message
+    for (int i = 0; i < 10; ++i) {
+        storage = move(os).str();
+        assert(storage.data() == data);
+        storage.clear();
+        os.str(move(storage));
+        os << i;
+        assert(os.view() == to_string(i));
+        assert(os.view().data() == data);
+    }
+
+    ostringstream appending(string{long_text}, ios_base::ate);
+    appending << "y";
+    assert(appending.view() == long_text + "y");
+
+    stringstream ss(string{long_text});
+    string word;
+    ss >> word;
+    assert(word == long_text);
+    ss.clear();
+    ss.seekp(0);
+    ss << "zz";
+    assert(ss.view().substr(0, 3) == "zzx");
+
+    istringstream is(string{long_text});
+    assert(is.view() == long_text);
+    is.str(string{"short"});
+    is >> word;
+    assert(word == "short");
+
+    stringbuf buf(string{long_text}, ios_base::out);
+    assert(buf.sputc('a') == 'a');
+    assert(buf.view().size() == long_text.size() && buf.view().front() == 'a');
+}
+
+void test_wide() {
+    wostringstream os;
+    os << wstring(100, L'w');
+    const wchar_t* const data = os.view().data();
+    const wstring result      = move(os).str();
+    assert(result == wstring(100, L'w'));
+    assert(result.data() == data);
+
+    wistringstream is(wstring{L"1 2"});
+    int a = 0;
+    int b = 0;
+    is >> a >> b;
+    assert(a == 1 && b == 2);
+}
+
+int main() {
+    test_view();
+    test_str_rvalue();
+    test_str_from_rvalue();
+    test_wide();
+}
@@ -0,0 +1,317 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <flat_map>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class FlatMap, class Reference>
+void assert_same(const FlatMap& fm, const Reference& ref) {
+    assert(fm.size() == ref.size());
+    assert(fm.keys().size() == fm.values().size());
+    assert(equal(fm.begin(), fm.end(), ref.begin(), ref.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first && lhs.second == rhs.second; }));
+}
+
+void test_basic() {
+    flat_map<int, string> m;
+    assert(m.empty());
+    assert(m.begin() == m.end());
+    assert(m.find(1) == m.end());
+
+    const auto first = m.emplace(2, "two");
+    assert(first.second);
+    assert(first.first->first == 2 && first.first->second == "two");
+    assert(!m.emplace(2, "deux").second);
+    assert(m.insert({1, "one"}).second);
+    assert(m.try_emplace(3, "three").second);
+    assert(!m.try_emplace(3, "drei").second);
+    m[4] = "four";
+    assert(m.insert_or_assign(4, "vier").first->second == "vier");
+    assert((m.keys() == vector<int>{1, 2, 3, 4}));
+    assert((m.values() == vector<string>{"one", "two", "three", "vier"}));
+
+    assert(m.at(3) == "three");
+    bool threw = false;
+    try {
+        (void) m.at(42);
+    } catch (const out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    auto it = m.find(2);
+    it->second = "zwei";
+    assert(m[2] == "zwei");
+    assert((*it).first == 2);
+    assert(it[1].first == 3);
+    assert(m.end() - m.begin() == 4);
+    assert(m.lower_bound(3)->first == 3);
+    assert(m.upper_bound(3)->first == 4);
+    assert(m.count(3) == 1 && m.contains(3) && !m.contains(5));
+
+    flat_map<int, string>::const_iterator cit = it; // iterator converts to const_iterator
+    assert(cit == m.find(2));
+    assert(prev(m.cend())->first == 4);
+    assert(m.rbegin()->first == 4);
+
+    assert(m.erase(2) == 1);
+    assert(m.erase(2) == 0);
+    const auto next = m.erase(m.begin());
+    assert(next->first == 3);
+    assert(m.size() == 2);
+
+    // hints are used when they fit and ignored otherwise
+    const auto at_end = m.emplace_hint(m.end(), 10, "ten");
+    assert(at_end->first == 10);
+    const auto misplaced = m.emplace_hint(m.begin(), 5, "five");
+    assert(misplaced->first == 5);
+    assert(m.try_emplace(m.begin(), 10, "x")->second == "ten");
+    assert((m.keys() == vector<int>{3, 4, 5, 10}));
+
+    auto copy = m;
+    assert(copy == m);
+    copy[0] = "zero";
+    assert(copy != m);
+    assert(copy < m);
+
+    swap(copy, m);
+    assert(m.begin()->first == 0);
+
+    auto parts = move(m).extract();
+    assert(m.empty());
+    assert(parts.keys.size() == 5 && parts.values.size() == 5);
+    m.replace(move(parts.keys), move(parts.values));
+    assert(m.size() == 5 && m[0] == "zero");
+
+    assert(erase_if(m, [](const auto& elem) { return elem.first % 2 == 0; }) == 3);
+    assert((m.keys() == vector<int>{3, 5}));
+}
+
+void test_construction_and_bulk_insert() {
+    // unsorted construction sorts and keeps the first of each run of equivalent keys
+    flat_map<int, int> m{{3, 30}, {1, 10}, {2, 20}, {1, 11}, {3, 31}};
+    assert((m.keys() == vector<int>{1, 2, 3}));
+    assert((m.values() == vector<int>{10, 20, 30}));
+
+    flat_map<int, int> from_containers(vector<int>{5, 4, 5}, vector<int>{50, 40, 51});
+    assert((from_containers.keys() == vector<int>{4, 5}));
+    assert((from_containers.values() == vector<int>{40, 50}));
+
+    const vector<pair<int, int>> sorted{{0, 0}, {2, 2}, {4, 4}, {6, 6}};
+    flat_map<int, int> presorted(sorted_unique, sorted.begin(), sorted.end());
+    assert((presorted.keys() == vector<int>{0, 2, 4, 6}));
+
+    // a sorted bulk insert is merged in one pass; existing elements win over equivalent new ones
+    const vector<pair<int, int>> more{{1, 1}, {2, 200}, {5, 5}, {8, 8}};
+    presorted.insert(sorted_unique, more.begin(), more.end());
+    assert((presorted.keys() == vector<int>{0, 1, 2, 4, 5, 6, 8}));
+    assert(presorted[2] == 2);
+
+    const vector<pair<int, int>> unsorted_more{{9, 9}, {-1, -1}, {4, 400}, {3, 3}};
+    presorted.insert(unsorted_more.begin(), unsorted_more.end());
+    assert((presorted.keys() == vector<int>{-1, 0, 1, 2, 3, 4, 5, 6, 8, 9}));
+    assert(presorted[4] == 4);
+
+    // appending past the end needs no merge
+    presorted.insert(sorted_unique, {{10, 10}, {11, 11}});
+    assert(presorted.size() == 12 && prev(presorted.end())->first == 11);
+
+    flat_map<int, int, greater<int>> descending{{1, 1}, {3, 3}, {2, 2}};
+    assert((descending.keys() == vector<int>{3, 2, 1}));
+}
+
+void test_multimap() {
+    flat_multimap<int, char> mm{{2, 'a'}, {1, 'b'}, {2, 'c'}};
+    assert(mm.size() == 3);
+    assert(mm.count(2) == 2);
+    mm.emplace(2, 'd');
+    mm.insert(sorted_equivalent, {{0, 'e'}, {2, 'f'}});
+    assert((mm.keys() == vector<int>{0, 1, 2, 2, 2, 2}));
+
+    // equivalent keys keep their insertion order
+    const auto range = mm.equal_range(2);
+    string order;
+    for (auto it = range.first; it != range.second; ++it) {
+        order.push_back(it->second);
+    }
+    assert(order == "acdf");
+
+    assert(mm.erase(2) == 4);
+    assert(mm.size() == 2);
+}
+
+void test_transparent_lookup() {
+    flat_map<string, int, less<>> m{{"alpha", 1}, {"beta", 2}};
+    assert(m.find(string_view{"beta"})->second == 2);
+    assert(m.find("gamma") == m.end());
+    assert(m.contains("alpha"));
+    assert(m.count(string_view{"alpha"}) == 1);
+    assert(m.lower_bound("b")->first == "beta");
+    const auto& cm = m;
+    assert(cm.equal_range("alpha").first == cm.begin());
+}
+
+void test_against_map() {
+    // random operations, including bulk inserts, must agree with map
+    mt19937 gen(1729);
+    uniform_int_distribution<int> key_dist(0, 999);
+    uniform_int_distribution<int> op_dist(0, 4);
+    flat_map<int, int, less<int>, deque<int>> fm;
+    map<int, int> ref;
+    for (int i = 0; i < 5000; ++i) {
+        const int key = key_dist(gen);
+        switch (op_dist(gen)) {
+        case 0:
+            assert(fm.emplace(key, i).second == ref.emplace(key, i).second);
+            break;
+        case 1:
+            fm[key] = i;
+            ref[key] = i;
+            break;
+        case 2:
+            assert(fm.erase(key) == ref.erase(key));
+            break;
+        case 3:
+            {
+                vector<pair<int, int>> batch;
+                for (int j = 0; j < 10; ++j) {
+                    batch.emplace_back(key_dist(gen), i);
+                }
+                fm.insert(batch.begin(), batch.end());
+                ref.insert(batch.begin(), batch.end());
+                break;
+            }
+        default:
+            assert(fm.contains(key) == (ref.count(key) != 0));
+            break;
+        }
+    }
+
+    assert_same(fm, ref);
+}
+
+template <class T>
+struct tagged_allocator {
+    using value_type = T;
+
+    int id = 0;
+
+    tagged_allocator() = default;
+    explicit tagged_allocator(const int i) : id(i) {}
+    template <class U>
+    tagged_allocator(const tagged_allocator<U>& other) : id(other.id) {}
+
+    T* allocate(const size_t n) {
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const tagged_allocator<U>& other) const {
+        return id == other.id;
+    }
+
+    template <class U>
+    bool operator!=(const tagged_allocator<U>& other) const {
+        return id != other.id;
+    }
+};
+
+void test_allocator_extended_construction() {
+    using key_vec    = vector<int, tagged_allocator<int>>;
+    using mapped_vec = vector<char, tagged_allocator<char>>;
+    using map_type   = flat_map<int, char, less<int>, key_vec, mapped_vec>;
+    static_assert(uses_allocator_v<map_type, tagged_allocator<int>>);
+    static_assert(!uses_allocator_v<map_type, allocator<int>>);
+
+    const tagged_allocator<int> al(7);
+    const auto uses_al = [](const map_type& m, const int id) {
+        return m.keys().get_allocator().id == id && m.values().get_allocator().id == id;
+    };
+
+    const map_type empty(al);
+    assert(empty.empty() && uses_al(empty, 7));
+
+    const key_vec keys({3, 1, 2, 1});
+    const mapped_vec values({'c', 'a', 'b', 'x'});
+    const map_type from_containers(keys, values, al);
+    assert((from_containers.keys() == key_vec{1, 2, 3}));
+    assert(from_containers.at(1) == 'a' && uses_al(from_containers, 7));
+
+    const map_type presorted(sorted_unique, key_vec({1, 2}), mapped_vec({'a', 'b'}), less<int>{}, al);
+    assert(presorted.size() == 2 && uses_al(presorted, 7));
+
+    map_type copied(from_containers, tagged_allocator<int>(8));
+    assert(copied == from_containers && uses_al(copied, 8));
+    const map_type moved(move(copied), tagged_allocator<int>(9));
+    assert(moved == from_containers && uses_al(moved, 9));
+
+    const vector<pair<int, char>> pairs{{2, 'b'}, {1, 'a'}, {2, 'z'}};
+    const map_type from_range(pairs.begin(), pairs.end(), al);
+    assert(from_range.size() == 2 && from_range.at(2) == 'b' && uses_al(from_range, 7));
+
+    const map_type from_list({{5, 'e'}, {4, 'd'}}, less<int>{}, al);
+    assert(from_list.begin()->first == 4 && uses_al(from_list, 7));
+
+    const flat_multimap<int, char, less<int>, key_vec, mapped_vec> mm(pairs.begin(), pairs.end(), al);
+    assert(mm.size() == 3 && mm.keys().get_allocator().id == 7);
+}
+
+void test_deduction_guides() {
+    using key_vec    = vector<int, tagged_allocator<int>>;
+    using mapped_vec = vector<char, tagged_allocator<char>>;
+
+    flat_map from_containers(vector<int>{2, 1}, vector<double>{2.0, 1.0});
+    static_assert(is_same_v<decltype(from_containers), flat_map<int, double>>);
+    assert(from_containers.begin()->second == 1.0);
+
+    flat_map with_compare(vector<int>{1, 2}, deque<char>{'a', 'b'}, greater<int>{});
+    static_assert(is_same_v<decltype(with_compare), flat_map<int, char, greater<int>, vector<int>, deque<char>>>);
+    assert(with_compare.begin()->first == 2);
+
+    flat_map with_allocator(key_vec{1}, mapped_vec{'a'}, tagged_allocator<int>(1));
+    static_assert(is_same_v<decltype(with_allocator), flat_map<int, char, less<int>, key_vec, mapped_vec>>);
+
+    flat_map presorted(sorted_unique, key_vec{1}, mapped_vec{'a'}, greater<int>{}, tagged_allocator<int>(1));
+    static_assert(is_same_v<decltype(presorted), flat_map<int, char, greater<int>, key_vec, mapped_vec>>);
+
+    const vector<pair<int, char>> pairs{{1, 'a'}, {2, 'b'}};
+    flat_map from_range(pairs.begin(), pairs.end());
+    static_assert(is_same_v<decltype(from_range), flat_map<int, char>>);
+
+    flat_multimap from_sorted_range(sorted_equivalent, pairs.begin(), pairs.end(), less<>{});
+    static_assert(is_same_v<decltype(from_sorted_range), flat_multimap<int, char, less<>>>);
+
+    flat_map from_list({pair{1, 10L}}, greater<int>{});
+    static_assert(is_same_v<decltype(from_list), flat_map<int, long, greater<int>>>);
+
+    flat_multimap from_sorted_list(sorted_equivalent, {pair{1, 'a'}, pair{1, 'b'}});
+    static_assert(is_same_v<decltype(from_sorted_list), flat_multimap<int, char>>);
+    assert(from_sorted_list.size() == 2);
+}
+
+int main() {
+    test_basic();
+    test_construction_and_bulk_insert();
+    test_multimap();
+    test_transparent_lookup();
+    test_against_map();
+    test_allocator_extended_construction();
+    test_deduction_guides();
+}
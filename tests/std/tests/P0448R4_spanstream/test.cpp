@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <ios>
+#include <span>
+#include <spanstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(is_same_v<spanbuf, basic_spanbuf<char>>);
+STATIC_ASSERT(is_same_v<wspanstream, basic_spanstream<wchar_t>>);
+STATIC_ASSERT(!is_copy_constructible_v<spanstream>);
+STATIC_ASSERT(is_move_constructible_v<ispanstream> && is_move_assignable_v<ospanstream>);
+
+string_view as_view(const span<const char> s) {
+    return string_view{s.data(), s.size()};
+}
+
+void test_ospanstream() {
+    char buffer[16];
+    ospanstream os{span<char>{buffer}};
+    os << "meow " << 42;
+    assert(os);
+    assert(as_view(os.span()) == "meow 42");
+    assert(os.span().data() == buffer);
+
+    os << " and more than fits";
+    assert(os.bad()); // no allocation: output stops at the end of the buffer
+    assert(as_view(os.span()) == "meow 42 and more");
+
+    os.clear();
+    os.span(span<char>{buffer, 4}); // reuse the buffer from the start
+    os << "ab";
+    assert(as_view(os.span()) == "ab");
+    assert(os.seekp(0, ios_base::end) && os.tellp() == 2); // the end of what was written
+    assert(os.seekp(4) && os.tellp() == 4);
+    assert(!os.seekp(5));
+
+    char appended[8] = {'x', 'y'};
+    ospanstream ate_stream{span<char>{appended, 2}, ios_base::ate};
+    assert(as_view(ate_stream.span()) == "xy");
+}
+
+void test_ispanstream() {
+    char packet[] = "12 34 meow";
+    ispanstream is{span<char>{packet, sizeof(packet) - 1}};
+    int a = 0;
+    int b = 0;
+    string word;
+    is >> a >> b >> word;
+    assert(a == 12 && b == 34 && word == "meow");
+    assert(is.eof());
+    assert(is.span().data() == packet && is.span().size() == sizeof(packet) - 1);
+
+    is.clear();
+    assert(is.seekg(-4, ios_base::end));
+    is >> word;
+    assert(word == "meow");
+
+    is.clear();
+    is.seekg(3);
+    is >> b;
+    assert(b == 34);
+    assert(is.seekg(-2, ios_base::cur) && is.tellg() == 3);
+    assert(!is.seekg(-1, ios_base::beg));
+
+#ifdef __cpp_lib_concepts
+    const string_view read_only = "5 6";
+    ispanstream from_view{read_only};
+    from_view >> a >> b;
+    assert(a == 5 && b == 6);
+    assert(from_view.span().data() == read_only.data());
+
+    from_view.clear();
+    from_view.span(string_view{"7"});
+    from_view >> a;
+    assert(a == 7);
+#endif // __cpp_lib_concepts
+}
+
+void test_spanstream() {
+    char buffer[32]{};
+    spanstream ss{span<char>{buffer}};
+    ss << 1729 << ' ' << 2.5;
+    int i    = 0;
+    double d = 0;
+    ss >> i >> d;
+    assert(i == 1729 && d == 2.5);
+    assert(as_view(ss.span()) == "1729 2.5");
+
+    assert(ss.rdbuf()->pubseekoff(0, ios_base::cur) == -1); // ambiguous for both sequences
+    assert(ss.rdbuf()->pubseekoff(0, ios_base::end) == 32); // the whole buffer when readable
+    assert(ss.seekp(0));
+
+    spanstream moved{move(ss)};
+    assert(moved.rdbuf()->span().data() == buffer);
+    moved << "x";
+    assert(buffer[0] == 'x');
+
+    spanbuf buf;
+    assert(buf.span().empty());
+    char storage[4];
+    assert(buf.pubsetbuf(storage, 4) == &buf);
+    assert(buf.sputn("abcde", 5) == 4);
+    assert(as_view(buf.span()) == "abcd");
+}
+
+void test_wide() {
+    wchar_t buffer[8];
+    wospanstream os{span<wchar_t>{buffer}};
+    os << L"w" << 1;
+    assert(wstring_view(os.span().data(), os.span().size()) == L"w1");
+}
+
+int main() {
+    test_ospanstream();
+    test_ispanstream();
+    test_spanstream();
+    test_wide();
+}
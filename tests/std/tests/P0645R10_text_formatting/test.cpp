@@ -0,0 +1,197 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <string>
+#include <string_view>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(output_iterator<format_context::iterator, const char&>);
+STATIC_ASSERT(output_iterator<wformat_context::iterator, const wchar_t&>);
+STATIC_ASSERT(!is_default_constructible_v<formatter<int*>>);
+
+struct point {
+    int x;
+    int y;
+};
+
+// a user-defined formatter with its own presentation types: 'p' (the default) and 'c'
+template <>
+struct std::formatter<point> {
+    constexpr format_parse_context::iterator parse(format_parse_context& ctx) {
+        auto it = ctx.begin();
+        if (it != ctx.end() && (*it == 'p' || *it == 'c')) {
+            compact = *it == 'c';
+            ++it;
+        }
+
+        if (it != ctx.end() && *it != '}') {
+            throw format_error("bad point spec");
+        }
+
+        return it;
+    }
+
+    format_context::iterator format(const point& pt, format_context& ctx) {
+        if (compact) {
+            return format_to(ctx.out(), "{},{}", pt.x, pt.y);
+        }
+
+        return format_to(ctx.out(), "({}, {})", pt.x, pt.y);
+    }
+
+    bool compact = false;
+};
+
+bool throws_format_error(const string_view fmt, const format_args args) {
+    try {
+        (void) vformat(fmt, args);
+    } catch (const format_error&) {
+        return true;
+    }
+
+    return false;
+}
+
+void test_integers() {
+    assert(format("{}", 0) == "0");
+    assert(format("{} {} {}", -42, 42u, 'x') == "-42 42 x");
+    assert(format("{}", (numeric_limits<long long>::min)()) == "-9223372036854775808");
+    assert(format("{}", (numeric_limits<unsigned long long>::max)()) == "18446744073709551615");
+    assert(format("{}", static_cast<signed char>(-5)) == "-5");
+    assert(format("{:5}|{:<5}|{:^5}|{:>5}", 42, 42, 42, 42) == "   42|42   | 42  |   42");
+    assert(format("{:*^7}", 42) == "**42***");
+    assert(format("{:+} {:+} {: } {:-}", 1, -1, 1, 1) == "+1 -1  1 1");
+    assert(format("{:#b} {:#B} {:#o} {:#x} {:#X}", 5, 5, 8, 255, 255) == "0b101 0B101 010 0xff 0XFF");
+    assert(format("{:#o}", 0) == "0");
+    assert(format("{:x}", -255) == "-ff");
+    assert(format("{:08}|{:+08}|{:#010x}", -42, 42, 255) == "-0000042|+0000042|0x000000ff");
+    assert(format("{:<08}", 42) == "42      "); // an explicit alignment disables zero padding
+    assert(format("{:c}", 65) == "A");
+    assert(format("{:d} {:#x}", 'A', 'A') == "65 0x41");
+    assert(format("{} {:s} {:d}", true, false, true) == "true false 1");
+    assert(format("{:6}|{:>6}", true, false) == "true  | false");
+}
+
+void test_floating() {
+    assert(format("{}", 0.0) == "0");
+    assert(format("{}", 1.5) == "1.5");
+    assert(format("{}", 0.1f) == "0.1");
+    assert(format("{}", 1e100) == "1e+100");
+    assert(format("{}", -0.0) == "-0");
+    assert(format("{:.3}", 3.14159) == "3.14");
+    assert(format("{:e} {:E}", 1234.5, 1234.5) == "1.234500e+03 1.234500E+03");
+    assert(format("{:f} {:.2f} {:.0f}", 1.5, 2.345, 2.5) == "1.500000 2.35 2");
+    assert(format("{:g} {:G}", 1e-10, 1e-10) == "1e-10 1E-10");
+    assert(format("{:a} {:.2A}", 1.0, 1.0) == "1p+0 1.00P+0");
+    assert(format("{:#} {:#.0f} {:#.0e}", 1.0, 1.0, 1.0) == "1. 1. 1.e+00");
+    assert(format("{:#g} {:#.3g}", 1.0, 0.00012) == "1.00000 0.000120");
+    assert(format("{:+} {: } {:08.2f} {:+08.2f}", 1.0, 1.0, -3.14159, 3.14159) == "+1  1 -0003.14 +0003.14");
+    assert(format("{:^9.1f}", 2.25) == "   2.2   ");
+
+    constexpr double inf = numeric_limits<double>::infinity();
+    constexpr double nan = numeric_limits<double>::quiet_NaN();
+    assert(format("{} {} {:+} {:F}", inf, -inf, inf, inf) == "inf -inf +inf INF");
+    assert(format("{} {}", nan, -nan) == "nan -nan");
+    assert(format("{:06}", -inf) == "  -inf"); // infinity and NaN are never zero-padded
+
+    // fixed output of large values and large precisions spills out of the stack buffer
+    const string big = format("{:f}", 1e300);
+    assert(big.size() == 308 && big.substr(0, 4) == "1000" && big.substr(301) == ".000000");
+    const string precise = format("{:.500f}", 1.0);
+    assert(precise.size() == 502 && precise.find_first_not_of('0', 2) == string::npos);
+}
+
+void test_strings_and_pointers() {
+    const char* const cstr = "meow";
+    const string str       = "purr";
+    assert(format("{} {} {} {}", cstr, str, string_view{"hiss"}, "mew") == "meow purr hiss mew");
+    assert(format("{:6}|{:>6}|{:^6}", "ab", "ab", "ab") == "ab    |    ab|  ab  ");
+    assert(format("{:.2}|{:5.3}", str, cstr) == "pu|meo  ");
+    assert(format("{:c}|{:3}|{:>3}", 'x', 'y', 'z') == "x|y  |  z");
+
+    assert(format("{}", nullptr) == "0x0");
+    const void* const ptr = reinterpret_cast<const void*>(static_cast<uintptr_t>(0xDEAD));
+    assert(format("{} {:>8}", ptr, ptr) == "0xdead   0xdead");
+}
+
+void test_format_strings() {
+    assert(format("") == "");
+    assert(format("no arguments") == "no arguments");
+    assert(format("{{}} {{{}}}", 1) == "{} {1}");
+    assert(format("{1} {0} {1}", "a", "b") == "b a b");
+    assert(format("{:{}}|{:.{}f}", 7, 3, 1.0, 2) == "  7|1.00");
+    assert(format("{0:{1}.{2}}", 3.14159, 8, 3) == "    3.14");
+    assert(format("{}", point{1, 2}) == "(1, 2)");
+    assert(format("{:c} {:p}", point{3, 4}, point{5, 6}) == "3,4 (5, 6)");
+
+    int i = 0;
+    assert(throws_format_error("{", make_format_args(i)));
+    assert(throws_format_error("}", make_format_args(i)));
+    assert(throws_format_error("{0} {}", make_format_args(i, i)));
+    assert(throws_format_error("{} {0}", make_format_args(i, i)));
+    assert(throws_format_error("{1}", make_format_args(i)));
+    assert(throws_format_error("{} {}", make_format_args(i)));
+    assert(throws_format_error("{:s}", make_format_args(i)));
+    assert(throws_format_error("{:.2}", make_format_args(i)));
+    assert(throws_format_error("{:{}}", make_format_args(i, "x")));
+    assert(throws_format_error("{:{}}", make_format_args(i, -1)));
+    assert(throws_format_error("{:99999999999}", make_format_args(i)));
+    assert(throws_format_error("{:c}", make_format_args(1000)));
+    assert(throws_format_error("{:x}", make_format_args(point{1, 2})));
+    assert(!throws_format_error("{:{}}", make_format_args(i, 5)));
+}
+
+void test_output_functions() {
+    string out;
+    format_to(back_inserter(out), "{}-{}", 1, 2);
+    assert(out == "1-2");
+
+    list<char> chars;
+    format_to(back_inserter(chars), "{:>300}", 'x');
+    assert(chars.size() == 300 && chars.back() == 'x');
+
+    char buffer[8]{};
+    const auto result = format_to_n(buffer, 4, "{}", 123456);
+    assert(result.out == buffer + 4 && result.size == 6);
+    assert(string_view(buffer) == "1234");
+
+    const auto empty = format_to_n(buffer, 0, "{}", 1);
+    assert(empty.out == buffer && empty.size == 1);
+
+    assert(formatted_size("{}", 123456) == 6);
+    assert(formatted_size("{:1000}", "") == 1000);
+
+    const string long_string(1000, 'a');
+    assert(format("{}{}", long_string, long_string) == long_string + long_string);
+
+    assert(vformat("{} {}", make_format_args(1, "two")) == "1 two");
+}
+
+void test_wide() {
+    assert(format(L"{} {} {}", 42, L"meow", 'c') == L"42 meow c");
+    assert(format(L"{:*^9.2f}", 3.14159) == L"**3.14***");
+    assert(format(L"{:#x} {}", 255, true) == L"0xff true");
+    assert(formatted_size(L"{}", 1.5) == 3);
+
+    wstring out;
+    format_to(back_inserter(out), L"{0}{0}", L'w');
+    assert(out == L"ww");
+}
+
+int main() {
+    test_integers();
+    test_floating();
+    test_strings_and_pointers();
+    test_format_strings();
+    test_output_functions();
+    test_wide();
+}
@@ -0,0 +1,272 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono_literals;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+struct counter {
+    int* count;
+
+    void operator()() const noexcept {
+        ++*count;
+    }
+};
+
+STATIC_ASSERT(is_nothrow_default_constructible_v<stop_token>);
+STATIC_ASSERT(is_nothrow_copy_constructible_v<stop_token>);
+STATIC_ASSERT(is_nothrow_move_constructible_v<stop_source>);
+STATIC_ASSERT(!is_copy_constructible_v<stop_callback<counter>>);
+STATIC_ASSERT(!is_move_constructible_v<stop_callback<counter>>);
+STATIC_ASSERT(is_same_v<stop_callback<counter>::callback_type, counter>);
+STATIC_ASSERT(is_nothrow_default_constructible_v<jthread>);
+STATIC_ASSERT(is_nothrow_move_constructible_v<jthread>);
+STATIC_ASSERT(!is_copy_constructible_v<jthread>);
+STATIC_ASSERT(is_same_v<jthread::id, thread::id>);
+
+void test_stop_token_states() {
+    stop_token empty;
+    assert(!empty.stop_possible());
+    assert(!empty.stop_requested());
+
+    stop_source none{nostopstate};
+    assert(!none.stop_possible());
+    assert(!none.request_stop());
+    assert(none.get_token() == empty);
+
+    stop_token token;
+    {
+        stop_source source;
+        assert(source.stop_possible());
+        token = source.get_token();
+        assert(token.stop_possible());
+        assert(!token.stop_requested());
+        assert(source.get_token() == token);
+
+        stop_source copy = source;
+        assert(copy == source);
+        assert(copy.request_stop());
+        assert(!source.request_stop());
+        assert(source.stop_requested());
+        assert(token.stop_requested());
+    }
+
+    assert(token.stop_possible()); // stop was requested, so it stays possible
+    assert(token.stop_requested());
+
+    stop_token orphan;
+    {
+        stop_source source;
+        orphan = source.get_token();
+    }
+
+    assert(!orphan.stop_possible());
+
+    stop_source a;
+    stop_source b;
+    stop_source a_copy = a;
+    swap(a_copy, b);
+    assert(b == a);
+    assert(a_copy != a);
+}
+
+void test_stop_callback() {
+    int count = 0;
+    stop_source source;
+    {
+        stop_callback<counter> registered{source.get_token(), counter{&count}};
+        stop_callback<counter> also_registered{source.get_token(), counter{&count}};
+        {
+            stop_callback<counter> destroyed_first{source.get_token(), counter{&count}};
+        }
+
+        assert(count == 0);
+        assert(source.request_stop());
+        assert(count == 2);
+        assert(!source.request_stop());
+        assert(count == 2);
+
+        stop_callback late{source.get_token(), counter{&count}}; // invoked immediately
+        assert(count == 3);
+    }
+
+    stop_callback<counter> no_state{stop_token{}, counter{&count}};
+    stop_token token = stop_source{}.get_token();
+    stop_callback<counter> stop_impossible{move(token), counter{&count}};
+    assert(count == 3);
+}
+
+struct delete_self {
+    stop_callback<delete_self>** self;
+
+    void operator()() const noexcept {
+        const auto local = self; // *this is destroyed along with the stop_callback
+        delete *local;
+        *local = nullptr;
+    }
+};
+
+void test_deregistration_from_callback() {
+    // a callback may destroy its own stop_callback, or another one, while it runs; neither waits for the other
+    stop_source source;
+    stop_callback<delete_self>* self = new stop_callback<delete_self>(source.get_token(), delete_self{&self});
+
+    int count    = 0;
+    auto* victim = new stop_callback<counter>(source.get_token(), counter{&count});
+    stop_callback reaper{source.get_token(), [&victim]() noexcept {
+                             delete victim; // not yet invoked, since reaper was registered later
+                             victim = nullptr;
+                         }};
+
+    assert(source.request_stop());
+    assert(self == nullptr);
+    assert(victim == nullptr);
+    assert(count == 0);
+}
+
+void test_concurrent_registration() {
+    // threads register and deregister callbacks while another thread requests stop; a callback that runs does so
+    // before its stop_callback's destructor returns
+    constexpr int thread_count = 8;
+    constexpr int iterations   = 1000;
+    for (int round = 0; round < 10; ++round) {
+        stop_source source;
+        atomic<int> invoked{0};
+        vector<jthread> threads;
+        for (int i = 0; i < thread_count; ++i) {
+            threads.emplace_back([&] {
+                for (int j = 0; j < iterations; ++j) {
+                    bool ran = false;
+                    {
+                        stop_callback cb{source.get_token(), [&ran]() noexcept { ran = true; }};
+                    }
+
+                    if (ran) {
+                        invoked.fetch_add(1, memory_order_relaxed);
+                    }
+                }
+            });
+        }
+
+        source.request_stop();
+        threads.clear();
+        assert(invoked.load() <= thread_count * iterations);
+    }
+}
+
+void test_jthread() {
+    atomic<bool> stopped{false};
+    {
+        jthread worker([&](stop_token token) {
+            while (!token.stop_requested()) {
+                this_thread::yield();
+            }
+
+            stopped = true;
+        });
+
+        assert(worker.joinable());
+        assert(worker.get_stop_source().stop_possible());
+        assert(worker.get_stop_token().stop_possible());
+    } // requests stop and joins
+
+    assert(stopped.load());
+
+    int value = 0;
+    jthread plain([](int& v, int addend) { v += addend; }, ref(value), 42);
+    plain.join();
+    assert(value == 42);
+    assert(!plain.joinable());
+    assert(plain.get_stop_token().stop_possible());
+
+    jthread empty;
+    assert(!empty.joinable());
+    assert(!empty.get_stop_token().stop_possible());
+    assert(!empty.request_stop());
+
+    jthread first([](stop_token token) {
+        while (!token.stop_requested()) {
+            this_thread::yield();
+        }
+    });
+    jthread second = move(first);
+    assert(!first.joinable());
+    assert(second.joinable());
+    first = move(second); // second is now empty
+    swap(first, second);
+    assert(second.request_stop());
+    second.join();
+
+    assert(jthread::hardware_concurrency() == thread::hardware_concurrency());
+}
+
+void test_condition_variable_any() {
+    // a stop request wakes a waiter immediately, not after a timeout
+    mutex m;
+    condition_variable_any cv;
+    bool ready = false;
+
+    {
+        jthread waiter([&](stop_token token) {
+            unique_lock<mutex> lock(m);
+            assert(!cv.wait(lock, token, [&] { return ready; }));
+            assert(token.stop_requested());
+        });
+
+        this_thread::sleep_for(20ms);
+    }
+
+    {
+        jthread waiter([&](stop_token token) {
+            unique_lock<mutex> lock(m);
+            const auto start = chrono::steady_clock::now();
+            assert(!cv.wait_for(lock, token, 1h, [&] { return ready; }));
+            assert(chrono::steady_clock::now() - start < 30min);
+        });
+
+        this_thread::sleep_for(20ms);
+    }
+
+    {
+        jthread waiter([&](stop_token token) {
+            unique_lock<mutex> lock(m);
+            assert(cv.wait_until(lock, token, chrono::steady_clock::now() + 1h, [&] { return ready; }));
+        });
+
+        {
+            lock_guard<mutex> lock(m);
+            ready = true;
+        }
+
+        cv.notify_all();
+        waiter.join();
+    }
+
+    stop_source source;
+    unique_lock<mutex> lock(m);
+    assert(!cv.wait_for(lock, source.get_token(), 10ms, [] { return false; }));
+    source.request_stop();
+    assert(!cv.wait(lock, source.get_token(), [] { return false; }));
+    assert(cv.wait(lock, source.get_token(), [] { return true; }));
+}
+
+int main() {
+    test_stop_token_states();
+    test_stop_callback();
+    test_deregistration_from_callback();
+    test_concurrent_registration();
+    test_jthread();
+    test_condition_variable_any();
+}
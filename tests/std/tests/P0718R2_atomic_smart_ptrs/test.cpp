@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <memory>
 #include <thread>
+#include <vector>
 #ifdef _DEBUG
 #include <crtdbg.h>
 #endif // _DEBUG
@@ -183,6 +184,34 @@ void test_weak_ptr_compare_exchange_strong() {
     }
 }
 
+void test_shared_ptr_loads_with_one_writer() {
+    // loads don't exclude each other; each one must still see a value the writer stored, in order
+    atomic<shared_ptr<int>> latest{make_shared<int>(0)};
+    atomic<bool> done{false};
+    vector<thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&] {
+            int last = 0;
+            while (!done.load()) {
+                const shared_ptr<int> current = latest.load();
+                assert(*current >= last);
+                last = *current;
+            }
+        });
+    }
+
+    for (int i = 1; i <= 10000; ++i) {
+        latest.store(make_shared<int>(i));
+    }
+
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    assert(*latest.load() == 10000);
+}
+
 void run_test(void (*fp)()) {
     thread thr0(fp);
     thread thr1(fp);
@@ -237,6 +266,7 @@ int main() {
     run_test(test_weak_ptr_exchange);
     run_test(test_weak_ptr_compare_exchange_weak);
     run_test(test_weak_ptr_compare_exchange_strong);
+    test_shared_ptr_loads_with_one_writer();
     ensure_nonmember_calls_compile<atomic<shared_ptr<int>>>();
     ensure_nonmember_calls_compile<atomic<weak_ptr<int>>>();
 
@@ -0,0 +1,214 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Covers the execution policy overloads of the ranges algorithms, which are an extension
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <execution>
+#include <functional>
+#include <list>
+#include <map>
+#include <numeric>
+#include <random>
+#include <ranges>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "range_algorithm_support.hpp"
+
+#define ASSERT(...) assert((__VA_ARGS__))
+
+using std::execution::par, std::list, std::string, std::vector;
+
+struct record {
+    int key;
+    string name;
+};
+
+constexpr bool is_even(const int i) {
+    return i % 2 == 0;
+}
+
+void test_sort() {
+    std::mt19937 gen(1729);
+    vector<int> v(10'000);
+    std::iota(v.begin(), v.end(), 0);
+    std::shuffle(v.begin(), v.end(), gen);
+
+    ASSERT(ranges::sort(par, v) == v.end());
+    ASSERT(std::is_sorted(v.begin(), v.end()));
+    ranges::sort(par, v.begin(), v.end(), std::greater{});
+    ASSERT(v.front() == 9'999);
+    ranges::sort(par, v, {}, [](int i) { return i % 100; });
+    ASSERT(std::is_sorted(v.begin(), v.end(), [](int l, int r) { return l % 100 < r % 100; }));
+
+    // the serial ranges::sort
+    std::shuffle(v.begin(), v.end(), gen);
+    ASSERT(ranges::sort(v) == v.end());
+    ASSERT(std::is_sorted(v.begin(), v.end()));
+    for (auto& i : v) {
+        i = static_cast<int>(gen() % 16);
+    }
+    ranges::sort(v.begin(), v.end(), std::greater{}, [](int i) { return i / 2; });
+    ASSERT(std::is_sorted(v.begin(), v.end(), [](int l, int r) { return l / 2 > r / 2; }));
+
+    vector<record> records{{3, "c"}, {1, "a"}, {2, "b"}};
+    ranges::sort(par, records, {}, &record::key);
+    ASSERT(records[0].name == "a" && records[1].name == "b" && records[2].name == "c");
+
+    vector<int> nth(1'000);
+    std::iota(nth.begin(), nth.end(), 0);
+    std::shuffle(nth.begin(), nth.end(), gen);
+    ASSERT(ranges::nth_element(par, nth, nth.begin() + 500) == nth.end());
+    ASSERT(nth[500] == 500);
+}
+
+void test_non_modifying() {
+    vector<record> records{{1, "a"}, {2, "b"}, {3, "c"}};
+    list<int> l{1, 2, 3, 4, 5, 6};
+
+    ASSERT(ranges::find(par, records, 2, &record::key)->name == "b");
+    ASSERT(ranges::find(par, records, 7, &record::key) == records.end());
+    ASSERT(*ranges::find(par, l, 4) == 4);
+    ASSERT(*ranges::find_if(par, l, [](int i) { return i > 4; }) == 5);
+    ASSERT(*ranges::find_if_not(par, l.begin(), l.end(), [](int i) { return i < 3; }) == 3);
+    ASSERT(ranges::adjacent_find(par, l) == l.end());
+    ASSERT(ranges::adjacent_find(par, l, {}, [](int i) { return i / 2; }) == std::next(l.begin()));
+
+    ASSERT(ranges::count(par, records, 2, &record::key) == 1);
+    ASSERT(ranges::count(par, l, 3) == 1);
+    ASSERT(ranges::count_if(par, l, is_even) == 3);
+
+    ASSERT(ranges::all_of(par, records, [](int i) { return i > 0; }, &record::key));
+    ASSERT(ranges::any_of(par, l, [](int i) { return i == 6; }));
+    ASSERT(ranges::none_of(par, l, [](int i) { return i > 6; }));
+    ASSERT(ranges::is_partitioned(par, l, [](int i) { return i < 3; }));
+
+    ASSERT(ranges::is_sorted(par, records, {}, &record::key));
+    ASSERT(ranges::is_sorted_until(par, records, std::greater{}, &record::key) == records.begin() + 1);
+    ASSERT(ranges::max_element(par, records, {}, &record::key)->name == "c");
+    ASSERT(ranges::min_element(par, records, {}, &record::key)->name == "a");
+
+    vector<int> heap{9, 5, 7, 1};
+    ASSERT(ranges::is_heap(par, heap));
+    ASSERT(ranges::is_heap_until(par, heap, {}, [](int i) { return -i; }) == heap.begin() + 1);
+}
+
+void test_modifying() {
+    vector<record> records{{1, "a"}, {2, "b"}, {3, "c"}};
+
+    ASSERT(ranges::for_each(par, records, [](string& s) { s += '!'; }, &record::name) == records.end());
+    ASSERT(records[2].name == "c!");
+    ASSERT(ranges::for_each_n(par, records.begin(), 2, [](int& i) { i *= 2; }, &record::key) == records.begin() + 2);
+    ASSERT(records[1].key == 4 && records[2].key == 3);
+
+    vector<int> out(3);
+    const auto transformed = ranges::transform(par, records, out.begin(), [](int i) { return i * 10; }, &record::key);
+    ASSERT(transformed.in == records.end() && transformed.out == out.end());
+    ASSERT((out == vector<int>{20, 40, 30}));
+
+    ASSERT(ranges::replace(par, records, 4, record{5, "e"}, &record::key) == records.end());
+    ASSERT(records[1].name == "e");
+    ranges::replace(par, out, 20, 21);
+    ranges::replace_if(par, out, [](int i) { return i > 30; }, 0);
+    ASSERT((out == vector<int>{21, 0, 30}));
+    ASSERT(ranges::fill(par, out, 5) == out.end());
+    ASSERT((out == vector<int>{5, 5, 5}));
+
+    vector<int> v{1, 2, 2, 3, 2, 4};
+    const auto removed = ranges::remove(par, v, 2);
+    ASSERT(removed.begin() == v.begin() + 3 && removed.end() == v.end());
+    ASSERT(v[0] == 1 && v[1] == 3 && v[2] == 4);
+
+    vector<record> keyed{{1, "a"}, {2, "b"}, {1, "c"}};
+    ASSERT(ranges::remove(par, keyed, 1, &record::key).begin() == keyed.begin() + 1);
+    ASSERT(keyed[0].name == "b");
+
+    v = {1, 1, 2, 2, 3};
+    ASSERT(ranges::unique(par, v).begin() == v.begin() + 3);
+    v = {1, 2, 3, 4, 5, 6};
+    ASSERT(ranges::partition(par, v, is_even).begin() == v.begin() + 3);
+    ASSERT(ranges::remove_if(par, v, [](int i) { return i > 3; }).end() == v.end());
+}
+
+// for_each over the ordered and unordered containers divides them by their trees and buckets
+template <class Container>
+void test_container_for_each(Container&& c, const long long expected_sum) {
+    std::atomic<long long> sum{0};
+    std::atomic<int> visits{0};
+    ASSERT(ranges::for_each(par, c, [&](int i) {
+        sum += i;
+        ++visits;
+    }) == ranges::end(c));
+    ASSERT(sum == expected_sum);
+    ASSERT(visits == static_cast<int>(c.size()));
+}
+
+void test_containers() {
+    for (const int size : {0, 1, 2, 100, 10'000}) {
+        const long long expected_sum = static_cast<long long>(size) * (size - 1) / 2;
+        std::set<int> s;
+        std::multiset<int> ms;
+        std::unordered_set<int> us;
+        std::unordered_multiset<int> ums;
+        std::map<int, string> m;
+        std::unordered_map<int, string> um;
+        for (int i = 0; i < size; ++i) {
+            s.insert(i);
+            ms.insert(i);
+            us.insert(i);
+            ums.insert(i);
+            m.emplace(i, "");
+            um.emplace(i, "");
+        }
+
+        test_container_for_each(s, expected_sum);
+        test_container_for_each(std::as_const(s), expected_sum);
+        test_container_for_each(ms, expected_sum);
+        test_container_for_each(us, expected_sum);
+        test_container_for_each(std::as_const(ums), expected_sum);
+
+        // the elements are mutable through non-const maps
+        ranges::for_each(par, m, [](string& str) { str = "m"; }, &std::pair<const int, string>::second);
+        ranges::for_each(par, um, [](std::pair<const int, string>& p) { p.second = std::to_string(p.first); });
+        ASSERT(ranges::all_of(
+            par, m, [](const string& str) { return str == "m"; }, &std::pair<const int, string>::second));
+        for (const auto& [key, value] : um) {
+            ASSERT(value == std::to_string(key));
+        }
+
+        // an rvalue container is visited too, though its iterators dangle
+        STATIC_ASSERT(std::is_same_v<decltype(ranges::for_each(par, std::set<int>{}, [](int) {})), ranges::dangling>);
+        std::atomic<int> visits{0};
+        (void) ranges::for_each(par, std::move(us), [&](int) { ++visits; });
+        ASSERT(visits == size);
+    }
+
+    // a multiset with many equal keys
+    std::multiset<int> equal_keys;
+    for (int i = 0; i < 5'000; ++i) {
+        equal_keys.insert(i % 3);
+    }
+
+    test_container_for_each(equal_keys, 4'999);
+}
+
+// The parallel algorithms require iterators that are forward iterators in the C++17 sense too
+using par_t = const std::execution::parallel_policy&;
+STATIC_ASSERT(!std::is_invocable_v<decltype(ranges::sort), par_t, ranges::iota_view<int, int>>);
+STATIC_ASSERT(!std::is_invocable_v<decltype(ranges::find), par_t, list<int>::iterator, std::default_sentinel_t, int>);
+STATIC_ASSERT(std::is_invocable_v<decltype(ranges::find), par_t, list<int>&, int>);
+
+int main() {
+    test_sort();
+    test_non_modifying();
+    test_modifying();
+    test_containers();
+}
@@ -0,0 +1,235 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Covers counted_iterator and the range adaptors of <ranges>
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <map>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "range_algorithm_support.hpp"
+
+#define ASSERT(...) assert((__VA_ARGS__))
+
+namespace views = std::views;
+
+using std::pair, std::string, std::string_view, std::vector;
+
+template <class Rng, class Expected>
+constexpr bool equal_to_list(Rng&& r, const Expected& expected) {
+    auto first      = ranges::begin(expected);
+    const auto last = ranges::end(expected);
+    for (auto&& x : r) {
+        if (first == last || !(x == *first)) {
+            return false;
+        }
+        ++first;
+    }
+    return first == last;
+}
+
+constexpr bool is_even(const int i) {
+    return i % 2 == 0;
+}
+
+constexpr int square(const int i) {
+    return i * i;
+}
+
+constexpr bool test_counted_iterator() {
+    int arr[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    std::counted_iterator it{arr + 1, 4};
+    ASSERT(it.count() == 4);
+    ASSERT(*it == 1);
+    ASSERT(it[2] == 3);
+    ++it;
+    ASSERT(it.base() == arr + 2);
+    ASSERT(it.count() == 3);
+    auto last = it + 3;
+    ASSERT(last == std::default_sentinel);
+    ASSERT(last - it == 3);
+    ASSERT(std::default_sentinel - it == 3);
+    ASSERT(it < last);
+    --last;
+    ASSERT(*last == 4);
+    STATIC_ASSERT(std::contiguous_iterator<std::counted_iterator<int*>>);
+    STATIC_ASSERT(std::same_as<std::iter_difference_t<std::counted_iterator<int*>>, std::ptrdiff_t>);
+    return true;
+}
+
+constexpr bool test_iota_single() {
+    ASSERT(equal_to_list(views::iota(2, 6), std::array{2, 3, 4, 5}));
+    ASSERT(views::iota(-3, 3).size() == 6);
+    ASSERT(*ranges::next(views::iota(10).begin(), 5) == 15);
+    ASSERT(views::iota(0, 10).end() - views::iota(0, 10).begin() == 10);
+    STATIC_ASSERT(ranges::random_access_range<ranges::iota_view<int, int>>);
+    STATIC_ASSERT(ranges::borrowed_range<ranges::iota_view<int, int>>);
+
+    ranges::single_view sv{42};
+    ASSERT(sv.size() == 1);
+    ASSERT(*sv.begin() == 42);
+    ASSERT(*views::single(7).data() == 7);
+    STATIC_ASSERT(ranges::contiguous_range<ranges::single_view<int>>);
+    return true;
+}
+
+constexpr bool test_filter_transform() {
+    int arr[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    auto evens = arr | views::filter(is_even);
+    ASSERT(equal_to_list(evens, std::array{2, 4, 6, 8}));
+    ASSERT(*evens.begin() == 2);
+    ASSERT(*ranges::prev(evens.end()) == 8);
+    STATIC_ASSERT(ranges::bidirectional_range<decltype(evens)>);
+    STATIC_ASSERT(!ranges::random_access_range<decltype(evens)>);
+
+    auto squares = arr | views::transform(square);
+    ASSERT(equal_to_list(squares, std::array{1, 4, 9, 16, 25, 36, 49, 64}));
+    ASSERT(squares[3] == 16);
+    ASSERT(squares.size() == 8);
+    STATIC_ASSERT(ranges::random_access_range<decltype(squares)>);
+    STATIC_ASSERT(ranges::sized_range<decltype(squares)>);
+    STATIC_ASSERT(!ranges::contiguous_range<decltype(squares)>);
+
+    // closures compose into pipelines before a range is supplied
+    auto even_squares = views::filter(is_even) | views::transform(square);
+    ASSERT(equal_to_list(arr | even_squares, std::array{4, 16, 36, 64}));
+    return true;
+}
+
+constexpr bool test_take_drop() {
+    int arr[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    auto first_three = arr | views::take(3);
+    ASSERT(equal_to_list(first_three, std::array{0, 1, 2}));
+    ASSERT(first_three.size() == 3);
+    ASSERT((arr | views::take(20)).size() == 10);
+    ASSERT(equal_to_list(arr | views::drop(7), std::array{7, 8, 9}));
+    ASSERT((arr | views::drop(20)).size() == 0);
+    ASSERT(equal_to_list(views::iota(0) | views::take(4), std::array{0, 1, 2, 3}));
+    ASSERT(equal_to_list(arr | views::drop(2) | views::take(3), std::array{2, 3, 4}));
+
+    // sized random-access views keep their own iterators, so contiguous algorithm paths still apply
+    STATIC_ASSERT(std::same_as<ranges::iterator_t<decltype(first_three)>, int*>);
+    STATIC_ASSERT(std::same_as<ranges::iterator_t<decltype(arr | views::drop(2))>, int*>);
+    STATIC_ASSERT(ranges::contiguous_range<decltype(first_three)>);
+    return true;
+}
+
+constexpr bool test_join_split() {
+    std::array<std::array<int, 2>, 3> nested{{{0, 1}, {2, 3}, {4, 5}}};
+    auto flat = nested | views::join;
+    ASSERT(equal_to_list(flat, std::array{0, 1, 2, 3, 4, 5}));
+    ASSERT(*ranges::prev(flat.end()) == 5);
+    STATIC_ASSERT(ranges::bidirectional_range<decltype(flat)>);
+
+    // inner ranges that are prvalue views are held by the join_view
+    ASSERT(equal_to_list(views::iota(1, 4) | views::transform([](int i) { return views::iota(0, i); }) | views::join,
+        std::array{0, 0, 1, 0, 1, 2}));
+
+    constexpr string_view text = "ab,c,,d";
+    std::array<string_view, 4> expected{"ab", "c", "", "d"};
+    auto first = expected.begin();
+    for (auto&& segment : text | views::split(',')) {
+        string_view::size_type n = 0;
+        for (auto it = segment.begin(); it != segment.end(); ++it) {
+            ++n;
+        }
+        ASSERT(n == first->size());
+        ++first;
+    }
+    ASSERT(first == expected.end());
+    return true;
+}
+
+constexpr bool test_reverse_elements() {
+    int arr[] = {1, 2, 3, 4};
+    auto rev  = arr | views::reverse;
+    ASSERT(equal_to_list(rev, std::array{4, 3, 2, 1}));
+    ASSERT(rev.size() == 4);
+    STATIC_ASSERT(std::same_as<decltype(rev | views::reverse), ranges::ref_view<int[4]>>);
+    STATIC_ASSERT(ranges::random_access_range<decltype(rev)>);
+
+    std::array<pair<int, char>, 3> pairs{{{1, 'a'}, {2, 'b'}, {3, 'c'}}};
+    ASSERT(equal_to_list(pairs | views::keys, std::array{1, 2, 3}));
+    ASSERT(equal_to_list(pairs | views::values, std::array{'a', 'b', 'c'}));
+    ASSERT(equal_to_list(pairs | views::elements<0> | views::reverse, std::array{3, 2, 1}));
+    (pairs | views::values)[1] = 'z';
+    ASSERT(pairs[1].second == 'z');
+    return true;
+}
+
+void test_non_constexpr() {
+    // filter_view and drop_view cache begin() on forward ranges, so a predicate only runs on the first call
+    std::forward_list<int> fl{1, 3, 5, 6, 7};
+    int calls    = 0;
+    auto counted = fl | views::filter([&calls](int i) {
+        ++calls;
+        return i % 2 == 0;
+    });
+    ASSERT(*counted.begin() == 6);
+    ASSERT(calls == 4);
+    ASSERT(*counted.begin() == 6);
+    ASSERT(calls == 4);
+
+    std::list<int> l{0, 1, 2, 3, 4};
+    auto dropped = l | views::drop(3);
+    ASSERT(equal_to_list(dropped, std::array{3, 4}));
+    ASSERT(dropped.begin() == ranges::next(l.begin(), 3));
+
+    // a trailing delimiter produces a trailing empty segment
+    string text = "a b ";
+    vector<string> words;
+    for (auto&& word : text | views::split(' ')) {
+        string w;
+        for (char c : word) {
+            w.push_back(c);
+        }
+        words.push_back(w);
+    }
+    ASSERT((words == vector<string>{"a", "b", ""}));
+
+    words.clear();
+    for (auto&& word : string_view{"one--two--three"} | views::split(string_view{"--"})) {
+        string w;
+        for (char c : word) {
+            w.push_back(c);
+        }
+        words.push_back(w);
+    }
+    ASSERT((words == vector<string>{"one", "two", "three"}));
+
+    std::map<string, int> m{{"x", 1}, {"y", 2}};
+    ASSERT(equal_to_list(m | views::values, std::array{1, 2}));
+
+    vector<vector<int>> vv{{}, {1}, {}, {2, 3}, {}};
+    ASSERT(equal_to_list(vv | views::join, std::array{1, 2, 3}));
+    ASSERT(equal_to_list(vv | views::join | views::reverse, std::array{3, 2, 1}));
+
+    STATIC_ASSERT(!std::is_constructible_v<ranges::ref_view<vector<int>>, vector<int>>);
+}
+
+int main() {
+    STATIC_ASSERT(test_counted_iterator());
+    test_counted_iterator();
+    STATIC_ASSERT(test_iota_single());
+    test_iota_single();
+    STATIC_ASSERT(test_filter_transform());
+    test_filter_transform();
+    STATIC_ASSERT(test_take_drop());
+    test_take_drop();
+    STATIC_ASSERT(test_join_split());
+    test_join_split();
+    STATIC_ASSERT(test_reverse_elements());
+    test_reverse_elements();
+    test_non_constexpr();
+}
@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#if defined(__cpp_lib_constexpr_vector) && defined(__cpp_lib_constexpr_string)
+constexpr bool test_vector() {
+    vector<int> vec;
+    for (int i = 0; i < 20; ++i) {
+        vec.push_back(i); // reallocates several times
+    }
+
+    assert(vec.size() == 20 && vec.front() == 0 && vec.back() == 19);
+
+    vec.insert(vec.begin() + 1, 3, -1);
+    assert(vec.size() == 23 && vec[0] == 0 && vec[1] == -1 && vec[3] == -1 && vec[4] == 1);
+
+    vec.erase(vec.begin(), vec.begin() + 4);
+    assert(vec.size() == 19 && vec[0] == 1);
+
+    const auto removed = erase_if(vec, [](const int x) { return x % 2 == 0; });
+    assert(removed == 9 && vec.size() == 10 && vec[9] == 19);
+
+    vector<int> other = vec;
+    other.emplace(other.begin(), 100);
+    assert(other.size() == 11 && other[0] == 100 && other[1] == 1);
+    assert(other != vec && vec < other);
+
+    other.swap(vec);
+    assert(vec.size() == 11 && other.size() == 10);
+
+    vec.resize(3);
+    vec.shrink_to_fit();
+    assert(vec.size() == 3 && vec.capacity() == 3);
+
+    vector<bool> bits(70);
+    bits[65] = true;
+    bits.flip();
+    assert(!bits[65] && bits[64] && bits.size() == 70);
+
+    vector<vector<int>> nested(2, vector<int>{1, 2, 3});
+    nested.emplace_back(5, 7);
+    assert(nested.size() == 3 && nested[2].size() == 5 && nested[2][4] == 7);
+
+    return true;
+}
+
+constexpr bool test_string() {
+    string str = "hello";
+    assert(str.size() == 5 && str == "hello");
+
+    str += ", world, this string no longer fits in the small buffer";
+    assert(str.size() == 60 && str.starts_with("hello, world") && str.ends_with("buffer"));
+    assert(str.find("world") == 7 && str.rfind('s') == 48);
+
+    str.replace(0, 5, "goodbye");
+    assert(str.compare(0, 13, "goodbye, worl") == 0);
+
+    str.erase(7);
+    str.shrink_to_fit(); // returns to the small buffer
+    assert(str == "goodbye" && str.capacity() < 16);
+
+    string other = str + " and " + "hello";
+    assert(other == "goodbye and hello");
+
+    other.swap(str);
+    assert(str == "goodbye and hello" && other == "goodbye");
+
+    string moved = move(str);
+    assert(moved.size() == 17 && str.empty());
+
+    str = other;
+    str.insert(0, 3, '>');
+    assert(str == ">>>goodbye" && str < other);
+
+    wstring wide(40, L'w');
+    wide.resize(2);
+    assert(wide == L"ww");
+
+    return true;
+}
+
+// a CRC-32 lookup table built at compile time, with vector as scratch space
+constexpr unsigned int crc32_of(const string& input) {
+    vector<unsigned int> table;
+    table.reserve(256);
+    for (unsigned int n = 0; n < 256; ++n) {
+        unsigned int c = n;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? 0xEDB88320U ^ (c >> 1) : c >> 1;
+        }
+
+        table.push_back(c);
+    }
+
+    unsigned int crc = 0xFFFFFFFFU;
+    for (const char ch : input) {
+        crc = table[(crc ^ static_cast<unsigned char>(ch)) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc ^ 0xFFFFFFFFU;
+}
+
+static_assert(test_vector());
+static_assert(test_string());
+static_assert(crc32_of(string{"123456789"}) == 0xCBF43926U);
+#endif // defined(__cpp_lib_constexpr_vector) && defined(__cpp_lib_constexpr_string)
+
+int main() {
+#if defined(__cpp_lib_constexpr_vector) && defined(__cpp_lib_constexpr_string)
+    test_vector();
+    test_string();
+    assert(crc32_of(string{"123456789"}) == 0xCBF43926U);
+#endif // defined(__cpp_lib_constexpr_vector) && defined(__cpp_lib_constexpr_string)
+}
@@ -0,0 +1,184 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+int constructCount = 0;
+int destroyCount   = 0;
+int canCreate      = 1000; // counter to force an exception when default constructing
+
+struct DefaultInitialized {
+    int value;
+
+    DefaultInitialized() : value(1729) {
+        if (canCreate == 0) {
+            throw runtime_error("Can't create more DefaultInitialized objects.");
+        }
+
+        --canCreate;
+        ++constructCount;
+    }
+
+    DefaultInitialized(const DefaultInitialized&) = delete;
+    DefaultInitialized& operator=(const DefaultInitialized&) = delete;
+
+    ~DefaultInitialized() {
+        ++destroyCount;
+    }
+};
+
+struct alignas(32) HighlyAligned {
+    uint64_t a;
+    uint64_t b;
+    uint64_t c;
+    uint64_t d;
+};
+
+void reset_counts(const int create = 1000) {
+    constructCount = 0;
+    destroyCount   = 0;
+    canCreate      = create;
+}
+
+void assert_construct_destruct_equal() {
+    assert(constructCount == destroyCount);
+}
+
+template <class T>
+struct DestroyCountingAllocator {
+    using value_type = T;
+
+    DestroyCountingAllocator() = default;
+    template <class U>
+    DestroyCountingAllocator(const DestroyCountingAllocator<U>&) {}
+
+    T* allocate(const size_t n) {
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U, class... Args>
+    void construct(U*, Args&&...) {
+        assert(false); // the _for_overwrite functions must not construct through the allocator
+    }
+
+    template <class U>
+    void destroy(U* const p) {
+        p->~U();
+    }
+
+    template <class U>
+    bool operator==(const DestroyCountingAllocator<U>&) const {
+        return true;
+    }
+};
+
+void test_make_unique_for_overwrite() {
+    STATIC_ASSERT(is_same_v<decltype(make_unique_for_overwrite<int>()), unique_ptr<int>>);
+    STATIC_ASSERT(is_same_v<decltype(make_unique_for_overwrite<int[]>(3u)), unique_ptr<int[]>>);
+
+    reset_counts();
+    {
+        auto p0 = make_unique_for_overwrite<DefaultInitialized>();
+        assert(p0->value == 1729);
+
+        auto p1 = make_unique_for_overwrite<DefaultInitialized[]>(5u);
+        for (int i = 0; i < 5; ++i) {
+            assert(p1[i].value == 1729);
+        }
+
+        auto p2 = make_unique_for_overwrite<HighlyAligned>();
+        assert(reinterpret_cast<uintptr_t>(p2.get()) % alignof(HighlyAligned) == 0);
+        p2->a = 42;
+        assert(p2->a == 42);
+    }
+    assert(constructCount == 6);
+    assert_construct_destruct_equal();
+}
+
+void test_make_shared_for_overwrite() {
+    STATIC_ASSERT(is_same_v<decltype(make_shared_for_overwrite<int>()), shared_ptr<int>>);
+    STATIC_ASSERT(is_same_v<decltype(make_shared_for_overwrite<int[4]>()), shared_ptr<int[4]>>);
+    STATIC_ASSERT(is_same_v<decltype(make_shared_for_overwrite<int[]>(3u)), shared_ptr<int[]>>);
+
+    reset_counts();
+    {
+        shared_ptr<DefaultInitialized> p0 = make_shared_for_overwrite<DefaultInitialized>();
+        assert(p0.use_count() == 1);
+        assert(p0->value == 1729);
+
+        shared_ptr<DefaultInitialized[2][3]> p1 = make_shared_for_overwrite<DefaultInitialized[2][3]>();
+        assert(p1[1][2].value == 1729);
+
+        shared_ptr<DefaultInitialized[][2]> p2 = make_shared_for_overwrite<DefaultInitialized[][2]>(4u);
+        assert(p2[3][1].value == 1729);
+
+        shared_ptr<const int[]> p3 = make_shared_for_overwrite<const int[]>(8u);
+        assert(p3.use_count() == 1);
+
+        shared_ptr<HighlyAligned[]> p4 = make_shared_for_overwrite<HighlyAligned[]>(7u);
+        assert(reinterpret_cast<uintptr_t>(p4.get()) % alignof(HighlyAligned) == 0);
+        p4[6].d = 42;
+        assert(p4[6].d == 42);
+    }
+    assert(constructCount == 1 + 6 + 8);
+    assert_construct_destruct_equal();
+
+    // already constructed elements are destroyed when a later one throws
+    reset_counts(5);
+    try {
+        (void) make_shared_for_overwrite<DefaultInitialized[][3]>(2u);
+        assert(false);
+    } catch (const runtime_error&) {
+    }
+    assert(constructCount == 5);
+    assert_construct_destruct_equal();
+}
+
+void test_allocate_shared_for_overwrite() {
+    DestroyCountingAllocator<int> al;
+
+    reset_counts();
+    {
+        shared_ptr<DefaultInitialized> p0 = allocate_shared_for_overwrite<DefaultInitialized>(al);
+        assert(p0->value == 1729);
+
+        shared_ptr<DefaultInitialized[2][3]> p1 = allocate_shared_for_overwrite<DefaultInitialized[2][3]>(al);
+        assert(p1[1][2].value == 1729);
+
+        shared_ptr<DefaultInitialized[]> p2 = allocate_shared_for_overwrite<DefaultInitialized[]>(al, 4u);
+        assert(p2[3].value == 1729);
+
+        shared_ptr<HighlyAligned[]> p3 = allocate_shared_for_overwrite<HighlyAligned[]>(al, 7u);
+        assert(reinterpret_cast<uintptr_t>(p3.get()) % alignof(HighlyAligned) == 0);
+    }
+    assert(constructCount == 1 + 6 + 4);
+    assert_construct_destruct_equal();
+
+    reset_counts(3);
+    try {
+        (void) allocate_shared_for_overwrite<DefaultInitialized[2][2]>(al);
+        assert(false);
+    } catch (const runtime_error&) {
+    }
+    assert(constructCount == 3);
+    assert_construct_destruct_equal();
+}
+
+int main() {
+    test_make_unique_for_overwrite();
+    test_make_shared_for_overwrite();
+    test_allocate_shared_for_overwrite();
+}
@@ -0,0 +1,171 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <utility>
+
+using namespace std;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    static size_t allocations;
+
+    counting_allocator() = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        ++allocations;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+template <class T>
+size_t counting_allocator<T>::allocations = 0;
+
+// the operation is only required to be move constructible
+struct move_only_fill {
+    unique_ptr<char> fill;
+
+    size_t operator()(char* const p, const size_t n) && {
+        for (size_t i = 0; i < n; ++i) {
+            p[i] = *fill;
+        }
+
+        return n;
+    }
+};
+
+void test_grow() {
+    string s = "abc";
+    s.resize_and_overwrite(100, [](char* const p, const size_t n) {
+        assert(n == 100);
+        assert(p[0] == 'a' && p[1] == 'b' && p[2] == 'c'); // old contents are kept
+        for (size_t i = 3; i < n; ++i) {
+            p[i] = 'x';
+        }
+
+        return n;
+    });
+
+    assert(s.size() == 100);
+    assert(s.capacity() >= 100);
+    assert(s.compare(0, 3, "abc") == 0);
+    assert(s.find_first_not_of('x', 3) == string::npos);
+    assert(s.c_str()[100] == '\0');
+}
+
+void test_partial_write() {
+    string s;
+    s.resize_and_overwrite(64, [](char* const p, size_t) {
+        p[0] = 'h';
+        p[1] = 'i';
+        return 2;
+    });
+
+    assert(s == "hi");
+    assert(s.c_str()[2] == '\0');
+    assert(s.capacity() >= 64);
+
+    s.resize_and_overwrite(10, [](char*, size_t) { return 0; });
+    assert(s.empty());
+    assert(*s.c_str() == '\0');
+}
+
+void test_shrink() {
+    string s(50, 'q');
+    const auto old_data     = s.data();
+    const auto old_capacity = s.capacity();
+    s.resize_and_overwrite(5, [](char* const p, const size_t n) {
+        assert(n == 5);
+        p[4] = 'z';
+        return n;
+    });
+
+    assert(s == "qqqqz");
+    assert(s.data() == old_data);
+    assert(s.capacity() == old_capacity);
+}
+
+void test_operation_types() {
+    string s;
+    s.resize_and_overwrite(3, move_only_fill{make_unique<char>('m')});
+    assert(s == "mmm");
+
+    // the result can be any integer-like type
+    s.resize_and_overwrite(8, [](char* const p, const size_t) {
+        p[0] = 'a';
+        return static_cast<unsigned char>(1);
+    });
+    assert(s == "a");
+
+    // the arguments are lvalues the operation may modify
+    s.resize_and_overwrite(4, [](char*& p, size_t& n) {
+        p[0] = 'w';
+        p    = nullptr;
+        n    = 0;
+        return 1;
+    });
+    assert(s == "w");
+}
+
+void test_wide_and_allocator() {
+    wstring w = L"wide";
+    w.resize_and_overwrite(40, [](wchar_t* const p, const size_t n) {
+        for (size_t i = 4; i < n; ++i) {
+            p[i] = L'!';
+        }
+
+        return n;
+    });
+
+    assert(w.size() == 40);
+    assert(w.compare(0, 4, L"wide") == 0);
+    assert(w[39] == L'!');
+
+    using alloc = counting_allocator<char>;
+    basic_string<char, char_traits<char>, alloc> s;
+    s.resize_and_overwrite(1000, [](char* const p, const size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            p[i] = static_cast<char>('0' + i % 10);
+        }
+
+        return n;
+    });
+
+    assert(alloc::allocations == 1);
+    assert(s.size() == 1000);
+    assert(s[999] == '9');
+
+    s.resize_and_overwrite(900, [](char*, const size_t n) { return n; });
+    assert(alloc::allocations == 1);
+    assert(s.size() == 900);
+    assert(s[899] == '9');
+}
+
+int main() {
+    test_grow();
+    test_partial_write();
+    test_shrink();
+    test_operation_types();
+    test_wide_and_allocator();
+}
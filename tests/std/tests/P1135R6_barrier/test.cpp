@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <barrier>
+#include <cassert>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(barrier<>::max() >= 1);
+STATIC_ASSERT(!is_copy_constructible_v<barrier<>>);
+STATIC_ASSERT(!is_copy_assignable_v<barrier<>>);
+STATIC_ASSERT(is_move_constructible_v<barrier<>::arrival_token>);
+STATIC_ASSERT(is_move_assignable_v<barrier<>::arrival_token>);
+
+struct counting_completion {
+    atomic<int>* phases;
+
+    void operator()() noexcept {
+        phases->fetch_add(1, memory_order_relaxed);
+    }
+};
+
+void test_single_thread() {
+    atomic<int> phases{0};
+    barrier b{2, counting_completion{&phases}};
+
+    auto token = b.arrive();
+    assert(phases.load() == 0);
+    b.wait(b.arrive());
+    assert(phases.load() == 1);
+    b.wait(move(token)); // the phase of token already completed
+
+    b.wait(b.arrive(2));
+    assert(phases.load() == 2);
+
+    b.arrive_and_drop();
+    b.arrive_and_wait();
+    assert(phases.load() == 3);
+    b.arrive_and_wait();
+    assert(phases.load() == 4);
+}
+
+// thread_count > 32 exercises the combining tree
+void test_threads(const int thread_count) {
+    constexpr int rounds = 100;
+    atomic<int> phases{0};
+    atomic<int> arrivals{0};
+    barrier b{thread_count, [&]() noexcept {
+                  // every arrival of this phase happened before the completion
+                  assert(arrivals.load(memory_order_relaxed) == (phases.load(memory_order_relaxed) + 1) * thread_count);
+                  phases.fetch_add(1, memory_order_relaxed);
+              }};
+
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < rounds; ++j) {
+                arrivals.fetch_add(1, memory_order_relaxed);
+                b.arrive_and_wait();
+                assert(phases.load(memory_order_relaxed) >= j + 1);
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(phases.load() == rounds);
+}
+
+void test_drop(const int thread_count) {
+    // each thread drops out after a number of phases equal to its index; the completion counts phases
+    atomic<int> phases{0};
+    barrier b{thread_count, counting_completion{&phases}};
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&b, i] {
+            for (int j = 0; j < i; ++j) {
+                b.arrive_and_wait();
+            }
+
+            b.arrive_and_drop();
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(phases.load() == thread_count);
+}
+
+int main() {
+    test_single_thread();
+    test_threads(1);
+    test_threads(4);
+    test_threads(32);
+    test_threads(33);
+    test_threads(64);
+    test_drop(8);
+    test_drop(40);
+}
@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <latch>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(latch::max() >= 1);
+STATIC_ASSERT(!is_copy_constructible_v<latch>);
+STATIC_ASSERT(!is_copy_assignable_v<latch>);
+
+void test_single_thread() {
+    latch l{3};
+    assert(!l.try_wait());
+    l.count_down();
+    assert(!l.try_wait());
+    l.count_down(0);
+    assert(!l.try_wait());
+    l.count_down(2);
+    assert(l.try_wait());
+    l.wait();
+
+    latch zero{0};
+    assert(zero.try_wait());
+    zero.wait();
+    zero.arrive_and_wait(0);
+
+    latch one{1};
+    one.arrive_and_wait();
+    assert(one.try_wait());
+}
+
+void test_threads() {
+    constexpr int thread_count = 8;
+    latch start{thread_count + 1};
+    latch finish{thread_count};
+    atomic<int> arrived{0};
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&] {
+            arrived.fetch_add(1);
+            start.arrive_and_wait();
+            assert(arrived.load() == thread_count);
+            finish.count_down();
+        });
+    }
+
+    while (arrived.load() != thread_count) {
+        this_thread::yield();
+    }
+
+    assert(!finish.try_wait());
+    start.count_down();
+    finish.wait();
+    assert(finish.try_wait());
+
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+int main() {
+    test_single_thread();
+    test_threads();
+}
@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <semaphore>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono_literals;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(is_same_v<binary_semaphore, counting_semaphore<1>>);
+STATIC_ASSERT(binary_semaphore::max() == 1);
+STATIC_ASSERT(counting_semaphore<5>::max() == 5);
+STATIC_ASSERT(counting_semaphore<>::max() >= 1);
+STATIC_ASSERT(!is_copy_constructible_v<binary_semaphore>);
+STATIC_ASSERT(!is_copy_assignable_v<binary_semaphore>);
+
+void test_uncontended() {
+    counting_semaphore<5> sem{2};
+    assert(sem.try_acquire());
+    assert(sem.try_acquire());
+    assert(!sem.try_acquire());
+
+    sem.release(3);
+    sem.acquire();
+    sem.acquire();
+    sem.acquire();
+    assert(!sem.try_acquire());
+
+    sem.release(0);
+    assert(!sem.try_acquire());
+}
+
+void test_timed() {
+    binary_semaphore sem{0};
+    assert(!sem.try_acquire_for(0ms));
+    assert(!sem.try_acquire_for(-1s));
+    assert(!sem.try_acquire_for(20ms));
+    assert(!sem.try_acquire_until(chrono::steady_clock::now() + 20ms));
+    assert(!sem.try_acquire_until(chrono::system_clock::now() - 1h));
+
+    sem.release();
+    assert(sem.try_acquire_for(1ms));
+    sem.release();
+    assert(sem.try_acquire_until(chrono::steady_clock::now()));
+}
+
+void test_wakes_blocked_acquire() {
+    binary_semaphore ready{0};
+    binary_semaphore done{0};
+    thread t([&] {
+        ready.acquire();
+        done.release();
+    });
+
+    this_thread::sleep_for(20ms);
+    ready.release();
+    assert(done.try_acquire_for(1min));
+    t.join();
+}
+
+void test_ping_pong() {
+    constexpr int rounds = 10000;
+    binary_semaphore ping{0};
+    binary_semaphore pong{0};
+    thread t([&] {
+        for (int i = 0; i < rounds; ++i) {
+            ping.acquire();
+            pong.release();
+        }
+    });
+
+    for (int i = 0; i < rounds; ++i) {
+        ping.release();
+        pong.acquire();
+    }
+
+    t.join();
+    assert(!ping.try_acquire());
+    assert(!pong.try_acquire());
+}
+
+void test_counting() {
+    constexpr ptrdiff_t thread_count = 8;
+    constexpr int rounds             = 1000;
+    counting_semaphore<thread_count> sem{0};
+    atomic<int> acquired{0};
+    vector<thread> threads;
+    for (ptrdiff_t i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < rounds; ++j) {
+                sem.acquire();
+                acquired.fetch_add(1, memory_order_relaxed);
+            }
+        });
+    }
+
+    for (int j = 0; j < rounds; ++j) {
+        sem.release(thread_count);
+        while (acquired.load() != (j + 1) * thread_count) {
+            this_thread::yield();
+        }
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(acquired.load() == thread_count * rounds);
+    assert(!sem.try_acquire());
+}
+
+int main() {
+    test_uncontended();
+    test_timed();
+    test_wakes_blocked_acquire();
+    test_ping_pong();
+    test_counting();
+}
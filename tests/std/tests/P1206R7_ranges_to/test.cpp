@@ -0,0 +1,180 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Covers ranges::to and the from_range constructors, append_range, and insert_range of vector, deque, and basic_string
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <map>
+#include <ranges>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "range_algorithm_support.hpp"
+
+#define ASSERT(...) assert((__VA_ARGS__))
+
+namespace views = std::views;
+
+using std::deque, std::list, std::string, std::vector;
+
+int square(const int i) {
+    return i * i;
+}
+
+// sized_range, but its iterators are only C++17 input iterators, so the iterator pair constructors can't pre-size
+struct squares_of_list {
+    list<int> l{1, 2, 3, 4};
+
+    auto get() const {
+        return l | views::transform(square);
+    }
+};
+
+// a container without a from_range constructor, to observe whether ranges::to reserves
+struct reserve_counting_container {
+    using value_type = int;
+
+    vector<int> elements;
+    int reserve_calls = 0;
+
+    void reserve(const size_t n) {
+        ++reserve_calls;
+        elements.reserve(n);
+    }
+    size_t capacity() const noexcept {
+        return elements.capacity();
+    }
+    size_t max_size() const noexcept {
+        return elements.max_size();
+    }
+    size_t size() const noexcept {
+        return elements.size();
+    }
+    auto begin() noexcept {
+        return elements.begin();
+    }
+    auto begin() const noexcept {
+        return elements.begin();
+    }
+    auto end() noexcept {
+        return elements.end();
+    }
+    auto end() const noexcept {
+        return elements.end();
+    }
+    void push_back(const int i) {
+        elements.push_back(i);
+    }
+};
+
+template <class Container>
+void test_container() {
+    const squares_of_list source;
+    using source_iterator = ranges::iterator_t<decltype(source.get())>;
+    STATIC_ASSERT(ranges::sized_range<decltype(source.get())>);
+    STATIC_ASSERT(
+        !std::derived_from<std::iterator_traits<source_iterator>::iterator_category, std::forward_iterator_tag>);
+
+    Container c(std::from_range, source.get());
+    ASSERT(ranges::equal(c, vector{1, 4, 9, 16}));
+
+    c.append_range(source.get());
+    ASSERT(ranges::equal(c, vector{1, 4, 9, 16, 1, 4, 9, 16}));
+
+    auto it = c.insert_range(c.begin() + 1, views::iota(20, 23));
+    ASSERT(it == c.begin() + 1);
+    ASSERT(ranges::equal(c, vector{1, 20, 21, 22, 4, 9, 16, 1, 4, 9, 16}));
+
+    it = c.insert_range(c.end() - 1, vector{7, 8});
+    ASSERT(it == c.end() - 3);
+    ASSERT(ranges::equal(c, vector{1, 20, 21, 22, 4, 9, 16, 1, 4, 9, 7, 8, 16}));
+
+    // inserting an empty range changes nothing
+    it = c.insert_range(c.begin() + 2, vector<int>{});
+    ASSERT(it == c.begin() + 2);
+    ASSERT(c.size() == 13);
+
+    // input ranges, sized or not, are consumed in a single pass
+    int input_elements[] = {5, 6};
+    using input_range = test::range<test::input, int, test::Sized::no>;
+    Container from_input(std::from_range, input_range{input_elements});
+    ASSERT(ranges::equal(from_input, vector{5, 6}));
+    using sized_input_range = test::range<test::input, int, test::Sized::yes>;
+    from_input.insert_range(from_input.begin(), sized_input_range{input_elements});
+    from_input.append_range(input_range{input_elements});
+    ASSERT(ranges::equal(from_input, vector{5, 6, 5, 6, 5, 6}));
+
+    ASSERT(ranges::equal(ranges::to<Container>(source.get()), vector{1, 4, 9, 16}));
+    ASSERT(ranges::equal(source.get() | ranges::to<Container>(), vector{1, 4, 9, 16}));
+}
+
+void test_string() {
+    const vector<char> chars{'a', 'b', 'c'};
+    string s(std::from_range, chars);
+    ASSERT(s == "abc");
+
+    s.append_range(list<char>{'d', 'e'});
+    ASSERT(s == "abcde");
+
+    const auto it = s.insert_range(s.begin() + 1, string{"xy"});
+    ASSERT(it == s.begin() + 1);
+    ASSERT(s == "axybcde");
+
+    s.insert_range(s.end(), chars | views::transform([](const char c) { return static_cast<char>(c - 'a' + 'A'); }));
+    ASSERT(s == "axybcdeABC");
+
+    STATIC_ASSERT(std::same_as<decltype(string{std::from_range, chars}), string>);
+    STATIC_ASSERT(std::same_as<decltype(std::basic_string(std::from_range, chars)), string>);
+    ASSERT(ranges::to<string>(chars) == "abc");
+}
+
+void test_to() {
+    const squares_of_list source;
+
+    // class template arguments are deduced from the range
+    auto v = source.get() | ranges::to<vector>();
+    STATIC_ASSERT(std::same_as<decltype(v), vector<int>>);
+    ASSERT((v == vector{1, 4, 9, 16}));
+    auto d = ranges::to<deque>(views::iota(0, 3));
+    STATIC_ASSERT(std::same_as<decltype(d), deque<int>>);
+    ASSERT(d.size() == 3);
+    STATIC_ASSERT(std::same_as<decltype(vector(std::from_range, source.get())), vector<int>>);
+
+    // trailing arguments are passed to the constructor
+    const auto with_allocator = source.get() | ranges::to<vector<int>>(std::allocator<int>{});
+    ASSERT((with_allocator == v));
+
+    // containers without from_range constructors are reserved when the range is sized, then appended to
+    const auto counted = ranges::to<reserve_counting_container>(source.get());
+    ASSERT(counted.reserve_calls == 1);
+    ASSERT(ranges::equal(counted, v));
+    const auto unsized = ranges::to<reserve_counting_container>(source.get() | views::filter([](int) { return true; }));
+    ASSERT(unsized.reserve_calls == 0);
+    ASSERT(ranges::equal(unsized, v));
+
+    // associative containers are built from iterator pairs
+    const auto set = ranges::to<std::set<int>>(vector{3, 1, 3, 2});
+    ASSERT(ranges::equal(set, vector{1, 2, 3}));
+    const auto map = ranges::to<std::map<int, char>>(vector<std::pair<int, char>>{{1, 'a'}, {2, 'b'}});
+    ASSERT(map.at(2) == 'b');
+
+    // ranges of ranges are converted element by element
+    const vector<vector<int>> nested{{1, 2}, {}, {3}};
+    const auto lists = ranges::to<list<list<int>>>(nested);
+    ASSERT(lists.size() == 3);
+    ASSERT(ranges::equal(lists.front(), vector{1, 2}));
+    const auto chunks = views::iota(0, 5) | views::chunk(2) | ranges::to<vector<vector<int>>>();
+    ASSERT((chunks == vector<vector<int>>{{0, 1}, {2, 3}, {4}}));
+}
+
+int main() {
+    test_container<vector<int>>();
+    test_container<deque<int>>();
+    test_string();
+    test_to();
+}
@@ -0,0 +1,219 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <flat_set>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+void test_basic() {
+    flat_set<int> s;
+    assert(s.empty());
+    assert(s.insert(3).second);
+    assert(s.insert(1).second);
+    assert(!s.insert(3).second);
+    assert(s.emplace(2).second);
+    assert(*s.emplace_hint(s.end(), 9) == 9);
+    assert(*s.insert(s.begin(), 5) == 5); // misplaced hint
+    assert(*s.insert(s.begin(), 1) == 1); // duplicate through a hint
+    assert((vector<int>(s.begin(), s.end()) == vector<int>{1, 2, 3, 5, 9}));
+
+    assert(s.contains(5) && !s.contains(4));
+    assert(s.count(2) == 1);
+    assert(*s.lower_bound(4) == 5);
+    assert(*s.upper_bound(5) == 9);
+    assert(s.find(4) == s.end());
+    assert(*s.rbegin() == 9);
+
+    assert(s.erase(2) == 1);
+    assert(*s.erase(s.begin()) == 3);
+    assert(s.size() == 3);
+
+    auto copy = s;
+    assert(copy == s);
+    copy.insert(0);
+    assert(copy < s);
+    swap(copy, s);
+    assert(*s.begin() == 0);
+
+    auto cont = move(s).extract();
+    assert(s.empty());
+    assert((cont == vector<int>{0, 3, 5, 9}));
+    s.replace(move(cont));
+    assert(s.size() == 4);
+
+    assert(erase_if(s, [](const int i) { return i % 3 == 0; }) == 3);
+    assert((vector<int>(s.begin(), s.end()) == vector<int>{5}));
+}
+
+void test_construction_and_bulk_insert() {
+    const flat_set<int> unsorted{5, 1, 4, 1, 5, 9, 2, 6};
+    assert((vector<int>(unsorted.begin(), unsorted.end()) == vector<int>{1, 2, 4, 5, 6, 9}));
+
+    flat_set<int> s(sorted_unique, vector<int>{0, 10, 20});
+    const vector<int> sorted{5, 10, 15, 25};
+    s.insert(sorted_unique, sorted.begin(), sorted.end());
+    assert((vector<int>(s.begin(), s.end()) == vector<int>{0, 5, 10, 15, 20, 25}));
+
+    s.insert({30, -5, 12, 12});
+    assert((vector<int>(s.begin(), s.end()) == vector<int>{-5, 0, 5, 10, 12, 15, 20, 25, 30}));
+
+    flat_multiset<int> ms{3, 1, 3};
+    ms.insert(sorted_equivalent, {1, 2, 3});
+    assert((vector<int>(ms.begin(), ms.end()) == vector<int>{1, 1, 2, 3, 3, 3}));
+    assert(ms.count(3) == 3);
+    assert(ms.erase(1) == 2);
+
+    const flat_set<int, greater<int>, deque<int>> descending{1, 3, 2};
+    assert((vector<int>(descending.begin(), descending.end()) == vector<int>{3, 2, 1}));
+}
+
+void test_transparent_lookup() {
+    const flat_set<string, less<>> s{"alpha", "beta"};
+    assert(s.contains(string_view{"beta"}));
+    assert(s.find("gamma") == s.end());
+    assert(s.count("alpha") == 1);
+    assert(*s.lower_bound("b") == "beta");
+    assert(s.equal_range(string_view{"alpha"}).first == s.begin());
+}
+
+void test_against_set() {
+    mt19937 gen(1729);
+    uniform_int_distribution<int> key_dist(0, 999);
+    uniform_int_distribution<int> op_dist(0, 3);
+    flat_set<int> fs;
+    set<int> ref;
+    for (int i = 0; i < 5000; ++i) {
+        const int key = key_dist(gen);
+        switch (op_dist(gen)) {
+        case 0:
+            assert(fs.insert(key).second == ref.insert(key).second);
+            break;
+        case 1:
+            assert(fs.erase(key) == ref.erase(key));
+            break;
+        case 2:
+            {
+                vector<int> batch;
+                for (int j = 0; j < 10; ++j) {
+                    batch.push_back(key_dist(gen));
+                }
+                fs.insert(batch.begin(), batch.end());
+                ref.insert(batch.begin(), batch.end());
+                break;
+            }
+        default:
+            assert(fs.contains(key) == (ref.count(key) != 0));
+            break;
+        }
+    }
+
+    assert(equal(fs.begin(), fs.end(), ref.begin(), ref.end()));
+}
+
+template <class T>
+struct tagged_allocator {
+    using value_type = T;
+
+    int id = 0;
+
+    tagged_allocator() = default;
+    explicit tagged_allocator(const int i) : id(i) {}
+    template <class U>
+    tagged_allocator(const tagged_allocator<U>& other) : id(other.id) {}
+
+    T* allocate(const size_t n) {
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const tagged_allocator<U>& other) const {
+        return id == other.id;
+    }
+
+    template <class U>
+    bool operator!=(const tagged_allocator<U>& other) const {
+        return id != other.id;
+    }
+};
+
+void test_allocator_extended_construction() {
+    using vec      = vector<int, tagged_allocator<int>>;
+    using set_type = flat_set<int, greater<int>, vec>;
+    static_assert(uses_allocator_v<set_type, tagged_allocator<int>>);
+    static_assert(!uses_allocator_v<set_type, allocator<int>>);
+
+    const tagged_allocator<int> al(7);
+
+    set_type from_container(vec({1, 3, 2, 3}), al);
+    assert((vector<int>(from_container.begin(), from_container.end()) == vector<int>{3, 2, 1}));
+
+    const set_type presorted(sorted_unique, vec({3, 1}), greater<int>{}, al);
+    assert(presorted.size() == 2);
+
+    set_type copied(from_container, tagged_allocator<int>(8));
+    assert(copied == from_container);
+    const set_type moved(move(copied), tagged_allocator<int>(9));
+    assert(moved == from_container);
+
+    const vector<int> values{1, 5, 5, 2};
+    const set_type from_range(values.begin(), values.end(), al);
+    assert(from_range.size() == 3 && *from_range.begin() == 5);
+
+    const flat_multiset<int, less<int>, vec> ms({2, 1, 2}, al);
+    assert(ms.size() == 3 && ms.count(2) == 2);
+
+    assert(move(from_container).extract().get_allocator().id == 7);
+    assert(set_type(al).empty());
+}
+
+void test_deduction_guides() {
+    using vec = vector<int, tagged_allocator<int>>;
+
+    flat_set from_container(vector<int>{3, 1});
+    static_assert(is_same_v<decltype(from_container), flat_set<int>>);
+    assert(*from_container.begin() == 1);
+
+    flat_set with_allocator(vec{1}, tagged_allocator<int>(1));
+    static_assert(is_same_v<decltype(with_allocator), flat_set<int, less<int>, vec>>);
+
+    flat_set presorted(sorted_unique, deque<int>{3, 2}, greater<int>{});
+    static_assert(is_same_v<decltype(presorted), flat_set<int, greater<int>, deque<int>>>);
+
+    flat_multiset presorted_alloc(sorted_equivalent, vec{1, 1}, greater<int>{}, tagged_allocator<int>(1));
+    static_assert(is_same_v<decltype(presorted_alloc), flat_multiset<int, greater<int>, vec>>);
+
+    const vector<int> values{1, 5, 5, 2};
+    flat_multiset from_range(values.begin(), values.end(), greater<int>{});
+    static_assert(is_same_v<decltype(from_range), flat_multiset<int, greater<int>>>);
+    assert(from_range.size() == 4);
+
+    flat_set from_list({2L, 1L});
+    static_assert(is_same_v<decltype(from_list), flat_set<long>>);
+
+    flat_multiset from_sorted_list(sorted_equivalent, {1, 1, 2});
+    static_assert(is_same_v<decltype(from_sorted_list), flat_multiset<int>>);
+}
+
+int main() {
+    test_basic();
+    test_construction_and_bulk_insert();
+    test_transparent_lookup();
+    test_against_set();
+    test_allocator_extended_construction();
+    test_deduction_guides();
+}
@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Covers views::zip, sorting and partitioning through its proxy references, and stdext::sort_by_key
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#define ASSERT(...) assert((__VA_ARGS__))
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+namespace ranges = std::ranges;
+namespace views  = std::views;
+
+using std::forward_list;
+using std::list;
+using std::string;
+using std::tuple;
+using std::vector;
+
+using ZipVI = ranges::zip_view<views::all_t<vector<int>&>, views::all_t<vector<double>&>>;
+
+STATIC_ASSERT(ranges::random_access_range<ZipVI>);
+STATIC_ASSERT(ranges::sized_range<ZipVI>);
+STATIC_ASSERT(ranges::common_range<ZipVI>);
+STATIC_ASSERT(ranges::view<ZipVI>);
+STATIC_ASSERT(std::is_same_v<ranges::range_value_t<ZipVI>, tuple<int, double>>);
+STATIC_ASSERT(std::indirectly_writable<ranges::iterator_t<ZipVI>, tuple<int, double>>);
+STATIC_ASSERT(std::sortable<ranges::iterator_t<ZipVI>>);
+STATIC_ASSERT(ranges::borrowed_range<ZipVI>);
+STATIC_ASSERT(!ranges::borrowed_range<ranges::zip_view<views::all_t<vector<int>>>>);
+
+using ZipFwd = decltype(views::zip(std::declval<forward_list<int>&>(), std::declval<vector<int>&>()));
+STATIC_ASSERT(ranges::forward_range<ZipFwd>);
+STATIC_ASSERT(!ranges::bidirectional_range<ZipFwd>);
+STATIC_ASSERT(!ranges::sized_range<ZipFwd>);
+
+using ZipBidi = decltype(views::zip(std::declval<list<int>&>(), std::declval<vector<int>&>()));
+STATIC_ASSERT(ranges::bidirectional_range<ZipBidi>);
+STATIC_ASSERT(!ranges::common_range<ZipBidi>); // the shorter of the two lists can't be known without walking them
+
+constexpr bool test_zip_basics() {
+    int ints[]       = {1, 2, 3, 4};
+    const char str[] = "abc";
+    auto z           = views::zip(ints, ranges::subrange(str, str + 3));
+    ASSERT(z.size() == 3);
+    ASSERT(ranges::distance(z) == 3);
+    ASSERT(z.end() - z.begin() == 3);
+
+    auto it = z.begin();
+    ASSERT(std::get<0>(*it) == 1 && std::get<1>(*it) == 'a');
+    ++it;
+    ASSERT(std::get<0>(it[1]) == 3 && std::get<1>(it[1]) == 'c');
+    ASSERT(it > z.begin() && it <= it + 1 && (it <=> z.begin()) > 0);
+
+    // writes through the reference reach the underlying ranges, even through a const reference
+    const auto ref   = *it;
+    std::get<0>(ref) = 20;
+    ASSERT(ints[1] == 20);
+    char chars[] = {'x', 'y'};
+    *views::zip(ints, chars).begin() = tuple<int, char>{10, 'a'};
+    ASSERT(ints[0] == 10 && chars[0] == 'a');
+
+    int total = 0;
+    for (auto [i, c] : z) {
+        total += i + (c - 'a');
+    }
+    ASSERT(total == 10 + 20 + 3 + 3);
+
+    const auto cz = views::zip(ints);
+    ASSERT(ranges::next(cz.begin(), 4) == cz.end());
+    return true;
+}
+
+void test_zip_shortest() {
+    forward_list<int> fl = {1, 2, 3, 4, 5};
+    vector<string> names = {"one", "two", "three"};
+    int count            = 0;
+    for (auto [i, s] : views::zip(fl, names)) {
+        ASSERT(names[static_cast<std::size_t>(i - 1)] == s);
+        ++count;
+    }
+    ASSERT(count == 3);
+
+    list<int> li = {1, 2};
+    auto z       = views::zip(li, names);
+    auto last    = ranges::next(z.begin(), z.end());
+    ASSERT(last == z.end());
+    --last;
+    ASSERT(std::get<1>(*last) == "two");
+}
+
+void test_zip_sort() {
+    vector<int> keys      = {5, 3, 9, 1, 3};
+    vector<string> values = {"five", "three", "nine", "one", "three again"};
+    auto z                = views::zip(keys, values);
+
+    ranges::sort(z, {}, [](const auto& elem) { return std::get<0>(elem); });
+    ASSERT(keys == vector<int>{1, 3, 3, 5, 9});
+    ASSERT(values[0] == "one" && values[3] == "five" && values[4] == "nine");
+
+    ranges::sort(z, ranges::greater{}); // sorts by the whole tuple
+    ASSERT(keys == vector<int>{9, 5, 3, 3, 1});
+    ASSERT(values[2] == "three again" && values[3] == "three");
+
+    const auto mid = ranges::partition(z, [](const auto& elem) { return std::get<0>(elem) % 3 == 0; });
+    ASSERT(mid.begin() - z.begin() == 3);
+    for (auto [k, v] : z) {
+        ASSERT((k == 9) == (v == "nine"));
+    }
+
+    ranges::reverse(z);
+    ASSERT(std::get<1>(*z.begin()) == values.front());
+}
+
+void test_sort_by_key() {
+    // the packed path, for small arithmetic keys
+    vector<float> keys    = {2.5f, -1.0f, 2.5f, 0.0f, -7.25f};
+    vector<int> ids       = {0, 1, 2, 3, 4};
+    vector<string> labels = {"a", "b", "c", "d", "e"};
+    stdext::sort_by_key(keys, ids, labels);
+    ASSERT(keys == vector<float>{-7.25f, -1.0f, 0.0f, 2.5f, 2.5f});
+    ASSERT(ids == vector<int>{4, 1, 3, 0, 2}); // stable
+    ASSERT(labels == vector<string>{"e", "b", "d", "a", "c"});
+
+    stdext::sort_by_key(std::greater<>{}, keys, ids);
+    ASSERT(keys == vector<float>{2.5f, 2.5f, 0.0f, -1.0f, -7.25f});
+    ASSERT(ids == vector<int>{0, 2, 3, 1, 4});
+
+    vector<short> shorts = {3, -3, 3, -3};
+    vector<int> order    = {0, 1, 2, 3};
+    stdext::sort_by_key(ranges::greater{}, shorts, order);
+    ASSERT(order == vector<int>{0, 2, 1, 3});
+
+    // the general path, for other keys and predicates; the values may be longer than the keys
+    vector<string> words = {"pear", "fig", "apple", "kiwi", "date"};
+    vector<int> lengths  = {4, 3, 5, 4, 4, 100};
+    auto by_length       = [](const string& left, const string& right) { return left.size() < right.size(); };
+    stdext::sort_by_key(by_length, words, lengths);
+    ASSERT(words == vector<string>{"fig", "pear", "kiwi", "date", "apple"});
+    ASSERT(lengths == vector<int>{3, 4, 4, 4, 5, 100});
+
+    vector<long long> wide = {30, 10, 20};
+    int other[]            = {3, 1, 2};
+    stdext::sort_by_key(wide, other);
+    ASSERT(wide == vector<long long>{10, 20, 30});
+    ASSERT(other[0] == 1 && other[2] == 3);
+
+    vector<int> alone = {2, 1};
+    stdext::sort_by_key(alone);
+    ASSERT(alone == vector<int>{1, 2});
+
+    vector<int> empty;
+    vector<string> unused = {"unchanged"};
+    stdext::sort_by_key(empty, unused);
+    ASSERT(unused[0] == "unchanged");
+
+    // a longer input with long cycles
+    vector<unsigned int> many(1000);
+    vector<std::size_t> positions(1000);
+    for (std::size_t idx = 0; idx < many.size(); ++idx) {
+        many[idx]      = static_cast<unsigned int>((idx * 7919) % 1000);
+        positions[idx] = idx;
+    }
+
+    stdext::sort_by_key(many, positions);
+    for (std::size_t idx = 0; idx < many.size(); ++idx) {
+        ASSERT(many[idx] == idx);
+        ASSERT((positions[idx] * 7919) % 1000 == idx);
+    }
+}
+
+int main() {
+    test_zip_basics();
+    STATIC_ASSERT(test_zip_basics());
+    test_zip_shortest();
+    test_zip_sort();
+    test_sort_by_key();
+}
@@ -0,0 +1,179 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Covers views::chunk, views::slide, and views::stride, and the parallel ranges::for_each over a chunk_view
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <concepts>
+#include <execution>
+#include <forward_list>
+#include <list>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "range_algorithm_support.hpp"
+
+#define ASSERT(...) assert((__VA_ARGS__))
+
+namespace views = std::views;
+
+using std::vector;
+
+template <class Rng, class Expected>
+constexpr bool equal_to_list(Rng&& r, const Expected& expected) {
+    auto first      = ranges::begin(expected);
+    const auto last = ranges::end(expected);
+    for (auto&& x : r) {
+        if (first == last || !(x == *first)) {
+            return false;
+        }
+        ++first;
+    }
+    return first == last;
+}
+
+template <class Rng, class Expected>
+constexpr bool equal_to_nested(Rng&& r, const Expected& expected) {
+    auto first      = ranges::begin(expected);
+    const auto last = ranges::end(expected);
+    for (auto&& inner : r) {
+        if (first == last || !equal_to_list(inner, *first)) {
+            return false;
+        }
+        ++first;
+    }
+    return first == last;
+}
+
+constexpr bool test_chunk() {
+    int arr[] = {0, 1, 2, 3, 4, 5, 6};
+    auto chunks = arr | views::chunk(3);
+    ASSERT(chunks.size() == 3);
+    ASSERT(equal_to_nested(chunks, std::array<vector<int>, 3>{{{0, 1, 2}, {3, 4, 5}, {6}}}));
+    ASSERT(chunks[2].size() == 1);
+    ASSERT(chunks.end() - chunks.begin() == 3);
+
+    // the chunks of a contiguous range are spans, and iteration runs backwards from a partial last chunk
+    STATIC_ASSERT(std::same_as<ranges::range_value_t<decltype(chunks)>, std::span<int>>);
+    STATIC_ASSERT(ranges::random_access_range<decltype(chunks)>);
+    STATIC_ASSERT(ranges::common_range<decltype(chunks)>);
+    STATIC_ASSERT(ranges::borrowed_range<decltype(chunks)>);
+    ASSERT(equal_to_nested(chunks | views::reverse, std::array<vector<int>, 3>{{{6}, {3, 4, 5}, {0, 1, 2}}}));
+
+    auto it = chunks.end();
+    it -= 2;
+    ASSERT((*it)[0] == 3);
+    ASSERT(it + 2 == chunks.end());
+    ASSERT(std::default_sentinel - chunks.begin() == 3);
+
+    ASSERT((arr | views::chunk(7)).size() == 1);
+    ASSERT((arr | views::chunk(10)).size() == 1);
+    ASSERT(equal_to_nested(views::iota(0, 4) | views::chunk(2), std::array<vector<int>, 2>{{{0, 1}, {2, 3}}}));
+    return true;
+}
+
+constexpr bool test_slide() {
+    int arr[] = {0, 1, 2, 3, 4};
+    auto windows = arr | views::slide(3);
+    ASSERT(windows.size() == 3);
+    ASSERT(equal_to_nested(windows, std::array<vector<int>, 3>{{{0, 1, 2}, {1, 2, 3}, {2, 3, 4}}}));
+    ASSERT(windows[1][2] == 3);
+    STATIC_ASSERT(std::same_as<ranges::range_value_t<decltype(windows)>, std::span<int>>);
+    STATIC_ASSERT(ranges::random_access_range<decltype(windows)>);
+    STATIC_ASSERT(ranges::common_range<decltype(windows)>);
+
+    ASSERT((arr | views::slide(5)).size() == 1);
+    ASSERT((arr | views::slide(6)).size() == 0);
+    ASSERT((arr | views::slide(6)).begin() == (arr | views::slide(6)).end());
+    ASSERT(equal_to_nested(windows | views::reverse, std::array<vector<int>, 3>{{{2, 3, 4}, {1, 2, 3}, {0, 1, 2}}}));
+    return true;
+}
+
+constexpr bool test_stride() {
+    int arr[] = {0, 1, 2, 3, 4, 5, 6};
+    auto strided = arr | views::stride(3);
+    ASSERT(strided.size() == 3);
+    ASSERT(strided.stride() == 3);
+    ASSERT(equal_to_list(strided, std::array{0, 3, 6}));
+    ASSERT(equal_to_list(strided | views::reverse, std::array{6, 3, 0}));
+    ASSERT(strided[1] == 3);
+    ASSERT(strided.end() - strided.begin() == 3);
+    STATIC_ASSERT(ranges::random_access_range<decltype(strided)>);
+    STATIC_ASSERT(ranges::common_range<decltype(strided)>);
+
+    ASSERT(equal_to_list(arr | views::stride(2), std::array{0, 2, 4, 6}));
+    ASSERT(equal_to_list(arr | views::stride(10), std::array{0}));
+    ASSERT(equal_to_list(views::iota(0) | views::stride(5) | views::take(3), std::array{0, 5, 10}));
+    return true;
+}
+
+void test_non_random_access() {
+    std::list<int> l{0, 1, 2, 3, 4, 5, 6};
+    auto chunks = l | views::chunk(3);
+    STATIC_ASSERT(ranges::bidirectional_range<decltype(chunks)>);
+    STATIC_ASSERT(!ranges::random_access_range<decltype(chunks)>);
+    ASSERT(chunks.size() == 3);
+    ASSERT(equal_to_nested(chunks, std::array<vector<int>, 3>{{{0, 1, 2}, {3, 4, 5}, {6}}}));
+    ASSERT(equal_to_nested(chunks | views::reverse, std::array<vector<int>, 3>{{{6}, {3, 4, 5}, {0, 1, 2}}}));
+    ASSERT(equal_to_list(l | views::stride(4) | views::reverse, std::array{4, 0}));
+
+    // a forward_list's end can be neither reached backwards nor computed, so these views end in sentinels
+    std::forward_list<int> fl{0, 1, 2, 3, 4};
+    ASSERT(equal_to_nested(fl | views::chunk(2), std::array<vector<int>, 3>{{{0, 1}, {2, 3}, {4}}}));
+    ASSERT(equal_to_nested(fl | views::slide(4), std::array<vector<int>, 2>{{{0, 1, 2, 3}, {1, 2, 3, 4}}}));
+    ASSERT(equal_to_list(fl | views::stride(2), std::array{0, 2, 4}));
+    STATIC_ASSERT(ranges::forward_range<decltype(fl | views::slide(4))>);
+
+    // slide_view caches the end of its first window on ranges that cannot compute it in constant time
+    auto windows = l | views::slide(2);
+    ASSERT(windows.size() == 6);
+    ASSERT(equal_to_nested(windows, std::array<vector<int>, 6>{{{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 6}}}));
+    ASSERT(ranges::next(windows.begin(), 6) == windows.end());
+    ASSERT((l | views::slide(8)).begin() == (l | views::slide(8)).end());
+}
+
+void test_parallel_for_each() {
+    // each chunk is a single work item, so a body may treat its chunk as a serial batch
+    vector<int> v(10'000);
+    std::iota(v.begin(), v.end(), 0);
+    vector<long long> sums(ranges::size(v | views::chunk(64)));
+    auto chunks = v | views::chunk(64);
+    ranges::for_each(std::execution::par, chunks, [&](std::span<int> chunk) {
+        long long sum = 0;
+        for (const int i : chunk) {
+            sum += i;
+        }
+        sums[static_cast<size_t>((chunk.data() - v.data()) / 64)] = sum;
+    });
+
+    ASSERT(std::accumulate(sums.begin(), sums.end(), 0LL) == 10'000LL * 9'999 / 2);
+    ASSERT(sums.back() == std::accumulate(v.begin() + 9'984, v.end(), 0LL));
+
+    // random-access views without contiguous iterators are partitioned directly too
+    std::atomic<int> visited{0};
+    ranges::for_each(std::execution::par, views::iota(0, 1000), [&](int) { ++visited; });
+    ASSERT(visited == 1000);
+
+    std::atomic<int> strided{0};
+    ranges::for_each(std::execution::par, v | views::stride(10), [&](const int i) {
+        ASSERT(i % 10 == 0);
+        ++strided;
+    });
+    ASSERT(strided == 1000);
+}
+
+int main() {
+    STATIC_ASSERT(test_chunk());
+    test_chunk();
+    STATIC_ASSERT(test_slide());
+    test_slide();
+    STATIC_ASSERT(test_stride());
+    test_stride();
+    test_non_random_access();
+    test_parallel_for_each();
+}
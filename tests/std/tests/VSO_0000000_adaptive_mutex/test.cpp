@@ -0,0 +1,91 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::adaptive_mutex;
+
+STATIC_ASSERT(is_nothrow_default_constructible_v<adaptive_mutex>);
+STATIC_ASSERT(!is_copy_constructible_v<adaptive_mutex>);
+STATIC_ASSERT(!is_copy_assignable_v<adaptive_mutex>);
+
+adaptive_mutex constant_initialized; // constexpr default constructor
+
+void test_single_thread() {
+    adaptive_mutex m;
+    assert(m.try_lock());
+    assert(!m.try_lock());
+    m.unlock();
+
+    {
+        lock_guard<adaptive_mutex> guard(m);
+        assert(!m.try_lock());
+    }
+
+    unique_lock<adaptive_mutex> lock(m, try_to_lock);
+    assert(lock.owns_lock());
+    lock.unlock();
+
+    constant_initialized.lock();
+    constant_initialized.unlock();
+}
+
+void test_contended(const int thread_count, const bool long_holds) {
+    constexpr int iterations = 20000;
+    adaptive_mutex m;
+    long long counter = 0;
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < iterations; ++j) {
+                lock_guard<adaptive_mutex> guard(m);
+                ++counter;
+                if (long_holds && j % 1000 == 0) {
+                    // exceeds any spin limit, so waiters block
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(counter == static_cast<long long>(thread_count) * iterations);
+}
+
+void test_condition_variable_any() {
+    adaptive_mutex m;
+    condition_variable_any cv;
+    bool ready = false;
+    thread t([&] {
+        lock_guard<adaptive_mutex> guard(m);
+        ready = true;
+        cv.notify_one();
+    });
+
+    {
+        unique_lock<adaptive_mutex> lock(m);
+        cv.wait(lock, [&] { return ready; });
+    }
+
+    t.join();
+}
+
+int main() {
+    test_single_thread();
+    test_contended(2, false);
+    test_contended(8, false);
+    test_contended(8, true);
+    test_condition_variable_any();
+}
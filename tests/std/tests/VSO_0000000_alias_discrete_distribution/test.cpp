@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+constexpr int sample_count = 1'000'000;
+
+// whether the observed frequencies match probabilities() to within 5 standard deviations
+template <class Dist, class Engine>
+bool matches_probabilities(Dist& dist, Engine& eng) {
+    const vector<double> probs = dist.probabilities();
+    vector<int> counts(probs.size());
+    for (int i = 0; i < sample_count; ++i) {
+        const auto val = dist(eng);
+        assert((dist.min)() <= val && val <= (dist.max)());
+        ++counts[static_cast<size_t>(val)];
+    }
+
+    for (size_t i = 0; i < probs.size(); ++i) {
+        const double expected = probs[i] * sample_count;
+        if (expected == 0.0) {
+            if (counts[i] != 0) {
+                return false;
+            }
+        } else if (abs(counts[i] - expected) > 5.0 * sqrt(expected * (1.0 - probs[i]))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class Engine>
+void test_sampling() {
+    Engine eng;
+    stdext::alias_discrete_distribution<> dist{1.0, 0.0, 3.0, 0.5, 10.0, 2.5};
+    assert((dist.max)() == 5);
+    const vector<double> probs = dist.probabilities();
+    assert(probs.size() == 6 && probs[1] == 0.0 && probs[4] == 10.0 / 17.0);
+    assert(matches_probabilities(dist, eng));
+
+    vector<double> weights;
+    for (int i = 0; i < 1000; ++i) {
+        weights.push_back(static_cast<double>(i % 7) + (i == 3 ? 500.0 : 0.0));
+    }
+
+    stdext::alias_discrete_distribution<short> many(weights.begin(), weights.end());
+    assert(matches_probabilities(many, eng));
+
+    // the same probabilities as discrete_distribution
+    stdext::alias_discrete_distribution<> from_function(10, 0.0, 1.0, [](const double x) { return x * x; });
+    discrete_distribution<> reference(10, 0.0, 1.0, [](const double x) { return x * x; });
+    assert(from_function.probabilities() == reference.probabilities());
+}
+
+void test_degenerate() {
+    mt19937 eng;
+    stdext::alias_discrete_distribution<> empty;
+    assert((empty.max)() == 0);
+    stdext::alias_discrete_distribution<> single{42.0};
+    for (int i = 0; i < 100; ++i) {
+        assert(empty(eng) == 0);
+        assert(single(eng) == 0);
+    }
+}
+
+void test_set_weight() {
+    mt19937_64 eng;
+    stdext::alias_discrete_distribution<> dist{1.0, 1.0, 1.0, 1.0};
+    dist.set_weight(0, 0.0);
+    dist.set_weight(2, 5.0);
+    assert(dist.weight(2) == 5.0);
+    assert(dist.probabilities() == (vector<double>{0.0, 1.0 / 7.0, 5.0 / 7.0, 1.0 / 7.0}));
+    assert(dist.param() == decltype(dist)::param_type({0.0, 1.0, 5.0, 1.0}));
+    assert(matches_probabilities(dist, eng));
+
+    // many updates between draws, as a dynamic weighting does
+    vector<double> weights(100, 1.0);
+    stdext::alias_discrete_distribution<> dynamic(weights.begin(), weights.end());
+    for (size_t i = 0; i < 100; i += 2) {
+        dynamic.set_weight(i, 3.0);
+    }
+
+    assert(matches_probabilities(dynamic, eng));
+}
+
+void test_params_and_streams() {
+    stdext::alias_discrete_distribution<> dist{2.0, 1.0, 1.0};
+    stdext::alias_discrete_distribution<> copy;
+    assert(dist != copy);
+    stringstream stream;
+    stream << dist;
+    stream >> copy;
+    assert(dist == copy);
+
+    // weights that differ only by scale describe the same distribution
+    assert(dist == (stdext::alias_discrete_distribution<>{4.0, 2.0, 2.0}));
+
+    stdext::alias_discrete_distribution<> other;
+    other.param(dist.param());
+    mt19937 eng1(1729);
+    mt19937 eng2(1729);
+    for (int i = 0; i < 1000; ++i) {
+        assert(dist(eng1) == copy(eng2, other.param()));
+    }
+
+    mt19937 eng3(42);
+    mt19937 eng4(42);
+    vector<int> bulk(1000);
+    stdext::generate(eng3, dist, bulk.begin(), bulk.end());
+    for (const int val : bulk) {
+        assert(val == dist(eng4));
+    }
+}
+
+int main() {
+    test_sampling<mt19937>();
+    test_sampling<mt19937_64>();
+    test_sampling<minstd_rand>(); // 31-bit values, assembled by _Rng_from_urng
+    test_degenerate();
+    test_set_weight();
+    test_params_and_streams();
+}
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _STL_ALLOCATION_TRACKING 1
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using stdext::allocation_event;
+using stdext::allocation_kind;
+
+constexpr size_t kind_count = static_cast<size_t>(allocation_kind::default_resource) + 1;
+
+struct kind_counts {
+    atomic<long long> allocations{0};
+    atomic<long long> deallocations{0};
+    atomic<long long> bytes{0}; // allocated minus deallocated
+};
+
+array<kind_counts, kind_count> counts;
+
+void __cdecl record(const allocation_event& event) {
+    assert(event.sample_period != 0);
+    auto& kind = counts[static_cast<size_t>(event.kind)];
+    const auto bytes = static_cast<long long>(event.bytes * event.sample_period);
+    if (event.deallocation) {
+        kind.deallocations += event.sample_period;
+        kind.bytes -= bytes;
+    } else {
+        assert(event.ptr != nullptr);
+        kind.allocations += event.sample_period;
+        kind.bytes += bytes;
+    }
+
+    // allocating here must not report anything, nor recurse
+    vector<int> scratch(4);
+    (void) scratch;
+}
+
+const kind_counts& counts_of(const allocation_kind kind) {
+    return counts[static_cast<size_t>(kind)];
+}
+
+void reset_counts() {
+    for (auto& kind : counts) {
+        kind.allocations   = 0;
+        kind.deallocations = 0;
+        kind.bytes         = 0;
+    }
+}
+
+// a fresh thread hasn't skipped any allocations yet, so it reports from its first one on
+template <class Fn>
+void on_new_thread(Fn fn) {
+    thread t{fn};
+    t.join();
+}
+
+void test_kinds() {
+    assert(stdext::set_allocation_hook(record) == nullptr);
+    reset_counts();
+    on_new_thread([] {
+        vector<int> v(100);
+        string s(100, 'x');
+        list<int> l{1, 2, 3};
+        forward_list<int> fl{1, 2, 3};
+        map<int, int> m{{1, 1}, {2, 2}};
+        unordered_map<int, int> um{{1, 1}, {2, 2}};
+        array<char, 256> big{};
+        function<int()> f = [big] { return static_cast<int>(big[0]); };
+        pmr::vector<int> pv(100);
+        assert(f() == 0);
+    });
+
+    for (const auto kind : {allocation_kind::vector, allocation_kind::basic_string, allocation_kind::list_node,
+             allocation_kind::tree_node, allocation_kind::hash_buckets, allocation_kind::function,
+             allocation_kind::default_resource}) {
+        const auto& kind_counts = counts_of(kind);
+        assert(kind_counts.allocations > 0);
+        assert(kind_counts.allocations == kind_counts.deallocations);
+        assert(kind_counts.bytes == 0);
+    }
+
+    assert(counts_of(allocation_kind::tree_node).allocations == 3); // head and two nodes
+    assert(counts_of(allocation_kind::function).allocations == 1);
+    assert(stdext::set_allocation_hook(nullptr) == record);
+}
+
+void test_sampling() {
+    constexpr unsigned int period = 8;
+    (void) stdext::set_allocation_hook(record, period);
+    reset_counts();
+    on_new_thread([] {
+        allocator<long long> al;
+        for (int i = 0; i < 800; ++i) {
+            al.deallocate(al.allocate(10), 10);
+        }
+    });
+
+    // 1600 events in all; the first is reported, then every period-th, each standing for period events
+    const auto& vector_counts = counts_of(allocation_kind::vector);
+    assert(vector_counts.allocations + vector_counts.deallocations == 1600);
+    (void) stdext::set_allocation_hook(nullptr);
+}
+
+void test_unhooked() {
+    reset_counts();
+    on_new_thread([] { vector<int> v(100); });
+    for (const auto& kind : counts) {
+        assert(kind.allocations == 0 && kind.deallocations == 0);
+    }
+
+    assert(pmr::get_default_resource() == pmr::new_delete_resource());
+}
+
+int main() {
+    test_kinds();
+    test_sampling();
+    test_unhooked();
+}
@@ -0,0 +1,170 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <map>
+#include <memory_resource>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <unordered_set>
+
+using namespace std;
+using stdext::pmr::arena_group;
+using stdext::pmr::arena_options;
+using stdext::pmr::arena_resource;
+using stdext::pmr::statistics_resource;
+
+bool is_aligned(const void* const p, const size_t align) {
+    return (reinterpret_cast<uintptr_t>(p) & (align - 1)) == 0;
+}
+
+void simulate_request(arena_resource& arena) {
+    for (size_t i = 0; i < 1000; ++i) {
+        const size_t size  = i % 200 + 1;
+        const size_t align = i % 3 == 0 ? 64 : 8;
+        void* const p      = arena.allocate(size, align);
+        assert(is_aligned(p, align));
+        memset(p, 0xCD, size);
+    }
+
+    void* const big = arena.allocate(50000, 4096);
+    assert(is_aligned(big, 4096));
+    memset(big, 0xCD, 50000);
+}
+
+void test_reset_keeps_blocks() {
+    statistics_resource upstream;
+    {
+        arena_resource arena{&upstream};
+        simulate_request(arena);
+        const auto warm = upstream.statistics();
+        assert(warm.allocation_count > 1);
+        assert(arena.capacity() <= warm.bytes_in_use);
+
+        for (int request = 0; request < 10; ++request) {
+            arena.reset();
+            simulate_request(arena);
+        }
+        assert(upstream.statistics().allocation_count == warm.allocation_count);
+
+        arena.release();
+        assert(upstream.statistics().bytes_in_use == 0);
+        assert(arena.capacity() == 0);
+
+        simulate_request(arena);
+    }
+    assert(upstream.statistics().bytes_in_use == 0);
+}
+
+void test_options() {
+    statistics_resource upstream;
+    arena_options opts;
+    opts.initial_size       = 4096;
+    opts.growth_numerator   = 2;
+    opts.growth_denominator = 1;
+    opts.max_block_size     = 16384;
+    arena_resource arena{&upstream, opts};
+    assert(arena.options().initial_size == 4096);
+    assert(arena.options().max_block_size == 16384);
+
+    for (int i = 0; i < 100; ++i) {
+        (void) arena.allocate(1000, 8);
+    }
+    assert(upstream.statistics().largest_allocation == 16384);
+
+    (void) arena.allocate(100000, 8); // larger than max_block_size still succeeds
+    assert(upstream.statistics().largest_allocation >= 100000);
+
+    opts.growth_numerator   = 1; // shrinking is not supported; blocks keep their size
+    opts.growth_denominator = 2;
+    arena_resource constant{&upstream, opts};
+    assert(constant.options().growth_numerator == constant.options().growth_denominator);
+}
+
+void test_initial_buffer() {
+    statistics_resource upstream;
+    char buffer[512];
+    arena_resource arena{buffer, sizeof(buffer), &upstream};
+    void* const first = arena.allocate(100, 1);
+    assert(first == buffer);
+    assert(upstream.statistics().allocation_count == 0);
+
+    (void) arena.allocate(1000, 8);
+    assert(upstream.statistics().allocation_count == 1);
+    assert(arena.capacity() > sizeof(buffer));
+
+    arena.reset();
+    assert(arena.allocate(100, 1) == first);
+
+    arena.release();
+    assert(upstream.statistics().bytes_in_use == 0);
+    assert(arena.capacity() == sizeof(buffer));
+    assert(arena.allocate(100, 1) == first);
+}
+
+void test_group() {
+    arena_group group;
+    arena_options opts;
+    opts.group = &group;
+
+    arena_resource first{pmr::new_delete_resource(), opts};
+    arena_resource second{pmr::new_delete_resource(), opts};
+    arena_resource outsider{pmr::new_delete_resource()};
+    assert(first.is_equal(second) && second.is_equal(first));
+    assert(!first.is_equal(outsider) && !outsider.is_equal(first));
+    assert(group.contains(first) && group.contains(second) && !group.contains(outsider));
+
+    {
+        pmr::map<int, int> source{&first};
+        pmr::map<int, int> dest{&second};
+        for (int i = 0; i < 100; ++i) {
+            source.emplace(i, i);
+        }
+
+        const int* const node_value = &source.at(42);
+        stdext::pmr::adopt(dest, source); // dest is empty: the containers trade their trees
+        assert(source.empty() && dest.size() == 100);
+        assert(&dest.at(42) == node_value);
+
+        pmr::map<int, int> more{&first};
+        for (int i = 95; i < 105; ++i) {
+            more.emplace(i, -i);
+        }
+
+        const int* const moved_value = &more.at(100);
+        stdext::pmr::adopt(dest, more); // the nodes are relinked; duplicate keys stay behind
+        assert(dest.size() == 105 && more.size() == 5);
+        assert(&dest.at(100) == moved_value && dest.at(95) == 95);
+    }
+
+    {
+        pmr::unordered_multiset<int> source{&second};
+        pmr::unordered_multiset<int> dest{&first};
+        dest.insert(1);
+        source.insert({1, 2, 3});
+        stdext::pmr::adopt(dest, source);
+        assert(source.empty() && dest.size() == 4 && dest.count(1) == 2);
+    }
+
+    {
+        arena_resource late{pmr::new_delete_resource(), opts};
+        assert(late.is_equal(first) && group.contains(late));
+    }
+    assert(group.contains(first) && group.contains(second)); // the list survives unlinking
+
+    group.reset();
+    group.release();
+    assert(first.capacity() == 0 && second.capacity() == 0);
+}
+
+int main() {
+    test_reset_keeps_blocks();
+    test_options();
+    test_initial_buffer();
+    test_group();
+
+    arena_resource defaulted;
+    assert(defaulted.upstream_resource() == pmr::get_default_resource());
+    assert(defaulted.is_equal(defaulted));
+}
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <async_file>
+#include <coroutine_task>
+
+#ifdef __cpp_lib_coroutine
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::async_file;
+using stdext::task;
+
+STATIC_ASSERT(!is_copy_constructible_v<async_file>);
+STATIC_ASSERT(is_nothrow_move_constructible_v<async_file>);
+STATIC_ASSERT(is_nothrow_move_assignable_v<async_file>);
+
+const char message[] = "the quick brown fox jumps over the lazy dog";
+
+task<void> write_and_read(async_file& file) {
+    assert(co_await file.write_at(0, as_bytes(span{message})) == sizeof(message));
+    assert(file.size() == sizeof(message));
+
+    byte whole[sizeof(message)];
+    assert(co_await file.read_at(0, span{whole}) == sizeof(message));
+    assert(memcmp(whole, message, sizeof(message)) == 0);
+
+    // reads at the end of the file are short, and past it are empty
+    byte tail[16];
+    assert(co_await file.read_at(sizeof(message) - 4, span{tail}) == 4);
+    assert(memcmp(tail, "dog", 4) == 0);
+    assert(co_await file.read_at(1000, span{tail}) == 0);
+}
+
+task<void> scatter_and_gather(async_file& file) {
+    // each buffer gets the next bytes of the file
+    byte first[3];
+    byte second[6];
+    byte rest[100];
+    const span<byte> scattered[] = {first, second, rest};
+    assert(co_await file.read_at(4, span{scattered}) == sizeof(message) - 4);
+    assert(memcmp(first, "qui", 3) == 0);
+    assert(memcmp(second, "ck bro", 6) == 0);
+    assert(memcmp(rest, "wn fox", 6) == 0);
+
+    const span<const byte> gathered[] = {as_bytes(span{"cat", 3}), as_bytes(span{"s!", 2}), {}};
+    assert(co_await file.write_at(sizeof(message) + 1, span{gathered}) == 5);
+    assert(file.size() == sizeof(message) + 6);
+
+    byte appended[5];
+    assert(co_await file.read_at(sizeof(message) + 1, span{appended}) == 5);
+    assert(memcmp(appended, "cats!", 5) == 0);
+
+    const span<byte> nothing[] = {span<byte>{}};
+    assert(co_await file.read_at(0, span{nothing}) == 0);
+}
+
+task<void> many_in_flight(async_file& file) {
+    // enough buffers that some requests finish on the thread pool while others are still being started
+    vector<vector<byte>> buffers(64, vector<byte>(4096));
+    for (size_t idx = 0; idx < buffers.size(); ++idx) {
+        for (auto& b : buffers[idx]) {
+            b = static_cast<byte>(idx);
+        }
+    }
+
+    vector<span<const byte>> gathered(buffers.begin(), buffers.end());
+    assert(co_await file.write_at(0, span{gathered}) == 64 * 4096);
+
+    vector<byte> whole(64 * 4096);
+    assert(co_await file.read_at(0, span{whole}) == whole.size());
+    for (size_t idx = 0; idx < whole.size(); ++idx) {
+        assert(whole[idx] == static_cast<byte>(idx / 4096));
+    }
+}
+
+task<void> read_only(async_file& file) {
+    try {
+        (void) co_await file.write_at(0, as_bytes(span{message}));
+        assert(false);
+    } catch (const system_error& e) {
+        assert(e.code().value() == 5); // ERROR_ACCESS_DENIED
+    }
+}
+
+int main() {
+    const auto name = filesystem::temp_directory_path() / "VSO_0000000_async_file.txt";
+
+    {
+        async_file file(name, async_file::open_mode::truncate);
+        assert(file.is_open());
+        stdext::sync_wait(write_and_read(file));
+        stdext::sync_wait(scatter_and_gather(file));
+    }
+
+    {
+        async_file file;
+        file.open(name, async_file::open_mode::read_write);
+        assert(file.size() == sizeof(message) + 6); // read_write keeps the contents
+        stdext::sync_wait(many_in_flight(file));
+
+        async_file moved = move(file);
+        assert(!file.is_open() && moved.is_open());
+        moved.close();
+        assert(!moved.is_open());
+    }
+
+    {
+        async_file file(name);
+        assert(file.size() == 64 * 4096);
+        stdext::sync_wait(read_only(file));
+    }
+
+    filesystem::remove(name);
+    try {
+        async_file missing(name);
+        assert(false);
+    } catch (const system_error& e) {
+        assert(e.code().value() == 2); // ERROR_FILE_NOT_FOUND
+    }
+}
+#else // ^^^ __cpp_lib_coroutine / no __cpp_lib_coroutine vvv
+int main() {}
+#endif // ^^^ no __cpp_lib_coroutine ^^^
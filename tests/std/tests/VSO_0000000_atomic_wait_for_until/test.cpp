@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <thread>
+
+using namespace std;
+using namespace std::chrono_literals;
+
+using stdext::atomic_wait_for;
+using stdext::atomic_wait_until;
+
+struct three_bytes { // not lock-free, so waits go through __std_atomic_wait_indirect
+    char a;
+    char b;
+    char c;
+
+    friend bool operator==(const three_bytes&, const three_bytes&) = default;
+};
+
+struct padded_large { // not lock-free, and has padding bits that the comparisons must ignore
+    char tag;
+    long long values[3];
+
+    friend bool operator==(const padded_large&, const padded_large&) = default;
+};
+
+template <class T>
+void test_timeouts(const T old_value, const T new_value) {
+    atomic<T> a{old_value};
+
+    // the value is checked before the deadline
+    assert(!atomic_wait_for(a, old_value, 0ms));
+    assert(!atomic_wait_for(a, old_value, -1s));
+    assert(atomic_wait_for(a, new_value, 0ms));
+    assert(atomic_wait_for(a, new_value, -1s, memory_order_acquire));
+    assert(!atomic_wait_until(a, old_value, chrono::steady_clock::now()));
+    assert(!atomic_wait_until(a, old_value, chrono::system_clock::now() - 1h));
+    assert(atomic_wait_until(a, new_value, chrono::steady_clock::now() - 1h));
+
+    // a wait that nobody ends times out; wait_for measures with the tick count, so only wait_until is exact
+    assert(!atomic_wait_for(a, old_value, 30ms));
+
+    const auto start = chrono::steady_clock::now();
+    assert(!atomic_wait_until(a, old_value, start + 30ms, memory_order_relaxed));
+    assert(chrono::steady_clock::now() >= start + 30ms);
+
+    // a notified change ends the wait early
+    thread t([&] {
+        this_thread::sleep_for(20ms);
+        a.store(new_value);
+        a.notify_all();
+    });
+
+    assert(atomic_wait_for(a, old_value, 1h));
+    assert(a.load() == new_value);
+    t.join();
+
+    a.store(old_value);
+    thread u([&] {
+        this_thread::sleep_for(20ms);
+        a.store(new_value);
+        a.notify_one();
+    });
+
+    assert(atomic_wait_until(a, old_value, chrono::steady_clock::now() + 1h));
+    u.join();
+
+    // so does one for std::atomic::wait, which shares the implementation
+    a.store(old_value);
+    thread v([&] {
+        this_thread::sleep_for(20ms);
+        a.store(new_value);
+        a.notify_one();
+    });
+
+    a.wait(old_value);
+    assert(a.load() == new_value);
+    v.join();
+}
+
+int some_object;
+
+int main() {
+    test_timeouts<char>('a', 'b');
+    test_timeouts<short>(1, 2);
+    test_timeouts<int>(1, 2);
+    test_timeouts<long long>(1, 2);
+    test_timeouts<bool>(false, true);
+    test_timeouts<double>(1.5, 2.5);
+    test_timeouts<void*>(nullptr, &some_object);
+    test_timeouts<three_bytes>({'a', 'b', 'c'}, {'a', 'b', 'd'});
+    test_timeouts<padded_large>({'a', {1, 2, 3}}, {'a', {1, 2, 4}});
+}
@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <any>
+#include <assert.h>
+#include <stddef.h>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+using namespace std;
+using stdext::any_cast;
+using stdext::basic_any;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(basic_any<64>::capacity == 64);
+STATIC_ASSERT(sizeof(basic_any<64>) == 64 + 2 * sizeof(void*));
+STATIC_ASSERT(sizeof(basic_any<>) == sizeof(any));
+STATIC_ASSERT(alignof(basic_any<64>) >= alignof(max_align_t));
+STATIC_ASSERT(is_nothrow_move_constructible_v<basic_any<64>>);
+
+// a nontrivial type that does not fit in std::any without allocating
+struct property {
+    string name;
+    string value;
+    size_t extra[2];
+
+    property(const char* const n, const char* const v) : name(n), value(v), extra{} {}
+};
+STATIC_ASSERT(sizeof(property) > std::_Any_small_space_size);
+STATIC_ASSERT(sizeof(property) <= 96);
+
+struct too_big {
+    unsigned char data[200];
+};
+
+template <class T, size_t N>
+bool is_inline(basic_any<N>& a) {
+    const auto p       = reinterpret_cast<const unsigned char*>(any_cast<T>(&a));
+    const auto storage = reinterpret_cast<const unsigned char*>(&a);
+    return p >= storage && p < storage + sizeof(a);
+}
+
+void test_representations() {
+    basic_any<96> a;
+    assert(!a.has_value());
+    assert(a.type() == typeid(void));
+
+    a = 42;
+    assert(a.type() == typeid(int));
+    assert(any_cast<int>(a) == 42);
+    assert(is_inline<int>(a));
+
+    a.emplace<property>("color", "blue");
+    assert(a.type() == typeid(property));
+    assert(any_cast<property&>(a).value == "blue");
+    assert(is_inline<property>(a));
+
+    a = too_big{{7}};
+    assert(any_cast<const too_big&>(a).data[0] == 7);
+    assert(!is_inline<too_big>(a));
+
+    a.reset();
+    assert(!a.has_value());
+}
+
+void test_copies_and_moves() {
+    basic_any<96> a{in_place_type<property>, "shape", "round"};
+    basic_any<96> b = a;
+    assert(any_cast<property&>(b).value == "round");
+    assert(any_cast<property&>(a).value == "round");
+
+    basic_any<96> c = move(b);
+    assert(any_cast<property&>(c).name == "shape");
+
+    basic_any<96> d{too_big{{3}}};
+    swap(c, d);
+    assert(any_cast<too_big&>(c).data[0] == 3);
+    assert(any_cast<property&>(d).name == "shape");
+
+    c = d;
+    assert(any_cast<property&>(c).name == "shape");
+
+    const basic_any<96>& cref = c;
+    assert(any_cast<property>(&cref) != nullptr);
+    assert(any_cast<int>(&cref) == nullptr);
+    assert(any_cast<string>(basic_any<96>{string{"moved"}}) == "moved");
+}
+
+void test_bad_cast() {
+    basic_any<64> a{1.5};
+    try {
+        (void) any_cast<int>(a);
+        assert(false);
+    } catch (const bad_any_cast&) {
+    }
+}
+
+int main() {
+    test_representations();
+    test_copies_and_moves();
+    test_bad_cast();
+}
@@ -0,0 +1,208 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <bounded_queue>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::mpmc_queue;
+using stdext::spsc_queue;
+
+STATIC_ASSERT(!is_copy_constructible_v<spsc_queue<int>>);
+STATIC_ASSERT(!is_copy_assignable_v<spsc_queue<int>>);
+STATIC_ASSERT(!is_copy_constructible_v<mpmc_queue<int>>);
+STATIC_ASSERT(!is_copy_assignable_v<mpmc_queue<int>>);
+
+struct live_counter {
+    static int live;
+
+    int value;
+
+    explicit live_counter(const int v = 0) noexcept : value(v) {
+        ++live;
+    }
+
+    live_counter(const live_counter& other) noexcept : value(other.value) {
+        ++live;
+    }
+
+    live_counter& operator=(const live_counter&) = default;
+
+    ~live_counter() {
+        --live;
+    }
+};
+
+int live_counter::live = 0;
+
+template <template <class...> class Queue>
+void test_single_thread(const size_t min_capacity) {
+    Queue<int> q(5);
+    assert(q.capacity() == 8);
+    assert(q.empty());
+
+    for (int i = 0; i < 8; ++i) {
+        assert(q.try_push(i));
+    }
+
+    assert(!q.try_push(8));
+    assert(!q.try_emplace(8));
+    assert(q.size() == 8);
+
+    int out = -1;
+    for (int i = 0; i < 3; ++i) {
+        assert(q.try_pop(out));
+        assert(out == i);
+    }
+
+    for (int i = 8; i < 11; ++i) { // wraps around
+        q.push(i);
+    }
+
+    for (int i = 3; i < 11; ++i) {
+        q.pop(out);
+        assert(out == i);
+    }
+
+    assert(!q.try_pop(out));
+    assert(q.empty());
+
+    assert(Queue<int>(0).capacity() == min_capacity);
+    assert(Queue<int>(1).capacity() == min_capacity);
+
+    try {
+        Queue<int> huge(static_cast<size_t>(-1));
+        assert(false);
+    } catch (const length_error&) {
+    }
+
+    {
+        Queue<live_counter> counters(4);
+        counters.emplace(1);
+        assert(counters.try_push(live_counter{2}));
+        assert(counters.try_emplace(3));
+        live_counter popped;
+        assert(counters.try_pop(popped));
+        assert(popped.value == 1);
+        assert(live_counter::live == 3);
+    } // destroys the elements still queued
+
+    assert(live_counter::live == 0);
+
+    Queue<unique_ptr<int>> move_only(2);
+    move_only.push(make_unique<int>(42));
+    unique_ptr<int> owner;
+    move_only.pop(owner);
+    assert(*owner == 42);
+
+    Queue<vector<int>> vectors(2); // constructors that may throw
+    vectors.emplace(3, 7);
+    assert(vectors.try_emplace(2, 1));
+    vector<int> front;
+    vectors.pop(front);
+    assert(front == vector<int>(3, 7));
+}
+
+void test_spsc_threads() {
+    // the consumer sees the producer's elements in order; a small capacity makes both sides block
+    constexpr int count = 100000;
+    for (const size_t capacity : {size_t{1}, size_t{2}, size_t{64}}) {
+        spsc_queue<int> q(capacity);
+        thread producer([&] {
+            for (int i = 0; i < count; ++i) {
+                q.push(i);
+            }
+        });
+
+        for (int i = 0; i < count; ++i) {
+            int out;
+            if (i % 2 == 0) {
+                q.pop(out);
+            } else {
+                while (!q.try_pop(out)) {
+                    this_thread::yield();
+                }
+            }
+
+            assert(out == i);
+        }
+
+        producer.join();
+        assert(q.empty());
+    }
+}
+
+void test_mpmc_threads() {
+    // every element is popped exactly once, and each producer's elements are popped in the order pushed
+    constexpr int producer_count = 4;
+    constexpr int consumer_count = 4;
+    constexpr int per_producer   = 20000;
+    for (const size_t capacity : {size_t{2}, size_t{64}}) {
+        mpmc_queue<pair<int, int>> q(capacity);
+        vector<vector<int>> seen(consumer_count * producer_count);
+        vector<thread> threads;
+        for (int p = 0; p < producer_count; ++p) {
+            threads.emplace_back([&q, p] {
+                for (int i = 0; i < per_producer; ++i) {
+                    if (i % 2 == 0) {
+                        q.emplace(p, i);
+                    } else {
+                        while (!q.try_push(pair<int, int>{p, i})) {
+                            this_thread::yield();
+                        }
+                    }
+                }
+            });
+        }
+
+        atomic<int> remaining{producer_count * per_producer};
+        for (int c = 0; c < consumer_count; ++c) {
+            threads.emplace_back([&, c] {
+                pair<int, int> out;
+                while (remaining.fetch_sub(1) > 0) {
+                    q.pop(out);
+                    seen[static_cast<size_t>(c * producer_count + out.first)].push_back(out.second);
+                }
+            });
+        }
+
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        assert(q.empty());
+        vector<int> popped(producer_count);
+        for (int c = 0; c < consumer_count; ++c) {
+            for (int p = 0; p < producer_count; ++p) {
+                const auto& values = seen[static_cast<size_t>(c * producer_count + p)];
+                for (size_t i = 1; i < values.size(); ++i) {
+                    assert(values[i - 1] < values[i]);
+                }
+
+                popped[static_cast<size_t>(p)] += static_cast<int>(values.size());
+            }
+        }
+
+        for (const int n : popped) {
+            assert(n == per_producer);
+        }
+    }
+}
+
+int main() {
+    test_single_thread<spsc_queue>(1);
+    test_single_thread<mpmc_queue>(2);
+    test_spsc_threads();
+    test_mpmc_threads();
+}
@@ -0,0 +1,127 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::cached_allocator;
+using stdext::cached_allocator_stats;
+using stdext::release_cached_allocations;
+
+STATIC_ASSERT(allocator_traits<cached_allocator<int>>::is_always_equal::value);
+STATIC_ASSERT(is_same_v<allocator_traits<cached_allocator<int>>::rebind_alloc<char>, cached_allocator<char>>);
+
+struct alignas(128) OverAligned {
+    char data[128];
+};
+
+void test_small_allocations_bypass_cache() {
+    release_cached_allocations();
+    const auto before = cached_allocator_stats();
+
+    cached_allocator<char> al;
+    char* const p = al.allocate(100);
+    al.deallocate(p, 100);
+
+    const auto after = cached_allocator_stats();
+    assert(after.hits == before.hits);
+    assert(after.misses == before.misses);
+    assert(after.cached_bytes == 0);
+}
+
+void test_recycling() {
+    release_cached_allocations();
+    const auto before = cached_allocator_stats();
+
+    cached_allocator<char> al;
+    char* const p1 = al.allocate(5000);
+    assert(reinterpret_cast<uintptr_t>(p1) % 64 == 0);
+    al.deallocate(p1, 5000);
+    assert(cached_allocator_stats().cached_bytes == 5120);
+
+    // 4097 through 5120 bytes share a size class, so the block is reused
+    char* const p2 = al.allocate(4500);
+    assert(p2 == p1);
+    assert(cached_allocator_stats().cached_bytes == 0);
+    al.deallocate(p2, 4500);
+
+    const auto after = cached_allocator_stats();
+    assert(after.hits - before.hits == 1);
+    assert(after.misses - before.misses == 1);
+    assert(after.hit_rate() > 0.0 && after.hit_rate() <= 1.0);
+
+    release_cached_allocations();
+    assert(cached_allocator_stats().cached_bytes == 0);
+}
+
+void test_vector_growth() {
+    release_cached_allocations();
+    const auto before = cached_allocator_stats();
+
+    for (int round = 0; round < 10; ++round) {
+        vector<int, cached_allocator<int>> v;
+        for (int i = 0; i < 100000; ++i) {
+            v.push_back(i);
+        }
+
+        for (int i = 0; i < 100000; ++i) {
+            assert(v[static_cast<size_t>(i)] == i);
+        }
+    }
+
+    // every round after the first finds the blocks freed by the previous one
+    const auto after = cached_allocator_stats();
+    assert(after.hits - before.hits > after.misses - before.misses);
+
+    basic_string<char, char_traits<char>, cached_allocator<char>> s(10000, 'x');
+    s += s;
+    assert(s.size() == 20000);
+
+    release_cached_allocations();
+}
+
+void test_over_aligned_bypasses_cache() {
+    release_cached_allocations();
+    const auto before = cached_allocator_stats();
+
+    cached_allocator<OverAligned> al;
+    OverAligned* const p = al.allocate(64);
+    assert(reinterpret_cast<uintptr_t>(p) % alignof(OverAligned) == 0);
+    al.deallocate(p, 64);
+
+    const auto after = cached_allocator_stats();
+    assert(after.hits == before.hits);
+    assert(after.misses == before.misses);
+}
+
+void test_cross_thread_deallocation() {
+    release_cached_allocations();
+
+    cached_allocator<char> al;
+    char* const p = al.allocate(100000);
+    thread([&] {
+        al.deallocate(p, 100000);
+        assert(cached_allocator_stats().cached_bytes >= 100000);
+        // the thread's cache is released when it exits
+    }).join();
+
+    assert(cached_allocator_stats().cached_bytes == 0);
+}
+
+int main() {
+    test_small_allocations_bypass_cache();
+    test_recycling();
+    test_vector_growth();
+    test_over_aligned_bypasses_cache();
+    test_cross_thread_deallocation();
+}
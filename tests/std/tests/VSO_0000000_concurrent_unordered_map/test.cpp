@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <concurrent_unordered_map>
+#include <execution>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::concurrent_unordered_map;
+
+using int_map = concurrent_unordered_map<int, int>;
+
+void test_shard_count() {
+    assert(int_map(1).shard_count() == 1);
+    assert(int_map(5).shard_count() == 8);
+    assert(int_map(64).shard_count() == 64);
+
+    const int_map defaulted;
+    assert(defaulted.shard_count() >= 4);
+    assert(defaulted.empty() && defaulted.size() == 0);
+}
+
+void test_single_thread() {
+    concurrent_unordered_map<string, int> m(4);
+    assert(m.insert_or_assign("meow", 1));
+    assert(!m.insert_or_assign("meow", 2));
+    assert(m.try_emplace("purr", 3));
+    assert(!m.try_emplace("purr", 4));
+    assert(m.size() == 2 && m.contains("meow") && !m.contains("hiss"));
+
+    int seen = 0;
+    assert(as_const(m).find_and_visit("meow", [&](const pair<const string, int>& kv) { seen = kv.second; }));
+    assert(seen == 2);
+    assert(m.find_and_visit("purr", [](pair<const string, int>& kv) { kv.second *= 10; }));
+    assert(m.find_and_visit("purr", [&](const pair<const string, int>& kv) { seen = kv.second; }));
+    assert(seen == 30);
+    assert(!m.find_and_visit("hiss", [](auto&) { assert(false); }));
+
+    assert(m.erase("meow") == 1);
+    assert(m.erase("meow") == 0);
+    m.clear();
+    assert(m.empty());
+}
+
+void test_concurrent_writers() {
+    constexpr int threads_count = 8;
+    constexpr int keys          = 10'000;
+
+    int_map m(16);
+    m.reserve(keys);
+    vector<thread> threads;
+    for (int t = 0; t < threads_count; ++t) {
+        threads.emplace_back([&m] {
+            for (int key = 0; key < keys; ++key) {
+                (void) m.try_emplace(key, 0);
+                (void) m.find_and_visit(key, [](pair<const int, int>& kv) { ++kv.second; });
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(m.size() == keys);
+    long long total = 0;
+    m.for_each([&](const pair<const int, int>& kv) { total += kv.second; });
+    assert(total == static_cast<long long>(keys) * threads_count);
+
+    atomic<long long> key_sum{0};
+    as_const(m).for_each(execution::par, [&](const pair<const int, int>& kv) { key_sum += kv.first; });
+    assert(key_sum == static_cast<long long>(keys) * (keys - 1) / 2);
+
+    m.for_each(execution::par, [](pair<const int, int>& kv) { kv.second = kv.first; });
+    assert(m.find_and_visit(1729, [](const pair<const int, int>& kv) { assert(kv.second == 1729); }));
+
+    assert(m.erase_if([](const pair<const int, int>& kv) { return kv.first % 2 == 0; }) == keys / 2);
+    assert(m.size() == keys / 2 && !m.contains(42) && m.contains(43));
+}
+
+int main() {
+    test_shard_count();
+    test_single_thread();
+    test_concurrent_writers();
+}
@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _ENABLE_CONDITION_VARIABLE_ANY_WAIT_ON_ADDRESS
+
+#include <assert.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::chrono;
+
+static_assert(sizeof(condition_variable_any) == sizeof(unsigned long), "only the generation counter is stored");
+
+void test_notify_all() {
+    condition_variable_any cv;
+    mutex m;
+    int ready = 0;
+
+    vector<thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            unique_lock<mutex> lck(m);
+            cv.wait(lck, [&] { return ready != 0; });
+        });
+    }
+
+    {
+        lock_guard<mutex> lck(m);
+        ready = 1;
+    }
+
+    cv.notify_all();
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void test_notify_one_with_shared_lock() {
+    condition_variable_any cv;
+    shared_timed_mutex m;
+    int tickets = 0;
+    int served  = 0;
+
+    vector<thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] {
+            unique_lock<shared_timed_mutex> lck(m);
+            cv.wait(lck, [&] { return tickets != 0; });
+            --tickets;
+            ++served;
+        });
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        {
+            lock_guard<shared_timed_mutex> lck(m);
+            ++tickets;
+        }
+
+        cv.notify_one();
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(served == 4 && tickets == 0);
+}
+
+void test_timeouts() {
+    condition_variable_any cv;
+    mutex m;
+    unique_lock<mutex> lck(m);
+
+    const auto start = steady_clock::now();
+    assert(cv.wait_for(lck, 20ms) == cv_status::timeout);
+    assert(steady_clock::now() - start >= 20ms);
+    assert(lck.owns_lock());
+
+    assert(cv.wait_for(lck, -1ms) == cv_status::timeout);
+    assert(cv.wait_until(lck, steady_clock::now() - 1s) == cv_status::timeout);
+    assert(!cv.wait_until(lck, system_clock::now() + 10ms, [] { return false; }));
+    assert(cv.wait_for(lck, 10ms, [] { return true; }));
+    assert(lck.owns_lock());
+}
+
+void test_destroy_after_notify() {
+    // the condition_variable_any may be destroyed once all of its waiters are notified, before they've returned
+    mutex m;
+    for (int i = 0; i < 1000; ++i) {
+        auto cv      = make_unique<condition_variable_any>();
+        bool waiting = false;
+        bool done    = false;
+        thread waiter([&m, &waiting, &done, raw = cv.get()] {
+            unique_lock<mutex> lck(m);
+            waiting = true; // m is held until the wait begins
+            raw->wait(lck, [&] { return done; });
+        });
+
+        for (;;) {
+            lock_guard<mutex> lck(m);
+            if (waiting) {
+                done = true;
+                break;
+            }
+        }
+
+        cv->notify_all();
+        cv.reset();
+        waiter.join();
+    }
+}
+
+#if _HAS_CXX20
+void test_stop_token() {
+    condition_variable_any cv;
+    mutex m;
+
+    stop_source untimed;
+    thread waiter([&] {
+        unique_lock<mutex> lck(m);
+        assert(!cv.wait(lck, untimed.get_token(), [] { return false; }));
+    });
+    this_thread::sleep_for(10ms);
+    untimed.request_stop();
+    waiter.join();
+
+    stop_source timed;
+    thread timed_waiter([&] {
+        unique_lock<mutex> lck(m);
+        assert(!cv.wait_for(lck, timed.get_token(), 1h, [] { return false; }));
+    });
+    this_thread::sleep_for(10ms);
+    timed.request_stop();
+    timed_waiter.join();
+}
+#endif // _HAS_CXX20
+
+int main() {
+    test_notify_all();
+    test_notify_one_with_shared_lock();
+    test_timeouts();
+    test_destroy_after_notify();
+#if _HAS_CXX20
+    test_stop_token();
+#endif // _HAS_CXX20
+}
@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <parallel_walk>
+#include <string>
+#include <system_error>
+#include <thread_pool>
+
+using namespace std;
+using namespace std::filesystem;
+
+using stdext::thread_pool;
+using stdext::filesystem::copy_file_ex;
+using stdext::filesystem::copy_file_flags;
+using stdext::filesystem::parallel_copy;
+
+const path root = "VSO_0000000_copy_file_ex_test";
+
+void write_file(const path& p, const string& contents) {
+    ofstream{p, ios::binary} << contents;
+}
+
+string read_file(const path& p) {
+    ifstream in{p, ios::binary};
+    return string{istreambuf_iterator<char>{in}, istreambuf_iterator<char>{}};
+}
+
+void test_copy_file_ex() {
+    const string contents(100'000, 'm');
+    const path from = root / "from.txt";
+    const path to   = root / "to.txt";
+    write_file(from, contents);
+
+    assert(copy_file_ex(from, to));
+    assert(read_file(to) == contents);
+
+    error_code ec;
+    assert(!copy_file_ex(from, to, copy_options::none, copy_file_flags::none, ec));
+    assert(ec);
+    assert(!copy_file_ex(from, to, copy_options::skip_existing, copy_file_flags::none, ec));
+    assert(!ec);
+
+    try {
+        (void) copy_file_ex(from, to);
+        assert(false);
+    } catch (const filesystem_error& e) {
+        assert(e.path1() == from && e.path2() == to);
+    }
+
+    write_file(from, "purr");
+    assert(copy_file_ex(from, to, copy_options::overwrite_existing, copy_file_flags::unbuffered_large_files, ec));
+    assert(!ec);
+    assert(read_file(to) == "purr");
+}
+
+void test_progress() {
+    const string contents(1'000'000, 'p');
+    const path from = root / "progress_from.txt";
+    const path to   = root / "progress_to.txt";
+    write_file(from, contents);
+
+    const copy_file_flags all_flags = copy_file_flags::clone_blocks | copy_file_flags::unbuffered_large_files;
+    for (const auto flags : {copy_file_flags::none, all_flags}) {
+        uintmax_t last_copied = 0;
+        uintmax_t last_total  = 0;
+        int calls             = 0;
+        const auto progress   = [&](const uintmax_t copied, const uintmax_t total) {
+            assert(copied >= last_copied && copied <= total);
+            last_copied = copied;
+            last_total  = total;
+            ++calls;
+        };
+
+        assert(copy_file_ex(from, to, copy_options::overwrite_existing, flags, progress));
+        assert(calls != 0);
+        assert(last_copied == contents.size() && last_total == contents.size());
+        assert(read_file(to) == contents);
+    }
+
+    // returning false cancels the copy and leaves no target behind
+    remove(to);
+    error_code ec;
+    assert(!copy_file_ex(from, to, copy_options::none, copy_file_flags::clone_blocks,
+        [](uintmax_t, uintmax_t) { return false; }, ec));
+    assert(ec.value() == 1235); // ERROR_REQUEST_ABORTED
+    assert(!exists(to));
+}
+
+void make_tree(const path& dir, const int depth) {
+    create_directory(dir);
+    for (int i = 0; i < 3; ++i) {
+        write_file(dir / ("file" + to_string(i) + ".txt"), string(static_cast<size_t>(i) * 1000, 'x'));
+    }
+
+    if (depth != 0) {
+        for (int i = 0; i < 3; ++i) {
+            make_tree(dir / ("dir" + to_string(i)), depth - 1);
+        }
+    }
+}
+
+void assert_same_tree(const path& from, const path& to) {
+    int entries = 0;
+    for (const auto& entry : recursive_directory_iterator(from)) {
+        const path copy = to / entry.path().lexically_relative(from);
+        if (entry.is_directory()) {
+            assert(is_directory(copy));
+        } else {
+            assert(read_file(copy) == read_file(entry.path()));
+        }
+
+        ++entries;
+    }
+
+    for (const auto& entry : recursive_directory_iterator(to)) {
+        (void) entry;
+        --entries;
+    }
+
+    assert(entries == 0);
+}
+
+void test_parallel_copy() {
+    const path tree = root / "tree";
+    make_tree(tree, 3);
+
+    parallel_copy(tree, root / "copy");
+    assert_same_tree(tree, root / "copy");
+
+    thread_pool pool(4);
+    parallel_copy(tree, root / "pool_copy", copy_options::none, copy_file_flags::none, pool, 2);
+    assert_same_tree(tree, root / "pool_copy");
+
+    // an existing file in the destination is an error, as it is for copy
+    try {
+        parallel_copy(tree, root / "copy", copy_options::none);
+        assert(false);
+    } catch (const filesystem_error&) {
+    }
+
+    parallel_copy(tree, root / "copy", copy_options::skip_existing);
+
+    // directories_only copies just the directory structure
+    parallel_copy(tree, root / "dirs", copy_options::directories_only);
+    assert(is_directory(root / "dirs" / "dir1" / "dir2" / "dir0"));
+    assert(!exists(root / "dirs" / "file1.txt"));
+
+    // a file copies like copy_file
+    parallel_copy(tree / "file2.txt", root / "single.txt", copy_options::none);
+    assert(read_file(root / "single.txt") == string(2000, 'x'));
+}
+
+int main() {
+    remove_all(root);
+    create_directory(root);
+
+    test_copy_file_ex();
+    test_progress();
+    test_parallel_copy();
+
+    remove_all(root);
+}
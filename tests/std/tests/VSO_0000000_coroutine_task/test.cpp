@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <coroutine_task>
+
+#ifdef __cpp_lib_coroutine
+#include <cassert>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::task;
+
+STATIC_ASSERT(!is_copy_constructible_v<task<int>>);
+STATIC_ASSERT(!is_copy_assignable_v<task<int>>);
+STATIC_ASSERT(is_nothrow_move_constructible_v<task<int>>);
+STATIC_ASSERT(is_nothrow_move_assignable_v<task<void>>);
+
+class counting_resource : public pmr::memory_resource {
+public:
+    int allocations   = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        ++allocations;
+        return pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        ++deallocations;
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+task<int> answer() {
+    co_return 42;
+}
+
+task<int> add(const int lhs, task<int> rhs) {
+    co_return lhs + co_await move(rhs);
+}
+
+task<string> on_pool(const thread::id caller) {
+    co_await stdext::schedule();
+    assert(this_thread::get_id() != caller);
+    co_return string{"meow"};
+}
+
+task<void> thrower() {
+    throw runtime_error{"woof"};
+    co_return;
+}
+
+task<int&> reference(int& target) {
+    co_return target;
+}
+
+task<unique_ptr<int>> move_only() {
+    co_return make_unique<int>(1729);
+}
+
+task<int> depth(const int n) {
+    if (n == 0) {
+        co_return 0;
+    }
+
+    co_return 1 + co_await depth(n - 1);
+}
+
+task<int> doubled(allocator_arg_t, pmr::memory_resource*, const int value) {
+    co_return value * 2;
+}
+
+struct widget {
+    int base;
+
+    task<int> get(allocator_arg_t, pmr::memory_resource*) const {
+        co_return base;
+    }
+};
+
+task<int> fan_out() {
+    int sum = 0;
+    for (int i = 0; i < 100; ++i) {
+        co_await stdext::schedule();
+        sum += co_await add(i, answer());
+    }
+
+    co_return sum;
+}
+
+int main() {
+    assert(stdext::sync_wait(answer()) == 42);
+    assert(stdext::sync_wait(add(1, answer())) == 43);
+    assert(stdext::sync_wait(on_pool(this_thread::get_id())) == "meow");
+    assert(*stdext::sync_wait(move_only()) == 1729);
+
+    try {
+        stdext::sync_wait(thrower());
+        assert(false);
+    } catch (const runtime_error&) {
+    }
+
+    int target = 5;
+    assert(&stdext::sync_wait(reference(target)) == &target);
+
+    // each completed task resumes its awaiter by symmetric transfer, so a long chain doesn't grow the stack
+    assert(stdext::sync_wait(depth(100000)) == 100000);
+
+    {
+        counting_resource resource;
+        assert(stdext::sync_wait(doubled(allocator_arg, &resource, 21)) == 42);
+        const widget w{7};
+        assert(stdext::sync_wait(w.get(allocator_arg, &resource)) == 7);
+        assert(resource.allocations == 2);
+        assert(resource.deallocations == 2);
+    }
+
+    {
+        task<int> unstarted = answer(); // destroyed without ever running
+        task<int> moved     = move(unstarted);
+        assert(!unstarted);
+        assert(moved);
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        assert(stdext::sync_wait(fan_out()) == 100 * 42 + 4950);
+    }
+}
+#else // ^^^ __cpp_lib_coroutine / no __cpp_lib_coroutine vvv
+int main() {}
+#endif // ^^^ no __cpp_lib_coroutine ^^^
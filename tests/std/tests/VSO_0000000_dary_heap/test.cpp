@@ -0,0 +1,273 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <dary_heap>
+#include <functional>
+#include <queue>
+#include <random>
+#include <stddef.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::addressable_priority_queue;
+using stdext::d_ary_priority_queue;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(d_ary_priority_queue<int>::arity == 4);
+STATIC_ASSERT(addressable_priority_queue<int>::arity == 4);
+
+mt19937 gen(1729);
+
+vector<int> random_values(const size_t count) {
+    uniform_int_distribution<int> dist(0, static_cast<int>(count / 2)); // plenty of duplicates
+    vector<int> v(count);
+    for (auto& x : v) {
+        x = dist(gen);
+    }
+
+    return v;
+}
+
+template <size_t Arity>
+void test_algorithms() {
+    for (size_t count = 0; count < 70; ++count) {
+        auto v        = random_values(count);
+        auto expected = v;
+        sort(expected.begin(), expected.end());
+
+        stdext::make_dary_heap<Arity>(v.begin(), v.end());
+        assert(stdext::is_dary_heap<Arity>(v.begin(), v.end()));
+        assert(stdext::is_dary_heap_until<Arity>(v.begin(), v.end()) == v.end());
+        if (!v.empty()) {
+            assert(v.front() == expected.back());
+        }
+
+        auto copy = v;
+        stdext::sort_dary_heap<Arity>(copy.begin(), copy.end());
+        assert(copy == expected);
+
+        // rebuild by pushing one element at a time, then pop everything
+        vector<int> heap;
+        for (const int x : v) {
+            heap.push_back(x);
+            stdext::push_dary_heap<Arity>(heap.begin(), heap.end());
+            assert(stdext::is_dary_heap<Arity>(heap.begin(), heap.end()));
+        }
+
+        for (auto last = heap.end(); last != heap.begin(); --last) {
+            stdext::pop_dary_heap<Arity>(heap.begin(), last);
+            assert(stdext::is_dary_heap<Arity>(heap.begin(), last - 1));
+        }
+
+        assert(heap == expected);
+
+        // a min-heap through the predicate
+        stdext::make_dary_heap<Arity>(heap.begin(), heap.end(), greater<>{});
+        assert(stdext::is_dary_heap<Arity>(heap.begin(), heap.end(), greater<>{}));
+        stdext::sort_dary_heap<Arity>(heap.begin(), heap.end(), greater<>{});
+        assert(is_sorted(heap.begin(), heap.end(), greater<>{}));
+    }
+
+    // is_dary_heap_until reports the first element larger than its parent
+    vector<int> v{9, 8, 7, 6, 5, 4, 3, 2, 1, 10};
+    assert(stdext::is_dary_heap_until<Arity>(v.begin(), v.end()) == v.end() - 1);
+}
+
+void test_priority_queue() {
+    d_ary_priority_queue<string> q;
+    assert(q.empty());
+    for (int i = 0; i < 100; ++i) {
+        q.push(to_string(i * 37 % 100));
+    }
+
+    q.emplace(3, 'z');
+    assert(q.size() == 101);
+    assert(q.top() == "zzz");
+    q.pop();
+
+    string previous = q.top();
+    while (!q.empty()) {
+        assert(q.top() <= previous);
+        previous = q.top();
+        q.pop();
+    }
+
+    const auto values = random_values(1000);
+    d_ary_priority_queue<int, 8, vector<int>, greater<int>> min_queue(values.begin(), values.end());
+    priority_queue<int, vector<int>, greater<int>> reference(values.begin(), values.end());
+    while (!reference.empty()) {
+        assert(min_queue.top() == reference.top());
+        min_queue.pop();
+        reference.pop();
+    }
+
+    assert(min_queue.empty());
+
+    d_ary_priority_queue<int> a(less<int>{}, vector<int>{1, 5, 3});
+    d_ary_priority_queue<int> b;
+    swap(a, b);
+    assert(a.empty());
+    assert(b.top() == 5);
+}
+
+void test_addressable_basics() {
+    addressable_priority_queue<string> q;
+    const auto apple  = q.push("apple");
+    const auto cherry = q.push("cherry");
+    const auto banana = q.emplace(6, 'b');
+    assert(q.size() == 3);
+    assert(q.top() == "cherry");
+    assert(q.top_handle() == cherry);
+    assert(q.value(banana) == "bbbbbb");
+
+    q.update(apple, "date"); // moves up
+    assert(q.top_handle() == apple);
+    q.update(apple, "aardvark"); // moves down
+    assert(q.top_handle() == cherry);
+
+    q.erase(cherry);
+    assert(!q.contains(cherry));
+    assert(q.contains(apple));
+    assert(q.top() == "bbbbbb");
+
+    const auto fig = q.push("fig"); // reuses the handle of the erased element
+    assert(fig == cherry);
+    assert(q.top() == "fig");
+
+    q.pop();
+    q.pop();
+    assert(q.size() == 1);
+    assert(q.top_handle() == apple);
+    q.clear();
+    assert(q.empty());
+    assert(!q.contains(apple));
+}
+
+void test_addressable_against_reference() {
+    // random pushes, pops, updates and erases, checked against a vector of (value, handle) pairs
+    addressable_priority_queue<int, greater<int>, 3> q;
+    vector<pair<int, size_t>> live;
+    uniform_int_distribution<int> op(0, 9);
+    uniform_int_distribution<int> value(0, 500);
+    for (int i = 0; i < 20000; ++i) {
+        const int choice = op(gen);
+        if (live.empty() || choice < 4) {
+            const int x = value(gen);
+            live.emplace_back(x, q.push(x));
+        } else if (choice < 6) {
+            const auto top = q.top_handle();
+            q.pop();
+            const auto it = find_if(live.begin(), live.end(), [&](const auto& e) { return e.second == top; });
+            assert(it != live.end());
+            live.erase(it);
+        } else {
+            const size_t index = static_cast<size_t>(value(gen)) % live.size();
+            if (choice < 9) {
+                live[index].first = value(gen);
+                q.update(live[index].second, live[index].first);
+            } else {
+                q.erase(live[index].second);
+                live.erase(live.begin() + static_cast<ptrdiff_t>(index));
+            }
+        }
+
+        assert(q.size() == live.size());
+        if (!live.empty()) {
+            assert(q.top() == min_element(live.begin(), live.end())->first);
+        }
+    }
+
+    for (const auto& e : live) {
+        assert(q.contains(e.second));
+        assert(q.value(e.second) == e.first);
+    }
+}
+
+void test_dijkstra() {
+    // shortest paths on a grid with random weights, using decrease-key instead of duplicate entries
+    constexpr size_t side  = 30;
+    constexpr size_t nodes = side * side;
+    uniform_int_distribution<int> weight(1, 9);
+    vector<int> cost(nodes);
+    for (auto& c : cost) {
+        c = weight(gen);
+    }
+
+    const auto neighbors = [&](const size_t n) {
+        vector<size_t> result;
+        if (n % side != 0) {
+            result.push_back(n - 1);
+        }
+        if (n % side != side - 1) {
+            result.push_back(n + 1);
+        }
+        if (n >= side) {
+            result.push_back(n - side);
+        }
+        if (n + side < nodes) {
+            result.push_back(n + side);
+        }
+        return result;
+    };
+
+    constexpr int unreached = 1 << 30;
+    vector<int> dist(nodes, unreached);
+    vector<size_t> handle(nodes);
+    addressable_priority_queue<pair<int, size_t>, greater<>> q;
+    dist[0]   = 0;
+    handle[0] = q.push({0, 0});
+    vector<bool> done(nodes);
+    while (!q.empty()) {
+        const auto n = q.top().second;
+        q.pop();
+        done[n] = true;
+        for (const auto m : neighbors(n)) {
+            const int candidate = dist[n] + cost[m];
+            if (!done[m] && candidate < dist[m]) {
+                if (dist[m] == unreached) {
+                    handle[m] = q.push({candidate, m});
+                } else {
+                    q.update(handle[m], {candidate, m});
+                }
+                dist[m] = candidate;
+            }
+        }
+    }
+
+    // compare with the duplicate-entry formulation on priority_queue
+    vector<int> expected(nodes, unreached);
+    priority_queue<pair<int, size_t>, vector<pair<int, size_t>>, greater<>> reference;
+    expected[0] = 0;
+    reference.push({0, 0});
+    while (!reference.empty()) {
+        const auto [d, n] = reference.top();
+        reference.pop();
+        if (d != expected[n]) {
+            continue;
+        }
+        for (const auto m : neighbors(n)) {
+            if (d + cost[m] < expected[m]) {
+                expected[m] = d + cost[m];
+                reference.push({expected[m], m});
+            }
+        }
+    }
+
+    assert(dist == expected);
+}
+
+int main() {
+    test_algorithms<2>();
+    test_algorithms<3>();
+    test_algorithms<4>();
+    test_algorithms<8>();
+    test_priority_queue();
+    test_addressable_basics();
+    test_addressable_against_reference();
+    test_dijkstra();
+}
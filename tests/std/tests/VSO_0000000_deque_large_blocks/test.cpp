@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _ENABLE_DEQUE_LARGE_BLOCKS
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stddef.h>
+#include <vector>
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using namespace std;
+
+size_t g_element_blocks = 0; // allocations of blocks of elements, as opposed to the map or the container proxy
+size_t g_block_elements = 0; // elements in the last such allocation
+
+template <class T, class Element>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U, Element>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        if (is_same<T, Element>::value) {
+            ++g_element_blocks;
+            g_block_elements = n;
+        }
+
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U, Element>&) const noexcept {
+        return true;
+    }
+    template <class U>
+    bool operator!=(const counting_allocator<U, Element>&) const noexcept {
+        return false;
+    }
+};
+
+struct message {
+    int id;
+    char payload[60];
+};
+
+STATIC_ASSERT(sizeof(message) == 64);
+
+struct large_record {
+    char data[1000];
+};
+
+template <class T>
+void test_block_size(const size_t expected_elements) {
+    g_element_blocks = 0;
+    deque<T, counting_allocator<T, T>> d;
+    for (size_t i = 0; i < expected_elements * 10; ++i) {
+        d.push_back(T{});
+    }
+
+    assert(g_block_elements == expected_elements);
+    assert(g_element_blocks == 10);
+}
+
+template <class T>
+void test_against_vector() {
+    // random pushes and pops at both ends, with iteration and indexing, must agree with a vector
+    mt19937 gen(1729);
+    uniform_int_distribution<int> op_dist(0, 5);
+    deque<T> d;
+    vector<T> ref;
+    for (int i = 0; i < 20'000; ++i) {
+        const auto value = static_cast<T>(i);
+        switch (op_dist(gen)) {
+        case 0:
+        case 1:
+            d.push_back(value);
+            ref.push_back(value);
+            break;
+        case 2:
+            d.push_front(value);
+            ref.insert(ref.begin(), value);
+            break;
+        case 3:
+            if (!ref.empty()) {
+                d.pop_front();
+                ref.erase(ref.begin());
+            }
+            break;
+        case 4:
+            if (!ref.empty()) {
+                d.pop_back();
+                ref.pop_back();
+            }
+            break;
+        default:
+            if (!ref.empty()) {
+                const size_t where = static_cast<size_t>(i) % ref.size();
+                assert(d[where] == ref[where]);
+                d.insert(d.begin() + static_cast<ptrdiff_t>(where), value);
+                ref.insert(ref.begin() + static_cast<ptrdiff_t>(where), value);
+            }
+            break;
+        }
+    }
+
+    assert(equal(d.begin(), d.end(), ref.begin(), ref.end()));
+    assert(equal(d.rbegin(), d.rend(), ref.rbegin(), ref.rend()));
+    d.shrink_to_fit();
+    assert(equal(d.begin(), d.end(), ref.begin(), ref.end()));
+}
+
+int main() {
+    test_block_size<char>(4096);
+    test_block_size<int>(1024);
+    test_block_size<message>(64);
+    test_block_size<large_record>(16);
+
+    test_against_vector<char>();
+    test_against_vector<long long>();
+
+    queue<message> q;
+    for (int i = 0; i < 1000; ++i) {
+        q.push(message{i, {}});
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        assert(q.front().id == i);
+        q.pop();
+    }
+}
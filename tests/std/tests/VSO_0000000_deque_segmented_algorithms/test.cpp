@@ -0,0 +1,145 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Large blocks are what make deque's iterators segmented for the purposes of these algorithms.
+#define _ENABLE_DEQUE_LARGE_BLOCKS
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+template <class T>
+T make_value(const size_t i) {
+    return static_cast<T>(i % 100 + 1);
+}
+
+template <>
+string make_value<string>(const size_t i) {
+    return "element " + to_string(i);
+}
+
+template <class T>
+deque<T> make_deque(const size_t front_count, const size_t back_count) {
+    // pushing to the front first leaves the elements starting partway into a block
+    deque<T> result;
+    for (size_t i = front_count; i != 0; --i) {
+        result.push_front(make_value<T>(i - 1));
+    }
+
+    for (size_t i = front_count; i != front_count + back_count; ++i) {
+        result.push_back(make_value<T>(i));
+    }
+
+    return result;
+}
+
+template <class T>
+void test_one(const size_t front_count, const size_t back_count) {
+    const size_t n     = front_count + back_count;
+    const deque<T> src = make_deque<T>(front_count, back_count);
+    vector<T> expected;
+    for (size_t i = 0; i != n; ++i) {
+        expected.push_back(make_value<T>(i));
+    }
+
+    assert(equal(src.begin(), src.end(), expected.begin()));
+    assert(equal(expected.begin(), expected.end(), src.begin()));
+    assert(equal(src.begin(), src.end(), src.begin()));
+
+    // deque to vector, vector to deque, and deque to deque at a different position within its blocks
+    vector<T> vec(n);
+    assert(copy(src.begin(), src.end(), vec.begin()) == vec.end());
+    assert(vec == expected);
+
+    deque<T> dst = make_deque<T>(3, n);
+    assert(copy(expected.begin(), expected.end(), dst.begin() + 1) == dst.begin() + static_cast<ptrdiff_t>(n + 1));
+    assert(equal(dst.begin() + 1, dst.end() - 2, expected.begin()));
+
+    deque<T> dst2 = make_deque<T>(1, n + 1);
+    assert(copy(src.begin(), src.end(), dst2.begin() + 2) == dst2.end());
+    assert(equal(dst2.begin() + 2, dst2.end(), src.begin()));
+
+    vector<T> appended;
+    copy(src.begin(), src.end(), back_inserter(appended));
+    assert(appended == expected);
+
+    // move, including to an overlapping destination earlier in the same deque
+    deque<T> moved_from = src;
+    vector<T> moved(n);
+    move(moved_from.begin(), moved_from.end(), moved.begin());
+    assert(moved == expected);
+
+    deque<T> shifting = src;
+    if (n > 5) {
+        assert(move(shifting.begin() + 5, shifting.end(), shifting.begin()) == shifting.end() - 5);
+        assert(equal(shifting.begin(), shifting.end() - 5, expected.begin() + 5));
+    }
+
+    // find values starting from various positions, which often means searching past the end of a block
+    for (size_t start = 0; start < n; start += 997) {
+        for (const size_t target : {start, start + 37, start + 99, n - 1}) {
+            if (target >= n) {
+                continue;
+            }
+
+            const auto found = find(src.begin() + static_cast<ptrdiff_t>(start), src.end(), expected[target]);
+            const auto found_in_vector =
+                find(expected.begin() + static_cast<ptrdiff_t>(start), expected.end(), expected[target]);
+            assert(found - src.begin() == found_in_vector - expected.begin());
+        }
+    }
+
+    assert(find(src.begin(), src.end(), T{}) == src.end());
+
+    // for_each visits the elements in order
+    size_t visited = 0;
+    for_each(src.begin(), src.end(), [&](const T& elem) {
+        assert(elem == expected[visited]);
+        ++visited;
+    });
+    assert(visited == n);
+
+    // fill part of the deque, leaving the rest intact
+    deque<T> filled = src;
+    if (n > 3) {
+        fill(filled.begin() + 1, filled.end() - 2, make_value<T>(42));
+        assert(filled.front() == expected.front());
+        assert(all_of(filled.begin() + 1, filled.end() - 2, [](const T& elem) { return elem == make_value<T>(42); }));
+        assert(equal(filled.end() - 2, filled.end(), expected.end() - 2));
+    }
+
+    // a mismatch is reported wherever it is
+    if (n != 0) {
+        auto changed   = expected;
+        changed.back() = make_value<T>(n + 50);
+        assert(!equal(src.begin(), src.end(), changed.begin()));
+        assert(!equal(changed.begin(), changed.end(), src.begin()));
+        assert(!equal(src.begin(), src.end(), changed.begin(), equal_to<>{}));
+    }
+}
+
+template <class T>
+void test_type() {
+    for (const size_t front_count : {0, 1, 17, 5000}) {
+        for (const size_t back_count : {0, 1, 33, 5000, 20000}) {
+            test_one<T>(front_count, back_count);
+        }
+    }
+}
+
+int main() {
+    test_type<char>();
+    test_type<unsigned char>();
+    test_type<short>();
+    test_type<int>();
+    test_type<long long>();
+    test_type<double>();
+    test_type<string>();
+}
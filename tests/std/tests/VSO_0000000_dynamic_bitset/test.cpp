@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <dynamic_bitset>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+
+using stdext::dynamic_bitset;
+
+template <class Block>
+void test_basics() {
+    using Bits = dynamic_bitset<Block>;
+
+    Bits empty;
+    assert(empty.size() == 0 && empty.empty() && empty.num_blocks() == 0);
+    assert(empty.none() && empty.all() && empty.count() == 0);
+    assert(empty.find_first() == Bits::npos);
+
+    Bits ones(Bits::bits_per_block + 3, true);
+    assert(ones.num_blocks() == 2);
+    assert(ones.all() && ones.count() == Bits::bits_per_block + 3);
+    assert(ones.data()[1] == 7); // the bits beyond size() are zero
+
+    ones.flip(1);
+    assert(!ones[1] && !ones.all() && ones.any());
+    ones[1] = true;
+    assert(ones.test(1) && ones.all());
+
+    ones.flip();
+    assert(ones.none() && ones.data()[1] == 0);
+
+    ones.resize(Bits::bits_per_block * 2 + 1, true);
+    assert(ones.count() == Bits::bits_per_block - 2);
+    assert(ones.find_first() == Bits::bits_per_block + 3);
+
+    ones.resize(Bits::bits_per_block);
+    assert(ones.none() && ones.num_blocks() == 1);
+
+    ones.push_back(true);
+    assert(ones.size() == Bits::bits_per_block + 1 && ones[Bits::bits_per_block]);
+
+    try {
+        (void) ones.test(ones.size());
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    Bits pattern(10);
+    pattern.set(2).set(5).set(9);
+    assert((~pattern).count() == 7 && (~pattern).size() == 10);
+    pattern.reset(5);
+    assert(pattern.find_first() == 2 && pattern.find_next(2) == 9 && pattern.find_next(9) == Bits::npos);
+    assert(pattern.find_next(100) == Bits::npos);
+}
+
+// large enough for the vector kernels, with a tail that isn't a whole vector
+constexpr size_t large = 100'000 + 37;
+
+vector<bool> make_pattern(const size_t modulus, const size_t residue) {
+    vector<bool> result(large);
+    for (size_t idx = residue; idx < large; idx += modulus) {
+        result[idx] = true;
+    }
+
+    return result;
+}
+
+template <class Block>
+dynamic_bitset<Block> to_bitset(const vector<bool>& bools) {
+    dynamic_bitset<Block> result(bools.size());
+    for (size_t idx = 0; idx < bools.size(); ++idx) {
+        result[idx] = bools[idx];
+    }
+
+    return result;
+}
+
+template <class Block>
+void check_equal(const dynamic_bitset<Block>& bits, const vector<bool>& bools) {
+    assert(bits.size() == bools.size());
+    size_t expected_count = 0;
+    for (size_t idx = 0; idx < bools.size(); ++idx) {
+        assert(bits[idx] == bools[idx]);
+        expected_count += bools[idx];
+    }
+
+    assert(bits.count() == expected_count);
+}
+
+template <class Block>
+void test_bulk_operations() {
+    const vector<bool> threes = make_pattern(3, 1);
+    const vector<bool> fives  = make_pattern(5, 0);
+    const auto left           = to_bitset<Block>(threes);
+    const auto right          = to_bitset<Block>(fives);
+
+    vector<bool> expected(large);
+    for (size_t idx = 0; idx < large; ++idx) {
+        expected[idx] = threes[idx] && fives[idx];
+    }
+    check_equal(left & right, expected);
+
+    for (size_t idx = 0; idx < large; ++idx) {
+        expected[idx] = threes[idx] || fives[idx];
+    }
+    check_equal(left | right, expected);
+
+    for (size_t idx = 0; idx < large; ++idx) {
+        expected[idx] = threes[idx] != fives[idx];
+    }
+    check_equal(left ^ right, expected);
+
+    for (size_t idx = 0; idx < large; ++idx) {
+        expected[idx] = threes[idx] && !fives[idx];
+    }
+    auto difference = left;
+    difference -= right;
+    check_equal(difference, expected);
+    assert(difference == left - right && difference != left);
+
+    // find_first and find_next skip long runs of zero blocks
+    dynamic_bitset<Block> sparse(large);
+    const size_t positions[] = {0, 1, 63, 64, 4'099, 50'000, large - 1};
+    for (const size_t pos : positions) {
+        sparse.set(pos);
+    }
+
+    size_t found = sparse.find_first();
+    for (const size_t pos : positions) {
+        assert(found == pos);
+        found = sparse.find_next(found);
+    }
+    assert(found == dynamic_bitset<Block>::npos);
+
+    sparse.reset(0);
+    assert(sparse.find_first() == 1);
+    sparse.reset();
+    assert(sparse.none() && sparse.find_first() == dynamic_bitset<Block>::npos);
+    sparse.set(large - 1);
+    assert(sparse.any() && sparse.find_next(0) == large - 1);
+}
+
+int main() {
+    test_basics<unsigned char>();
+    test_basics<unsigned short>();
+    test_basics<unsigned int>();
+    test_basics<unsigned long long>();
+
+    test_bulk_operations<unsigned char>();
+    test_bulk_operations<unsigned int>();
+    test_bulk_operations<unsigned long long>();
+}
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <ios>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+using namespace std;
+using stdext::error_message_view;
+
+int messages_formatted = 0;
+
+struct counting_category : error_category { // user categories aren't cached, so message() is called every time
+    const char* name() const noexcept override {
+        return "counting";
+    }
+
+    string message(const int value) const override {
+        ++messages_formatted;
+        return "counting message " + to_string(value);
+    }
+};
+
+void test_system_category() {
+    string storage;
+    const error_code access_denied(5, system_category()); // ERROR_ACCESS_DENIED
+    const string message   = access_denied.message();
+    const string_view view = error_message_view(access_denied, storage);
+    assert(!message.empty());
+    assert(view == message);
+    assert(access_denied.message() == message); // from the cache
+
+    const string_view again = error_message_view(access_denied, storage);
+    assert(again.data() == view.data()); // the same cached characters, rather than a new copy
+    assert(storage.empty());
+
+    // unknown codes aren't cached, and keep reporting "unknown error"
+    const error_code unknown(0x7FFF'FFF0, system_category());
+    assert(error_message_view(unknown, storage) == "unknown error");
+    assert(unknown.message() == "unknown error");
+    assert(error_message_view(unknown, storage) == "unknown error");
+}
+
+void test_generic_and_iostream_categories() {
+    string storage;
+    const error_code no_space = make_error_code(errc::no_space_on_device);
+    assert(error_message_view(no_space, storage) == no_space.message());
+    assert(error_message_view(no_space, storage) == "no space on device");
+    assert(error_message_view(error_code(-1, generic_category()), storage) == "unknown error");
+    assert(error_message_view(error_code(1000, generic_category()), storage) == "unknown error");
+    assert(storage.empty());
+
+    const error_code stream = make_error_code(io_errc::stream);
+    assert(error_message_view(stream, storage) == stream.message());
+    assert(storage == stream.message());
+}
+
+void test_user_category() {
+    static const counting_category category;
+    const error_code first(1, category);
+    const error_code second(2, category);
+
+    string storage;
+    const string_view view = error_message_view(first, storage);
+    assert(view == "counting message 1");
+    assert(view.data() == storage.data());
+    assert(error_message_view(second, storage) == "counting message 2");
+    assert(error_message_view(first, storage) == "counting message 1");
+    assert(messages_formatted == 3);
+}
+
+int main() {
+    test_system_category();
+    test_generic_and_iostream_categories();
+    test_user_category();
+}
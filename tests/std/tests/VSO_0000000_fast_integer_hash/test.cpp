@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _STL_FAST_INTEGER_HASH 1
+
+#include <assert.h>
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+
+enum class color : int { red = 5 };
+
+// The unordered containers keep the low bits of a hash, so keys that differ only in their high bits, or that are all
+// multiples of a power of two, must still spread evenly over a power-of-two number of buckets.
+template <class Key, class MakeKey>
+void test_dispersion(MakeKey make_key) {
+    constexpr size_t bucket_count = 1024;
+    vector<int> loads(bucket_count);
+    for (size_t idx = 0; idx < 4 * bucket_count; ++idx) {
+        ++loads[hash<Key>{}(make_key(idx)) & (bucket_count - 1)];
+    }
+
+    size_t empty = 0;
+    for (const int load : loads) {
+        assert(load <= 20); // an average of 4
+        empty += load == 0;
+    }
+
+    assert(empty <= bucket_count / 16);
+}
+
+void test_values() {
+    assert(hash<int>{}(42) == hash<int>{}(42));
+    assert(hash<int>{}(42) != hash<int>{}(43));
+    assert(hash<color>{}(color::red) == hash<int>{}(5));
+    int x = 0;
+    assert(hash<int*>{}(&x) == hash<int*>{}(&x));
+    assert(hash<int*>{}(&x) != hash<int*>{}(&x + 1));
+}
+
+void test_keys() {
+    test_dispersion<unsigned int>([](size_t idx) { return static_cast<unsigned int>(idx); });
+    test_dispersion<int>([](size_t idx) { return -static_cast<int>(idx); });
+    test_dispersion<unsigned int>([](size_t idx) { return static_cast<unsigned int>(idx << 20); });
+    test_dispersion<uint64_t>([](size_t idx) { return uint64_t{idx} << 32; });
+    test_dispersion<uint64_t>([](size_t idx) { return uint64_t{idx} * 1000003; });
+    test_dispersion<const void*>(
+        [](size_t idx) { return reinterpret_cast<const void*>(uintptr_t{0x10000} + idx * 16); }); // aligned nodes
+    test_dispersion<const void*>(
+        [](size_t idx) { return reinterpret_cast<const void*>(uintptr_t{0x10000} + idx * 4096); }); // pages
+}
+
+void test_containers() {
+    unordered_map<uint64_t, int> by_id;
+    for (int i = 0; i < 10000; ++i) {
+        by_id.emplace(uint64_t{static_cast<unsigned int>(i)} << 32, i);
+    }
+
+    assert(by_id.size() == 10000);
+    for (int i = 0; i < 10000; ++i) {
+        assert(by_id.at(uint64_t{static_cast<unsigned int>(i)} << 32) == i);
+    }
+
+    vector<int> storage(1000);
+    unordered_set<int*> pointers;
+    for (auto& element : storage) {
+        pointers.insert(&element);
+    }
+
+    assert(pointers.size() == storage.size());
+    assert(pointers.count(&storage[500]) == 1);
+}
+
+int main() {
+    test_values();
+    test_keys();
+    test_containers();
+}
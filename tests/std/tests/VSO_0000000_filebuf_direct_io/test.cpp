@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <string>
+
+using namespace std;
+
+const char* const filename = "VSO_0000000_filebuf_direct_io.txt";
+
+string make_payload(const size_t size) {
+    string result(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+        result[i] = static_cast<char>('a' + i % 26);
+        if (i % 100 == 99) {
+            result[i] = '\n';
+        }
+    }
+
+    return result;
+}
+
+string read_all_binary() {
+    ifstream in(filename, ios_base::binary);
+    return string{istreambuf_iterator<char>(in), istreambuf_iterator<char>()};
+}
+
+void test_binary() {
+    const string big = make_payload(100'000);
+    {
+        ofstream out(filename, ios_base::binary);
+        out << "head"; // buffered before the large write
+        assert(out.write(big.data(), static_cast<streamsize>(big.size())));
+        out << "tail"; // buffered after it
+        assert(out.write(big.data(), 5000));
+    }
+
+    const string expected = "head" + big + "tail" + big.substr(0, 5000);
+    assert(read_all_binary() == expected);
+
+    ifstream in(filename, ios_base::binary);
+    char small[4];
+    assert(in.read(small, 4) && string(small, 4) == "head"); // leaves the rest of the C stream buffer unread
+    string buffer(big.size(), '\0');
+    assert(in.read(&buffer[0], static_cast<streamsize>(buffer.size())) && buffer == big);
+    assert(in.read(small, 4) && string(small, 4) == "tail");
+
+    assert(in.seekg(4));
+    assert(in.get() == 'a');
+    assert(in.unget());
+    assert(in.read(&buffer[0], static_cast<streamsize>(buffer.size())) && buffer == big);
+
+    buffer.assign(10'000, '\0');
+    assert(!in.read(&buffer[0], static_cast<streamsize>(buffer.size())));
+    assert(in.gcount() == 5004 && buffer.compare(0, 5004, "tail" + big.substr(0, 5000)) == 0);
+}
+
+void test_text() {
+    const string big = make_payload(50'000);
+    {
+        ofstream out(filename);
+        assert(out.write(big.data(), static_cast<streamsize>(big.size())));
+    }
+
+    // the direct path still translates newlines
+    const string on_disk = read_all_binary();
+    assert(on_disk.size() == big.size() + big.size() / 100);
+    assert(on_disk.compare(98, 4, "u\r\nw") == 0);
+
+    ifstream in(filename);
+    string buffer(big.size(), '\0');
+    assert(in.read(&buffer[0], static_cast<streamsize>(buffer.size())) && buffer == big);
+    assert(in.get() == char_traits<char>::eof());
+}
+
+int main() {
+    test_binary();
+    test_text();
+    assert(remove(filename) == 0);
+}
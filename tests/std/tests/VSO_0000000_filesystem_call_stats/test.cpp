@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <test_filesystem_support.hpp>
+
+using namespace std;
+using namespace std::filesystem;
+
+using stdext::filesystem::call_statistics;
+using stdext::filesystem::call_stats;
+using stdext::filesystem::enable_call_stats;
+
+const path root = get_new_test_directory("VSO_0000000_filesystem_call_stats");
+
+void test_start_over() {
+    enable_call_stats(true);
+    const call_statistics stats = call_stats();
+    assert(stats.get_stats == 0 && stats.open_handle == 0 && stats.directory_iterator_open == 0);
+    assert(stats.directory_iterator_advance == 0 && stats.get_file_id == 0 && stats.copy_file == 0);
+    assert(stats.remove == 0 && stats.create_directory == 0 && stats.convert == 0);
+}
+
+void test_directory_iterator() {
+    enable_call_stats(true);
+    uintmax_t total_size = 0;
+    for (const auto& entry : directory_iterator{root}) {
+        // answered by the directory listing
+        assert(entry.is_regular_file());
+        total_size += entry.file_size();
+        (void) entry.last_write_time();
+    }
+
+    assert(total_size == 0 + 1 + 2);
+    const call_statistics stats = call_stats();
+    assert(stats.directory_iterator_open == 1);
+    assert(stats.directory_iterator_advance >= 3);
+    assert(stats.get_stats == 0);
+}
+
+void test_stats() {
+    enable_call_stats(true);
+    for (int i = 0; i < 3; ++i) {
+        (void) file_size(root / ("file" + to_string(i)));
+    }
+
+    assert(call_stats().get_stats == 3);
+
+    directory_entry entry{root / "file0"};
+    entry.refresh();
+    assert(call_stats().get_stats == 5);
+}
+
+void test_copy_and_equivalent() {
+    enable_call_stats(true);
+    assert(copy_file(root / "file1", root / "copy"));
+    assert(!equivalent(root / "file1", root / "copy"));
+    const call_statistics stats = call_stats();
+    assert(stats.copy_file == 1);
+    assert(stats.get_file_id == 2);
+}
+
+void test_convert() {
+    enable_call_stats(true);
+    const path narrow{string{"narrow"}};
+    (void) narrow.string();
+    assert(call_stats().convert >= 2);
+}
+
+void test_disabled() {
+    enable_call_stats(true);
+    (void) exists(root);
+    enable_call_stats(false);
+    (void) exists(root);
+    // disabling keeps the counts, but stops counting
+    assert(call_stats().get_stats == 1);
+}
+
+int main() {
+    create_directories(root);
+    for (int i = 0; i < 3; ++i) {
+        ofstream{root / ("file" + to_string(i))} << string(static_cast<size_t>(i), 'x');
+    }
+
+    test_start_over();
+    test_directory_iterator();
+    test_stats();
+    test_copy_and_equivalent();
+    test_convert();
+    test_disabled();
+
+    enable_call_stats(true);
+    remove_all(root);
+    assert(call_stats().remove >= 5);
+    enable_call_stats(false);
+}
@@ -0,0 +1,317 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <flat_unordered_map>
+#include <flat_unordered_set>
+#include <memory>
+#include <random>
+#include <stddef.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::flat_unordered_map;
+using stdext::flat_unordered_set;
+
+struct bad_hash { // sends every key to the same group, so that lookups depend on probing alone
+    size_t operator()(int) const noexcept {
+        return 0;
+    }
+};
+
+int g_string_hashes = 0;
+
+struct transparent_string_hash {
+    using is_transparent = void;
+    size_t operator()(const string& target) const noexcept {
+        ++g_string_hashes;
+        return hash<string_view>{}(target);
+    }
+    size_t operator()(const string_view target) const noexcept {
+        return hash<string_view>{}(target);
+    }
+    size_t operator()(const char* const target) const noexcept {
+        return hash<string_view>{}(target);
+    }
+};
+
+struct transparent_string_equal {
+    using is_transparent = void;
+    bool operator()(const string_view lhs, const string_view rhs) const noexcept {
+        return lhs == rhs;
+    }
+};
+
+size_t g_expensive_hashes = 0;
+
+struct expensive_hash {
+    using cache_hash_codes = void;
+    size_t operator()(const int i) const noexcept {
+        ++g_expensive_hashes;
+        return static_cast<size_t>(i) % 64; // collide often, so that lookups must reject slots by hash
+    }
+};
+
+struct live_counted {
+    static int live;
+    int value;
+
+    explicit live_counted(int v) : value(v) {
+        ++live;
+    }
+    live_counted(const live_counted& other) : value(other.value) {
+        ++live;
+    }
+    ~live_counted() {
+        --live;
+    }
+    live_counted& operator=(const live_counted&) = default;
+};
+
+int live_counted::live = 0;
+
+template <class Map, class Reference>
+void assert_same(const Map& m, const Reference& ref) {
+    assert(m.size() == ref.size());
+    size_t visited = 0;
+    for (const auto& [key, value] : m) {
+        const auto found = ref.find(key);
+        assert(found != ref.end());
+        assert(found->second == value);
+        ++visited;
+    }
+
+    assert(visited == ref.size());
+}
+
+void test_basic_map() {
+    flat_unordered_map<int, string> m;
+    assert(m.empty());
+    assert(m.begin() == m.end());
+    assert(m.bucket_count() == 0);
+    assert(m.find(1) == m.end());
+    assert(m.erase(1) == 0);
+
+    const auto first = m.insert({1, "one"});
+    assert(first.second);
+    assert(first.first->first == 1 && first.first->second == "one");
+    const auto dup = m.insert({1, "uno"});
+    assert(!dup.second);
+    assert(dup.first == first.first);
+    assert(dup.first->second == "one");
+
+    assert(m.emplace(2, "two").second);
+    assert(m.try_emplace(3, "three").second);
+    assert(!m.try_emplace(3, "tres").second);
+    assert(m[3] == "three");
+    m[4] = "four";
+    assert(m.size() == 4);
+    assert(m.at(4) == "four");
+
+    const auto assigned = m.insert_or_assign(4, "vier");
+    assert(!assigned.second);
+    assert(assigned.first->second == "vier");
+    assert(m.insert_or_assign(5, "five").second);
+
+    assert(m.contains(2));
+    assert(m.count(2) == 1);
+    assert(m.count(42) == 0);
+    const auto range = m.equal_range(2);
+    assert(distance(range.first, range.second) == 1);
+
+    bool threw = false;
+    try {
+        (void) m.at(42);
+    } catch (const out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    assert(m.erase(2) == 1);
+    assert(!m.contains(2));
+    assert(m.size() == 4);
+
+    auto copy = m;
+    assert(copy == m);
+    copy[1] = "ein";
+    assert(copy != m);
+
+    auto moved = move(copy);
+    assert(moved.size() == 4);
+    assert(moved[1] == "ein");
+
+    m.swap(moved);
+    assert(m[1] == "ein");
+    assert(moved[1] == "one");
+
+    m.clear();
+    assert(m.empty());
+    assert(m.begin() == m.end());
+    assert(m.bucket_count() != 0);
+}
+
+void test_basic_set() {
+    flat_unordered_set<string> s{"cat", "dog", "cat"};
+    assert(s.size() == 2);
+    assert(s.contains("cat"));
+    assert(!s.insert("dog").second);
+    assert(s.emplace("eel").second);
+
+    vector<string> items(s.begin(), s.end());
+    sort(items.begin(), items.end());
+    assert((items == vector<string>{"cat", "dog", "eel"}));
+
+    for (auto it = s.begin(); it != s.end();) {
+        if (it->size() == 3 && (*it)[0] == 'd') {
+            it = s.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    assert(s.size() == 2);
+    assert(!s.contains("dog"));
+}
+
+void test_transparent_lookup() {
+    flat_unordered_map<string, int, transparent_string_hash, transparent_string_equal> m;
+    m.emplace("alpha", 1);
+    m.emplace("beta", 2);
+    g_string_hashes = 0;
+
+    // lookups by string_view and const char* reach the hasher without building a string
+    assert(m.find(string_view{"alpha"})->second == 1);
+    assert(m.find("beta")->second == 2);
+    assert(m.count("gamma") == 0);
+    assert(m.contains(string_view{"beta"}));
+    const auto range = m.equal_range("alpha");
+    assert(distance(range.first, range.second) == 1);
+    const auto& cm = m;
+    assert(cm.find("alpha") != cm.end());
+    assert(g_string_hashes == 0);
+
+    // a non-transparent container still converts to key_type
+    flat_unordered_map<string, int, transparent_string_hash> legacy;
+    legacy.emplace("alpha", 1);
+    g_string_hashes = 0;
+    assert(legacy.find("alpha")->second == 1);
+    assert(g_string_hashes == 1);
+}
+
+template <class Hasher>
+void test_against_unordered_map(const int keys, const int steps) {
+    // random inserts and erases must agree with unordered_map, including across rebuilds
+    mt19937 gen(1729);
+    uniform_int_distribution<int> key_dist(0, keys - 1);
+    uniform_int_distribution<int> op_dist(0, 3);
+    flat_unordered_map<int, int, Hasher> m;
+    unordered_map<int, int> ref;
+    for (int i = 0; i < steps; ++i) {
+        const int key = key_dist(gen);
+        switch (op_dist(gen)) {
+        case 0:
+        case 1:
+            assert(m.emplace(key, i).second == ref.emplace(key, i).second);
+            break;
+        case 2:
+            m[key] = i;
+            ref[key] = i;
+            break;
+        default:
+            assert(m.erase(key) == ref.erase(key));
+            break;
+        }
+
+        assert(m.size() == ref.size());
+        assert(m.load_factor() <= m.max_load_factor());
+    }
+
+    assert_same(m, ref);
+
+    m.rehash(0); // drops the deleted markers
+    assert_same(m, ref);
+
+    m.reserve(static_cast<size_t>(keys) * 4);
+    const auto buckets = m.bucket_count();
+    for (int key = 0; key < keys * 3; ++key) {
+        m.emplace(key, key);
+        ref.emplace(key, key);
+    }
+
+    assert(m.bucket_count() == buckets);
+    assert_same(m, ref);
+}
+
+void test_cached_hash_codes() {
+    g_expensive_hashes = 0;
+    flat_unordered_map<int, int, expensive_hash> m;
+    for (int i = 0; i < 1000; ++i) {
+        m.emplace(i, i);
+    }
+
+    assert(g_expensive_hashes == 1000); // growing the table did not hash again
+    m.rehash(4096);
+    for (int i = 0; i < 1000; i += 2) {
+        m.erase(i);
+    }
+
+    auto copy = m;
+    assert(g_expensive_hashes == 1500);
+    for (int i = 0; i < 1000; ++i) {
+        assert(copy.count(i) == static_cast<size_t>(i % 2));
+    }
+
+    assert(g_expensive_hashes == 2500);
+}
+
+void test_element_lifetimes() {
+    {
+        flat_unordered_map<int, live_counted> m;
+        for (int i = 0; i < 1000; ++i) {
+            m.try_emplace(i, i);
+        }
+
+        assert(live_counted::live == 1000);
+        for (int i = 0; i < 1000; i += 2) {
+            m.erase(i);
+        }
+
+        assert(live_counted::live == 500);
+        auto copy = m;
+        assert(live_counted::live == 1000);
+        copy.clear();
+        assert(live_counted::live == 500);
+    }
+
+    assert(live_counted::live == 0);
+}
+
+void test_move_only() {
+    flat_unordered_map<int, unique_ptr<int>> m;
+    for (int i = 0; i < 100; ++i) {
+        m.try_emplace(i, make_unique<int>(i));
+    }
+
+    auto moved = move(m);
+    for (int i = 0; i < 100; ++i) {
+        assert(*moved.at(i) == i);
+    }
+}
+
+int main() {
+    test_basic_map();
+    test_basic_set();
+    test_transparent_lookup();
+    test_against_unordered_map<hash<int>>(5000, 100'000);
+    test_against_unordered_map<bad_hash>(100, 5'000);
+    test_against_unordered_map<expensive_hash>(5000, 100'000);
+    test_cached_hash_codes();
+    test_element_lifetimes();
+    test_move_only();
+}
@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _ENABLE_FUTURE_CONTINUATIONS
+
+#include <cassert>
+#include <cstddef>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::when_all;
+using stdext::when_any;
+using stdext::when_any_result;
+
+STATIC_ASSERT(is_base_of_v<future<int>, stdext::future<int>>);
+STATIC_ASSERT(is_nothrow_move_constructible_v<stdext::future<int>>);
+STATIC_ASSERT(!is_copy_constructible_v<stdext::future<int>>);
+STATIC_ASSERT(is_same_v<decltype(declval<stdext::future<int>&>().then(declval<string (*)(stdext::future<int>)>())),
+    stdext::future<string>>);
+STATIC_ASSERT(is_same_v<decltype(when_all(declval<stdext::future<int>>(), declval<stdext::future<void>>())),
+    stdext::future<tuple<stdext::future<int>, stdext::future<void>>>>);
+STATIC_ASSERT(is_same_v<decltype(when_any(declval<vector<stdext::future<int>>&>().begin(),
+                            declval<vector<stdext::future<int>>&>().end())),
+    stdext::future<when_any_result<vector<stdext::future<int>>>>>);
+
+void test_then() {
+    for (int round = 0; round < 100; ++round) { // the continuation runs on whichever side comes second
+        promise<int> p;
+        stdext::future<int> f = p.get_future();
+        stdext::future<string> chained = f.then([](stdext::future<int> x) { return x.get() * 2; })
+                                             .then([](stdext::future<int> x) { return to_string(x.get()); });
+        assert(!f.valid());
+        if (round % 2 == 0) {
+            this_thread::yield();
+        }
+
+        p.set_value(21);
+        assert(chained.get() == "42");
+    }
+
+    {
+        promise<int> p;
+        p.set_value(5);
+        stdext::future<int> f = p.get_future();
+        assert(f.is_ready());
+
+        int value                   = 0;
+        stdext::future<int&> to_ref = f.then([&value](stdext::future<int> x) -> int& {
+            value = x.get();
+            return value;
+        });
+        assert(&to_ref.get() == &value);
+        assert(value == 5);
+    }
+
+    {
+        promise<void> p;
+        stdext::future<void> f = p.get_future();
+        stdext::future<void> rethrown = f.then([](stdext::future<void> x) { x.get(); });
+        p.set_exception(make_exception_ptr(runtime_error("meow")));
+        try {
+            rethrown.get();
+            assert(false);
+        } catch (const runtime_error& e) {
+            assert(string(e.what()) == "meow");
+        }
+    }
+
+    {
+        stdext::future<int> abandoned;
+        {
+            promise<int> p;
+            abandoned = p.get_future();
+        }
+
+        try {
+            (void) abandoned.then([](stdext::future<int> x) { return x.get(); }).get();
+            assert(false);
+        } catch (const future_error& e) {
+            assert(e.code() == future_errc::broken_promise);
+        }
+    }
+
+    {
+        stdext::future<int> deferred = async(launch::deferred, [] { return 1729; });
+        assert(deferred.then([](stdext::future<int> x) { return x.get() + 1; }).get() == 1730);
+
+        stdext::future<int> pooled = async(launch::async, [] { return 7; });
+        assert(pooled.then([](stdext::future<int> x) { return x.get() * 6; }).get() == 42);
+    }
+
+    {
+        stdext::future<int> empty;
+        try {
+            (void) empty.then([](stdext::future<int>) { return 0; });
+            assert(false);
+        } catch (const future_error& e) {
+            assert(e.code() == future_errc::no_state);
+        }
+    }
+
+    {
+        promise<int> p;
+        stdext::future<int> f = p.get_future();
+        (void) f.then([](stdext::future<int> x) { (void) x.get(); }); // result discarded before it is ready
+        p.set_value(3);
+    }
+}
+
+void test_when_all() {
+    for (int round = 0; round < 100; ++round) {
+        vector<promise<int>> promises(5);
+        vector<stdext::future<int>> futures;
+        for (auto& p : promises) {
+            futures.push_back(p.get_future());
+        }
+
+        stdext::future<vector<stdext::future<int>>> all = when_all(futures.begin(), futures.end());
+        vector<thread> threads;
+        for (int i = 0; i < 5; ++i) {
+            threads.emplace_back([&promises, i] { promises[static_cast<size_t>(i)].set_value(i); });
+        }
+
+        vector<stdext::future<int>> results = all.get();
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        for (int i = 0; i < 5; ++i) {
+            assert(results[static_cast<size_t>(i)].is_ready());
+            assert(results[static_cast<size_t>(i)].get() == i);
+        }
+    }
+
+    {
+        promise<int> a;
+        promise<string> b;
+        auto sum = when_all(stdext::future<int>(a.get_future()), stdext::future<string>(b.get_future()))
+                       .then([](auto both) {
+                           auto results = both.get();
+                           return get<0>(results).get() + static_cast<int>(get<1>(results).get().size());
+                       });
+        thread setter([&b] { b.set_value("four"); });
+        a.set_value(38);
+        assert(sum.get() == 42);
+        setter.join();
+    }
+
+    assert(tuple_size_v<decltype(when_all().get())> == 0);
+    vector<stdext::future<int>> none;
+    assert(when_all(none.begin(), none.end()).get().empty());
+}
+
+void test_when_any() {
+    for (int round = 0; round < 100; ++round) {
+        promise<int> a;
+        promise<void> b;
+        auto any = when_any(stdext::future<int>(a.get_future()), stdext::future<void>(b.get_future()));
+        thread setter([&b] { b.set_value(); });
+        auto result = any.get();
+        setter.join();
+        assert(result.index == 1);
+        get<1>(result.futures).get();
+        if (round % 2 == 0) {
+            result = {}; // the remaining input may become ready after the result is gone
+        }
+
+        a.set_value(7);
+    }
+
+    {
+        promise<int> ready;
+        ready.set_value(9);
+        promise<int> never;
+        vector<stdext::future<int>> futures;
+        futures.push_back(never.get_future());
+        futures.push_back(ready.get_future());
+        auto result = when_any(futures.begin(), futures.end()).get();
+        assert(result.index == 1);
+        assert(result.futures[1].get() == 9);
+        assert(!result.futures[0].is_ready());
+    } // never is abandoned
+
+    vector<stdext::future<int>> none;
+    const auto result = when_any(none.begin(), none.end()).get();
+    assert(result.index == static_cast<size_t>(-1));
+    assert(result.futures.empty());
+    assert(when_any().get().index == static_cast<size_t>(-1));
+
+    try {
+        (void) when_any(stdext::future<int>{});
+        assert(false);
+    } catch (const future_error& e) {
+        assert(e.code() == future_errc::no_state);
+    }
+}
+
+int main() {
+    test_then();
+    test_when_all();
+    test_when_any();
+}
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+using namespace std;
+
+template <class T>
+constexpr bool is_isqrt(const T val, const T root) {
+    using U = conditional_t<(sizeof(T) < sizeof(unsigned long long)), unsigned long long, make_unsigned_t<T>>;
+    const auto uval = static_cast<U>(val);
+    const auto ur   = static_cast<U>(root);
+    if (ur * ur > uval) {
+        return false;
+    }
+
+    // (root + 1)^2 > val, without overflowing when root is the largest possible
+    return ur + 1 > uval / (ur + 1);
+}
+
+template <class T>
+constexpr bool test_isqrt(const int count) {
+    for (int i = 0; i <= count; ++i) {
+        const auto val = static_cast<T>(i % (numeric_limits<T>::max)());
+        assert(is_isqrt(val, stdext::isqrt(val)));
+    }
+
+    constexpr T max_val = (numeric_limits<T>::max)();
+    assert(is_isqrt(max_val, stdext::isqrt(max_val)));
+    assert(is_isqrt(static_cast<T>(max_val - 1), stdext::isqrt(static_cast<T>(max_val - 1))));
+    return true;
+}
+
+void test_isqrt_64() {
+    // near perfect squares, converting to double may round the argument across them
+    for (uint64_t root = 0xFFFF'FFFF; root > 0xFFFF'0000; --root) {
+        const uint64_t square = root * root;
+        assert(stdext::isqrt(square) == root);
+        assert(stdext::isqrt(square - 1) == root - 1);
+        assert(stdext::isqrt(square + 1) == root);
+    }
+
+    assert(stdext::isqrt(UINT64_MAX) == 0xFFFF'FFFF);
+    assert(stdext::isqrt(INT64_MAX) == 3'037'000'499);
+    for (uint64_t val = 1; val <= UINT64_MAX / 3; val = val * 3 + 1) {
+        assert(is_isqrt(val, stdext::isqrt(val)));
+    }
+}
+
+template <class T>
+constexpr bool test_gcd(const int count) {
+    for (int i = 0; i < count; ++i) {
+        for (int j = 0; j < count; ++j) {
+            const auto left  = static_cast<T>(i * 37 % 101);
+            const auto right = static_cast<T>(j * 53 % 97);
+            const auto div   = gcd(left, right);
+            if (left == 0 && right == 0) {
+                assert(div == 0);
+                continue;
+            }
+
+            assert(div > 0 && left % div == 0 && right % div == 0);
+            assert(gcd(static_cast<T>(left / div), static_cast<T>(right / div)) == 1);
+            assert(gcd(right, left) == div);
+            if constexpr (is_signed_v<T>) {
+                assert(gcd(static_cast<T>(-left), right) == div);
+                assert(gcd(static_cast<T>(-left), static_cast<T>(-right)) == div);
+            }
+        }
+    }
+
+    return true;
+}
+
+void test_gcd_wide() {
+    assert(gcd(0ULL, 0ULL) == 0);
+    assert(gcd(1ULL << 63, 1ULL << 40) == 1ULL << 40);
+    assert(gcd(UINT64_MAX, UINT64_MAX / 3) == UINT64_MAX / 3);
+    assert(gcd(INT64_MIN, INT64_MIN / 2) == static_cast<int64_t>(1ULL << 62));
+    assert(gcd(4'294'967'291ULL * 3'000'000'007, 4'294'967'291ULL * 7) == 4'294'967'291ULL); // primes
+    // consecutive Fibonacci numbers are the slowest case for Euclid's algorithm
+    uint64_t prev = 1;
+    uint64_t cur  = 1;
+    for (int i = 0; i < 90; ++i) {
+        assert(gcd(prev, cur) == 1);
+        if (cur <= UINT32_MAX) {
+            assert(lcm(prev, cur) == prev * cur);
+        }
+
+        const uint64_t next = prev + cur;
+        prev                = cur;
+        cur                 = next;
+    }
+
+    assert(lcm(-4, 6) == 12);
+    assert(lcm(0, 6) == 0);
+}
+
+int main() {
+    static_assert(stdext::isqrt(0) == 0);
+    static_assert(stdext::isqrt(99) == 9);
+    static_assert(stdext::isqrt(100) == 10);
+    static_assert(stdext::isqrt(UINT64_MAX) == 0xFFFF'FFFF);
+    static_assert(test_isqrt<signed char>(100));
+    static_assert(test_isqrt<unsigned short>(100));
+    static_assert(test_isqrt<int>(100));
+    static_assert(test_isqrt<unsigned long long>(100));
+    test_isqrt<signed char>(1000);
+    test_isqrt<unsigned char>(1000);
+    test_isqrt<short>(1000);
+    test_isqrt<unsigned short>(1000);
+    test_isqrt<int>(1000);
+    test_isqrt<unsigned int>(1000);
+    test_isqrt<long long>(1000);
+    test_isqrt<unsigned long long>(1000);
+    test_isqrt_64();
+
+    static_assert(test_gcd<unsigned char>(20));
+    static_assert(test_gcd<int>(20));
+    test_gcd<signed char>(200);
+    test_gcd<unsigned char>(200);
+    test_gcd<short>(200);
+    test_gcd<int>(200);
+    test_gcd<unsigned int>(200);
+    test_gcd<long long>(200);
+    test_gcd<unsigned long long>(200);
+    test_gcd_wide();
+}
@@ -0,0 +1,173 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <experimental/generator>
+#include <memory>
+#include <memory_resource>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace std::experimental;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using pmr_generator = generator<int, pmr::polymorphic_allocator<char>>;
+
+STATIC_ASSERT(is_nothrow_move_constructible_v<generator<int>>);
+STATIC_ASSERT(is_nothrow_move_assignable_v<generator<int>>);
+#ifdef __cpp_lib_concepts
+STATIC_ASSERT(ranges::view<generator<int>>);
+STATIC_ASSERT(ranges::input_range<pmr_generator>);
+#endif // __cpp_lib_concepts
+
+class counting_resource : public pmr::memory_resource {
+public:
+    int allocations   = 0;
+    int deallocations = 0;
+
+private:
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        assert(align >= __STDCPP_DEFAULT_NEW_ALIGNMENT__); // frames are never under-aligned
+        ++allocations;
+        return pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        ++deallocations;
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+generator<int> iota(const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+pmr_generator iota_from(allocator_arg_t, pmr::polymorphic_allocator<char>, const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+pmr_generator iota_default(const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield i;
+    }
+}
+
+struct widget {
+    int base;
+
+    pmr_generator values(allocator_arg_t, pmr::memory_resource*) const {
+        co_yield base;
+        co_yield base + 1;
+    }
+};
+
+generator<long long, recycling_allocator<char>> squares(const int n) {
+    for (int i = 0; i < n; ++i) {
+        co_yield static_cast<long long>(i) * i;
+    }
+}
+
+generator<long long, recycling_allocator<char>> even_squares(const int n) {
+    for (const long long value : squares(n)) {
+        if (value % 2 == 0) {
+            co_yield value;
+        }
+    }
+}
+
+template <class Generator>
+int sum(Generator&& gen) {
+    int result = 0;
+    for (const int value : gen) {
+        result += value;
+    }
+
+    return result;
+}
+
+void test_polymorphic_allocator() {
+    counting_resource resource;
+    assert(sum(iota_from(allocator_arg, &resource, 4)) == 6);
+
+    const widget w{7};
+    assert(sum(w.values(allocator_arg, &resource)) == 15);
+    assert(resource.allocations == 2);
+    assert(resource.deallocations == 2);
+
+    pmr::set_default_resource(&resource); // used when no allocator is passed
+    assert(sum(iota_default(3)) == 3);
+    pmr::set_default_resource(nullptr);
+    assert(resource.allocations == 3);
+    assert(resource.deallocations == 3);
+}
+
+void test_recycling_allocator() {
+    assert(recycling_allocator<int>{} == recycling_allocator<char>{});
+
+    for (int i = 0; i < 1000; ++i) { // after the first pass, both frames come from this thread's cache
+        long long total = 0;
+        for (const long long value : even_squares(10)) {
+            total += value;
+        }
+
+        assert(total == 0 + 4 + 16 + 36 + 64);
+    }
+
+    // frames may be freed on a different thread from the one that allocated them
+    auto gen = squares(3);
+    thread([&gen] {
+        long long total = 0;
+        for (const long long value : gen) {
+            total += value;
+        }
+
+        assert(total == 5);
+        gen = {};
+    }).join();
+
+    recycling_allocator<int> al;
+    int* const ptr = al.allocate(1000); // too large to cache
+    ptr[999]       = 42;
+    al.deallocate(ptr, 1000);
+}
+
+void test_move() {
+    generator<int> first  = iota(3);
+    generator<int> second = iota(4);
+    first                 = move(second); // destroys the frame first held
+    assert(sum(first) == 6);
+    assert(second.begin() == second.end());
+}
+
+#ifdef __cpp_lib_concepts
+void test_range_algorithms() {
+    assert(ranges::count_if(iota(10), [](const int value) { return value % 2 != 0; }) == 5);
+
+    int total = 0;
+    ranges::for_each(iota_default(5), [&total](const int value) { total += value; });
+    assert(total == 10);
+}
+#endif // __cpp_lib_concepts
+
+int main() {
+    test_polymorphic_allocator();
+    test_recycling_allocator();
+    test_move();
+#ifdef __cpp_lib_concepts
+    test_range_algorithms();
+#endif // __cpp_lib_concepts
+}
@@ -0,0 +1,221 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _ENABLE_STL_HASH_NODE_RECYCLING
+
+#include <assert.h>
+#include <functional>
+#include <memory>
+#include <stddef.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+using namespace std;
+using stdext::clear_and_recycle;
+using stdext::shrink_to_fit;
+
+size_t allocations = 0;
+size_t live_blocks = 0;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        ++allocations;
+        ++live_blocks;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        --live_blocks;
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+struct throwing_hash { // not noexcept, so clear_and_recycle resets every bucket
+    size_t operator()(const int i) const {
+        return hash<int>{}(i);
+    }
+};
+
+template <class Set>
+void insert_values(Set& s, const int count) {
+    for (int i = 0; i < count; ++i) {
+        s.insert(i);
+    }
+}
+
+template <class Set>
+void test_refill_allocates_nothing() {
+    {
+        Set s;
+        insert_values(s, 1000);
+        const size_t buckets = s.bucket_count();
+        const size_t blocks  = live_blocks;
+
+        clear_and_recycle(s);
+        assert(s.empty());
+        assert(s.begin() == s.end());
+        assert(s.bucket_count() == buckets);
+        assert(live_blocks == blocks); // the nodes are kept
+        for (size_t bucket = 0; bucket < s.bucket_count(); ++bucket) {
+            assert(s.bucket_size(bucket) == 0);
+        }
+
+        const size_t before = allocations;
+        insert_values(s, 1000);
+        assert(allocations == before);
+        assert(s.size() == 1000);
+        for (int i = 0; i < 1000; ++i) {
+            assert(s.count(i) == 1);
+        }
+
+        // more elements than there are recycled nodes allocate the rest
+        clear_and_recycle(s);
+        insert_values(s, 1500);
+        assert(allocations > before);
+        assert(s.size() == 1500);
+        clear_and_recycle(s);
+    }
+
+    assert(live_blocks == 0); // the destructor frees the recycled nodes
+}
+
+void test_few_elements_in_many_buckets() {
+    unordered_set<int, hash<int>, equal_to<int>, counting_allocator<int>> s;
+    s.rehash(4096);
+    s.insert({1, 2, 3});
+    clear_and_recycle(s); // resets only the buckets of the three elements
+    assert(s.bucket_count() >= 4096);
+    for (size_t bucket = 0; bucket < s.bucket_count(); ++bucket) {
+        assert(s.bucket_size(bucket) == 0);
+    }
+
+    const size_t before = allocations;
+    s.insert({4, 5, 6});
+    assert(allocations == before);
+    assert(s.size() == 3 && s.count(5) == 1 && s.count(1) == 0);
+}
+
+void test_maps() {
+    using map_type = unordered_map<int, string, hash<int>, equal_to<int>, counting_allocator<pair<const int, string>>>;
+    map_type m;
+    for (int i = 0; i < 100; ++i) {
+        m.emplace(i, to_string(i));
+    }
+
+    clear_and_recycle(m);
+    const size_t before = allocations;
+    for (int i = 0; i < 25; ++i) {
+        m[i] = "x"; // short strings, so only the nodes could allocate
+        m.try_emplace(i + 25, "y");
+        m.insert_or_assign(i + 50, "z");
+        m.insert({i + 75, "w"});
+    }
+
+    assert(allocations == before);
+    assert(m.size() == 100);
+    assert(m.at(3) == "x" && m.at(30) == "y" && m.at(60) == "z" && m.at(80) == "w");
+
+    unordered_multimap<int, int, hash<int>, equal_to<int>, counting_allocator<pair<const int, int>>> mm;
+    for (int i = 0; i < 100; ++i) {
+        mm.emplace(i % 10, i);
+    }
+
+    clear_and_recycle(mm);
+    const size_t multi_before = allocations;
+    for (int i = 0; i < 100; ++i) {
+        mm.emplace(i % 5, i);
+    }
+
+    assert(allocations == multi_before);
+    assert(mm.count(4) == 20);
+}
+
+void test_shrink_to_fit() {
+    {
+        unordered_set<int, hash<int>, equal_to<int>, counting_allocator<int>> s;
+        insert_values(s, 1000);
+        const size_t buckets = s.bucket_count();
+        clear_and_recycle(s);
+        const size_t blocks = live_blocks;
+
+        shrink_to_fit(s);
+        assert(live_blocks + 1000 == blocks); // the recycled nodes; the buckets are replaced by fewer
+        assert(s.bucket_count() == 8);
+        assert(s.bucket_count() < buckets);
+
+        insert_values(s, 100);
+        s.rehash(4096);
+        shrink_to_fit(s); // keeps the elements, in as few buckets as max_load_factor() allows
+        assert(s.size() == 100);
+        assert(s.bucket_count() == 128);
+        assert(s.load_factor() <= s.max_load_factor());
+        for (int i = 0; i < 100; ++i) {
+            assert(s.count(i) == 1);
+        }
+
+        const size_t same_buckets = s.bucket_count();
+        shrink_to_fit(s);
+        assert(s.bucket_count() == same_buckets);
+    }
+
+    unordered_set<int> plain; // without recycled nodes, only the buckets shrink
+    plain.rehash(1024);
+    plain.insert(1);
+    shrink_to_fit(plain);
+    assert(plain.bucket_count() == 8);
+    assert(plain.count(1) == 1);
+}
+
+void test_swap_and_move() {
+    using set_type = unordered_set<int, hash<int>, equal_to<int>, counting_allocator<int>>;
+    {
+        set_type a;
+        set_type b;
+        insert_values(a, 100);
+        clear_and_recycle(a);
+        a.swap(b); // the recycled nodes go with the allocator they came from
+
+        const size_t before = allocations;
+        insert_values(b, 100);
+        assert(allocations == before);
+
+        set_type c = move(b);
+        b          = move(c);
+        clear_and_recycle(b);
+        set_type d;
+        d = move(b);
+        insert_values(b, 10);
+    }
+
+    assert(live_blocks == 0);
+}
+
+int main() {
+    test_refill_allocates_nothing<unordered_set<int, hash<int>, equal_to<int>, counting_allocator<int>>>();
+    test_refill_allocates_nothing<unordered_set<int, throwing_hash, equal_to<int>, counting_allocator<int>>>();
+    test_refill_allocates_nothing<unordered_multiset<int, hash<int>, equal_to<int>, counting_allocator<int>>>();
+    test_few_elements_in_many_buckets();
+    test_maps();
+    test_shrink_to_fit();
+    test_swap_and_move();
+    assert(live_blocks == 0);
+}
@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _ENABLE_STL_HASH_STATISTICS
+
+#include <assert.h>
+#include <stddef.h>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace std;
+using stdext::hash_table_statistics;
+using stdext::hash_table_stats;
+
+struct bucketed_hash { // puts 10 consecutive keys in each bucket
+    size_t operator()(const int i) const noexcept {
+        return static_cast<size_t>(i / 10);
+    }
+};
+
+void test_fresh_container() {
+    const unordered_set<int> s;
+    const hash_table_statistics stats = hash_table_stats(s);
+    assert(stats.size == 0);
+    assert(stats.used_buckets == 0);
+    assert(stats.max_bucket_size == 0);
+    assert(stats.rehash_count == 0);
+    assert(stats.rehash_seconds == 0.0);
+    assert(stats.lookup_count == 0);
+    assert(stats.average_lookup_length == 0.0);
+}
+
+void test_rehashes_and_lookups() {
+    unordered_map<int, int> m;
+    for (int i = 0; i < 1000; ++i) {
+        m.emplace(i, i);
+    }
+
+    const auto after_inserts = hash_table_stats(m);
+    assert(after_inserts.size == 1000);
+    assert(after_inserts.bucket_count == m.bucket_count());
+    assert(after_inserts.rehash_count > 0);
+    assert(after_inserts.rehash_seconds >= 0.0);
+    assert(after_inserts.lookup_count >= 1000); // each insertion looked for a duplicate
+    assert(after_inserts.max_bucket_size <= after_inserts.size);
+
+    for (int i = 0; i < 500; ++i) {
+        assert(m.find(i) != m.end());
+    }
+
+    const auto after_finds = hash_table_stats(m);
+    assert(after_finds.lookup_count == after_inserts.lookup_count + 500);
+    assert(after_finds.rehash_count == after_inserts.rehash_count);
+
+    m.rehash(m.bucket_count() * 4);
+    assert(hash_table_stats(m).rehash_count == after_inserts.rehash_count + 1);
+
+    const auto copy = m;
+    assert(hash_table_stats(copy).lookup_count == 1000); // counted afresh by the copy's own insertions
+}
+
+void test_chain_lengths() {
+    unordered_set<int, bucketed_hash> s;
+    s.max_load_factor(100.0f);
+    for (int i = 0; i < 100; ++i) {
+        s.insert(i);
+    }
+
+    s.rehash(16); // one bucket for each hash value
+    const auto before = hash_table_stats(s);
+    assert(before.max_bucket_size == 10);
+    assert(before.used_buckets == 10);
+
+    (void) s.count(0); // the first element of its bucket, which lookups reach last
+    const auto after = hash_table_stats(s);
+    assert(after.lookup_count == before.lookup_count + 1);
+    assert(after.max_lookup_length == 10);
+    assert(after.average_lookup_length > 0.0);
+}
+
+int main() {
+    test_fresh_container();
+    test_rehashes_and_lookups();
+    test_chain_lengths();
+}
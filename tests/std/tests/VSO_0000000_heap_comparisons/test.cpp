@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// The heap algorithms sift the hole left by the removed root all the way to a leaf with one comparison per level
+// and then push the displaced element back up (Floyd's bottom-up heapsort). This keeps make_heap under about 1.65N
+// comparisons on random input (2N at worst) and sort_heap under about N log2 N, versus 1.88N and 2N log2 N for a
+// top-down sift. Pin those bounds so a regression to the top-down form is noticed.
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <functional>
+#include <random>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+using namespace std;
+
+struct counting_less {
+    size_t* count;
+
+    bool operator()(const uint32_t left, const uint32_t right) const {
+        ++*count;
+        return left < right;
+    }
+};
+
+size_t floor_log2(size_t n) {
+    size_t result = 0;
+    while (n > 1) {
+        n >>= 1;
+        ++result;
+    }
+
+    return result;
+}
+
+template <class Container>
+void check_comparisons(Container c, const size_t make_heap_limit) {
+    const size_t n = c.size();
+    size_t count   = 0;
+    const counting_less pred{&count};
+
+    make_heap(c.begin(), c.end(), pred);
+    assert(is_heap(c.begin(), c.end()));
+    assert(count <= make_heap_limit);
+
+    Container popped = c;
+    count            = 0;
+    pop_heap(popped.begin(), popped.end(), pred);
+    assert(is_heap(popped.begin(), popped.end() - 1));
+    assert(count <= 2 * floor_log2(n) + 1);
+
+    count = 0;
+    sort_heap(c.begin(), c.end(), pred);
+    assert(is_sorted(c.begin(), c.end()));
+    assert(count <= n * (floor_log2(n) + 1));
+
+#if _HAS_CXX20
+    ranges::shuffle(c, mt19937{static_cast<uint32_t>(n)});
+    count = 0;
+    ranges::make_heap(c, pred);
+    assert(ranges::is_heap(c));
+    assert(count <= 2 * n);
+
+    count = 0;
+    ranges::sort_heap(c, pred);
+    assert(ranges::is_sorted(c));
+    assert(count <= n * (floor_log2(n) + 1));
+#endif // _HAS_CXX20
+}
+
+int main() {
+    mt19937 gen(1729);
+    for (const size_t n : {size_t{1000}, size_t{4096}, size_t{100000}}) {
+        vector<uint32_t> random_input(n);
+        for (auto& x : random_input) {
+            x = static_cast<uint32_t>(gen());
+        }
+
+        vector<uint32_t> ascending(n);
+        for (size_t i = 0; i < n; ++i) {
+            ascending[i] = static_cast<uint32_t>(i);
+        }
+
+        vector<uint32_t> descending(ascending.rbegin(), ascending.rend());
+
+        check_comparisons(random_input, n * 7 / 4);
+        check_comparisons(ascending, 2 * n);
+        check_comparisons(descending, 2 * n);
+        check_comparisons(deque<uint32_t>(random_input.begin(), random_input.end()), n * 7 / 4);
+    }
+}
@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Covers the read buffer fast paths of getline, string's istreambuf_iterator constructor, and copy from
+// istreambuf_iterator, against stream buffers that refill a few characters at a time and that have no buffer at all
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class chunky_buf : public streambuf { // hands out its source three characters at a time
+public:
+    explicit chunky_buf(const char* const src) : src_(src) {}
+
+protected:
+    int_type underflow() override {
+        if (src_[pos_] == '\0') {
+            return traits_type::eof();
+        }
+
+        size_t n = 0;
+        for (; n < sizeof(buf_) && src_[pos_] != '\0'; ++n, ++pos_) {
+            buf_[n] = src_[pos_];
+        }
+
+        setg(buf_, buf_, buf_ + n);
+        return traits_type::to_int_type(buf_[0]);
+    }
+
+private:
+    const char* src_;
+    size_t pos_ = 0;
+    char buf_[3];
+};
+
+class unbuffered_buf : public streambuf { // never sets up a read buffer
+public:
+    explicit unbuffered_buf(const char* const src) : src_(src) {}
+
+protected:
+    int_type underflow() override {
+        return src_[pos_] == '\0' ? traits_type::eof() : traits_type::to_int_type(src_[pos_]);
+    }
+
+    int_type uflow() override {
+        return src_[pos_] == '\0' ? traits_type::eof() : traits_type::to_int_type(src_[pos_++]);
+    }
+
+private:
+    const char* src_;
+    size_t pos_ = 0;
+};
+
+template <class Buf>
+void test_getline() {
+    Buf buf("ab\ncdefgh\n\nxy");
+    istream is(&buf);
+    string line;
+
+    assert(getline(is, line) && line == "ab");
+    assert(getline(is, line) && line == "cdefgh");
+    assert(getline(is, line) && line.empty());
+    assert(getline(is, line) && line == "xy");
+    assert(is.eof() && !is.fail());
+    assert(!getline(is, line));
+
+    Buf delimited("one;two;;three");
+    istream is2(&delimited);
+    vector<string> fields;
+    while (getline(is2, line, ';')) {
+        fields.push_back(line);
+    }
+
+    assert((fields == vector<string>{"one", "two", "", "three"}));
+}
+
+template <class Buf>
+void test_string_construction() {
+    const char text[] = "the quick brown fox jumps over the lazy dog, again and again and again";
+
+    Buf buf(text);
+    const string s{istreambuf_iterator<char>(&buf), istreambuf_iterator<char>()};
+    assert(s == text);
+
+    // a peeked iterator still reads from the current position
+    Buf buf2(text);
+    istreambuf_iterator<char> first(&buf2);
+    assert(*first == 't');
+    const string s2(first, istreambuf_iterator<char>());
+    assert(s2 == text);
+
+    Buf empty("");
+    assert(string(istreambuf_iterator<char>(&empty), istreambuf_iterator<char>()).empty());
+}
+
+template <class Buf>
+void test_copy() {
+    const char text[] = "copying a stream buffer, one read buffer at a time";
+
+    Buf buf(text);
+    char out[sizeof(text)]{};
+    char* const last = copy(istreambuf_iterator<char>(&buf), istreambuf_iterator<char>(), out);
+    assert(last == out + sizeof(text) - 1);
+    assert(strcmp(out, text) == 0);
+
+    Buf buf2(text);
+    vector<char> v;
+    copy(istreambuf_iterator<char>(&buf2), istreambuf_iterator<char>(), back_inserter(v));
+    assert(string(v.begin(), v.end()) == text);
+}
+
+void test_large() {
+    // longer than any stream buffer's get area, so the fast paths must refill many times
+    string big;
+    for (int i = 0; i < 20000; ++i) {
+        big += static_cast<char>('a' + i % 26);
+        if (i % 1000 == 999) {
+            big += '\n';
+        }
+    }
+
+    istringstream iss(big);
+    const string copied{istreambuf_iterator<char>(iss), istreambuf_iterator<char>()};
+    assert(copied == big);
+
+    iss.clear();
+    iss.seekg(0);
+    string line;
+    size_t lines = 0;
+    while (getline(iss, line)) {
+        assert(line.size() == 1000);
+        ++lines;
+    }
+
+    assert(lines == 20);
+
+    wistringstream wiss(L"wide\nlines");
+    wstring wline;
+    assert(getline(wiss, wline) && wline == L"wide");
+    assert(getline(wiss, wline) && wline == L"lines");
+    assert(wiss.eof());
+}
+
+int main() {
+    test_getline<stringbuf>();
+    test_getline<chunky_buf>();
+    test_getline<unbuffered_buf>();
+
+    test_string_construction<chunky_buf>();
+    test_string_construction<unbuffered_buf>();
+
+    test_copy<chunky_buf>();
+    test_copy<unbuffered_buf>();
+
+    test_large();
+}
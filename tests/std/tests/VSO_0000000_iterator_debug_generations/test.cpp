@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <test_death.hpp>
+
+using namespace std;
+
+static_assert(_ITERATOR_DEBUG_LEVEL == 1 && _ITERATOR_DEBUG_GENERATIONS == 1, "this test needs both settings");
+
+// the generation takes the place of the unused link to the next iterator, so the layout of IDL=1 is unchanged
+static_assert(sizeof(vector<int>::iterator) == 3 * sizeof(void*), "unexpected vector iterator size");
+static_assert(sizeof(_Container_proxy) == 2 * sizeof(void*), "unexpected container proxy size");
+
+void test_valid_iterators() {
+    vector<int> v;
+    v.reserve(10);
+    v.push_back(10);
+    v.push_back(20);
+    const auto first = v.begin();
+    v.push_back(30); // no reallocation, so first stays valid
+    assert(*first == 10);
+    assert(first == v.begin());
+
+    // copies carry the generation along
+    auto copy = first;
+    ++copy;
+    assert(*copy == 20);
+
+    v.push_back(40);
+    v.reserve(100); // reallocates; iterators obtained afterwards are fine
+    assert(*v.begin() == 10);
+    assert(v.end() - v.begin() == 4);
+
+    // iterators follow their elements through swap
+    vector<int> other{1, 2, 3};
+    const auto other_first = other.begin();
+    v.swap(other);
+    assert(*other_first == 1);
+    assert(other_first == v.begin());
+
+    // moving a vector moves its proxy, so iterators stay valid too
+    vector<int> moved(move(v));
+    assert(*other_first == 1);
+    assert(other_first == moved.begin());
+
+    deque<int> d{1, 2, 3};
+    auto d_it = d.begin();
+    d.push_back(4);
+    d_it = d.begin(); // reassignment from a current iterator clears the staleness
+    assert(*d_it == 1);
+
+    string s = "short";
+    const auto s_it = s.begin();
+    s[0] = 'S';
+    assert(*s_it == 'S');
+}
+
+void test_vector_reallocation() {
+    vector<int> v{10, 20};
+    v.shrink_to_fit();
+    const auto it = v.begin();
+    v.push_back(30);
+    (void) *it; // iterator used after its container was reallocated
+}
+
+void test_vector_clear() {
+    vector<int> v{10, 20};
+    const auto it = v.begin();
+    v.clear();
+    v.push_back(30);
+    (void) *it; // iterator used after its container was cleared
+}
+
+void test_vector_assign_compare() {
+    vector<int> v{10, 20};
+    const auto it = v.begin();
+    v = {30, 40, 50};
+    (void) (it == v.begin()); // stale iterator compared with a current one
+}
+
+void test_stale_copy() {
+    vector<int> v{10, 20};
+    v.shrink_to_fit();
+    const auto it = v.begin();
+    v.push_back(30);
+    auto copy = it; // copying a stale iterator is allowed, but the copy is stale too
+    ++copy;
+}
+
+void test_deque_push_back() {
+    deque<int> d{1, 2, 3};
+    auto it = d.begin();
+    d.push_back(4);
+    ++it; // push_back invalidates every deque iterator
+}
+
+void test_string_reallocation() {
+    string s = "short";
+    const auto it = s.begin();
+    s.assign(100, 'x');
+    (void) *it; // iterator used after its string was reallocated
+}
+
+int main(int argc, char* argv[]) {
+    std_testing::death_test_executive exec(test_valid_iterators);
+
+    exec.add_death_tests({
+        test_vector_reallocation,
+        test_vector_clear,
+        test_vector_assign_compare,
+        test_stale_copy,
+        test_deque_push_back,
+        test_string_reallocation,
+    });
+
+    return exec.run(argc, argv);
+}
@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <memory_resource>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+using namespace std;
+using stdext::pmr::large_page_resource;
+
+bool is_aligned(const void* const p, const size_t align) {
+    return (reinterpret_cast<uintptr_t>(p) & (align - 1)) == 0;
+}
+
+void test_direct(large_page_resource& lpr) {
+    for (const size_t bytes : {size_t{0}, size_t{1}, size_t{4096}, size_t{100000}, size_t{3} << 20}) {
+        for (const size_t align : {size_t{1}, size_t{64}, size_t{1} << 16, size_t{1} << 22}) {
+            void* const p = lpr.allocate(bytes, align);
+            assert(is_aligned(p, align));
+            memset(p, 0xCD, bytes);
+            lpr.deallocate(p, bytes, align);
+        }
+    }
+}
+
+void test_as_upstream(large_page_resource& lpr) {
+    {
+        pmr::monotonic_buffer_resource mbr{1 << 20, &lpr};
+        pmr::vector<int> v{&mbr};
+        for (int i = 0; i < 1000000; ++i) {
+            v.push_back(i);
+        }
+        assert(v[123456] == 123456);
+    }
+
+    {
+        pmr::unsynchronized_pool_resource pool{{0, 1 << 20}, &lpr};
+        pmr::vector<pmr::vector<char>> vs{&pool};
+        for (size_t i = 0; i < 100; ++i) {
+            vs.emplace_back(i * 1000, 'x');
+        }
+        assert(vs[99].size() == 99000);
+        assert(vs[99][98999] == 'x');
+    }
+}
+
+int main() {
+    (void) large_page_resource::large_page_size();
+
+    large_page_resource lpr;
+    assert(lpr == lpr);
+    test_direct(lpr);
+    test_as_upstream(lpr);
+
+    large_page_resource small_pages_only{false};
+    assert(lpr != small_pages_only);
+    test_direct(small_pages_only);
+    test_as_upstream(small_pages_only);
+}
@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Long lists are sorted through an array of node pointers; check that this path and the short-list merge path
+// agree and stay stable, and that the pointer path leaves the list untouched when the predicate throws.
+
+#include <algorithm>
+#include <assert.h>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <random>
+#include <stddef.h>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+using element = pair<int, size_t>; // (key, original position)
+
+struct key_less {
+    bool operator()(const element& left, const element& right) const {
+        return left.first < right.first;
+    }
+};
+
+struct key_greater {
+    bool operator()(const element& left, const element& right) const {
+        return left.first > right.first;
+    }
+};
+
+struct throwing_less {
+    size_t* remaining;
+
+    bool operator()(const element& left, const element& right) const {
+        if (--*remaining == 0) {
+            throw 42;
+        }
+
+        return left.first < right.first;
+    }
+};
+
+vector<element> make_input(const size_t n, const int distinct_keys, mt19937& gen) {
+    vector<element> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        v[i] = {static_cast<int>(gen() % static_cast<unsigned int>(distinct_keys)), i};
+    }
+
+    return v;
+}
+
+template <class Container, class Pred>
+void check_sort(const vector<element>& input, Pred pred) {
+    vector<element> expected = input;
+    stable_sort(expected.begin(), expected.end(), pred);
+
+    Container c(input.begin(), input.end());
+    c.sort(pred);
+    assert(equal(c.begin(), c.end(), expected.begin(), expected.end()));
+}
+
+template <class Container>
+void check_throwing_sort(const vector<element>& input) {
+    Container c(input.begin(), input.end());
+    size_t remaining = input.size();
+    try {
+        c.sort(throwing_less{&remaining});
+        assert(false);
+    } catch (int) {
+    }
+
+    // no link is rewritten before the last comparison
+    assert(equal(c.begin(), c.end(), input.begin(), input.end()));
+}
+
+int main() {
+    mt19937 gen(1729);
+    for (const size_t n : {size_t{0}, size_t{1}, size_t{100}, size_t{511}, size_t{512}, size_t{513}, size_t{4097},
+             size_t{100000}}) {
+        for (const int distinct_keys : {1, 7, 1000000}) {
+            const auto input = make_input(n, distinct_keys, gen);
+            check_sort<list<element>>(input, key_less{});
+            check_sort<list<element>>(input, key_greater{});
+            check_sort<forward_list<element>>(input, key_less{});
+            check_sort<forward_list<element>>(input, key_greater{});
+        }
+
+        if (n >= 4097) {
+            const auto input = make_input(n, 1000, gen);
+            check_throwing_sort<list<element>>(input);
+            check_throwing_sort<forward_list<element>>(input);
+        }
+    }
+
+    { // already sorted and reversed input
+        vector<element> ascending;
+        for (size_t i = 0; i < 10000; ++i) {
+            ascending.emplace_back(static_cast<int>(i / 3), i);
+        }
+
+        vector<element> descending(ascending.rbegin(), ascending.rend());
+        check_sort<list<element>>(ascending, key_less{});
+        check_sort<list<element>>(descending, key_less{});
+        check_sort<forward_list<element>>(ascending, key_less{});
+        check_sort<forward_list<element>>(descending, key_less{});
+    }
+}
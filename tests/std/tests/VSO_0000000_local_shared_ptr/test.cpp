@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <memory>
+#include <string>
+#include <utility>
+
+using namespace std;
+using stdext::allocate_local_shared;
+using stdext::local_shared_ptr;
+using stdext::make_local_shared;
+
+struct base {
+    virtual ~base() = default;
+};
+
+struct widget : base, enable_shared_from_this<widget> {
+    static int live;
+
+    widget(const int id_, string name_) : id(id_), name(move(name_)) {
+        ++live;
+    }
+
+    widget(const widget&) = delete;
+    widget& operator=(const widget&) = delete;
+
+    ~widget() {
+        --live;
+    }
+
+    int id;
+    string name;
+};
+
+int widget::live = 0;
+
+void test_make_local_shared() {
+    {
+        auto p = make_local_shared<widget>(5, "five");
+        assert(p->id == 5);
+        assert(p->name == "five");
+        assert(p.local_use_count() == 1);
+        assert(widget::live == 1);
+
+        local_shared_ptr<base> copy = p;
+        assert(p.local_use_count() == 2);
+
+        // copies share one strong reference in the control block
+        shared_ptr<widget> shared = p;
+        assert(shared.use_count() == 2);
+        assert(shared->shared_from_this() == shared);
+
+        const weak_ptr<widget> weak = p;
+        p.reset();
+        copy.reset();
+        assert(widget::live == 1);
+        assert(!weak.expired());
+        shared.reset();
+        assert(weak.expired());
+    }
+
+    assert(widget::live == 0);
+
+    const auto number = allocate_local_shared<const int>(allocator<int>{}, 7);
+    assert(*number == 7);
+    local_shared_ptr<const void> erased = number;
+    assert(number.local_use_count() == 2);
+    erased = nullptr;
+    assert(number.local_use_count() == 1);
+}
+
+void test_adopting_constructors() {
+    {
+        local_shared_ptr<widget> raw(new widget(1, "one"));
+        assert(raw->shared_from_this().get() == raw.get());
+
+        local_shared_ptr<widget> unique(make_unique<widget>(2, "two"));
+        assert(raw != unique);
+        swap(raw, unique);
+        assert(raw->id == 2);
+        assert(unique->id == 1);
+
+        bool deleted = false;
+        {
+            local_shared_ptr<int> custom(new int(3), [&deleted](int* const ptr) {
+                deleted = true;
+                delete ptr;
+            });
+        }
+        assert(deleted);
+    }
+
+    assert(widget::live == 0);
+
+    auto shared = make_shared<widget>(3, "three");
+    {
+        local_shared_ptr<base> group(shared);
+        assert(group.local_use_count() == 1);
+        assert(shared.use_count() == 2);
+
+        local_shared_ptr<int> alias(group, &shared->id);
+        assert(*alias == 3);
+        assert(group.local_use_count() == 2);
+
+        local_shared_ptr<base> moved = move(group);
+        assert(!group);
+        assert(group == nullptr);
+        assert(moved.local_use_count() == 2);
+    }
+
+    assert(shared.use_count() == 1);
+
+    local_shared_ptr<widget> empty;
+    const shared_ptr<widget> emptyShared = empty;
+    assert(!emptyShared);
+    assert(emptyShared.use_count() == 0);
+    assert(empty.local_use_count() == 0);
+}
+
+int main() {
+    test_make_local_shared();
+    test_adopting_constructors();
+}
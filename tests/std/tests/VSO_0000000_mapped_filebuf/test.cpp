@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <string>
+#include <utility>
+
+using namespace std;
+
+const char* const filename     = "VSO_0000000_mapped_filebuf.txt";
+const char* const empty_name   = "VSO_0000000_mapped_filebuf_empty.txt";
+const wchar_t* const wide_name = L"VSO_0000000_mapped_filebuf.txt";
+const char* const missing_name = "VSO_0000000_mapped_filebuf_missing.txt";
+const char contents[]          = "meow 42\r\npurr 1729\nhiss";
+constexpr size_t contents_size = sizeof(contents) - 1;
+
+void write_file(const char* const name, const char* const text, const size_t size) {
+    ofstream out(name, ios_base::binary);
+    out.write(text, static_cast<streamsize>(size));
+    assert(out);
+}
+
+void test_read() {
+    stdext::mapped_filebuf buf;
+    assert(!buf.is_open());
+    assert(buf.open(filename) == &buf);
+    assert(buf.is_open());
+    assert(buf.size() == contents_size);
+    assert(memcmp(buf.data(), contents, contents_size) == 0);
+    assert(!buf.open(filename)); // already open
+
+    istream in(&buf);
+    string word;
+    int number = 0;
+    in >> word >> number;
+    assert(word == "meow" && number == 42);
+
+    string line;
+    assert(getline(in, line) && line == "\r"); // no newline translation
+    assert(getline(in, line) && line == "purr 1729");
+    assert(getline(in, line) && line == "hiss");
+    assert(in.eof());
+
+    in.clear();
+    assert(in.seekg(5));
+    char chars[4]{};
+    assert(in.read(chars, 2) && memcmp(chars, "42", 2) == 0);
+    assert(in.tellg() == 7);
+    assert(in.seekg(-4, ios_base::end) && in.read(chars, 4) && memcmp(chars, "hiss", 4) == 0);
+    assert(!in.read(chars, 1) && in.gcount() == 0);
+
+    in.clear();
+    assert(in.seekg(0, ios_base::beg));
+    assert(in.get() == 'm');
+    assert(in.unget() && in.get() == 'm');
+    assert(!in.putback('x')); // the view is read-only
+    in.clear();
+
+    assert(buf.pubseekoff(1, ios_base::end) == streampos(-1));
+    assert(buf.pubseekoff(-1, ios_base::beg) == streampos(-1));
+    assert(buf.pubseekoff(0, ios_base::beg, ios_base::out) == streampos(-1));
+
+    buf.pubseekpos(0);
+    const string all{istreambuf_iterator<char>(&buf), istreambuf_iterator<char>()};
+    assert(all == contents);
+
+    assert(buf.close() == &buf);
+    assert(!buf.is_open());
+    assert(!buf.close());
+}
+
+void test_modes() {
+    stdext::mapped_filebuf buf;
+    assert(!buf.open(filename, ios_base::out));
+    assert(!buf.open(filename, ios_base::in | ios_base::out));
+    assert(!buf.open(filename, ios_base::in | ios_base::trunc));
+    assert(!buf.open(filename, ios_base::in | ios_base::app));
+
+    assert(buf.open(wide_name, ios_base::in | ios_base::binary | ios_base::ate));
+    assert(buf.pubseekoff(0, ios_base::cur) == streampos(static_cast<streamoff>(contents_size)));
+    assert(buf.sgetc() == char_traits<char>::eof());
+
+    stdext::mapped_filebuf moved(move(buf));
+    assert(moved.is_open() && !buf.is_open());
+    assert(moved.pubseekpos(1) == streampos(1));
+    assert(moved.sbumpc() == 'e');
+
+    buf = move(moved);
+    assert(buf.is_open() && !moved.is_open());
+    assert(buf.sgetc() == 'o');
+}
+
+void test_empty_and_missing() {
+    write_file(empty_name, "", 0);
+
+    stdext::mapped_filebuf buf;
+    assert(buf.open(string{empty_name}));
+    assert(buf.size() == 0);
+    assert(buf.sgetc() == char_traits<char>::eof());
+    assert(buf.pubseekoff(0, ios_base::end) == streampos(0));
+    assert(buf.close());
+
+    assert(!buf.open(missing_name));
+    assert(!buf.is_open());
+}
+
+int main() {
+    write_file(filename, contents, contents_size);
+
+    test_read();
+    test_modes();
+    test_empty_and_missing();
+
+    assert(remove(filename) == 0);
+    assert(remove(empty_name) == 0);
+}
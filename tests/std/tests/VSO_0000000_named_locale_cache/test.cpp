@@ -0,0 +1,82 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <locale>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+struct comma_numpunct : numpunct<char> {
+    char do_decimal_point() const override {
+        return ',';
+    }
+};
+
+template <class Facet>
+const Facet* facet_of(const locale& loc) {
+    return &use_facet<Facet>(loc);
+}
+
+void test_shared_facets() {
+    // constructing a name again shares the facets built the first time
+    const locale first("C");
+    const locale second("C");
+    const locale from_string(string("C"));
+    assert(facet_of<ctype<char>>(first) == facet_of<ctype<char>>(second));
+    assert(facet_of<numpunct<wchar_t>>(first) == facet_of<numpunct<wchar_t>>(from_string));
+    assert(first == second && first.name() == "C");
+
+    // a locale with only some named categories is built from scratch
+    const locale some("C", locale::numeric);
+    assert(use_facet<numpunct<char>>(some).decimal_point() == '.');
+}
+
+void test_cached_locale_unchanged() {
+    // replacing a facet copies the shared implementation rather than changing it
+    const locale named("C");
+    const locale replaced(named, new comma_numpunct);
+    assert(use_facet<numpunct<char>>(replaced).decimal_point() == ',');
+    assert(use_facet<numpunct<char>>(named).decimal_point() == '.');
+    assert(use_facet<numpunct<char>>(locale("C")).decimal_point() == '.');
+}
+
+void test_bad_names() {
+    for (int attempt = 0; attempt < 2; ++attempt) { // a failed construction isn't cached
+        try {
+            const locale bad("no such locale name");
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+    }
+}
+
+void test_concurrent_construction() {
+    vector<const ctype<char>*> facets(8);
+    vector<thread> threads;
+    for (size_t idx = 0; idx < facets.size(); ++idx) {
+        threads.emplace_back([&facets, idx] {
+            const locale loc("");
+            facets[idx] = &use_facet<ctype<char>>(loc);
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    const locale user_default("");
+    for (const auto facet : facets) {
+        assert(facet == &use_facet<ctype<char>>(user_default));
+    }
+}
+
+int main() {
+    test_shared_facets();
+    test_cached_locale_unchanged();
+    test_bad_names();
+    test_concurrent_construction();
+}
@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <functional>
+#include <random>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+using namespace std;
+
+enum class pattern { random, sorted, reversed, few_unique, all_equal, organ_pipe, sawtooth };
+
+const pattern all_patterns[] = {pattern::random, pattern::sorted, pattern::reversed, pattern::few_unique,
+    pattern::all_equal, pattern::organ_pipe, pattern::sawtooth};
+
+vector<int64_t> make_input(const pattern p, const size_t n, mt19937_64& gen) {
+    vector<int64_t> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        const auto val = static_cast<int64_t>(i);
+        switch (p) {
+        case pattern::random:
+            v[i] = static_cast<int64_t>(gen());
+            break;
+        case pattern::sorted:
+            v[i] = val;
+            break;
+        case pattern::reversed:
+            v[i] = -val;
+            break;
+        case pattern::few_unique:
+            v[i] = static_cast<int64_t>(gen() % 4);
+            break;
+        case pattern::all_equal:
+            v[i] = 7;
+            break;
+        case pattern::organ_pipe:
+            v[i] = i < n / 2 ? val : static_cast<int64_t>(n) - val;
+            break;
+        case pattern::sawtooth:
+            v[i] = val % 37;
+            break;
+        }
+    }
+
+    return v;
+}
+
+template <class Container, class Pred>
+void check_nth_element(Container c, const size_t nth, Pred pred) {
+    Container expected = c;
+    sort(expected.begin(), expected.end(), pred);
+    const auto nth_iter = c.begin() + static_cast<ptrdiff_t>(nth);
+    nth_element(c.begin(), nth_iter, c.end(), pred);
+    if (nth_iter == c.end()) {
+        return;
+    }
+
+    assert(*nth_iter == expected[nth]);
+    assert(none_of(c.begin(), nth_iter, [&](const auto& elem) { return pred(*nth_iter, elem); }));
+    assert(none_of(nth_iter + 1, c.end(), [&](const auto& elem) { return pred(elem, *nth_iter); }));
+    sort(c.begin(), c.end(), pred);
+    assert(c == expected);
+}
+
+void test_patterns() {
+    // exercise the branchless partition (arithmetic elements in contiguous storage with plain comparisons) and the
+    // general partition on the same inputs, across sizes around the insertion sort cutoff
+    mt19937_64 gen(1729);
+    for (const size_t n : {0, 1, 2, 31, 32, 33, 34, 100, 1000, 50000}) {
+        for (const auto p : all_patterns) {
+            const auto v = make_input(p, n, gen);
+            for (const size_t nth : {size_t{0}, n / 3, n / 2, n - (min)(n, size_t{1}), n}) {
+                check_nth_element(v, nth, less<>{});
+                check_nth_element(v, nth, greater<int64_t>{});
+                check_nth_element(deque<int64_t>(v.begin(), v.end()), nth, less<>{});
+            }
+        }
+    }
+}
+
+struct adversary {
+    // McIlroy's "A Killer Adversary for Quicksort": values are decided only when compared, so as to make every
+    // median guess a poor pivot
+    vector<size_t> values;
+    size_t gas;
+    size_t solid_count = 0;
+    size_t candidate   = 0;
+    size_t comparisons = 0;
+
+    explicit adversary(const size_t n) : values(n, n), gas(n) {}
+
+    bool compare(const size_t lhs, const size_t rhs) {
+        ++comparisons;
+        if (values[lhs] == gas && values[rhs] == gas) {
+            values[lhs == candidate ? lhs : rhs] = solid_count++;
+        }
+
+        if (values[lhs] == gas) {
+            candidate = lhs;
+        } else if (values[rhs] == gas) {
+            candidate = rhs;
+        }
+
+        return values[lhs] < values[rhs];
+    }
+};
+
+void test_adversary_is_linear() {
+    constexpr size_t n = 100000;
+    adversary adv(n);
+    vector<size_t> indices(n);
+    for (size_t i = 0; i < n; ++i) {
+        indices[i] = i;
+    }
+
+    nth_element(indices.begin(), indices.begin() + n / 2, indices.end(),
+        [&adv](const size_t lhs, const size_t rhs) { return adv.compare(lhs, rhs); });
+    assert(adv.comparisons < 20 * n);
+}
+
+#if _HAS_CXX20
+constexpr bool test_constexpr() {
+    int arr[200]{};
+    for (int i = 0; i < 200; ++i) {
+        arr[i] = (i * 37) % 101;
+    }
+
+    nth_element(begin(arr), begin(arr) + 150, end(arr));
+    const int nth = arr[150];
+    return all_of(begin(arr), begin(arr) + 150, [nth](const int elem) { return elem <= nth; })
+        && all_of(begin(arr) + 151, end(arr), [nth](const int elem) { return nth <= elem; });
+}
+
+static_assert(test_constexpr());
+#endif // _HAS_CXX20
+
+int main() {
+    test_patterns();
+    test_adversary_is_linear();
+}
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <ios>
+#include <iterator>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+template <class T>
+void test_sequence(const char* const input, const T expected_last, const int expected_count) {
+    istringstream iss(input);
+    T val{};
+    T last{};
+    int count = 0;
+    while (iss >> val) {
+        last = val;
+        ++count;
+    }
+
+    assert(count == expected_count);
+    assert(last == expected_last);
+    assert(iss.eof());
+}
+
+void test_integers() {
+    test_sequence<int>("1 -2 +3 0004 2147483647 -2147483648", -2147483647 - 1, 6);
+    test_sequence<long long>("9223372036854775807\n-9223372036854775808", (numeric_limits<long long>::min)(), 2);
+    test_sequence<unsigned long long>("18446744073709551615 00000000000000000000000001", 1, 2);
+
+    istringstream iss("12345x 2147483648 -1");
+    int i = 0;
+    assert(iss >> i && i == 12345);
+    assert(iss.get() == 'x');
+    assert(!(iss >> i)); // overflow still reports failbit
+    iss.clear();
+    unsigned int u = 0;
+    assert(iss >> u && u == (numeric_limits<unsigned int>::max)()); // "-1" keeps its strtoul meaning
+    assert(iss.eof());
+
+    // a field at the end of the read buffer sets eofbit
+    istringstream tail("42");
+    long l = 0;
+    assert(tail >> l && l == 42 && tail.eof());
+
+    istringstream bad("- 1 +");
+    assert(!(bad >> l) && l == 0);
+}
+
+void test_flags() {
+    istringstream iss("ff 17 0x10 10");
+    int i = 0;
+    assert(iss >> hex >> i && i == 0xff);
+    assert(iss >> oct >> i && i == 017);
+    iss.unsetf(ios_base::basefield);
+    assert(iss >> i && i == 0x10);
+    assert(iss >> dec >> i && i == 10);
+
+    istringstream hexfloats("1p4 2");
+    double d = 0.0;
+    assert(hexfloats >> hexfloat >> d && d == 16.0);
+    assert(hexfloats >> defaultfloat >> d && d == 2.0);
+}
+
+void test_floating() {
+    test_sequence<double>("1.5 -0.25 .5 5. 1e10 1E-5 -1.25e+2", -125.0, 7);
+    test_sequence<float>("0.1 3.5", 3.5f, 2);
+
+    istringstream iss("0.1 1.2.3 0x1p3 1e999 1e");
+    double d = 0.0;
+    assert(iss >> d && d == 0.1);
+    assert(iss >> d && d == 1.2);
+    assert(iss >> d && d == 0.3);
+    assert(iss >> d && d == 0.0);
+    assert(iss.get() == 'x');
+    assert(iss >> d && d == 1.0);
+    assert(iss.get() == 'p');
+    assert(iss >> d && d == 3.0);
+    assert(!(iss >> d) && d == 0.0); // overflow still reports failbit
+    iss.clear();
+    assert(!(iss >> d) && iss.eof()); // a dangling exponent is consumed and rejected
+
+    // fields longer than the fast path's buffer are still correctly rounded
+    const string long_field = "0." + string(100, '0') + "1 2";
+    istringstream long_iss(long_field);
+    assert(long_iss >> d && d == 1e-101);
+    assert(long_iss >> d && d == 2.0);
+
+    istringstream float_overflow("1e50");
+    float f = 0.0f;
+    assert(!(float_overflow >> f));
+}
+
+struct comma_numpunct : numpunct<char> {
+    char do_decimal_point() const override {
+        return ',';
+    }
+
+    char do_thousands_sep() const override {
+        return '.';
+    }
+
+    string do_grouping() const override {
+        return "\3";
+    }
+};
+
+void test_locales() {
+    // locales other than "C" use their numpunct facets
+    istringstream iss("1.234.567 2,5");
+    iss.imbue(locale(locale::classic(), new comma_numpunct));
+    int i = 0;
+    assert(iss >> i && i == 1234567);
+    double d = 0.0;
+    assert(iss >> d && d == 2.5);
+}
+
+struct pointer_num_get : num_get<char, const char*> {};
+
+void test_other_iterators() {
+    // num_get::get over a bounded range never reads past its end
+    const string str = "123456 7.5";
+    istringstream iss(str);
+    ios_base::iostate state = ios_base::goodbit;
+    long l                  = 0;
+    const auto& fac         = use_facet<num_get<char>>(iss.getloc());
+    auto it                 = fac.get(istreambuf_iterator<char>(iss), istreambuf_iterator<char>(), iss, state, l);
+    assert(l == 123456 && state == ios_base::goodbit && *it == ' ');
+
+    const pointer_num_get ptr_fac;
+    const char* first = str.c_str() + 7;
+    double d          = 0.0;
+    const char* last  = ptr_fac.get(first, first + 1, iss, state, d);
+    assert(last == first + 1 && d == 7.0 && state == ios_base::eofbit);
+}
+
+int main() {
+    test_integers();
+    test_flags();
+    test_floating();
+    test_locales();
+    test_other_iterators();
+}
@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstdio>
+#include <ios>
+#include <iomanip>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <streambuf>
+#include <string>
+
+using namespace std;
+
+template <class T>
+string put(const T val, const ios_base::fmtflags flags = ios_base::dec, const streamsize width = 0) {
+    ostringstream oss;
+    oss.flags(flags);
+    oss << setw(static_cast<int>(width)) << setfill('*') << val;
+    assert(oss.width() == 0);
+    return oss.str();
+}
+
+void test_integers() {
+    assert(put(0) == "0");
+    assert(put(-42) == "-42");
+    assert(put(42u) == "42");
+    assert(put(static_cast<short>(-7)) == "-7");
+    assert(put((numeric_limits<long>::min)()) == to_string((numeric_limits<long>::min)()));
+    assert(put((numeric_limits<long long>::min)()) == "-9223372036854775808");
+    assert(put((numeric_limits<unsigned long long>::max)()) == "18446744073709551615");
+
+    for (long long i = -100000; i <= 100000; i += 7) {
+        assert(put(i) == to_string(i));
+    }
+
+    assert(put(-42, ios_base::dec, 6) == "***-42");
+    assert(put(-42, ios_base::dec | ios_base::left, 6) == "-42***");
+    assert(put(-42, ios_base::dec | ios_base::internal, 6) == "-***42");
+    assert(put(12345, ios_base::dec, 3) == "12345");
+    assert(put(42, ios_base::dec | ios_base::showpos) == "+42");
+    assert(put(255, ios_base::hex | ios_base::showbase | ios_base::internal, 6) == "0x**ff");
+    assert(put(8, ios_base::oct) == "10");
+    assert(put(255, ios_base::fmtflags{}) == "255");
+}
+
+void test_floating() {
+    assert(put(1.5) == "1.5");
+    assert(put(-0.1) == "-0.1");
+    assert(put(1.0 / 3.0) == "0.333333");
+    assert(put(1e100) == "1e+100");
+    assert(put(2.5, ios_base::fixed) == "2.500000");
+    assert(put(-2.5, ios_base::scientific | ios_base::internal, 14) == "-*2.500000e+00");
+    assert(put(1.5f, ios_base::dec | ios_base::left, 5) == "1.5**");
+    assert(put(1.5L) == "1.5");
+
+    // outputs that don't fit the stack buffer
+    const string big = put(1e300, ios_base::fixed);
+    assert(big.size() == 308 && big.substr(0, 2) == "10" && big.substr(300) == "0.000000");
+
+    ostringstream oss;
+    oss << setprecision(200) << fixed << 1.0;
+    assert(oss.str().size() == 202 && oss.str().find_first_not_of('0', 2) == string::npos);
+}
+
+struct grouping_numpunct : numpunct<char> {
+    char do_decimal_point() const override {
+        return ',';
+    }
+
+    char do_thousands_sep() const override {
+        return '.';
+    }
+
+    string do_grouping() const override {
+        return "\3";
+    }
+};
+
+void test_locales() {
+    // locales other than "C" use their numpunct facets
+    ostringstream oss;
+    oss.imbue(locale(locale::classic(), new grouping_numpunct));
+    oss << 1234567 << ' ' << 2.5 << ' ' << setw(12) << setfill('_') << 1234567.0;
+    assert(oss.str() == "1.234.567 2,5 _1,23457e+06");
+}
+
+class tiny_buffer : public streambuf { // a stream buffer whose write buffer holds only four characters
+public:
+    tiny_buffer() {
+        setp(buf, buf + sizeof(buf));
+    }
+
+    string str() {
+        sync();
+        return result;
+    }
+
+protected:
+    int_type overflow(const int_type meta) override {
+        sync();
+        if (!traits_type::eq_int_type(meta, traits_type::eof())) {
+            result.push_back(traits_type::to_char_type(meta));
+        }
+
+        return traits_type::not_eof(meta);
+    }
+
+    int sync() override {
+        result.append(pbase(), pptr());
+        setp(buf, buf + sizeof(buf));
+        return 0;
+    }
+
+private:
+    char buf[4];
+    string result;
+};
+
+class failing_buffer : public streambuf { // a stream buffer that rejects all output
+protected:
+    int_type overflow(int_type) override {
+        return traits_type::eof();
+    }
+};
+
+void test_stream_buffers() {
+    tiny_buffer tiny;
+    ostream os(&tiny);
+    os << 12 << ' ' << 123456789 << ' ' << 0.5 << ' ' << setw(6) << 7;
+    assert(os.good());
+    assert(tiny.str() == "12 123456789 0.5      7");
+
+    failing_buffer failing;
+    ostream bad(&failing);
+    bad << 42;
+    assert(bad.bad());
+}
+
+int main() {
+    test_integers();
+    test_floating();
+    test_locales();
+    test_stream_buffers();
+}
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <order_statistic_tree>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+using namespace std;
+
+using stdext::order_statistic_map;
+using stdext::order_statistic_set;
+
+template <class Set>
+void check_ranks(const Set& tree, const set<int>& expected) {
+    assert(tree.size() == expected.size());
+    size_t rank = 0;
+    for (const int value : expected) {
+        assert(*tree.find_by_order(rank) == value);
+        assert(tree.order_of_key(value) == rank);
+        ++rank;
+    }
+
+    assert(tree.find_by_order(rank) == tree.end());
+}
+
+void test_set() {
+    order_statistic_set<int> os = {50, 10, 40, 20, 30};
+    assert(*os.find_by_order(0) == 10 && *os.find_by_order(4) == 50);
+    assert(os.find_by_order(5) == os.end());
+    assert(os.order_of_key(10) == 0 && os.order_of_key(35) == 3 && os.order_of_key(100) == 5);
+
+    os.erase(30);
+    assert(*os.find_by_order(2) == 40 && os.order_of_key(40) == 2);
+
+    // copies, node handles, and merges keep the subtree sizes
+    order_statistic_set<int> copy = os;
+    auto node                     = copy.extract(10);
+    assert(*copy.find_by_order(0) == 20 && copy.size() == 3);
+    node.value() = 45;
+    copy.insert(move(node));
+    assert(*copy.find_by_order(2) == 45 && copy.order_of_key(50) == 3);
+
+    order_statistic_set<int> other = {5, 20, 60};
+    copy.merge(other);
+    assert(other.size() == 1 && *other.find_by_order(0) == 20);
+    assert(*copy.find_by_order(0) == 5 && *copy.find_by_order(5) == 60 && copy.order_of_key(50) == 4);
+
+    order_statistic_set<int, greater<>> descending(os.begin(), os.end());
+    assert(*descending.find_by_order(0) == 50 && descending.order_of_key(15) == 3);
+
+    copy.clear();
+    assert(copy.find_by_order(0) == copy.end() && copy.order_of_key(0) == 0);
+    swap(copy, os);
+    assert(os.empty() && copy.size() == 4);
+}
+
+void test_set_randomized() {
+    // interleaved inserts and erases exercise every rebalancing case
+    order_statistic_set<int> tree;
+    set<int> expected;
+    mt19937 gen(1729);
+    for (int iteration = 0; iteration < 20'000; ++iteration) {
+        const int key = static_cast<int>(gen() % 1'000);
+        if (gen() % 3 != 0) {
+            assert(tree.insert(key).second == expected.insert(key).second);
+        } else {
+            assert(tree.erase(key) == expected.erase(key));
+        }
+
+        if (iteration % 1'000 == 0) {
+            check_ranks(tree, expected);
+        }
+    }
+
+    check_ranks(tree, expected);
+    check_ranks(order_statistic_set<int>(tree), expected);
+}
+
+void test_map() {
+    order_statistic_map<string, int> om;
+    om["pear"]  = 3;
+    om["apple"] = 1;
+    om["fig"]   = 2;
+    om.emplace("kiwi", 4);
+    om.insert({"date", 5});
+
+    assert(om.find_by_order(0)->first == "apple" && om.find_by_order(4)->first == "pear");
+    assert(om.order_of_key("fig") == 2 && om.order_of_key("grape") == 3);
+    assert(om.at("kiwi") == 4);
+
+    ++om["fig"];
+    assert(om.find_by_order(2)->second == 3 && om.size() == 5);
+
+    try {
+        (void) om.at("plum");
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    om.erase(om.find_by_order(1));
+    assert(om.find_by_order(1)->first == "fig" && om.order_of_key("pear") == 3);
+
+    const order_statistic_map<string, int> copy = om;
+    assert(copy == om && copy.find_by_order(3)->second == 3);
+
+    order_statistic_map<string, int, less<>> transparent = {{"b", 1}, {"a", 2}};
+    assert(transparent.order_of_key("b") == 1);
+}
+
+int main() {
+    test_set();
+    test_set_randomized();
+    test_map();
+}
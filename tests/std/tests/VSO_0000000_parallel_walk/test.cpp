@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <parallel_walk>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread_pool>
+
+using namespace std;
+using namespace std::filesystem;
+
+using stdext::thread_pool;
+using stdext::filesystem::parallel_walk;
+
+const path root = "VSO_0000000_parallel_walk_tree";
+
+void make_tree(const path& dir, const int depth) {
+    create_directory(dir);
+    for (int i = 0; i < 3; ++i) {
+        ofstream{dir / ("file" + to_string(i) + ".txt")} << string(static_cast<size_t>(i), 'x');
+    }
+
+    if (depth != 0) {
+        for (int i = 0; i < 4; ++i) {
+            make_tree(dir / ("dir" + to_string(i)), depth - 1);
+        }
+
+        make_tree(dir / "skip", 0);
+    }
+}
+
+set<path> walk_sequentially() {
+    set<path> result;
+    for (const auto& entry : recursive_directory_iterator(root)) {
+        result.insert(entry.path());
+    }
+
+    return result;
+}
+
+class collector { // records the entries reported from any thread
+public:
+    void add(const directory_entry& entry) {
+        lock_guard<mutex> lock(mtx);
+        assert(entries.insert(entry.path()).second); // each entry is reported once
+        if (entry.is_regular_file()) {
+            // the size comes from the directory listing
+            assert(entry.file_size() == static_cast<uintmax_t>(entry.path().stem().native().back() - L'0'));
+        }
+    }
+
+    set<path> entries;
+
+private:
+    mutex mtx;
+};
+
+void test_default_pool() {
+    collector seen;
+    parallel_walk(root, directory_options::none, [&](const directory_entry& entry) { seen.add(entry); });
+    assert(seen.entries == walk_sequentially());
+}
+
+void test_private_pool() {
+    thread_pool pool(4);
+    for (const unsigned int max_open : {0u, 1u, 2u, 64u}) {
+        collector seen;
+        parallel_walk(
+            root, directory_options::none, [&](const directory_entry& entry) { seen.add(entry); }, pool, max_open);
+        assert(seen.entries == walk_sequentially());
+    }
+}
+
+void test_pruning() {
+    collector seen;
+    parallel_walk(root, directory_options::none, [&](const directory_entry& entry) {
+        seen.add(entry);
+        return entry.path().filename() != "skip"; // reported, but not descended into
+    });
+
+    set<path> expected = walk_sequentially();
+    for (auto it = expected.begin(); it != expected.end();) {
+        if (it->parent_path().filename() == "skip") {
+            it = expected.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    assert(seen.entries == expected);
+}
+
+void test_errors() {
+    atomic<int> calls{0};
+    try {
+        parallel_walk(root, directory_options::none, [&](const directory_entry&) {
+            if (++calls == 10) {
+                throw runtime_error("stop");
+            }
+        });
+        assert(false);
+    } catch (const runtime_error& e) {
+        assert(string(e.what()) == "stop");
+    }
+
+    try {
+        parallel_walk(root / "missing", directory_options::none, [](const directory_entry&) { assert(false); });
+        assert(false);
+    } catch (const filesystem_error& e) {
+        assert(e.path1() == root / "missing");
+    }
+}
+
+int main() {
+    remove_all(root);
+    make_tree(root, 3);
+
+    test_default_pool();
+    test_private_pool();
+    test_pruning();
+    test_errors();
+
+    remove_all(root);
+}
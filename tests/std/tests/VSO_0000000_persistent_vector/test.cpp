@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <persistent_vector>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::persistent_vector;
+
+struct live_counted {
+    static int live;
+
+    int value;
+
+    explicit live_counted(const int v) : value(v) {
+        ++live;
+    }
+
+    live_counted(const live_counted& other) : value(other.value) {
+        ++live;
+    }
+
+    live_counted& operator=(const live_counted&) = delete;
+
+    ~live_counted() {
+        --live;
+    }
+
+    friend bool operator==(const live_counted& left, const live_counted& right) {
+        return left.value == right.value;
+    }
+};
+
+int live_counted::live = 0;
+
+persistent_vector<int> make_iota(const int count) {
+    persistent_vector<int> vec;
+    for (int i = 0; i < count; ++i) {
+        vec = move(vec).push_back(i);
+    }
+
+    return vec;
+}
+
+void assert_iota(const persistent_vector<int>& vec, const size_t count) {
+    assert(vec.size() == count);
+    assert(vec.empty() == (count == 0));
+    for (size_t i = 0; i < count; ++i) {
+        assert(vec[i] == static_cast<int>(i));
+    }
+
+    // iterators walk the leaves in order
+    assert(static_cast<size_t>(distance(vec.begin(), vec.end())) == count);
+    int expected = 0;
+    for (const int elem : vec) {
+        assert(elem == expected);
+        ++expected;
+    }
+
+    // so do the chunks, each of them contiguous
+    size_t seen = 0;
+    vec.for_each_chunk([&](const int* first, const int* last) {
+        assert(last - first > 0 && last - first <= 32);
+        for (; first != last; ++first) {
+            assert(*first == static_cast<int>(seen));
+            ++seen;
+        }
+    });
+    assert(seen == count);
+}
+
+void test_push_back_and_pop_back() {
+    // sizes around the boundaries of the tail and of each tree level
+    for (const int count : {0, 1, 31, 32, 33, 64, 65, 1024, 1056, 1057, 33 * 32 + 1, 40000}) {
+        const auto vec = make_iota(count);
+        assert_iota(vec, static_cast<size_t>(count));
+        if (count != 0) {
+            assert(vec.front() == 0 && vec.back() == count - 1);
+        }
+    }
+
+    auto vec = make_iota(1100);
+    while (!vec.empty()) {
+        const auto smaller = vec.pop_back();
+        assert(smaller.size() == vec.size() - 1);
+        assert(smaller.empty() || smaller.back() == static_cast<int>(smaller.size()) - 1);
+        vec = smaller;
+    }
+
+    assert_iota(make_iota(1057).pop_back().pop_back().push_back(1055), 1056);
+}
+
+void test_versions_are_independent() {
+    const auto base = make_iota(2000);
+
+    // const& modifiers leave *this alone
+    const auto appended = base.push_back(2000);
+    assert_iota(base, 2000);
+    assert_iota(appended, 2001);
+
+    const auto changed = base.set(5, -5).set(1999, -1999).set(1500, -1500);
+    assert(changed[5] == -5 && changed[1999] == -1999 && changed[1500] == -1500 && changed[6] == 6);
+    assert_iota(base, 2000);
+
+    // so do rvalue modifiers of a copy, which shares its tail with base
+    auto copy = base;
+    copy      = move(copy).push_back(2000).push_back(2001);
+    assert_iota(base, 2000);
+    assert_iota(copy, 2002);
+
+    const auto popped = base.pop_back();
+    assert_iota(popped, 1999);
+    assert_iota(base, 2000);
+}
+
+void test_equality() {
+    const auto left  = make_iota(3000);
+    const auto right = make_iota(3000);
+    assert(left == right);
+    assert(left == left.set(100, 100)); // shares all but one path
+    assert(left != left.set(100, -100));
+    assert(left != left.set(2999, -1)); // in the tail
+    assert(left != left.pop_back());
+    assert(persistent_vector<int>{} == persistent_vector<int>{});
+}
+
+void test_construction_and_access() {
+    const persistent_vector<int> from_list{3, 1, 4, 1, 5};
+    assert(from_list.size() == 5 && from_list[2] == 4);
+
+    vector<int> source(100);
+    iota(source.begin(), source.end(), 0);
+    const persistent_vector<int> from_range(source.begin(), source.end());
+    assert_iota(from_range, 100);
+    assert(equal(from_range.rbegin(), from_range.rend(), source.rbegin(), source.rend()));
+
+    auto it = from_range.begin() + 70;
+    assert(*it == 70 && it[-40] == 30 && *(it - 69) == 1 && from_range.end() - it == 30);
+    it -= 35;
+    assert(*it == 35 && it < from_range.end() && from_range.begin() <= it);
+
+    try {
+        (void) from_range.at(100);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    try {
+        (void) from_range.set(100, 0);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    // the vectorized algorithms run on each chunk
+    size_t found_at = static_cast<size_t>(-1);
+    size_t offset   = 0;
+    from_range.for_each_chunk([&](const int* first, const int* last) {
+        const int* const found = find(first, last, 77);
+        if (found != last && found_at == static_cast<size_t>(-1)) {
+            found_at = offset + static_cast<size_t>(found - first);
+        }
+
+        offset += static_cast<size_t>(last - first);
+    });
+    assert(found_at == 77);
+}
+
+void test_non_trivial_elements() {
+    {
+        persistent_vector<string> strings;
+        for (int i = 0; i < 100; ++i) {
+            strings = move(strings).emplace_back(50, static_cast<char>('a' + i % 26));
+        }
+
+        const auto changed = strings.set(10, "changed");
+        assert(changed[10] == "changed" && strings[10] == string(50, 'k'));
+    }
+
+    {
+        persistent_vector<live_counted> objects;
+        for (int i = 0; i < 1000; ++i) {
+            objects = move(objects).emplace_back(i);
+        }
+
+        assert(live_counted::live == 1000);
+
+        auto versions = objects.set(3, live_counted{-3}).pop_back();
+        assert(versions[3].value == -3 && objects[3].value == 3);
+        versions = versions.push_back(live_counted{1});
+        assert(versions.back().value == 1 && objects.back().value == 999);
+        swap(objects, versions);
+        assert(objects.back().value == 1);
+    }
+
+    assert(live_counted::live == 0); // every node was freed
+}
+
+int main() {
+    test_push_back_and_pop_back();
+    test_versions_are_independent();
+    test_equality();
+    test_construction_and_access();
+    test_non_trivial_elements();
+}
@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <memory_resource>
+#include <stddef.h>
+#include <vector>
+
+using namespace std;
+using stdext::pmr::monotonic_buffer_stats;
+using stdext::pmr::pool_resource_stats;
+using stdext::pmr::statistics_resource;
+
+void test_statistics_resource() {
+    statistics_resource upstream;
+    assert(upstream.upstream_resource() == pmr::get_default_resource());
+
+    void* const p = upstream.allocate(100, 8);
+    void* const q = upstream.allocate(300, 16);
+    upstream.deallocate(p, 100, 8);
+
+    auto stats = upstream.statistics();
+    assert(stats.allocation_count == 2);
+    assert(stats.deallocation_count == 1);
+    assert(stats.bytes_in_use == 300);
+    assert(stats.peak_bytes_in_use == 400);
+    assert(stats.largest_allocation == 300);
+
+    upstream.reset_peak();
+    assert(upstream.statistics().peak_bytes_in_use == 300);
+
+    upstream.deallocate(q, 300, 16);
+    assert(upstream.statistics().bytes_in_use == 0);
+}
+
+template <class PoolResource>
+void test_pool_resource() {
+    statistics_resource upstream;
+    {
+        PoolResource pool{{8, 256}, &upstream};
+        auto stats = pool_resource_stats(pool);
+        assert(stats.options.max_blocks_per_chunk == 8);
+        assert(stats.options.largest_required_pool_block == 256);
+        assert(stats.pools.empty());
+        assert(stats.upstream_bytes == 0);
+
+        vector<void*> small;
+        for (int i = 0; i < 100; ++i) {
+            small.push_back(pool.allocate(24, 8));
+        }
+        void* const oversized = pool.allocate(1000, 8);
+
+        stats = pool_resource_stats(pool);
+        assert(stats.pools.size() == 1);
+        const auto& blocks = stats.pools[0];
+        assert(blocks.block_size == 32);
+        assert(blocks.blocks_in_use == 100);
+        assert(blocks.blocks_in_use + blocks.blocks_cached <= blocks.block_count);
+        assert(blocks.chunk_count >= 100 / 8);
+        assert(blocks.next_chunk_blocks == 8);
+        assert(blocks.upstream_bytes >= blocks.block_count * blocks.block_size);
+        assert(stats.oversized_count == 1);
+        assert(stats.oversized_bytes >= 1000);
+        assert(stats.upstream_bytes == blocks.upstream_bytes + stats.oversized_bytes);
+        assert(stats.upstream_bytes <= upstream.statistics().bytes_in_use);
+
+        for (void* const p : small) {
+            pool.deallocate(p, 24, 8);
+        }
+        pool.deallocate(oversized, 1000, 8);
+
+        stats = pool_resource_stats(pool);
+        assert(stats.pools[0].blocks_in_use == 0);
+        assert(stats.oversized_count == 0);
+        assert(stats.oversized_bytes == 0);
+
+        pool.release();
+        assert(pool_resource_stats(pool).upstream_bytes == 0);
+    }
+
+    const auto traffic = upstream.statistics();
+    assert(traffic.bytes_in_use == 0);
+    assert(traffic.allocation_count == traffic.deallocation_count);
+}
+
+void test_monotonic_buffer_resource() {
+    statistics_resource upstream;
+    {
+        pmr::monotonic_buffer_resource mbr{&upstream};
+        auto stats = monotonic_buffer_stats(mbr);
+        assert(stats.chunk_count == 0);
+        assert(stats.upstream_bytes == 0);
+        assert(stats.bytes_available == 0);
+
+        for (int i = 0; i < 100; ++i) {
+            (void) mbr.allocate(100, 8);
+        }
+
+        stats = monotonic_buffer_stats(mbr);
+        assert(stats.chunk_count > 1);
+        assert(stats.chunk_count == upstream.statistics().allocation_count);
+        assert(stats.upstream_bytes == upstream.statistics().bytes_in_use);
+        assert(stats.upstream_bytes >= 100 * 100);
+        assert(stats.next_buffer_size > 0);
+
+        mbr.release();
+        assert(monotonic_buffer_stats(mbr).upstream_bytes == 0);
+    }
+
+    char buffer[256];
+    pmr::monotonic_buffer_resource with_buffer{buffer, sizeof(buffer), &upstream};
+    (void) with_buffer.allocate(16, 1);
+    const auto stats = monotonic_buffer_stats(with_buffer);
+    assert(stats.chunk_count == 0); // the user's buffer is not counted
+    assert(stats.bytes_available == sizeof(buffer) - 16);
+}
+
+int main() {
+    test_statistics_resource();
+    test_pool_resource<pmr::unsynchronized_pool_resource>();
+#ifndef _M_CEE
+    test_pool_resource<pmr::synchronized_pool_resource>();
+#endif // _M_CEE
+    test_monotonic_buffer_resource();
+}
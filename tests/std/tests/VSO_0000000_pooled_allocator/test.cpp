@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory_resource>
+#include <pooled_allocator>
+#include <set>
+#include <stddef.h>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::pooled_allocator;
+
+class counting_resource : public pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t outstanding = 0;
+
+private:
+    void* do_allocate(const size_t bytes, const size_t align) override {
+        ++allocations;
+        ++outstanding;
+        return pmr::new_delete_resource()->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* const ptr, const size_t bytes, const size_t align) override {
+        --outstanding;
+        pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool do_is_equal(const pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+struct order {
+    int quantity;
+    double price;
+};
+
+void test_steady_state_churn() {
+    counting_resource upstream;
+    {
+        using alloc = pooled_allocator<pair<const int, order>>;
+        map<int, order, less<int>, alloc> book(alloc{pmr::pool_options{}, &upstream});
+        for (int i = 0; i < 1000; ++i) {
+            book.emplace(i, order{i, i * 0.5});
+        }
+
+        // freed nodes go back to the pool, so replacing orders must not reach the upstream resource
+        const size_t warmed_up = upstream.allocations;
+        for (int round = 0; round < 10; ++round) {
+            for (int i = 0; i < 1000; i += 3) {
+                book.erase(i + round * 1000);
+                book.emplace(i + (round + 1) * 1000, order{i, 1.0});
+            }
+        }
+
+        assert(upstream.allocations == warmed_up);
+        assert(book.size() == 1000);
+    }
+
+    assert(upstream.outstanding == 0);
+}
+
+void test_list() {
+    counting_resource upstream;
+    {
+        list<int, pooled_allocator<int>> l(pooled_allocator<int>{pmr::pool_options{}, &upstream});
+        for (int i = 0; i < 500; ++i) {
+            l.push_back(i);
+        }
+
+        const size_t warmed_up = upstream.allocations;
+        for (int i = 0; i < 5000; ++i) {
+            l.pop_front();
+            l.push_back(i);
+        }
+
+        assert(upstream.allocations == warmed_up);
+        assert(l.size() == 500 && l.back() == 4999);
+    }
+
+    assert(upstream.outstanding == 0);
+}
+
+void test_allocator_semantics() {
+    const pooled_allocator<int> a;
+    const pooled_allocator<int> b;
+    assert(a != b);
+    assert(a.resource() != nullptr);
+
+    const pooled_allocator<double> rebound(a);
+    assert(rebound == a);
+
+    pooled_allocator<int> copy(a);
+    assert(copy == a);
+    const pooled_allocator<int> moved(move(copy));
+    assert(moved == a && copy == a);
+
+    // a copied container gets a pool of its own
+    set<int, less<int>, pooled_allocator<int>> s({3, 1, 2}, less<int>{}, a);
+    const auto dup = s;
+    assert(dup == s);
+    assert(dup.get_allocator() != s.get_allocator());
+    assert(s.get_allocator() == a);
+
+    // move assignment propagates the pool along with the nodes
+    set<int, less<int>, pooled_allocator<int>> target;
+    target = move(s);
+    assert(target.get_allocator() == a);
+    assert(target.size() == 3);
+
+    vector<int, pooled_allocator<int>> v(100, 7, a);
+    assert(v.size() == 100 && v[99] == 7);
+}
+
+int main() {
+    test_steady_state_churn();
+    test_list();
+    test_allocator_semantics();
+}
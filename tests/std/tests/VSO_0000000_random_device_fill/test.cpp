@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+#ifndef _M_CEE_PURE
+#include <thread>
+#endif // _M_CEE_PURE
+
+using namespace std;
+
+void test_values() {
+    random_device rd;
+    set<unsigned int> seen;
+    for (int i = 0; i < 1000; ++i) { // crosses several refills of the per-thread pool
+        seen.insert(rd());
+    }
+
+    assert(seen.size() > 990);
+
+    seed_seq seq{rd(), rd(), rd(), rd(), rd(), rd(), rd(), rd()};
+    mt19937 eng(seq);
+    (void) eng();
+}
+
+#ifndef _M_CEE_PURE
+bool all_zero(const vector<unsigned char>& buf) {
+    return all_of(buf.begin(), buf.end(), [](const unsigned char c) { return c == 0; });
+}
+
+void test_fill() {
+    stdext::random_device rd;
+    // sizes below and above the per-thread pool, and ones that straddle its end
+    for (const size_t size : {size_t{0}, size_t{1}, size_t{3}, size_t{100}, size_t{255}, size_t{256}, size_t{257},
+             size_t{100'000}}) {
+        vector<unsigned char> buf(size);
+        rd.fill(buf.data(), buf.size());
+        if (size >= 16) {
+            assert(!all_zero(buf));
+        }
+
+        vector<unsigned char> other(size);
+        rd.fill(other.data(), other.size());
+        if (size >= 16) {
+            assert(buf != other);
+        }
+    }
+
+#if defined(__cpp_lib_span) && defined(__cpp_lib_byte)
+    byte bytes[64]{};
+    rd.fill(span<byte>{bytes});
+    assert(any_of(begin(bytes), end(bytes), [](const byte b) { return b != byte{0}; }));
+#endif // defined(__cpp_lib_span) && defined(__cpp_lib_byte)
+
+    // a stdext::random_device is a random_device
+    random_device& base = rd;
+    (void) base();
+}
+
+void test_threads() {
+    // every thread has its own pool, so no two threads hand out the same bytes
+    constexpr int thread_count = 4;
+    vector<vector<unsigned int>> values(thread_count);
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&values, i] {
+            random_device rd;
+            for (int j = 0; j < 500; ++j) {
+                values[i].push_back(rd());
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    set<unsigned int> seen;
+    for (const auto& v : values) {
+        seen.insert(v.begin(), v.end());
+    }
+
+    assert(seen.size() > thread_count * 500 - 10);
+}
+#endif // _M_CEE_PURE
+
+int main() {
+    test_values();
+#ifndef _M_CEE_PURE
+    test_fill();
+    test_threads();
+#endif // _M_CEE_PURE
+}
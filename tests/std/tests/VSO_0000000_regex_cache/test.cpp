@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+vector<string> make_patterns() {
+    vector<string> patterns;
+    for (int i = 0; i < 100; ++i) {
+        patterns.push_back("(key" + to_string(i) + ")=(\\d+)");
+    }
+
+    return patterns;
+}
+
+void test_lookup() {
+    stdext::regex_cache cache;
+    assert(cache.size() == 0);
+
+    const regex first = cache.get("a+b");
+    assert(cache.size() == 1);
+    const regex again = cache.get(string("a+b"));
+    assert(cache.size() == 1);
+    assert(regex_match("aab", first) && regex_match("aab", again));
+    assert(!regex_match("AAB", again));
+
+    // the flags are part of the key
+    const regex caseless = cache.get("a+b", regex::icase);
+    assert(cache.size() == 2);
+    assert(regex_match("AAB", caseless));
+    assert((caseless.flags() & regex::icase) != 0);
+
+    const regex basic = cache.get("a\\{2\\}", regex::basic);
+    assert(cache.size() == 3);
+    assert(regex_match("aa", basic));
+
+    // patterns that do not compile are not remembered
+    try {
+        (void) cache.get("(a");
+        assert(false);
+    } catch (const regex_error& e) {
+        assert(e.code() == regex_constants::error_paren);
+    }
+
+    assert(cache.size() == 3);
+
+    // regular expressions already handed out outlive the cache's copies
+    cache.clear();
+    assert(cache.size() == 0);
+    assert(regex_match("aab", first));
+    assert(regex_match("AAB", caseless));
+    assert(regex_match("aab", cache.get("a+b")));
+    assert(cache.size() == 1);
+}
+
+void test_threads() {
+    const vector<string> patterns = make_patterns();
+    stdext::regex_cache cache;
+    vector<thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, &patterns, t] {
+            for (int pass = 0; pass < 10; ++pass) {
+                for (size_t i = 0; i < patterns.size(); ++i) {
+                    const size_t n = (i * 7 + static_cast<size_t>(t)) % patterns.size();
+                    smatch m;
+                    const string text = "key" + to_string(n) + "=" + to_string(pass);
+                    assert(regex_match(text, m, cache.get(patterns[n])));
+                    assert(m[2] == to_string(pass));
+                }
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    assert(cache.size() == patterns.size());
+}
+
+void test_wide() {
+    stdext::wregex_cache cache;
+    assert(regex_search(L"meow purr", cache.get(L"p[aeiou]rr")));
+    assert(regex_search(L"meow purr", cache.get(wstring(L"p[aeiou]rr"))));
+    assert(cache.size() == 1);
+}
+
+int main() {
+    test_lookup();
+    test_threads();
+    test_wide();
+}
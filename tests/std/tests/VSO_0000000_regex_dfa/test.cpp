@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _ENABLE_REGEX_ACCELERATION
+
+#include <cassert>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace std::regex_constants;
+
+// regex::optimize patterns without anchors, word boundaries, back references, lookarounds, or counted repeats are
+// matched by a DFA first; the answers must not change
+void check_same(const char* const pattern, const syntax_option_type grammar, const bool expect_dfa) {
+    const regex optimized(pattern, grammar | optimize);
+    const regex plain(pattern, grammar);
+    assert(optimized._Uses_dfa() == expect_dfa);
+    assert(!plain._Uses_dfa());
+
+    const char* const inputs[] = {"", "a", "b", "ab", "abc", "aab", "ba", "cab", "abab", "AbC", "xyz", "a\nb",
+        "aaaaaaaaaaaaaaaaaaaab", "bbbbbbbbbbbbbbbbbbbbc", "the cat sat on the mat"};
+    for (const char* const input : inputs) {
+        const string str(input);
+        assert(regex_match(str, optimized) == regex_match(str, plain));
+        assert(regex_search(str, optimized) == regex_search(str, plain));
+        assert(regex_search(str, optimized, match_continuous) == regex_search(str, plain, match_continuous));
+        assert(regex_search(str, optimized, match_not_null) == regex_search(str, plain, match_not_null));
+
+        smatch optimized_match;
+        smatch plain_match;
+        assert(regex_search(str, optimized_match, optimized) == regex_search(str, plain_match, plain));
+        assert(optimized_match.ready());
+        assert(optimized_match.size() == plain_match.size());
+        if (!plain_match.empty()) {
+            assert(optimized_match.position(0) == plain_match.position(0));
+            assert(optimized_match.str(0) == plain_match.str(0));
+        }
+
+        assert(regex_match(str, optimized_match, optimized) == regex_match(str, plain_match, plain));
+        assert(optimized_match.size() == plain_match.size());
+
+        const sregex_iterator optimized_first(str.begin(), str.end(), optimized);
+        const sregex_iterator plain_first(str.begin(), str.end(), plain);
+        assert(distance(optimized_first, sregex_iterator{}) == distance(plain_first, sregex_iterator{}));
+    }
+}
+
+void test_equivalence() {
+    const char* const dfa_patterns[] = {"abc", "a*", "a+b", "(a|b)*c", "a?b?c?", "(ab|a)(bc|c)", "[a-c]+", "[^ab]*",
+        ".*", "a.c", "(a|)*b", "(a*)*", "(a+)+b", "[[:alpha:]]+", "a|b|cd|", "((a|b)c|d)*e?", "(?:ab)*a", "",
+        "c.*a", "(a|b)*a(a|b)(a|b)"};
+    for (const char* const pattern : dfa_patterns) {
+        check_same(pattern, ECMAScript, true);
+        check_same(pattern, ECMAScript | icase, true);
+    }
+
+    const char* const backtracking_patterns[] = {"^ab", "ab$", "\\bab", "(a)\\1", "(?=a)a", "(?!a)b", "a{2,3}"};
+    for (const char* const pattern : backtracking_patterns) {
+        check_same(pattern, ECMAScript, false);
+    }
+
+    check_same("(a|b)*c", extended, true);
+    check_same("a*b", basic, true);
+    check_same("[[.a.]]b", ECMAScript, false); // collating elements
+}
+
+void test_not_optimized() {
+    assert(!regex("a+b")._Uses_dfa());
+    assert(!wregex(L"a+b", wregex::optimize)._Uses_dfa());
+    assert(regex_search(L"xaab", wregex(L"a+b", wregex::optimize)));
+}
+
+void test_icase_bracket_search() {
+    // the search for a starting position must fold case as the match does
+    const regex r("[ab]b", icase);
+    assert(regex_search("cAb", r));
+    assert(regex_search("xBB", r));
+
+    smatch m;
+    const string str("cAb");
+    assert(regex_search(str, m, r));
+    assert(m.position(0) == 1);
+}
+
+void test_long_input() {
+    // the DFA decides without backtracking into the nested repetition
+    const regex r("(a|aa)*c", optimize);
+    assert(r._Uses_dfa());
+    const string str(100000, 'a');
+    assert(!regex_match(str, r));
+    assert(!regex_search(str, r));
+    assert(regex_match(str + 'c', r));
+}
+
+void test_threads() {
+    // states are added to the DFA shared by copies of the regex while other threads walk it
+    const regex r("(a|b)*a(a|b)(a|b)(a|b)(a|b)c", optimize);
+    vector<thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([r, i] {
+            string str;
+            for (int j = 0; j < 1000; ++j) {
+                str.assign(30, 'a');
+                for (size_t k = 0; k < str.size(); ++k) {
+                    str[k] = "ab"[(i + j * 7 + k * k) % 2];
+                }
+
+                str += "aaaaac";
+                assert(regex_search(str, r));
+                str.pop_back();
+                assert(!regex_search(str, r));
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+int main() {
+    test_equivalence();
+    test_not_optimized();
+    test_icase_bracket_search();
+    test_long_input();
+    test_threads();
+}
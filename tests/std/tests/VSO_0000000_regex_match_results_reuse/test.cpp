@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _ENABLE_REGEX_ACCELERATION
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <regex>
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+#pragma warning(disable : 28251) // Inconsistent annotation for 'new': this instance has no annotations.
+
+long g_allocations = 0;
+
+void* operator new(size_t n) {
+    void* const p = malloc(n ? n : 1);
+    if (p == nullptr) {
+        throw bad_alloc();
+    }
+
+    ++g_allocations;
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+// match_results lends its storage to the matcher, so matching again with the same match_results allocates nothing
+// once that storage has grown; containers that allocate proxies in debug modes make this hold only in release modes
+constexpr bool counts_allocations = _ITERATOR_DEBUG_LEVEL == 0;
+
+string make_text() {
+    string text;
+    for (int i = 0; i < 500; ++i) {
+        text += "word" + to_string(i) + " (x|y) ";
+    }
+
+    return text;
+}
+
+void test_regex_search_reuse() {
+    const string text = make_text();
+    const regex r(R"(([a-z]+)(\d+)|\((x|y)\|(x|y)\))");
+    smatch m;
+    for (int pass = 0; pass < 2; ++pass) {
+        const long before = g_allocations;
+        int count         = 0;
+        for (auto it = text.cbegin(); regex_search(it, text.cend(), m, r); it = m[0].second) {
+            ++count;
+        }
+
+        assert(count == 1000);
+        assert(!counts_allocations || pass == 0 || g_allocations == before);
+    }
+
+    assert(regex_match(text.cbegin(), text.cbegin() + 5, m, r));
+    assert(m.str(1) == "word" && m.str(2) == "0" && !m[3].matched);
+}
+
+void test_regex_iterator_reuse() {
+    const string text = make_text();
+    const regex r(R"(\d+|\(\w\|(\w)\))");
+    sregex_iterator it(text.begin(), text.end(), r);
+    ++it; // grows the storage
+    ++it;
+
+    const long before = g_allocations;
+    int count         = 2;
+    for (const sregex_iterator end; it != end; ++it) {
+        ++count;
+    }
+
+    assert(count == 1000);
+    assert(!counts_allocations || g_allocations == before);
+}
+
+void test_copies_do_not_share_storage() {
+    const string text = "abc123";
+    const regex letters("([a-z]+)");
+    const regex digits("([0-9]+)");
+    smatch first;
+    assert(regex_search(text, first, letters));
+
+    smatch second(first);
+    assert(regex_search(text, second, digits));
+    assert(first.str(1) == "abc");
+    assert(second.str(1) == "123");
+
+    smatch third(move(second));
+    assert(regex_search(text, third, letters));
+    assert(third.str(1) == "abc");
+
+    second = first;
+    assert(regex_search(text, second, digits));
+    assert(second.str(1) == "123");
+    assert(first.str(1) == "abc");
+}
+
+long g_live_blocks        = 0;
+long g_other_allocations = 0;
+
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        ++g_live_blocks;
+        if (!is_same<T, ssub_match>::value) {
+            ++g_other_allocations;
+        }
+
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        --g_live_blocks;
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(const counting_allocator&, const counting_allocator&) noexcept {
+        return true;
+    }
+
+    friend bool operator!=(const counting_allocator&, const counting_allocator&) noexcept {
+        return false;
+    }
+};
+
+void test_storage_uses_the_allocator() {
+    const string text = "abc123";
+    const regex r("([a-z]+)([0-9]+)");
+    {
+        match_results<string::const_iterator, counting_allocator<ssub_match>> m;
+        assert(regex_search(text, m, r));
+        assert(m.str(2) == "123");
+        assert(!counts_allocations || g_other_allocations == 1); // the storage is the one block of another type
+
+        auto copied = m;
+        assert(regex_match(text, copied, r));
+        auto moved = move(copied);
+        assert(regex_match(text, moved, r));
+    }
+
+    assert(g_live_blocks == 0);
+}
+
+int main() {
+    test_regex_search_reuse();
+    test_regex_iterator_reuse();
+    test_copies_do_not_share_storage();
+    test_storage_uses_the_allocator();
+}
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#define _ENABLE_REGEX_ACCELERATION
+
 #include <regex>
 #include <stdio.h>
 #include <stdlib.h>
@@ -546,6 +548,85 @@ void test_VSO_226914_word_boundaries() {
     aWordAny.should_search_fail("aa", match_not_bow | match_not_eow);
 }
 
+void test_long_inputs_should_not_exhaust_the_stack() {
+    // the matcher backtracks on the heap, so loops containing alternatives may run once per character of big inputs
+    string subject(100000, 'a');
+    for (size_t i = 0; i < subject.size(); i += 3) {
+        subject[i] = 'b';
+    }
+
+    smatch results;
+    g_regexTester.verify(regex_match(subject, results, regex("(a|b)*")));
+    g_regexTester.verify(results[0].length() == static_cast<ptrdiff_t>(subject.size()));
+
+    const string tail = subject + "c";
+    g_regexTester.verify(regex_search(tail, results, regex("(?:ab|b|a)+c")));
+    g_regexTester.verify(results.position(0) == 0);
+    g_regexTester.verify(results.length(0) == static_cast<ptrdiff_t>(tail.size()));
+
+    g_regexTester.verify(regex_match(subject, regex("(?:(?=[ab])[ab])*")));
+}
+
+void test_search_should_skip_to_literals_and_first_characters() {
+    // regex_search looks for a pattern's leading literal, its possible first characters, or a literal that every
+    // match contains before it tries to match
+    const test_regex prefix(&g_regexTester, "(?:\\b)needle");
+    prefix.should_search_match("haystack needles needle", "needle");
+    prefix.should_search_match("needle", "needle");
+    prefix.should_search_fail("needl needlf eedle");
+    prefix.should_search_fail("the needle", match_continuous);
+
+    const test_regex firsts(&g_regexTester, "[0-9]+ms|x?yz");
+    firsts.should_search_match("took 150ms", "150ms");
+    firsts.should_search_match("took 1.5ms", "5ms");
+    firsts.should_search_match("xxyz", "xyz");
+    firsts.should_search_match("abcyz", "yz");
+    firsts.should_search_fail("took 150 ms, xy z");
+
+    const test_regex required(&g_regexTester, "(a|b)*c+d");
+    required.should_search_match("abcabccd", "abccd");
+    required.should_search_match("cd", "cd");
+    required.should_search_fail("abcabc");
+
+    const test_regex caseless(&g_regexTester, "Hello", icase);
+    caseless.should_search_match("say HELLO", "HELLO");
+    caseless.should_search_match("say hello", "hello");
+    caseless.should_search_fail("say hell");
+
+    const test_regex anchored(&g_regexTester, "^abc");
+    anchored.should_search_match("xabc\nabc", "abc");
+    anchored.should_search_fail("xabc", match_not_bol);
+
+    const string haystack = string(100000, 'q') + "needle";
+    smatch results;
+    g_regexTester.verify(regex_search(haystack, results, regex("ne+dle|noodle")));
+    g_regexTester.verify(results.position(0) == 100000);
+    g_regexTester.verify(!regex_search(haystack, regex("q+xyz")));
+    g_regexTester.verify(!regex_search(haystack.c_str(), regex("nee[a-z]le$q")));
+}
+
+void test_tabulated_classes_should_match_like_the_locale() {
+    // regex::optimize tabulates bracket expressions over wchar_t; the tables must agree with the locale they replace
+    const wchar_t* const patterns[] = {
+        L"\\w", L"[^[:alpha:]0-9]", L"[\\u0100-\\u2000x]", L"[[=a=]\\s]", L"[A-Z\\u0400-\\u04ff]"};
+    for (const auto& pattern : patterns) {
+        for (const auto extra : {wregex::ECMAScript, wregex::icase, wregex::collate}) {
+            const wregex plain(pattern, extra);
+            const wregex optimized(pattern, extra | wregex::optimize);
+            for (unsigned int ch = 1; ch <= 0xFFFF; ++ch) {
+                const wchar_t subject[] = {static_cast<wchar_t>(ch), L'\0'};
+                g_regexTester.verify(regex_match(subject, plain) == regex_match(subject, optimized));
+            }
+        }
+    }
+
+    // collate ranges over char are folded into a bitmap
+    const regex collated("[b-y]", regex::collate);
+    g_regexTester.verify(regex_match("m", collated));
+    g_regexTester.verify(!regex_match("a", collated));
+    g_regexTester.verify(!regex_match("z", collated));
+}
+
 int main() {
     test_dev10_449367_case_insensitivity_should_work();
     test_dev11_462743_regex_collate_should_not_disable_regex_icase();
@@ -572,6 +653,9 @@ int main() {
     test_VSO_225160_match_bol_flag();
     test_VSO_225160_match_eol_flag();
     test_VSO_226914_word_boundaries();
+    test_long_inputs_should_not_exhaust_the_stack();
+    test_search_should_skip_to_literals_and_first_characters();
+    test_tabulated_classes_should_match_like_the_locale();
 
     return g_regexTester.result();
 }
@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct NonTrivial {
+    int value = 42;
+};
+
+template <class T>
+struct construct_counting_allocator {
+    using value_type = T;
+
+    static int constructions;
+
+    construct_counting_allocator() = default;
+    template <class U>
+    construct_counting_allocator(const construct_counting_allocator<U>&) {}
+
+    T* allocate(const size_t n) {
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) {
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U, class... Args>
+    void construct(U* const p, Args&&... args) {
+        ++constructions;
+        ::new (static_cast<void*>(p)) U(static_cast<Args&&>(args)...);
+    }
+
+    template <class U>
+    bool operator==(const construct_counting_allocator<U>&) const {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const construct_counting_allocator<U>&) const {
+        return false;
+    }
+};
+
+template <class T>
+int construct_counting_allocator<T>::constructions = 0;
+
+void test_vector() {
+    vector<int> vec = {1, 2, 3};
+    stdext::resize_default_init(vec, 1000); // reallocates
+    assert(vec.size() == 1000 && vec[0] == 1 && vec[2] == 3);
+    memset(vec.data() + 3, 0xFF, 997 * sizeof(int));
+    assert(vec[999] == -1);
+
+    stdext::resize_default_init(vec, 2);
+    assert(vec.size() == 2 && vec[1] == 2);
+
+    const int* const old_data = vec.data();
+    stdext::resize_default_init(vec, 500); // within capacity
+    assert(vec.size() == 500 && vec.data() == old_data && vec[1] == 2);
+
+    vector<unsigned char> buffer;
+    for (int chunk = 0; chunk < 100; ++chunk) {
+        unsigned char* const dest = stdext::append_default_init(buffer, 37);
+        assert(dest == buffer.data() + chunk * 37);
+        memset(dest, chunk, 37);
+    }
+
+    assert(buffer.size() == 3700 && buffer[0] == 0 && buffer[37] == 1 && buffer[3699] == 99);
+
+    // elements that aren't trivially default constructible are still constructed
+    vector<NonTrivial> objects(1);
+    stdext::resize_default_init(objects, 10);
+    assert(objects.size() == 10 && objects[9].value == 42);
+
+    // so are elements of allocators with their own construct
+    vector<int, construct_counting_allocator<int>> counted;
+    stdext::resize_default_init(counted, 5);
+    assert(construct_counting_allocator<int>::constructions == 5);
+    assert(counted[4] == 0);
+}
+
+void test_string() {
+    string str = "abc";
+    stdext::resize_default_init(str, 2);
+    assert(str == "ab");
+
+    stdext::resize_default_init(str, 100); // reallocates out of the small buffer
+    assert(str.size() == 100 && str.compare(0, 2, "ab") == 0 && str.c_str()[100] == '\0');
+    memset(&str[2], 'x', 98);
+    assert(str.find_first_not_of("abx") == string::npos);
+
+    char* const dest = stdext::append_default_init(str, 5);
+    assert(dest == str.data() + 100 && str.size() == 105 && str.c_str()[105] == '\0');
+    memcpy(dest, "hello", 5);
+    assert(str.compare(100, 5, "hello") == 0);
+
+    wstring wide;
+    wchar_t* const wdest = stdext::append_default_init(wide, 3);
+    wdest[0]             = L'x';
+    wdest[1]             = L'y';
+    wdest[2]             = L'z';
+    assert(wide == L"xyz");
+}
+
+int main() {
+    test_vector();
+    test_string();
+}
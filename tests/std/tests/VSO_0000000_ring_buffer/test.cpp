@@ -0,0 +1,298 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <ring_buffer>
+#include <stddef.h>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+using stdext::ring_buffer;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(is_same_v<iterator_traits<ring_buffer<int>::iterator>::iterator_category, random_access_iterator_tag>);
+STATIC_ASSERT(is_convertible_v<ring_buffer<int>::iterator, ring_buffer<int>::const_iterator>);
+STATIC_ASSERT(is_nothrow_move_constructible_v<ring_buffer<int>>);
+STATIC_ASSERT(is_nothrow_move_assignable_v<ring_buffer<int>>);
+
+template <class Ty>
+struct counting_allocator {
+    using value_type = Ty;
+
+    size_t* allocations;
+
+    explicit counting_allocator(size_t* const counter) noexcept : allocations(counter) {}
+
+    template <class Other>
+    counting_allocator(const counting_allocator<Other>& other) noexcept : allocations(other.allocations) {}
+
+    Ty* allocate(const size_t n) {
+        ++*allocations;
+        return allocator<Ty>{}.allocate(n);
+    }
+
+    void deallocate(Ty* const ptr, const size_t n) noexcept {
+        allocator<Ty>{}.deallocate(ptr, n);
+    }
+
+    template <class Other>
+    bool operator==(const counting_allocator<Other>& other) const noexcept {
+        return allocations == other.allocations;
+    }
+
+    template <class Other>
+    bool operator!=(const counting_allocator<Other>& other) const noexcept {
+        return allocations != other.allocations;
+    }
+};
+
+void test_wrap_around() {
+    ring_buffer<int> rb;
+    assert(rb.empty());
+    assert(rb.capacity() == 0);
+    assert(rb.begin() == rb.end());
+
+    rb.reserve(5);
+    assert(rb.capacity() == 8);
+
+    // slide a window of 6 elements through the 8 slots several times, so that the elements wrap around
+    for (int i = 0; i < 6; ++i) {
+        rb.push_back(i);
+    }
+
+    for (int i = 6; i < 100; ++i) {
+        rb.pop_front();
+        rb.push_back(i);
+        assert(rb.capacity() == 8);
+        assert(rb.size() == 6);
+        assert(rb.front() == i - 5);
+        assert(rb.back() == i);
+        assert(rb.end() - rb.begin() == 6);
+        for (size_t n = 0; n < 6; ++n) {
+            assert(rb[n] == i - 5 + static_cast<int>(n));
+            assert(rb.begin()[static_cast<ptrdiff_t>(n)] == rb[n]);
+        }
+
+        assert(equal(rb.rbegin(), rb.rend(), rb.crbegin()));
+        assert(is_sorted(rb.begin(), rb.end()));
+        assert(*(rb.end() - 1) == i);
+    }
+
+    const ring_buffer<int>& crb = rb;
+    assert(accumulate(crb.begin(), crb.end(), 0) == 94 + 95 + 96 + 97 + 98 + 99);
+    assert(crb.at(5) == 99);
+
+    try {
+        (void) crb.at(6);
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    rb.clear();
+    assert(rb.empty());
+    assert(rb.capacity() == 8);
+}
+
+void test_both_ends() {
+    ring_buffer<string> rb;
+    deque<string> expected;
+    for (int i = 1; i < 200; ++i) {
+        const string value = to_string(i);
+        if (i % 3 == 0) {
+            rb.push_front(value);
+            expected.push_front(value);
+        } else {
+            assert(rb.emplace_back(value) == value);
+            expected.emplace_back(value);
+        }
+
+        if (i % 7 == 0) {
+            rb.pop_back();
+            expected.pop_back();
+        }
+
+        if (i % 11 == 0) {
+            rb.pop_front();
+            expected.pop_front();
+        }
+
+        assert(rb.size() == expected.size());
+        assert(equal(rb.begin(), rb.end(), expected.begin(), expected.end()));
+    }
+
+    // growing keeps the order even when the elements wrap around
+    const size_t old_capacity = rb.capacity();
+    while (rb.size() != old_capacity) {
+        rb.emplace_front("x");
+        expected.emplace_front("x");
+    }
+
+    rb.push_back("y");
+    expected.push_back("y");
+    assert(rb.capacity() == old_capacity * 2);
+    assert(equal(rb.begin(), rb.end(), expected.begin(), expected.end()));
+
+    rb.shrink_to_fit();
+    assert(rb.capacity() == old_capacity * 2);
+    while (rb.size() > 9) {
+        rb.pop_front();
+        expected.pop_front();
+    }
+
+    rb.shrink_to_fit();
+    assert(rb.capacity() == 16);
+    assert(equal(rb.begin(), rb.end(), expected.begin(), expected.end()));
+
+    rb.clear();
+    rb.shrink_to_fit();
+    assert(rb.capacity() == 0);
+}
+
+void test_copy_move_swap() {
+    ring_buffer<int> a{1, 2, 3, 4, 5};
+    a.pop_front();
+    a.push_back(6);
+
+    ring_buffer<int> b(a);
+    assert(a == b);
+    assert((b == ring_buffer<int>{2, 3, 4, 5, 6}));
+
+    ring_buffer<int> c(move(b));
+    assert(b.empty());
+    assert(b.capacity() == 0);
+    assert(c == a);
+
+    ring_buffer<int> d;
+    d = a;
+    assert(d == a);
+    d = {7, 8};
+    assert(d != a);
+
+    auto a_first = a.begin();
+    swap(a, d);
+    assert((a == ring_buffer<int>{7, 8}));
+    assert(*a_first == 2); // iterators follow the elements
+    assert(a_first == d.begin());
+
+    d = move(a);
+    assert((d == ring_buffer<int>{7, 8}));
+
+    const int values[] = {10, 20, 30};
+    ring_buffer<int> e(begin(values), end(values));
+    assert(e.size() == 3);
+    assert(e.back() == 30);
+}
+
+void test_allocators() {
+    size_t first_count  = 0;
+    size_t second_count = 0;
+    using alloc         = counting_allocator<int>;
+
+    ring_buffer<int, alloc> first{alloc{&first_count}};
+    first.reserve(100);
+    assert(first.capacity() == 128);
+    assert(first_count == 1);
+    for (int i = 0; i < 10000; ++i) {
+        first.push_back(i);
+        if (first.size() > 100) {
+            first.pop_front();
+        }
+    }
+
+    assert(first_count == 1); // steady-state churn does not allocate
+
+    ring_buffer<int, alloc> second(first, alloc{&second_count});
+    assert(second == first);
+    assert(second_count == 1);
+
+    ring_buffer<int, alloc> third(move(second), alloc{&first_count});
+    assert(third == first);
+    assert(first_count == 2);
+
+    ring_buffer<int, alloc> fourth(move(first), alloc{&first_count});
+    assert(first.empty());
+    assert(first_count == 2); // equal allocators take over the buffer
+    assert(fourth.get_allocator() == alloc{&first_count});
+}
+
+struct throwing_copy {
+    static int countdown;
+
+    int value;
+
+    explicit throwing_copy(const int v) : value(v) {}
+    throwing_copy(const throwing_copy& other) : value(other.value) {
+        if (--countdown == 0) {
+            throw runtime_error("copy failed");
+        }
+    }
+
+    throwing_copy& operator=(const throwing_copy&) = default;
+};
+
+int throwing_copy::countdown = -1;
+
+void test_strong_guarantee() {
+    ring_buffer<throwing_copy> rb;
+    for (int i = 0; i < 8; ++i) {
+        rb.emplace_back(i);
+    }
+
+    rb.pop_front();
+    rb.emplace_back(8);
+    assert(rb.size() == rb.capacity());
+
+    throwing_copy::countdown = 4;
+    try {
+        rb.emplace_back(9);
+        assert(false);
+    } catch (const runtime_error&) {
+    }
+
+    throwing_copy::countdown = -1;
+    assert(rb.capacity() == 8);
+    assert(rb.size() == 8);
+    for (size_t n = 0; n < rb.size(); ++n) {
+        assert(rb[n].value == static_cast<int>(n) + 1);
+    }
+}
+
+void test_queue_adaptor() {
+    queue<int, ring_buffer<int>> q;
+    for (int i = 0; i < 1000; ++i) {
+        q.push(i);
+        if (i % 2 == 0) {
+            assert(q.front() == i / 2);
+            q.pop();
+        }
+    }
+
+    assert(q.size() == 500);
+    assert(q.front() == 500);
+    assert(q.back() == 999);
+
+    queue<int, ring_buffer<int>> other;
+    other.emplace(42);
+    swap(q, other);
+    assert(q.size() == 1);
+    assert(q.front() == 42);
+}
+
+int main() {
+    test_wrap_around();
+    test_both_ends();
+    test_copy_move_swap();
+    test_allocators();
+    test_strong_guarantee();
+    test_queue_adaptor();
+}
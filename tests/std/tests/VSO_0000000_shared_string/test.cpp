@@ -0,0 +1,223 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <shared_string>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::intern;
+using stdext::shared_string;
+
+static_assert(sizeof(shared_string) == 2 * sizeof(size_t) + 16, "unexpected shared_string size");
+static_assert(is_nothrow_copy_constructible_v<shared_string>);
+static_assert(is_nothrow_move_constructible_v<shared_string>);
+static_assert(!is_convertible_v<const char*, shared_string>);
+static_assert(is_convertible_v<shared_string, string_view>);
+
+const char long_text[] = "a string much too long for the inline buffer";
+
+void test_basics() {
+    const shared_string empty;
+    assert(empty.empty());
+    assert(empty.size() == 0);
+    assert(*empty.c_str() == '\0');
+    assert(empty.hash_code() == hash<string_view>{}(string_view{}));
+
+    const shared_string short_str{"short"};
+    assert(short_str.size() == 5);
+    assert(short_str == "short");
+    assert(short_str.c_str()[5] == '\0');
+    assert(!short_str.is_interned());
+
+    const shared_string long_str{string{long_text}};
+    assert(long_str.view() == long_text);
+    assert(long_str.c_str()[long_str.size()] == '\0');
+    assert(long_str.front() == 'a');
+    assert(long_str.back() == 'r');
+    assert(long_str[2] == 's');
+    assert(long_str.at(2) == 's');
+    assert(long_str.starts_with("a string"));
+    assert(long_str.ends_with("buffer"));
+    assert(!long_str.ends_with("a string much too long for the inline buffer!"));
+    assert(long_str.find("much") == 9);
+    assert(long_str.find('z') == shared_string::npos);
+    assert(long_str.rfind('e') == long_str.size() - 2);
+    assert(long_str.substr(2, 6) == "string");
+    assert(string(long_str.begin(), long_str.end()) == long_text);
+    assert(string(long_str.rbegin(), long_str.rend()).front() == 'r');
+
+    try {
+        (void) long_str.at(long_str.size());
+        assert(false);
+    } catch (const out_of_range&) {
+    }
+
+    // the cached hash matches string_view's, so hashed lookups by view find shared strings
+    assert(long_str.hash_code() == hash<string_view>{}(long_text));
+    assert(hash<shared_string>{}(long_str) == long_str.hash_code());
+    assert(hash<shared_string>{}(string_view{long_text}) == long_str.hash_code());
+
+    ostringstream os;
+    os << short_str << ' ' << long_str;
+    assert(os.str() == string{"short "} + long_text);
+}
+
+void test_copy_move() {
+    shared_string a{long_text};
+    shared_string b = a; // copies share the representation
+    assert(b.data() == a.data());
+    assert(a == b);
+
+    shared_string c = move(b);
+    assert(b.empty());
+    assert(c.data() == a.data());
+
+    b = c;
+    assert(b.data() == a.data());
+    b = shared_string{"other"};
+    assert(b == "other");
+    b = move(c);
+    assert(c.empty());
+    assert(b.data() == a.data());
+
+    shared_string s{"inline"};
+    shared_string t = s; // inline strings are copied
+    assert(t.data() != s.data());
+    assert(t == s);
+
+    swap(s, b);
+    assert(s.data() == a.data());
+    assert(b == "inline");
+}
+
+void test_comparisons() {
+    const shared_string abc{"abc"};
+    const shared_string abd{"abd"};
+    const shared_string long1{long_text};
+    const shared_string long2{long_text}; // equal, but a separate representation
+
+    assert(long1.data() != long2.data());
+    assert(long1 == long2);
+    assert(abc != abd);
+    assert(abc < abd);
+    assert(abd > abc);
+    assert(abc <= abc);
+    assert(abd >= abc);
+    assert(abc == string_view{"abc"});
+    assert(string_view{"abc"} == abc);
+    assert(abc != "abd");
+    assert("abd" != abc);
+    assert(abc.compare("abb") > 0);
+
+    equal_to<shared_string> eq;
+    assert(eq(long1, long2));
+    assert(eq(abc, string_view{"abc"}));
+    assert(!eq(string_view{"abd"}, abc));
+}
+
+void test_intern() {
+    const string key = long_text;
+    const shared_string a = intern(key);
+    const shared_string b = intern(string_view{key});
+    const shared_string c = intern(long_text);
+    assert(a.is_interned());
+    assert(a.data() == b.data());
+    assert(a.data() == c.data());
+    assert(a == shared_string{key});
+
+    // short strings stay inline
+    const shared_string tiny = intern("tiny");
+    assert(!tiny.is_interned());
+    assert(tiny == "tiny");
+
+    // distinct strings get distinct representations
+    const shared_string other = intern("a different string, also too long to be inline");
+    assert(other.data() != a.data());
+
+    const stdext::wshared_string wide = intern(L"wide characters that do not fit inline");
+    assert(wide.is_interned());
+    assert(wide.view() == L"wide characters that do not fit inline");
+    assert(wide.c_str()[wide.size()] == L'\0');
+    assert(intern(L"wide characters that do not fit inline").data() == wide.data());
+}
+
+void test_intern_release() {
+    // once every interned copy is gone, interning the same characters makes a fresh representation
+    string key = "a key that is interned, released, and interned again";
+    {
+        const shared_string first = intern(key);
+        const shared_string copy  = first;
+        assert(copy.data() == first.data());
+    }
+
+    const shared_string again = intern(key);
+    assert(again == key);
+    assert(again.is_interned());
+
+    // many entries, so the table's buckets grow
+    vector<shared_string> keys;
+    for (int i = 0; i < 2000; ++i) {
+        keys.push_back(intern("a reasonably long routing key #" + to_string(i)));
+    }
+
+    for (int i = 0; i < 2000; ++i) {
+        const shared_string found = intern("a reasonably long routing key #" + to_string(i));
+        assert(found.data() == keys[static_cast<size_t>(i)].data());
+    }
+}
+
+void test_threads() {
+    // threads intern and release the same keys concurrently; every live copy must stay readable
+    vector<thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 5000; ++i) {
+                const string key         = "a key shared between the threads #" + to_string(i % 37);
+                const shared_string s    = intern(key);
+                const shared_string copy = s;
+                assert(copy == key);
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void test_unordered_map() {
+    unordered_map<shared_string, int> routes;
+    routes.emplace(intern("/api/v1/users/profile/settings"), 1);
+    routes.emplace(intern("/api/v1/users/profile/avatar"), 2);
+    routes.emplace(shared_string{"/"}, 3);
+
+    assert(routes.at(intern("/api/v1/users/profile/settings")) == 1);
+    assert(routes.at(shared_string{"/"}) == 3);
+
+#if _HAS_CXX20
+    // heterogeneous lookup, since the hash and equal_to specializations are transparent
+    assert(routes.find(string_view{"/api/v1/users/profile/avatar"})->second == 2);
+    assert(routes.find(string_view{"/missing"}) == routes.end());
+#endif // _HAS_CXX20
+}
+
+int main() {
+    test_basics();
+    test_copy_move();
+    test_comparisons();
+    test_intern();
+    test_intern_release();
+    test_threads();
+    test_unordered_map();
+}
@@ -0,0 +1,353 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <memory>
+#include <random>
+#include <small_vector>
+#include <stddef.h>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using stdext::small_vector;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT(small_vector<int, 4>::inline_capacity == 4);
+STATIC_ASSERT(is_same_v<small_vector<int, 4>::iterator, vector<int>::iterator>);
+STATIC_ASSERT(is_nothrow_move_constructible_v<small_vector<string, 4>>);
+STATIC_ASSERT(is_nothrow_swappable_v<small_vector<string, 4>>);
+
+// counts the allocations made through it
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+
+    static size_t allocations;
+    static size_t outstanding;
+
+    counting_allocator() = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(const size_t n) {
+        ++allocations;
+        ++outstanding;
+        return allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* const p, const size_t n) noexcept {
+        --outstanding;
+        allocator<T>{}.deallocate(p, n);
+    }
+
+    template <class U>
+    bool operator==(const counting_allocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <class U>
+    bool operator!=(const counting_allocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+template <class T>
+size_t counting_allocator<T>::allocations = 0;
+template <class T>
+size_t counting_allocator<T>::outstanding = 0;
+
+// an element that throws on request, and keeps count of the live objects
+struct tracked {
+    static int live;
+    static int constructions_until_throw;
+
+    int value;
+
+    tracked(const int v) : value(v) {
+        if (constructions_until_throw > 0 && --constructions_until_throw == 0) {
+            throw runtime_error("tracked construction failed");
+        }
+
+        ++live;
+    }
+
+    tracked(const tracked& other) : tracked(other.value) {}
+
+    tracked(tracked&& other) noexcept : value(exchange(other.value, -1)) {
+        ++live;
+    }
+
+    tracked& operator=(const tracked&) = default;
+    tracked& operator=(tracked&& other) noexcept {
+        value = exchange(other.value, -1);
+        return *this;
+    }
+
+    ~tracked() {
+        --live;
+    }
+
+    friend bool operator==(const tracked& left, const tracked& right) {
+        return left.value == right.value;
+    }
+
+    friend bool operator<(const tracked& left, const tracked& right) {
+        return left.value < right.value;
+    }
+};
+
+int tracked::live                      = 0;
+int tracked::constructions_until_throw = 0;
+
+template <class SmallVector, class T>
+bool same_elements(const SmallVector& sv, const vector<T>& v) {
+    return equal(sv.begin(), sv.end(), v.begin(), v.end());
+}
+
+void test_inline_storage() {
+    using alloc = counting_allocator<int>;
+    {
+        small_vector<int, 8, alloc> v;
+        assert(v.empty());
+        assert(v.capacity() == 8);
+        assert(v.is_inline());
+        const void* const object_begin = &v;
+        const void* const object_end   = &v + 1;
+        for (int i = 0; i < 8; ++i) {
+            v.push_back(i);
+        }
+
+        assert(alloc::allocations == 0);
+        assert(static_cast<const void*>(v.data()) >= object_begin && static_cast<const void*>(v.data()) < object_end);
+
+        v.push_back(8); // spills to the allocator
+        assert(alloc::allocations == 1);
+        assert(!v.is_inline());
+        assert(v.capacity() == 12);
+        for (int i = 0; i < 9; ++i) {
+            assert(v[static_cast<size_t>(i)] == i);
+        }
+
+        v.resize(3);
+        v.shrink_to_fit(); // moves back inline
+        assert(v.is_inline());
+        assert(alloc::outstanding == 0);
+        assert(v.capacity() == 8);
+        assert((v == small_vector<int, 8, alloc>{0, 1, 2}));
+    }
+    assert(alloc::outstanding == 0);
+
+    small_vector<int, 0> empty_buffer;
+    assert(empty_buffer.capacity() == 0);
+    empty_buffer.push_back(1);
+    empty_buffer.push_back(2);
+    assert(!empty_buffer.is_inline());
+    assert(empty_buffer.size() == 2 && empty_buffer.back() == 2);
+}
+
+template <size_t N>
+void test_against_vector() {
+    mt19937 gen(1729);
+    uniform_int_distribution<int> op(0, 13);
+    uniform_int_distribution<int> value(0, 1000);
+    small_vector<string, N> sv;
+    vector<string> v;
+    for (int i = 0; i < 4000; ++i) {
+        const size_t where = v.empty() ? 0 : static_cast<size_t>(value(gen)) % (v.size() + 1);
+        const auto offset  = static_cast<ptrdiff_t>(where);
+        const string s     = to_string(value(gen)) + string(static_cast<size_t>(value(gen) % 30), 'x');
+        switch (op(gen)) {
+        case 0:
+        case 1:
+            sv.push_back(s);
+            v.push_back(s);
+            break;
+        case 2:
+            sv.emplace(sv.begin() + offset, s);
+            v.emplace(v.begin() + offset, s);
+            break;
+        case 3:
+            if (!v.empty()) {
+                sv.insert(sv.begin() + offset, 3, sv.front()); // aliasing
+                v.insert(v.begin() + offset, 3, v.front());
+            }
+            break;
+        case 4:
+            {
+                const string range[] = {s, s + "a", s + "b", s + "c", s + "d"};
+                sv.insert(sv.begin() + offset, begin(range), end(range));
+                v.insert(v.begin() + offset, begin(range), end(range));
+            }
+            break;
+        case 5:
+            if (where < v.size()) {
+                sv.erase(sv.begin() + offset);
+                v.erase(v.begin() + offset);
+            }
+            break;
+        case 6:
+            sv.erase(sv.begin() + offset / 2, sv.begin() + offset);
+            v.erase(v.begin() + offset / 2, v.begin() + offset);
+            break;
+        case 7:
+            sv.resize(where / 2);
+            v.resize(where / 2);
+            break;
+        case 8:
+            sv.resize(where + 3, s);
+            v.resize(where + 3, s);
+            break;
+        case 9:
+            sv.shrink_to_fit();
+            v.shrink_to_fit();
+            break;
+        case 10:
+            {
+                auto copy = sv;
+                assert(copy == sv);
+                sv = move(copy);
+                assert(copy.empty());
+            }
+            break;
+        case 11:
+            {
+                small_vector<string, N> other(v.begin(), v.begin() + offset / 3);
+                sv.swap(other);
+                assert(same_elements(other, v));
+                other.swap(sv);
+            }
+            break;
+        case 12:
+            if (!v.empty()) {
+                sv.pop_back();
+                v.pop_back();
+            }
+            break;
+        default:
+            sv.assign(where % 20, s);
+            v.assign(where % 20, s);
+            break;
+        }
+
+        assert(same_elements(sv, v));
+        assert(sv.capacity() >= N);
+        assert(sv.is_inline() == (sv.capacity() == N));
+    }
+}
+
+void test_moves_and_swaps() {
+    {
+        small_vector<tracked, 4> inline_elements{1, 2, 3};
+        const auto moved = move(inline_elements);
+        assert(inline_elements.empty());
+        assert((moved == small_vector<tracked, 4>{1, 2, 3}));
+
+        small_vector<tracked, 4> heap_elements{1, 2, 3, 4, 5, 6};
+        const tracked* const data = heap_elements.data();
+        small_vector<tracked, 4> stolen(move(heap_elements));
+        assert(stolen.data() == data); // the array was stolen
+        assert(heap_elements.empty() && heap_elements.is_inline());
+
+        small_vector<tracked, 4> a{10, 20};
+        small_vector<tracked, 4> b{1, 2, 3, 4, 5};
+        swap(a, b); // inline with allocated
+        assert((a == small_vector<tracked, 4>{1, 2, 3, 4, 5}));
+        assert((b == small_vector<tracked, 4>{10, 20}));
+        assert(!a.is_inline() && b.is_inline());
+        swap(a, b);
+        assert((a == small_vector<tracked, 4>{10, 20}));
+        assert((b == small_vector<tracked, 4>{1, 2, 3, 4, 5}));
+
+        small_vector<tracked, 4> c{7};
+        swap(a, c); // both inline, different sizes
+        assert((a == small_vector<tracked, 4>{7}));
+        assert((c == small_vector<tracked, 4>{10, 20}));
+
+        b = a; // copy assign into allocated storage
+        assert((b == small_vector<tracked, 4>{7}));
+        a = small_vector<tracked, 4>{1, 2, 3, 4, 5, 6, 7};
+        assert(a.size() == 7 && !a.is_inline());
+        assert(a < b && b > a && a <= a && a != b);
+    }
+    assert(tracked::live == 0);
+
+    small_vector<unique_ptr<int>, 2> pointers;
+    for (int i = 0; i < 10; ++i) {
+        pointers.insert(pointers.begin(), make_unique<int>(i));
+    }
+
+    auto other = move(pointers);
+    assert(*other.front() == 9 && *other.back() == 0);
+    other.erase(other.begin() + 1, other.end());
+    other.shrink_to_fit();
+    assert(other.is_inline() && *other[0] == 9);
+}
+
+void test_exception_safety() {
+    {
+        small_vector<tracked, 4> v{0, 1, 2, 3};
+        tracked::constructions_until_throw = 1;
+        try {
+            v.emplace_back(4); // would spill
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        assert((v == small_vector<tracked, 4>{0, 1, 2, 3}));
+        assert(v.is_inline());
+
+        v.push_back(4);
+        const int values[] = {10, 11, 12, 13, 14, 15};
+        tracked::constructions_until_throw = 3;
+        try {
+            v.insert(v.end(), begin(values), end(values));
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        assert((v == small_vector<tracked, 4>{0, 1, 2, 3, 4}));
+
+        tracked::constructions_until_throw = 2;
+        try {
+            small_vector<tracked, 4> copy(begin(values), end(values));
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        try {
+            (void) v.at(5);
+            assert(false);
+        } catch (const out_of_range&) {
+        }
+    }
+    assert(tracked::live == 0);
+}
+
+#if _HAS_CXX20
+void test_erase() {
+    small_vector<int, 4> v{1, 2, 3, 2, 5, 2};
+    assert(erase(v, 2) == 3);
+    assert((v == small_vector<int, 4>{1, 3, 5}));
+    assert(erase_if(v, [](const int x) { return x > 2; }) == 2);
+    assert((v == small_vector<int, 4>{1}));
+}
+#endif // _HAS_CXX20
+
+int main() {
+    test_inline_storage();
+    test_against_vector<0>();
+    test_against_vector<1>();
+    test_against_vector<5>();
+    test_against_vector<16>();
+    test_moves_and_swaps();
+    test_exception_safety();
+#if _HAS_CXX20
+    test_erase();
+#endif // _HAS_CXX20
+}
@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <functional>
+#include <random>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+size_t g_comparisons = 0;
+
+struct counting_less {
+    bool operator()(const int64_t lhs, const int64_t rhs) const {
+        ++g_comparisons;
+        return lhs < rhs;
+    }
+};
+
+enum class pattern { random, sorted, reversed, few_unique, all_equal, organ_pipe, sawtooth, sorted_with_noise };
+
+const pattern all_patterns[] = {pattern::random, pattern::sorted, pattern::reversed, pattern::few_unique,
+    pattern::all_equal, pattern::organ_pipe, pattern::sawtooth, pattern::sorted_with_noise};
+
+vector<int64_t> make_input(const pattern p, const size_t n, mt19937_64& gen) {
+    vector<int64_t> v(n);
+    for (size_t i = 0; i < n; ++i) {
+        const auto val = static_cast<int64_t>(i);
+        switch (p) {
+        case pattern::random:
+            v[i] = static_cast<int64_t>(gen());
+            break;
+        case pattern::sorted:
+            v[i] = val;
+            break;
+        case pattern::reversed:
+            v[i] = -val;
+            break;
+        case pattern::few_unique:
+            v[i] = static_cast<int64_t>(gen() % 4);
+            break;
+        case pattern::all_equal:
+            v[i] = 7;
+            break;
+        case pattern::organ_pipe:
+            v[i] = i < n / 2 ? val : static_cast<int64_t>(n) - val;
+            break;
+        case pattern::sawtooth:
+            v[i] = val % 37;
+            break;
+        case pattern::sorted_with_noise:
+            v[i] = i % 97 == 0 ? static_cast<int64_t>(gen() % (n + 1)) : val;
+            break;
+        }
+    }
+
+    return v;
+}
+
+template <class T>
+vector<T> convert(const vector<int64_t>& v) {
+    vector<T> result;
+    for (const auto& elem : v) {
+        result.push_back(static_cast<T>(elem));
+    }
+
+    return result;
+}
+
+template <class Container, class Pred>
+void check_sort(Container c, Pred pred) {
+    Container expected = c;
+    stable_sort(expected.begin(), expected.end(), pred);
+    sort(c.begin(), c.end(), pred);
+    assert(c == expected);
+}
+
+void test_patterns() {
+    // exercise the branchless partition (arithmetic elements in contiguous storage with plain comparisons) and the
+    // general partition on the same inputs, across sizes around the insertion sort and block size cutoffs
+    mt19937_64 gen(1729);
+    for (const size_t n : {0, 1, 2, 3, 31, 32, 33, 41, 64, 127, 128, 129, 130, 257, 1000, 4096, 50000}) {
+        for (const auto p : all_patterns) {
+            const auto v = make_input(p, n, gen);
+            check_sort(v, less<>{});
+            check_sort(v, less<int64_t>{});
+            check_sort(v, greater<>{});
+            check_sort(v, counting_less{});
+            check_sort(deque<int64_t>(v.begin(), v.end()), less<>{});
+            check_sort(convert<double>(v), less<double>{});
+            check_sort(convert<unsigned char>(v), greater<unsigned char>{});
+            if (n <= 4096) {
+                vector<string> strings;
+                for (const auto& elem : v) {
+                    strings.push_back(to_string(elem % 1000));
+                }
+
+                check_sort(strings, less<>{});
+            }
+        }
+    }
+}
+
+void test_presorted_is_linear() {
+    // already sorted input and input that is nothing but duplicates should not need n log n comparisons
+    mt19937_64 gen(1729);
+    constexpr size_t n = 100000;
+    for (const auto p : {pattern::sorted, pattern::all_equal}) {
+        auto v        = make_input(p, n, gen);
+        g_comparisons = 0;
+        sort(v.begin(), v.end(), counting_less{});
+        assert(is_sorted(v.begin(), v.end()));
+        assert(g_comparisons < 3 * n);
+    }
+}
+
+#if _HAS_CXX20
+constexpr bool test_constexpr() {
+    int arr[200]{};
+    for (int i = 0; i < 200; ++i) {
+        arr[i] = (i * 37) % 101;
+    }
+
+    sort(begin(arr), end(arr));
+    return is_sorted(begin(arr), end(arr));
+}
+
+static_assert(test_constexpr());
+#endif // _HAS_CXX20
+
+int main() {
+    test_patterns();
+    test_presorted_is_linear();
+}
@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <functional>
+#include <random>
+#include <stddef.h>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+template <class T, class V, class Pr>
+void check_searches(const vector<T>& v, const V val, Pr pred) {
+    // the expected bounds come from a linear scan
+    size_t lower = 0;
+    while (lower < v.size() && pred(v[lower], val)) {
+        ++lower;
+    }
+
+    size_t upper = lower;
+    while (upper < v.size() && !pred(val, v[upper])) {
+        ++upper;
+    }
+
+    const T* const first = v.data();
+    const T* const last  = first + v.size();
+    assert(lower_bound(v.begin(), v.end(), val, pred) == v.begin() + static_cast<ptrdiff_t>(lower));
+    assert(upper_bound(v.begin(), v.end(), val, pred) == v.begin() + static_cast<ptrdiff_t>(upper));
+    assert(lower_bound(first, last, val, pred) == first + lower);
+    assert(upper_bound(first, last, val, pred) == first + upper);
+
+    const auto range = equal_range(v.begin(), v.end(), val, pred);
+    assert(range.first == v.begin() + static_cast<ptrdiff_t>(lower));
+    assert(range.second == v.begin() + static_cast<ptrdiff_t>(upper));
+    assert(binary_search(v.begin(), v.end(), val, pred) == (lower != upper));
+
+#ifdef __cpp_lib_concepts
+    assert(ranges::lower_bound(v, val, pred) == v.begin() + static_cast<ptrdiff_t>(lower));
+    assert(ranges::upper_bound(first, last, val, pred) == first + upper);
+    const auto subrange = ranges::equal_range(v, val, pred);
+    assert(subrange.begin() == v.begin() + static_cast<ptrdiff_t>(lower));
+    assert(subrange.end() == v.begin() + static_cast<ptrdiff_t>(upper));
+    assert(ranges::binary_search(first, last, val, pred) == (lower != upper));
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_type(mt19937& gen) {
+    for (size_t n = 0; n < 300; n += (n < 40 ? 1 : 37)) {
+        vector<T> v(n);
+        for (auto& e : v) {
+            e = static_cast<T>(gen() % 50);
+        }
+
+        sort(v.begin(), v.end());
+        for (int i = -1; i <= 51; ++i) {
+            check_searches(v, static_cast<T>(i), less<>{});
+            check_searches(v, static_cast<T>(i), less<T>{});
+            check_searches(v, i, less<>{});
+            check_searches(v, i + 0.5, less<>{});
+            check_searches(v, static_cast<T>(i), [](const T& left, const T& right) { return left < right; });
+#ifdef __cpp_lib_concepts
+            check_searches(v, static_cast<T>(i), ranges::less{});
+#endif // __cpp_lib_concepts
+        }
+
+        reverse(v.begin(), v.end());
+        for (int i = -1; i <= 51; ++i) {
+            check_searches(v, static_cast<T>(i), greater<>{});
+            check_searches(v, static_cast<T>(i), greater<T>{});
+        }
+    }
+}
+
+int main() {
+    mt19937 gen(1729);
+    test_type<int>(gen);
+    test_type<unsigned char>(gen);
+    test_type<long long>(gen);
+    test_type<double>(gen);
+}
@@ -0,0 +1,162 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <forward_list>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stddef.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+size_t g_comparisons = 0;
+
+struct counting_less {
+    bool operator()(const int lhs, const int rhs) const {
+        ++g_comparisons;
+        return lhs < rhs;
+    }
+};
+
+int g_copies_until_throw = -1;
+
+struct throwing_copy {
+    int value;
+
+    explicit throwing_copy(int v) : value(v) {}
+    throwing_copy(const throwing_copy& other) : value(other.value) {
+        if (g_copies_until_throw == 0) {
+            throw 42;
+        }
+
+        --g_copies_until_throw;
+    }
+    throwing_copy& operator=(const throwing_copy&) = default;
+
+    friend bool operator<(const throwing_copy& lhs, const throwing_copy& rhs) {
+        return lhs.value < rhs.value;
+    }
+};
+
+template <class Tree>
+void check_tree(Tree& t, const vector<int>& expected) {
+    // walk both ways, then mutate, so that any broken link or coloring shows up
+    assert(t.size() == expected.size());
+    assert(equal(t.begin(), t.end(), expected.begin(), expected.end()));
+    assert(equal(t.rbegin(), t.rend(), expected.rbegin(), expected.rend()));
+    for (const int i : expected) {
+        assert(t.find(i) != t.end());
+    }
+
+    for (size_t i = 0; i < expected.size(); i += 2) {
+        t.erase(t.find(expected[i]));
+    }
+
+    assert(t.size() == expected.size() / 2);
+    for (size_t i = 0; i < expected.size(); i += 2) {
+        t.insert(expected[i]);
+    }
+
+    assert(equal(t.begin(), t.end(), expected.begin(), expected.end()));
+}
+
+void test_sorted_sizes() {
+    for (int n = 0; n < 300; ++n) {
+        vector<int> sorted;
+        for (int i = 0; i < n; ++i) {
+            sorted.push_back(i * 3);
+        }
+
+        g_comparisons = 0;
+        set<int, counting_less> s(sorted.begin(), sorted.end());
+#if _ITERATOR_DEBUG_LEVEL != 2
+        assert(g_comparisons == (n == 0 ? 0 : static_cast<size_t>(n - 1))); // only the sortedness check
+#endif // _ITERATOR_DEBUG_LEVEL != 2
+        check_tree(s, sorted);
+
+        multiset<int> ms(sorted.begin(), sorted.end());
+        check_tree(ms, sorted);
+    }
+}
+
+void test_map_from_pairs() {
+    vector<pair<int, string>> sorted;
+    for (int i = 0; i < 1000; ++i) {
+        sorted.emplace_back(i, to_string(i));
+    }
+
+    map<int, string> m(sorted.begin(), sorted.end());
+    assert(m.size() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        assert(m.at(i) == to_string(i));
+    }
+
+    const forward_list<pair<const int, string>> fl(sorted.begin(), sorted.end());
+    map<int, string> from_list(fl.begin(), fl.end());
+    assert(from_list == m);
+
+    multimap<int, string> mm(sorted.begin(), sorted.end());
+    assert(mm.size() == 1000);
+    assert(equal(mm.begin(), mm.end(), m.begin(), m.end()));
+}
+
+void test_unsorted_and_duplicates() {
+    const vector<int> unsorted{5, 1, 4, 1, 5, 9, 2, 6};
+    const set<int> s(unsorted.begin(), unsorted.end());
+    assert((vector<int>(s.begin(), s.end()) == vector<int>{1, 2, 4, 5, 6, 9}));
+
+    const vector<int> dups{1, 1, 2, 3, 3, 3, 4};
+    set<int> unique_from_dups(dups.begin(), dups.end());
+    check_tree(unique_from_dups, vector<int>{1, 2, 3, 4});
+
+    multiset<int> multi_from_dups(dups.begin(), dups.end());
+    assert((vector<int>(multi_from_dups.begin(), multi_from_dups.end()) == dups));
+
+    // a nonempty tree still inserts one element at a time
+    set<int> nonempty{0, 100};
+    nonempty.insert(dups.begin(), dups.end());
+    assert((vector<int>(nonempty.begin(), nonempty.end()) == vector<int>{0, 1, 2, 3, 4, 100}));
+
+    // input iterators can't be checked before building
+    istringstream input("1 2 3 4 5");
+    const set<int> from_stream{istream_iterator<int>(input), istream_iterator<int>()};
+    assert(from_stream.size() == 5);
+}
+
+void test_exception_safety() {
+    vector<throwing_copy> sorted;
+    for (int i = 0; i < 100; ++i) {
+        sorted.emplace_back(i);
+    }
+
+    for (int limit = 0; limit < 100; limit += 7) {
+        set<throwing_copy> s;
+        g_copies_until_throw = limit;
+        bool threw           = false;
+        try {
+            s.insert(sorted.begin(), sorted.end());
+        } catch (int) {
+            threw = true;
+        }
+
+        g_copies_until_throw = -1;
+        assert(threw);
+        assert(s.empty());
+        assert(s.begin() == s.end());
+        s.insert(sorted.begin(), sorted.end());
+        assert(s.size() == 100);
+    }
+}
+
+int main() {
+    test_sorted_sizes();
+    test_map_from_pairs();
+    test_unsorted_and_duplicates();
+    test_exception_safety();
+}
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <vector>
+
+using namespace std;
+
+bool is_close(const double actual, const double expected, const double tolerance = 1e-14) {
+    return abs(actual - expected) <= abs(expected) * tolerance;
+}
+
+bool is_same_value(const double left, const double right) {
+    return left == right || (isnan(left) && isnan(right));
+}
+
+struct bessel_case {
+    int order;
+    double arg;
+    double expected;
+};
+
+// computed in quad precision; both the power series and the recurrence are exercised for each order
+constexpr bessel_case bessel_cases[] = {
+    {2, 0.001, 1.25000010416666997e-07},
+    {2, 3.0, 2.24521244092995115e+00},
+    {2, 49.5, 1.71619397775428088e+20},
+    {3, 0.5, 2.64511196899028586e-03},
+    {3, 7.25, 1.10057249731587902e+02},
+    {5, 3.0, 9.12064776615133485e-02},
+    {5, 20.0, 2.30183922134136707e+07},
+    {10, 0.001, 2.69114451662974732e-40},
+    {10, 7.25, 3.38089481884590623e-01},
+    {20, 3.0, 1.52096600194266952e-15},
+    {20, 49.5, 3.18862161763948046e+18},
+    {35, 7.25, 5.23963035836147848e-21},
+    {50, 0.5, 2.59691526060265195e-95},
+    {50, 20.0, 2.25512057576040387e-14},
+};
+
+void test_cyl_bessel_i() {
+    for (const auto& c : bessel_cases) {
+        assert(is_close(cyl_bessel_i(c.order, c.arg), c.expected));
+        if (c.expected > 1e-30 && c.expected < 1e30) { // within the range of float
+            // rounding x to float perturbs I_n(x) by about n times as much
+            assert(is_close(cyl_bessel_if(static_cast<float>(c.order), static_cast<float>(c.arg)), c.expected, 1e-5));
+        }
+    }
+
+    assert(cyl_bessel_i(7, 0.0) == 0.0);
+
+    // I_(n-1)(x) - I_(n+1)(x) == (2n / x) * I_n(x), across the fast paths and the general algorithm
+    for (const double x : {0.25, 1.0, 4.5, 30.0, 50.0, 60.0}) {
+        for (int n = 1; n < 50; ++n) {
+            const double lower = cyl_bessel_i(n - 1, x);
+            const double upper = cyl_bessel_i(n + 1, x);
+            assert(is_close(lower - upper, 2 * n / x * cyl_bessel_i(n, x), 1e-12));
+        }
+    }
+
+    // orders that aren't integers, and the edges of the fast paths
+    assert(is_close(cyl_bessel_i(2.0, 50.0), cyl_bessel_i(2.0, nextafter(50.0, 51.0)), 1e-13));
+    assert(is_close(cyl_bessel_i(50.0, 10.0), cyl_bessel_i(nextafter(50.0, 51.0), 10.0), 1e-13));
+    assert(is_close(cyl_bessel_i(2.0, 3.0), cyl_bessel_i(nextafter(2.0, 3.0), 3.0), 1e-13));
+    assert(isnan(cyl_bessel_i(2.0, numeric_limits<double>::quiet_NaN())));
+}
+
+void test_cyl_bessel_i_array() {
+    vector<double> args;
+    for (int i = 0; i <= 200; ++i) {
+        args.push_back(i * 0.3);
+    }
+
+    args.push_back(numeric_limits<double>::quiet_NaN());
+    vector<double> results(args.size());
+    for (const double order : {0.0, 1.0, 2.0, 2.5, 17.0}) {
+        stdext::cyl_bessel_i(order, span<const double>{args}, span<double>{results});
+        for (size_t i = 0; i < args.size(); ++i) {
+            assert(is_same_value(results[i], cyl_bessel_i(order, args[i])));
+        }
+    }
+
+    const vector<float> float_args{0.0f, 0.5f, 2.0f, 10.0f, 45.0f};
+    vector<float> float_results(float_args.size());
+    stdext::cyl_bessel_i(3.0f, span<const float>{float_args}, span<float>{float_results});
+    for (size_t i = 0; i < float_args.size(); ++i) {
+        assert(float_results[i] == cyl_bessel_if(3.0f, float_args[i]));
+    }
+
+    // in place
+    vector<double> in_place = args;
+    stdext::cyl_bessel_i(4.0, span<const double>{in_place}, span<double>{in_place});
+    for (size_t i = 0; i < args.size(); ++i) {
+        assert(is_same_value(in_place[i], cyl_bessel_i(4.0, args[i])));
+    }
+
+    stdext::cyl_bessel_i(4.0, span<const double>{}, span<double>{});
+}
+
+void test_expint_array() {
+    vector<double> args;
+    for (int i = -100; i <= 100; ++i) {
+        args.push_back(i * 0.37);
+    }
+
+    args.push_back(numeric_limits<double>::infinity());
+    args.push_back(numeric_limits<double>::quiet_NaN());
+    vector<double> results(args.size());
+    stdext::expint(span<const double>{args}, span<double>{results});
+    for (size_t i = 0; i < args.size(); ++i) {
+        assert(is_same_value(results[i], expint(args[i])));
+    }
+
+    const vector<float> float_args{-3.0f, -0.5f, 0.25f, 1.0f, 12.0f};
+    vector<float> float_results(float_args.size());
+    stdext::expint(span<const float>{float_args}, span<float>{float_results});
+    for (size_t i = 0; i < float_args.size(); ++i) {
+        assert(float_results[i] == expintf(float_args[i]));
+    }
+}
+
+int main() {
+    test_cyl_bessel_i();
+    test_cyl_bessel_i_array();
+    test_expint_array();
+}
@@ -0,0 +1,146 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <assert.h>
+#include <deque>
+#include <random>
+#include <stddef.h>
+#include <utility>
+#include <vector>
+
+#if _HAS_CXX17
+#include <execution>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+size_t g_comparisons = 0;
+
+struct key_less {
+    bool operator()(const pair<int, size_t>& lhs, const pair<int, size_t>& rhs) const {
+        ++g_comparisons;
+        return lhs.first < rhs.first;
+    }
+};
+
+enum class pattern {
+    random,
+    few_unique,
+    sorted,
+    reversed,
+    reversed_with_duplicates,
+    ascending_runs,
+    mixed_runs,
+    sorted_then_random,
+    sorted_with_swaps
+};
+
+const pattern all_patterns[] = {pattern::random, pattern::few_unique, pattern::sorted, pattern::reversed,
+    pattern::reversed_with_duplicates, pattern::ascending_runs, pattern::mixed_runs, pattern::sorted_then_random,
+    pattern::sorted_with_swaps};
+
+vector<pair<int, size_t>> make_input(const pattern p, const size_t n, mt19937& gen) {
+    // the second member of each element records its original position, so that stability can be checked
+    vector<int> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        const auto val = static_cast<int>(i);
+        switch (p) {
+        case pattern::random:
+            keys[i] = static_cast<int>(gen() % 100000);
+            break;
+        case pattern::few_unique:
+            keys[i] = static_cast<int>(gen() % 4);
+            break;
+        case pattern::sorted:
+        case pattern::sorted_with_swaps:
+            keys[i] = val;
+            break;
+        case pattern::reversed:
+            keys[i] = -val;
+            break;
+        case pattern::reversed_with_duplicates:
+            keys[i] = -val / 3;
+            break;
+        case pattern::ascending_runs:
+        case pattern::mixed_runs:
+            keys[i] = static_cast<int>(gen() % 1000);
+            break;
+        case pattern::sorted_then_random:
+            keys[i] = i < n - n / 10 ? val : static_cast<int>(gen() % (n + 1));
+            break;
+        }
+    }
+
+    if (p == pattern::ascending_runs || p == pattern::mixed_runs) {
+        for (size_t first = 0; first != n;) {
+            const size_t last = (min)(n, first + 1 + gen() % 300);
+            if (p == pattern::mixed_runs && gen() % 2 == 0) {
+                sort(keys.begin() + first, keys.begin() + last, greater<>{});
+            } else {
+                sort(keys.begin() + first, keys.begin() + last);
+            }
+
+            first = last;
+        }
+    } else if (p == pattern::sorted_with_swaps && n != 0) {
+        for (size_t i = 0; i < n / 100; ++i) {
+            swap(keys[gen() % n], keys[gen() % n]);
+        }
+    }
+
+    vector<pair<int, size_t>> v;
+    for (size_t i = 0; i < n; ++i) {
+        v.emplace_back(keys[i], i);
+    }
+
+    return v;
+}
+
+template <class Container>
+void check_stable_sort(const vector<pair<int, size_t>>& v) {
+    auto expected = v;
+    sort(expected.begin(), expected.end()); // equivalent keys are ordered by original position
+    Container c(v.begin(), v.end());
+    stable_sort(c.begin(), c.end(), key_less{});
+    assert(equal(c.begin(), c.end(), expected.begin(), expected.end()));
+}
+
+void test_patterns() {
+    // sizes around the insertion sort cutoff, the block size of run-free stretches, and beyond
+    mt19937 gen(1729);
+    for (const size_t n : {0, 1, 2, 31, 32, 33, 64, 65, 100, 1000, 8191, 8192, 8193, 20000, 100000}) {
+        for (const auto p : all_patterns) {
+            const auto v = make_input(p, n, gen);
+            check_stable_sort<vector<pair<int, size_t>>>(v);
+            if (n <= 20000) {
+                check_stable_sort<deque<pair<int, size_t>>>(v);
+            }
+
+#if _HAS_CXX17
+            auto expected = v;
+            sort(expected.begin(), expected.end());
+            auto parallel = v;
+            stable_sort(execution::par, parallel.begin(), parallel.end(), key_less{});
+            assert(parallel == expected);
+#endif // _HAS_CXX17
+        }
+    }
+}
+
+void test_presorted_is_linear() {
+    // input that is one long run should be sorted by finding that run rather than sorting from scratch
+    mt19937 gen(1729);
+    constexpr size_t n = 100000;
+    for (const auto p : {pattern::sorted, pattern::reversed}) {
+        auto v        = make_input(p, n, gen);
+        g_comparisons = 0;
+        stable_sort(v.begin(), v.end(), key_less{});
+        assert(g_comparisons < 2 * n);
+    }
+}
+
+int main() {
+    test_patterns();
+    test_presorted_is_linear();
+}
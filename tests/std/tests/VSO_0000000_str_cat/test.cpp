@@ -0,0 +1,69 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <climits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+using namespace std;
+
+void test_str_cat() {
+    const string s = "abc";
+    const string_view sv{"def"};
+    const char* const ntbs = "ghi";
+    assert(stdext::str_cat() == "");
+    assert(stdext::str_cat(s, '-', sv, ntbs, "jkl") == "abc-defghijkl");
+    assert(stdext::str_cat(0, ' ', 42, ' ', -7, ' ', 123u, ' ', static_cast<short>(-300)) == "0 42 -7 123 -300");
+    assert(stdext::str_cat(LLONG_MIN, '|', LLONG_MAX, '|', ULLONG_MAX)
+           == "-9223372036854775808|9223372036854775807|18446744073709551615");
+    assert(stdext::str_cat(INT_MIN, static_cast<unsigned short>(65535)) == "-214748364865535");
+
+    const wstring w = stdext::str_cat<wchar_t>(L"x", L'=', -12, wstring_view{L"yz"});
+    assert(w == L"x=-12yz");
+    static_assert(is_same_v<decltype(stdext::str_cat<char16_t>(u"a", 1)), u16string>);
+    assert(stdext::str_cat<char16_t>(u"a", 1) == u"a1");
+}
+
+void test_str_append() {
+    string s = "key";
+    string& r = stdext::str_append(s, '=', 1729, ';');
+    assert(&r == &s);
+    assert(s == "key=1729;");
+
+    // enough capacity: the pieces are appended in place
+    s.reserve(100);
+    const auto capacity = s.capacity();
+    const char* const data = s.data();
+    stdext::str_append(s, "abc", string_view{"de"}, -1);
+    assert(s == "key=1729;abcde-1");
+    assert(s.capacity() == capacity);
+    assert(s.data() == data);
+
+    // not enough capacity: the string grows exactly once, to fit every piece
+    string t(20, 'a');
+    t.shrink_to_fit();
+    const string tail(200, 'b');
+    stdext::str_append(t, tail, tail, 7);
+    assert(t.size() == 421);
+    assert(t.capacity() >= 421);
+    assert(t == string(20, 'a') + tail + tail + "7");
+
+    // pieces may refer to the destination itself, even when it has to grow
+    string u = "xy";
+    u.shrink_to_fit();
+    stdext::str_append(u, u, u, u, u, u, u, u, u);
+    assert(u == "xyxyxyxyxyxyxyxyxy");
+    stdext::str_append(u, string_view{u}.substr(0, 3));
+    assert(u == "xyxyxyxyxyxyxyxyxyxyx");
+
+    wstring w = L"n";
+    stdext::str_append(w, L'=', 5u);
+    assert(w == L"n=5");
+}
+
+int main() {
+    test_str_cat();
+    test_str_append();
+}
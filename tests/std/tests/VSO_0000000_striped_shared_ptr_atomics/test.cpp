@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _ENABLE_STRIPED_SHARED_PTR_ATOMICS
+#define _SILENCE_CXX20_OLD_SHARED_PTR_ATOMIC_SUPPORT_DEPRECATION_WARNING
+
+#include <cassert>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+shared_ptr<int> g_sp;
+
+struct Noisy {
+    Noisy() = default;
+
+    ~Noisy() {
+        // the lock must not be held while an old value is destroyed
+        (void) atomic_load(&g_sp);
+    }
+
+    Noisy(const Noisy&) = delete;
+    Noisy& operator=(const Noisy&) = delete;
+};
+
+void test_no_destruction_under_lock() {
+    shared_ptr<Noisy> dest = make_shared<Noisy>();
+    atomic_store(&dest, make_shared<Noisy>());
+    (void) atomic_exchange(&dest, make_shared<Noisy>());
+
+    shared_ptr<Noisy> expected = make_shared<Noisy>();
+    assert(!atomic_compare_exchange_strong(&dest, &expected, make_shared<Noisy>()));
+    assert(expected == dest);
+    assert(atomic_compare_exchange_strong(&dest, &expected, make_shared<Noisy>()));
+    assert(expected != dest);
+}
+
+void test_single_thread() {
+    shared_ptr<int> sp;
+    assert(!atomic_is_lock_free(&sp));
+    assert(atomic_load(&sp) == nullptr);
+
+    atomic_store(&sp, make_shared<int>(1));
+    assert(*atomic_load_explicit(&sp, memory_order_acquire) == 1);
+
+    const shared_ptr<int> old = atomic_exchange(&sp, make_shared<int>(2));
+    assert(*old == 1);
+    assert(*sp == 2);
+
+    shared_ptr<int> expected = old;
+    assert(!atomic_compare_exchange_weak(&sp, &expected, make_shared<int>(3)));
+    assert(expected == sp);
+    while (!atomic_compare_exchange_weak(&sp, &expected, make_shared<int>(3))) {
+    }
+
+    assert(*sp == 3);
+}
+
+void test_contended() {
+    // each thread increments a counter held in one shared shared_ptr, and one of its own, by replacing the pointee
+    constexpr int thread_count = 8;
+    constexpr int iterations   = 2000;
+    shared_ptr<int> shared     = make_shared<int>(0);
+    vector<shared_ptr<int>> own(thread_count);
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < iterations; ++j) {
+                shared_ptr<int> expected = atomic_load(&shared);
+                while (!atomic_compare_exchange_weak(&shared, &expected, make_shared<int>(*expected + 1))) {
+                }
+
+                atomic_store(&own[static_cast<size_t>(i)], make_shared<int>(j));
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(*shared == thread_count * iterations);
+    for (const auto& sp : own) {
+        assert(*sp == iterations - 1);
+    }
+}
+
+int main() {
+    test_no_destruction_under_lock();
+    test_single_thread();
+    test_contended();
+}
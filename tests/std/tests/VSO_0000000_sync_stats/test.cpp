@@ -0,0 +1,131 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <locale>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+using stdext::lock_statistics;
+using stdext::mutex_statistics;
+
+void assert_consistent(const lock_statistics& stats) {
+    assert(stats.contended <= stats.acquisitions);
+    assert(stats.contended != 0 || stats.wait_nanoseconds == 0);
+    assert(stats.contention_rate() >= 0.0 && stats.contention_rate() <= 1.0);
+}
+
+void test_contention_rate() {
+    lock_statistics stats{};
+    assert(stats.contention_rate() == 0.0);
+    stats = {8, 2, 100};
+    assert(stats.contention_rate() == 0.25);
+}
+
+void test_mutex(const int thread_count) {
+    constexpr int iterations = 20 * stdext::mutex_stats_sample_period;
+    stdext::enable_sync_stats(true); // starts over, in case m has the address of an earlier test's mutex
+    mutex m;
+    long long counter = 0;
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < iterations; ++j) {
+                lock_guard<mutex> guard(m);
+                ++counter;
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(counter == static_cast<long long>(thread_count) * iterations);
+
+    vector<mutex_statistics> stats(mutex_sync_stats(nullptr, 0));
+    stats.resize(mutex_sync_stats(stats.data(), stats.size()));
+    bool found = false;
+    for (const auto& entry : stats) {
+        assert_consistent(entry.stats);
+        if (entry.mutex == &m) {
+            assert(!found);
+            found = true;
+            // every thread counted each of its sampled lock() calls
+            assert(entry.stats.acquisitions
+                   == static_cast<unsigned long long>(thread_count) * (iterations / stdext::mutex_stats_sample_period));
+        }
+    }
+
+    assert(found);
+}
+
+void test_lockit() {
+    const auto before = stdext::sync_stats().lockit[_LOCK_LOCALE].acquisitions;
+    for (int i = 0; i < 100; ++i) {
+        locale loc;
+        (void) use_facet<ctype<char>>(loc);
+    }
+
+    const auto stats = stdext::sync_stats();
+    assert(stats.lockit[_LOCK_LOCALE].acquisitions > before);
+    for (const auto& kind : stats.lockit) {
+        assert_consistent(kind);
+    }
+}
+
+struct big {
+    int a;
+    int b;
+    int c;
+};
+
+void test_atomic_wait() {
+    // not lock-free, so notify goes through the atomic wait table
+    atomic<big> value{big{0, 0, 0}};
+    const auto before = stdext::sync_stats().atomic_wait.acquisitions;
+    thread waiter([&] { value.wait(big{0, 0, 0}); });
+    value.store(big{1, 2, 3});
+    value.notify_all();
+    waiter.join();
+
+    const auto total = stdext::sync_stats().atomic_wait;
+    assert(total.acquisitions > before);
+    assert_consistent(total);
+
+    const size_t bucket_count = stdext::atomic_wait_sync_stats(nullptr, 0);
+    assert(bucket_count != 0);
+    vector<lock_statistics> buckets(bucket_count);
+    assert(stdext::atomic_wait_sync_stats(buckets.data(), buckets.size()) == bucket_count);
+    unsigned long long sum = 0;
+    for (const auto& bucket : buckets) {
+        assert_consistent(bucket);
+        sum += bucket.acquisitions;
+    }
+
+    assert(sum >= total.acquisitions);
+}
+
+void test_disabled() {
+    stdext::enable_sync_stats(false);
+    const auto before = stdext::sync_stats().lockit[_LOCK_LOCALE].acquisitions;
+    locale loc;
+    (void) use_facet<ctype<char>>(loc);
+    // disabling keeps the counts, but stops counting
+    assert(stdext::sync_stats().lockit[_LOCK_LOCALE].acquisitions == before);
+}
+
+int main() {
+    test_contention_rate();
+    stdext::enable_sync_stats(true);
+    test_mutex(1);
+    test_mutex(4);
+    test_lockit();
+    test_atomic_wait();
+    test_disabled();
+}
@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <ios>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+using namespace std;
+
+const char* const input_name  = "VSO_0000000_sync_with_stdio_in.txt";
+const char* const output_name = "VSO_0000000_sync_with_stdio_out.txt";
+
+int main() {
+    {
+        ofstream input(input_name);
+        input << "1 2 3\n";
+        for (int i = 0; i < 10'000; ++i) {
+            input << i << '\n';
+        }
+    }
+
+    FILE* stream = nullptr;
+    assert(freopen_s(&stream, input_name, "r", stdin) == 0);
+    assert(freopen_s(&stream, output_name, "w", stdout) == 0);
+
+    assert(ios_base::sync_with_stdio(false));
+    assert(!ios_base::sync_with_stdio(false));
+
+    // the standard streams still read and write through the C streams, now with large buffers
+    int a = 0;
+    int b = 0;
+    int c = 0;
+    assert(cin >> a >> b >> c);
+    assert(a == 1 && b == 2 && c == 3);
+
+    long long sum = 0;
+    int count     = 0;
+    for (int value; cin >> value; ++count) {
+        sum += value;
+    }
+
+    assert(count == 10'000);
+    assert(sum == 10'000LL * 9'999 / 2);
+
+    string expected;
+    for (int i = 0; i < 20'000; ++i) {
+        cout << i << ' ';
+        expected += to_string(i) + ' ';
+    }
+
+    cout << "end" << endl;
+    expected += "end\n";
+
+    assert(!ios_base::sync_with_stdio(true));
+    cout << "mixed ";
+    assert(fputs("with stdio\n", stdout) >= 0);
+    expected += "mixed with stdio\n";
+    assert(cout.flush());
+    assert(fflush(stdout) == 0);
+
+    ifstream output(output_name);
+    const string actual{istreambuf_iterator<char>(output), istreambuf_iterator<char>()};
+    assert(actual == expected);
+}
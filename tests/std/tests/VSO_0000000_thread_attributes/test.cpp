@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <atomic>
+#include <stddef.h>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <Windows.h>
+
+using namespace std;
+using stdext::thread_attributes;
+
+void test_defaults() {
+    // value-initialized attributes start the thread as the constructors without attributes do
+    int result = 0;
+    thread t(thread_attributes{}, [](int& dest, const int val) { dest = val; }, ref(result), 42);
+    t.join();
+    assert(result == 42);
+}
+
+void test_stack_size() {
+    thread_attributes attrs;
+    attrs.stack_size = 64 * 1024;
+
+    ULONG_PTR low  = 0;
+    ULONG_PTR high = 0;
+    thread t(attrs, [&] { GetCurrentThreadStackLimits(&low, &high); });
+    t.join();
+    assert(high - low == 64 * 1024); // the reservation, not only the initial commit
+}
+
+void test_affinity_and_priority() {
+    thread_attributes attrs;
+    attrs.affinity_mask = 1; // the first processor of group 0, which every machine has
+    attrs.priority      = THREAD_PRIORITY_ABOVE_NORMAL;
+    attrs.description   = L"test_affinity_and_priority";
+
+    GROUP_AFFINITY affinity{};
+    int priority = THREAD_PRIORITY_NORMAL;
+    thread t(attrs, [&] {
+        // applied before the thread runs, rather than raced against it
+        (void) GetThreadGroupAffinity(GetCurrentThread(), &affinity);
+        priority = GetThreadPriority(GetCurrentThread());
+    });
+    t.join();
+    assert(affinity.Group == 0 && affinity.Mask == 1);
+    assert(priority == THREAD_PRIORITY_ABOVE_NORMAL);
+}
+
+void test_rejected_attributes() {
+    // the function doesn't run on a thread whose attributes the system rejects
+    atomic<bool> ran{false};
+
+    thread_attributes bad_priority;
+    bad_priority.priority = 100;
+
+    thread_attributes bad_group;
+    bad_group.processor_group = 0xFFFF;
+    bad_group.affinity_mask   = 1;
+
+    for (const auto& attrs : {bad_priority, bad_group}) {
+        try {
+            thread t(attrs, [&] { ran = true; });
+            assert(false);
+        } catch (const system_error& e) {
+            assert(e.code() == errc::invalid_argument);
+        }
+    }
+
+    assert(!ran);
+}
+
+#if _HAS_CXX20
+void test_jthread() {
+    thread_attributes attrs;
+    attrs.stack_size  = 128 * 1024;
+    attrs.description = L"test_jthread";
+
+    atomic<bool> stopped{false};
+    {
+        jthread t(attrs, [&](stop_token token) {
+            while (!token.stop_requested()) {
+                this_thread::yield();
+            }
+
+            stopped = true;
+        });
+    }
+    assert(stopped);
+
+    bool ran = false;
+    jthread plain(attrs, [&] { ran = true; });
+    plain.join();
+    assert(ran);
+}
+#endif // _HAS_CXX20
+
+int main() {
+    test_defaults();
+    test_stack_size();
+    test_affinity_and_priority();
+    test_rejected_attributes();
+#if _HAS_CXX20
+    test_jthread();
+#endif // _HAS_CXX20
+}
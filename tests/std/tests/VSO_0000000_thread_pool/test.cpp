@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <execution>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <thread_pool>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::thread_pool;
+
+STATIC_ASSERT(!is_copy_constructible_v<thread_pool>);
+STATIC_ASSERT(!is_copy_assignable_v<thread_pool>);
+
+class concurrency_meter { // records the most calls to run() in progress at once
+public:
+    void run() {
+        const int now = ++active;
+        int seen      = peak.load();
+        while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+        }
+
+        this_thread::sleep_for(1ms);
+        --active;
+    }
+
+    int max_concurrency() const {
+        return peak.load();
+    }
+
+private:
+    atomic<int> active{0};
+    atomic<int> peak{0};
+};
+
+void test_submit() {
+    constexpr int count = 1000;
+    atomic<int> done{0};
+    {
+        thread_pool pool(4);
+        assert(pool.max_threads() == 4);
+        for (int i = 0; i < count; ++i) {
+            pool.submit([&done] { ++done; });
+        }
+
+        pool.wait();
+        assert(done == count);
+
+        auto owned = make_unique<int>(42); // move-only functions are accepted
+        pool.submit([&done, owned = move(owned)] { done += *owned; });
+    } // waits for the last function
+
+    assert(done == count + 42);
+    assert(thread_pool{}.max_threads() == max(thread::hardware_concurrency(), 1u));
+}
+
+void test_max_threads() {
+    thread_pool pool(2);
+    concurrency_meter meter;
+    for (int i = 0; i < 50; ++i) {
+        pool.submit([&meter] { meter.run(); });
+    }
+
+    pool.wait();
+    assert(meter.max_concurrency() <= 2);
+}
+
+void test_default_pool() {
+    thread_pool pool(2);
+    stdext::set_default_thread_pool(&pool);
+
+    // the calling thread takes part in parallel algorithms, so at most one more thread runs them
+    concurrency_meter meter;
+    vector<int> values(200);
+    for_each(execution::par, values.begin(), values.end(), [&meter](int&) { meter.run(); });
+    assert(meter.max_concurrency() <= 3);
+
+    const auto caller = this_thread::get_id();
+    assert(async(launch::async, [caller] { return this_thread::get_id() != caller; }).get());
+
+    stdext::set_default_thread_pool(nullptr);
+    assert(async(launch::async, [] { return 1729; }).get() == 1729);
+}
+
+void test_destroy_default_pool() {
+    {
+        thread_pool pool(1);
+        stdext::set_default_thread_pool(&pool);
+    } // the system thread pool takes over
+
+    vector<int> values(10000, 1);
+    assert(reduce(execution::par, values.begin(), values.end()) == 10000);
+    assert(async(launch::async, [] { return 7; }).get() == 7);
+}
+
+int main() {
+    test_submit();
+    test_max_threads();
+    test_default_pool();
+    test_destroy_default_pool();
+}
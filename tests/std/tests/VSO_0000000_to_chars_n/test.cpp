@@ -0,0 +1,93 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+using namespace std;
+
+using stdext::to_chars_n;
+using stdext::to_chars_n_result;
+
+// formats values one at a time with to_chars, as to_chars_n should
+template <class Floating, class... Format>
+string expected_output(const vector<Floating>& values, const char separator, const Format... fmt) {
+    string result;
+    char buffer[1024];
+    for (size_t i = 0; i != values.size(); ++i) {
+        if (i != 0) {
+            result += separator;
+        }
+
+        const auto [ptr, ec] = to_chars(buffer, end(buffer), values[i], fmt...);
+        assert(ec == errc{});
+        result.append(buffer, ptr);
+    }
+
+    return result;
+}
+
+template <class Floating>
+void test_type() {
+    const vector<Floating> values = {Floating{0}, Floating{-0.0}, Floating{1}, Floating{0.1}, Floating{-2.5},
+        Floating{1e30}, numeric_limits<Floating>::max(), numeric_limits<Floating>::denorm_min(),
+        numeric_limits<Floating>::infinity(), -numeric_limits<Floating>::infinity(),
+        numeric_limits<Floating>::quiet_NaN()};
+
+    char buffer[2048];
+    vector<size_t> offsets(values.size());
+    {
+        const string expected          = expected_output(values, ',');
+        const to_chars_n_result result =
+            to_chars_n(begin(buffer), end(buffer), values.data(), values.size(), ',', offsets.data());
+        assert(result.ec == errc{});
+        assert(result.count == values.size());
+        assert(string_view(buffer, static_cast<size_t>(result.ptr - buffer)) == expected);
+
+        assert(offsets[0] == 0);
+        for (size_t i = 1; i != values.size(); ++i) {
+            assert(buffer[offsets[i] - 1] == ',');
+        }
+    }
+
+    for (const auto fmt : {chars_format::general, chars_format::scientific, chars_format::fixed, chars_format::hex}) {
+        const string expected          = expected_output(values, '\n', fmt);
+        const to_chars_n_result result =
+            to_chars_n(begin(buffer), end(buffer), values.data(), values.size(), fmt, '\n');
+        assert(result.ec == errc{});
+        assert(result.count == values.size());
+        assert(string_view(buffer, static_cast<size_t>(result.ptr - buffer)) == expected);
+    }
+
+    { // nothing to write
+        const to_chars_n_result result = to_chars_n(buffer, buffer, values.data(), 0, ',');
+        assert(result.ptr == buffer && result.ec == errc{} && result.count == 0);
+    }
+
+    { // running out of room stops after the last value that fit, before its separator
+        const Floating small[] = {Floating{1}, Floating{22}, Floating{333}};
+        const char* const prefixes[] = {"", "1", "1", "1", "1 22", "1 22", "1 22", "1 22"};
+        for (size_t size = 0; size != 8; ++size) {
+            const to_chars_n_result result = to_chars_n(buffer, buffer + size, small, 3, ' ');
+            assert(result.ec == errc::value_too_large);
+            assert(string_view(buffer, static_cast<size_t>(result.ptr - buffer)) == prefixes[size]);
+            assert(result.count == (size < 1 ? 0 : size < 4 ? 1 : 2));
+        }
+
+        const to_chars_n_result result = to_chars_n(buffer, buffer + 8, small, 3, ' ');
+        assert(result.ec == errc{} && result.count == 3);
+        assert(string_view(buffer, 8) == "1 22 333");
+    }
+}
+
+int main() {
+    test_type<float>();
+    test_type<double>();
+}
@@ -0,0 +1,258 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+// a handle type whose special member functions are observable, and which opts into relocation
+struct handle {
+    static int moves;
+    static int destructions;
+    static int live;
+    static int constructions_until_throw;
+
+    int* resource;
+
+    explicit handle(const int value) : resource(new int(value)) {
+        if (constructions_until_throw > 0 && --constructions_until_throw == 0) {
+            delete resource;
+            throw runtime_error("handle construction failed");
+        }
+
+        ++live;
+    }
+
+    handle(const handle& other) : handle(*other.resource) {}
+
+    handle(handle&& other) noexcept : resource(exchange(other.resource, nullptr)) {
+        ++moves;
+        ++live;
+    }
+
+    handle& operator=(handle&& other) noexcept {
+        swap(resource, other.resource);
+        ++moves;
+        return *this;
+    }
+
+    handle& operator=(const handle& other) {
+        *resource = *other.resource;
+        return *this;
+    }
+
+    ~handle() {
+        delete resource;
+        ++destructions;
+        --live;
+    }
+
+    int value() const {
+        return *resource;
+    }
+};
+
+int handle::moves                     = 0;
+int handle::destructions              = 0;
+int handle::live                      = 0;
+int handle::constructions_until_throw = 0;
+
+namespace stdext {
+    template <>
+    struct is_trivially_relocatable<handle> : true_type {};
+} // namespace stdext
+
+// same as handle, but does not opt in
+struct plain_handle : handle {
+    using handle::handle;
+};
+
+STATIC_ASSERT(stdext::is_trivially_relocatable<int>::value);
+STATIC_ASSERT(stdext::is_trivially_relocatable<int*>::value);
+STATIC_ASSERT(stdext::is_trivially_relocatable<handle>::value);
+STATIC_ASSERT(!stdext::is_trivially_relocatable<plain_handle>::value);
+STATIC_ASSERT(stdext::is_trivially_relocatable<pair<int, handle>>::value);
+STATIC_ASSERT(!stdext::is_trivially_relocatable<pair<int, plain_handle>>::value);
+STATIC_ASSERT(stdext::is_trivially_relocatable<unique_ptr<int>>::value);
+STATIC_ASSERT(stdext::is_trivially_relocatable<unique_ptr<int[]>>::value);
+STATIC_ASSERT(stdext::is_trivially_relocatable<shared_ptr<int>>::value);
+STATIC_ASSERT(stdext::is_trivially_relocatable<weak_ptr<int>>::value);
+#if _ITERATOR_DEBUG_LEVEL == 0
+STATIC_ASSERT(stdext::is_trivially_relocatable<string>::value);
+STATIC_ASSERT(stdext::is_trivially_relocatable<vector<int>>::value);
+#else // ^^^ _ITERATOR_DEBUG_LEVEL == 0 / _ITERATOR_DEBUG_LEVEL != 0 vvv
+STATIC_ASSERT(!stdext::is_trivially_relocatable<string>::value);
+STATIC_ASSERT(!stdext::is_trivially_relocatable<vector<int>>::value);
+#endif // _ITERATOR_DEBUG_LEVEL == 0
+
+// vector<incomplete> must still be usable
+struct incomplete;
+struct holds_vector_of_incomplete {
+    vector<incomplete> v;
+};
+
+template <class Handle>
+vector<Handle> make_handles(const int count) {
+    vector<Handle> v;
+    v.reserve(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        v.emplace_back(i);
+    }
+
+    return v;
+}
+
+template <class Handle>
+void assert_values(const vector<Handle>& v, const vector<int>& expected) {
+    assert(v.size() == expected.size());
+    for (size_t i = 0; i < v.size(); ++i) {
+        assert(v[i].value() == expected[i]);
+    }
+}
+
+void reset_counters() {
+    handle::moves        = 0;
+    handle::destructions = 0;
+}
+
+void test_growth_skips_moves() {
+    {
+        auto v = make_handles<handle>(4);
+        reset_counters();
+        v.emplace_back(4); // reallocate at the back
+        v.emplace(v.begin(), 5);
+        v.emplace(v.begin() + 1, 6); // reallocate in the middle
+        v.reserve(100);
+        v.shrink_to_fit();
+        v.resize(20, handle(7));
+        assert(handle::moves == 1); // emplace(v.begin(), 5) had capacity, so it moved a temporary into the gap
+        assert(handle::destructions == 2); // that temporary and the one passed to resize
+        assert(v.size() == 20);
+        assert_values(vector<handle>(v.begin(), v.begin() + 8), {5, 6, 0, 1, 2, 3, 4, 7});
+    }
+    assert(handle::live == 0);
+
+    {
+        auto v = make_handles<plain_handle>(4);
+        reset_counters();
+        v.emplace_back(4);
+        assert(handle::moves == 4);
+        assert(handle::destructions == 4);
+    }
+    assert(handle::live == 0);
+}
+
+void test_shifting_skips_moves() {
+    {
+        auto v = make_handles<handle>(6);
+        v.reserve(20);
+        reset_counters();
+
+        v.emplace(v.begin() + 2, 10);
+        assert_values(v, {0, 1, 10, 2, 3, 4, 5});
+        assert(handle::moves == 1); // from the temporary into the gap
+
+        v.insert(v.begin(), 2, v[3]); // aliasing an element that shifts
+        assert_values(v, {2, 2, 0, 1, 10, 2, 3, 4, 5});
+
+        const handle extra[] = {handle(20), handle(21)};
+        reset_counters();
+        v.insert(v.end() - 1, begin(extra), end(extra));
+        assert_values(v, {2, 2, 0, 1, 10, 2, 3, 4, 20, 21, 5});
+        assert(handle::moves == 0);
+
+        v.erase(v.begin() + 4);
+        assert_values(v, {2, 2, 0, 1, 2, 3, 4, 20, 21, 5});
+        v.erase(v.begin(), v.begin() + 3);
+        assert_values(v, {1, 2, 3, 4, 20, 21, 5});
+        assert(handle::moves == 0);
+        assert(handle::destructions == 4);
+    }
+    assert(handle::live == 0);
+}
+
+void test_shifting_strong_guarantee() {
+    {
+        auto v = make_handles<handle>(5);
+        v.reserve(10);
+        const handle source(7);
+        handle::constructions_until_throw = 3; // the temporary copy and one element succeed
+        try {
+            v.insert(v.begin() + 1, 3, source);
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        assert_values(v, {0, 1, 2, 3, 4});
+        const handle sources[] = {handle(8), handle(9)};
+        handle::constructions_until_throw = 2;
+        try {
+            v.insert(v.begin() + 2, begin(sources), end(sources));
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        assert_values(v, {0, 1, 2, 3, 4});
+        handle::constructions_until_throw = 1;
+        try {
+            v.emplace(v.begin(), 10);
+            assert(false);
+        } catch (const runtime_error&) {
+        }
+
+        assert_values(v, {0, 1, 2, 3, 4});
+        assert(handle::constructions_until_throw == 0);
+        assert(handle::live == 8);
+    }
+    assert(handle::live == 0);
+}
+
+void test_standard_types() {
+    vector<string> strings;
+    for (int i = 0; i < 100; ++i) {
+        strings.push_back(string(static_cast<size_t>(i % 40), static_cast<char>('a' + i % 26)));
+    }
+
+    strings.insert(strings.begin() + 3, strings[50]);
+    strings.erase(strings.begin() + 10, strings.begin() + 20);
+    assert(strings.size() == 91);
+    assert(strings[3] == strings[41]);
+    assert(strings[10] == string(19, 't'));
+
+    vector<unique_ptr<int>> pointers;
+    for (int i = 0; i < 100; ++i) {
+        pointers.push_back(make_unique<int>(i));
+    }
+
+    pointers.erase(pointers.begin());
+    pointers.insert(pointers.begin() + 50, make_unique<int>(-1));
+    assert(*pointers.front() == 1);
+    assert(*pointers[50] == -1);
+    assert(*pointers.back() == 99);
+
+    vector<pair<shared_ptr<int>, string>> pairs;
+    const auto shared = make_shared<int>(42);
+    for (int i = 0; i < 50; ++i) {
+        pairs.emplace_back(shared, to_string(i));
+    }
+
+    assert(shared.use_count() == 51);
+    pairs.erase(pairs.begin(), pairs.begin() + 25);
+    assert(shared.use_count() == 26);
+    assert(pairs.front().second == "25");
+}
+
+int main() {
+    test_growth_skips_moves();
+    test_shifting_skips_moves();
+    test_shifting_strong_guarantee();
+    test_standard_types();
+}
@@ -0,0 +1,61 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include <tsc_clock>
+#include <type_traits>
+
+using namespace std;
+using namespace std::chrono;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+void test_steady_clock() {
+    // whichever conversion the counter's frequency selects, time only moves forward
+    auto previous = steady_clock::now();
+    for (int i = 0; i < 100000; ++i) {
+        const auto current = steady_clock::now();
+        assert(current >= previous);
+        previous = current;
+    }
+
+    const auto start = steady_clock::now();
+    this_thread::sleep_for(milliseconds{20});
+    assert(steady_clock::now() - start >= milliseconds{20});
+}
+
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+using stdext::tsc_clock;
+
+STATIC_ASSERT(is_same_v<tsc_clock::duration, nanoseconds>);
+STATIC_ASSERT(is_same_v<tsc_clock::time_point::clock, tsc_clock>);
+
+void test_tsc_clock() {
+    const auto tsc_start    = tsc_clock::now();
+    const auto steady_start = steady_clock::now();
+    const auto tick_start   = tsc_clock::ticks();
+    this_thread::sleep_for(milliseconds{100});
+    const auto tsc_elapsed    = tsc_clock::now() - tsc_start;
+    const auto steady_elapsed = steady_clock::now() - steady_start;
+    const auto tick_elapsed   = tsc_clock::to_duration(tsc_clock::ticks() - tick_start);
+
+    // the calibrated rate agrees with steady_clock to well within 1%
+    assert(tsc_elapsed > steady_elapsed * 99 / 100);
+    assert(tsc_elapsed < steady_elapsed * 101 / 100);
+    assert(tick_elapsed > steady_elapsed * 99 / 100);
+    assert(tick_elapsed < steady_elapsed * 101 / 100);
+
+    // the epoch is steady_clock's, up to the calibration error
+    const auto offset = tsc_clock::now().time_since_epoch() - steady_clock::now().time_since_epoch();
+    assert(offset < milliseconds{10} && offset > -milliseconds{10});
+}
+#endif // (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+
+int main() {
+    test_steady_clock();
+#if (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+    test_tsc_clock();
+#endif // (defined(_M_IX86) || defined(_M_X64)) && !defined(_M_ARM64EC)
+}
@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <assert.h>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <stddef.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+size_t g_hash_calls = 0;
+
+struct counting_hash {
+    size_t operator()(const int i) const {
+        ++g_hash_calls;
+        return hash<int>{}(i);
+    }
+};
+
+template <class T>
+struct input_only { // wraps a vector iterator to hide its category
+    using iterator_category = input_iterator_tag;
+    using value_type        = T;
+    using difference_type   = ptrdiff_t;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    typename vector<T>::const_iterator it;
+
+    reference operator*() const {
+        return *it;
+    }
+    input_only& operator++() {
+        ++it;
+        return *this;
+    }
+    input_only operator++(int) {
+        input_only old = *this;
+        ++it;
+        return old;
+    }
+    friend bool operator==(const input_only& lhs, const input_only& rhs) {
+        return lhs.it == rhs.it;
+    }
+    friend bool operator!=(const input_only& lhs, const input_only& rhs) {
+        return lhs.it != rhs.it;
+    }
+};
+
+template <class Container>
+void test_forward_range_hashes_once() {
+    // a forward range is sized for up front, so no element is rehashed while the range is inserted
+    vector<int> values;
+    for (int i = 0; i < 10'000; ++i) {
+        values.push_back(i);
+    }
+
+    g_hash_calls = 0;
+    Container c(values.begin(), values.end());
+    assert(c.size() == values.size());
+    assert(g_hash_calls == values.size());
+    assert(c.load_factor() <= c.max_load_factor());
+
+    forward_list<int> more;
+    for (int i = 10'000; i < 20'000; ++i) {
+        more.push_front(i);
+    }
+
+    g_hash_calls = 0;
+    c.insert(more.begin(), more.end());
+    assert(c.size() == 20'000);
+    assert(g_hash_calls <= 20'000); // at most one rehash of the elements already present
+    for (int i = 0; i < 20'000; ++i) {
+        assert(c.count(i) == 1);
+    }
+}
+
+void test_unique_duplicates() {
+    vector<pair<int, int>> values;
+    for (int i = 0; i < 1'000; ++i) {
+        values.emplace_back(i % 100, i);
+    }
+
+    unordered_map<int, int> m(values.begin(), values.end());
+    assert(m.size() == 100);
+    for (int i = 0; i < 100; ++i) {
+        assert(m.at(i) == i); // the first occurrence wins
+    }
+
+    unordered_multimap<int, int> mm(values.begin(), values.end());
+    assert(mm.size() == 1'000);
+    assert(mm.count(42) == 10);
+}
+
+void test_input_range() {
+    vector<int> values;
+    for (int i = 0; i < 1'000; ++i) {
+        values.push_back(i % 500);
+    }
+
+    unordered_set<int> s(input_only<int>{values.cbegin()}, input_only<int>{values.cend()});
+    assert(s.size() == 500);
+    for (int i = 0; i < 500; ++i) {
+        assert(s.count(i) == 1);
+    }
+}
+
+int main() {
+    test_forward_range_hashes_once<unordered_set<int, counting_hash>>();
+    test_forward_range_hashes_once<unordered_multiset<int, counting_hash>>();
+    test_unique_duplicates();
+    test_input_range();
+}
@@ -0,0 +1,229 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <shared_mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::distributed_shared_mutex;
+using stdext::upgrade_lock;
+using stdext::upgrade_mutex;
+
+STATIC_ASSERT(is_nothrow_default_constructible_v<upgrade_mutex>);
+STATIC_ASSERT(!is_copy_constructible_v<upgrade_mutex>);
+STATIC_ASSERT(!is_copy_assignable_v<upgrade_mutex>);
+STATIC_ASSERT(is_nothrow_default_constructible_v<distributed_shared_mutex>);
+STATIC_ASSERT(!is_copy_constructible_v<distributed_shared_mutex>);
+STATIC_ASSERT(!is_copy_assignable_v<distributed_shared_mutex>);
+STATIC_ASSERT(is_nothrow_move_constructible_v<upgrade_lock<upgrade_mutex>>);
+STATIC_ASSERT(!is_copy_constructible_v<upgrade_lock<upgrade_mutex>>);
+
+upgrade_mutex constant_initialized_upgrade; // constexpr default constructor
+distributed_shared_mutex constant_initialized_distributed;
+
+void test_upgrade_mutex_single_thread() {
+    upgrade_mutex m;
+    assert(m.try_lock());
+    assert(!m.try_lock());
+    assert(!m.try_lock_shared());
+    assert(!m.try_lock_upgrade());
+    m.unlock_and_lock_upgrade();
+    assert(m.try_lock_shared()); // readers may join an upgrade owner
+    assert(!m.try_lock_upgrade());
+    assert(!m.try_lock());
+    assert(!m.try_unlock_upgrade_and_lock()); // a reader is still in
+    m.unlock_shared();
+    assert(m.try_unlock_upgrade_and_lock());
+    m.unlock_and_lock_shared();
+    assert(m.try_lock_shared());
+    assert(m.try_lock_upgrade());
+    m.unlock_shared();
+    m.unlock_shared();
+    m.unlock_upgrade_and_lock();
+    assert(!m.try_lock_shared());
+    m.unlock();
+
+    m.lock_upgrade();
+    m.unlock_upgrade_and_lock_shared();
+    assert(!m.try_lock());
+    m.unlock_shared();
+    m.lock();
+    m.unlock();
+
+    constant_initialized_upgrade.lock_shared();
+    constant_initialized_upgrade.unlock_shared();
+}
+
+void test_upgrade_lock() {
+    upgrade_mutex m;
+    {
+        upgrade_lock<upgrade_mutex> lock(m);
+        assert(lock.owns_lock());
+        assert(lock.mutex() == &m);
+        assert(!m.try_lock_upgrade());
+
+        upgrade_lock<upgrade_mutex> moved(move(lock));
+        assert(!lock.owns_lock());
+        assert(moved.owns_lock());
+
+        unique_lock<upgrade_mutex> exclusive = moved.upgrade();
+        assert(exclusive.owns_lock());
+        assert(!moved.owns_lock());
+        assert(moved.mutex() == nullptr);
+        assert(!m.try_lock_shared());
+    }
+
+    upgrade_lock<upgrade_mutex> deferred(m, defer_lock);
+    assert(!deferred);
+    assert(deferred.try_lock());
+    try {
+        deferred.lock();
+        assert(false);
+    } catch (const system_error& e) {
+        assert(e.code() == errc::resource_deadlock_would_occur);
+    }
+
+    deferred.unlock();
+    try {
+        deferred.unlock();
+        assert(false);
+    } catch (const system_error& e) {
+        assert(e.code() == errc::operation_not_permitted);
+    }
+
+    m.lock_upgrade();
+    upgrade_lock<upgrade_mutex> adopted(m, adopt_lock);
+    upgrade_lock<upgrade_mutex> tried(m, try_to_lock);
+    assert(!tried.owns_lock());
+    swap(adopted, tried);
+    assert(tried.owns_lock());
+    assert(tried.release() == &m);
+    m.unlock_upgrade();
+}
+
+void test_upgrade_mutex_contended() {
+    // readers check that a value written in two halves is never seen half-written; upgraders read, then write
+    constexpr int thread_count = 4;
+    constexpr int iterations   = 2000;
+    upgrade_mutex m;
+    int first  = 0;
+    int second = 0;
+    vector<thread> threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < iterations; ++j) {
+                shared_lock<upgrade_mutex> lock(m);
+                assert(first == second);
+            }
+        });
+
+        threads.emplace_back([&] {
+            for (int j = 0; j < iterations; ++j) {
+                upgrade_lock<upgrade_mutex> lock(m);
+                const int observed = first;
+                unique_lock<upgrade_mutex> exclusive = lock.upgrade();
+                assert(first == observed); // no other writer got in between
+                ++first;
+                ++second;
+            }
+        });
+
+        threads.emplace_back([&] {
+            for (int j = 0; j < iterations; ++j) {
+                lock_guard<upgrade_mutex> lock(m);
+                ++first;
+                ++second;
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(first == 2 * thread_count * iterations);
+    assert(second == first);
+}
+
+void test_distributed_single_thread() {
+    distributed_shared_mutex m;
+    assert(m.try_lock());
+    assert(!m.try_lock());
+    assert(!m.try_lock_shared());
+    m.unlock();
+
+    assert(m.try_lock_shared());
+    assert(m.try_lock_shared());
+    assert(!m.try_lock());
+    m.unlock_shared();
+    m.unlock_shared();
+
+    {
+        shared_lock<distributed_shared_mutex> lock(m);
+        assert(!m.try_lock());
+    }
+
+    {
+        lock_guard<distributed_shared_mutex> lock(m);
+        assert(!m.try_lock_shared());
+    }
+
+    constant_initialized_distributed.lock();
+    constant_initialized_distributed.unlock();
+}
+
+void test_distributed_contended() {
+    constexpr int reader_count = 8;
+    constexpr int writer_count = 2;
+    constexpr int iterations   = 2000;
+    distributed_shared_mutex m;
+    int first  = 0;
+    int second = 0;
+    atomic<int> reads{0};
+    vector<thread> threads;
+    for (int i = 0; i < reader_count; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < iterations; ++j) {
+                shared_lock<distributed_shared_mutex> lock(m);
+                assert(first == second);
+                reads.fetch_add(1, memory_order_relaxed);
+            }
+        });
+    }
+
+    for (int i = 0; i < writer_count; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < iterations; ++j) {
+                lock_guard<distributed_shared_mutex> lock(m);
+                ++first;
+                ++second;
+            }
+        });
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    assert(first == writer_count * iterations);
+    assert(second == first);
+    assert(reads.load() == reader_count * iterations);
+}
+
+int main() {
+    test_upgrade_mutex_single_thread();
+    test_upgrade_lock();
+    test_upgrade_mutex_contended();
+    test_distributed_single_thread();
+    test_distributed_contended();
+}
@@ -0,0 +1,59 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <cassert>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+void test_concurrent_lookups() {
+    constexpr int thread_count = 8;
+    const locale loc;
+    const auto& expected_ctype = use_facet<ctype<char>>(loc);
+
+    atomic<int> ready{0};
+    vector<const void*> lazy_facets(thread_count);
+    vector<thread> threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            ++ready;
+            while (ready.load() != thread_count) {
+            }
+
+            // num_get<char, const char*> isn't part of any locale, so every thread races to create it lazily
+            lazy_facets[t] = &use_facet<num_get<char, const char*>>(loc);
+
+            for (int i = 0; i < 10000; ++i) {
+                assert(&use_facet<ctype<char>>(loc) == &expected_ctype);
+
+                ostringstream oss;
+                oss << i;
+                assert(oss.str() == to_string(i));
+            }
+        });
+    }
+
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    for (const auto& ptr : lazy_facets) {
+        assert(ptr == lazy_facets[0]);
+    }
+}
+
+void test_transparent_locale() {
+    // facets missing from a transparent locale come from the global locale
+    const locale transparent = locale::empty();
+    assert(&use_facet<ctype<char>>(transparent) == &use_facet<ctype<char>>(locale()));
+}
+
+int main() {
+    test_concurrent_lookups();
+    test_transparent_locale();
+}
@@ -0,0 +1,273 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Covers the UTF-8 <-> UTF-16 transcoder behind <filesystem> and the UTF-8 codecvt facets
+
+#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+#define _SILENCE_CXX20_CODECVT_FACETS_DEPRECATION_WARNING
+#define _SILENCE_CXX20_U8PATH_DEPRECATION_WARNING
+
+#include <__msvc_utf_transcode_abi.hpp>
+#include <cassert>
+#include <codecvt>
+#include <cstddef>
+#include <cwchar>
+#include <locale>
+#include <string>
+
+#if _HAS_CXX17
+#include <filesystem>
+#endif // _HAS_CXX17
+
+using namespace std;
+
+// long enough to take the vector paths, with non-ASCII text at several offsets
+string make_utf8(const size_t repeats) {
+    string result;
+    for (size_t i = 0; i < repeats; ++i) {
+        result += "C:\\Users\\someone\\source\\repos\\";
+        result += "\xD0\xBA\xD0\xBE\xD1\x88\xD0\xBA\xD0\xB0"; // U+043A U+043E U+0448 U+043A U+0430
+        result += "\\\xE6\x96\x87\xE4\xBB\xB6"; // U+6587 U+4EF6
+        result += "\\\xF0\x9F\x90\x88.txt"; // U+1F408
+    }
+
+    return result;
+}
+
+u16string make_utf16(const size_t repeats) {
+    u16string result;
+    for (size_t i = 0; i < repeats; ++i) {
+        result += u"C:\\Users\\someone\\source\\repos\\";
+        result += u"\u043A\u043E\u0448\u043A\u0430";
+        result += u"\\\u6587\u4EF6";
+        result += u"\\\U0001F408.txt";
+    }
+
+    return result;
+}
+
+#ifndef _M_CEE_PURE
+void test_abi() {
+    for (size_t repeats = 0; repeats < 5; ++repeats) {
+        const string narrow = make_utf8(repeats);
+        const u16string wide = make_utf16(repeats);
+
+        auto result = __std_utf8_to_utf16(narrow.data(), narrow.size(), nullptr, 0);
+        assert(result._Read == narrow.size());
+        assert(result._Written == wide.size());
+        u16string wide_out(wide.size(), u'\0');
+        result = __std_utf8_to_utf16(narrow.data(), narrow.size(), &wide_out[0], wide_out.size());
+        assert(result._Read == narrow.size());
+        assert(wide_out == wide);
+
+        result = __std_utf16_to_utf8(wide.data(), wide.size(), nullptr, 0);
+        assert(result._Read == wide.size());
+        assert(result._Written == narrow.size());
+        string narrow_out(narrow.size(), '\0');
+        result = __std_utf16_to_utf8(wide.data(), wide.size(), &narrow_out[0], narrow_out.size());
+        assert(result._Read == wide.size());
+        assert(narrow_out == narrow);
+    }
+
+    // conversion stops before a sequence that doesn't fit, even partway through a surrogate pair
+    char16_t small[3];
+    auto result = __std_utf8_to_utf16("ab\xF0\x9F\x90\x88", 6, small, 3);
+    assert(result._Read == 2 && result._Written == 2);
+    char bytes[5];
+    result = __std_utf16_to_utf8(u"a\u6587", 2, bytes, 3);
+    assert(result._Read == 1 && result._Written == 1);
+
+    // and before anything ill-formed, after converting what precedes it
+    const string ascii(100, 'x');
+    const char* const ill_formed[] = {"\x80", "\xC0\x80", "\xC1\xBF", "\xE0\x9F\xBF", "\xED\xA0\x80",
+        "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xC2", "\xE2\x82", "\xC2\x41"};
+    for (const char* const bad : ill_formed) {
+        const string input = ascii + bad + ascii;
+        result = __std_utf8_to_utf16(input.data(), input.size(), nullptr, 0);
+        assert(result._Read == 100 && result._Written == 100);
+    }
+
+    const u16string wide_ascii(100, u'x');
+    const u16string unpaired[] = {u16string(1, u'\xD800'), u16string(1, u'\xDC00'), u16string{u'\xD800', u'x'}};
+    for (const auto& bad : unpaired) {
+        const u16string input = wide_ascii + bad + wide_ascii;
+        result = __std_utf16_to_utf8(input.data(), input.size(), nullptr, 0);
+        assert(result._Read == 100 && result._Written == 100);
+    }
+}
+#endif // _M_CEE_PURE
+
+// feeds the facet small input and output windows, as a filebuf would
+template <class Facet, class Internal>
+void test_codecvt_chunks(const Facet& facet, const string& narrow, const basic_string<Internal>& wide) {
+    for (const size_t window : {size_t{1}, size_t{3}, size_t{7}, size_t{64}, size_t{1000}}) {
+        mbstate_t state{};
+        basic_string<Internal> in_result;
+        const char* next = narrow.data();
+        while (next != narrow.data() + narrow.size()) {
+            Internal buffer[1000];
+            const char* const end  = narrow.data() + narrow.size();
+            const char* const last = static_cast<size_t>(end - next) < window ? end : next + window;
+            const char* mid;
+            Internal* out;
+            const auto result = facet.in(state, next, last, mid, buffer, buffer + window, out);
+            assert(result == codecvt_base::ok || result == codecvt_base::partial);
+            assert(mid != next || out != buffer || last - next < 4);
+            in_result.append(buffer, out);
+            if (mid == next && out == buffer) {
+                // the window cut a sequence; widen it
+                const auto result2 = facet.in(state, next, end, mid, buffer, buffer + 1000, out);
+                assert(result2 == codecvt_base::ok);
+                in_result.append(buffer, out);
+            }
+
+            next = mid;
+        }
+
+        assert(in_result == wide);
+
+        state = mbstate_t{};
+        string out_result;
+        const Internal* from = wide.data();
+        while (from != wide.data() + wide.size()) {
+            char buffer[1000];
+            const Internal* mid;
+            char* out;
+            const auto result = facet.out(state, from, wide.data() + wide.size(), mid, buffer, buffer + window, out);
+            assert(result == codecvt_base::ok || result == codecvt_base::partial);
+            out_result.append(buffer, out);
+            if (mid == from && out == buffer) { // a sequence didn't fit
+                const auto result2 = facet.out(state, from, wide.data() + wide.size(), mid, buffer, buffer + 1000, out);
+                assert(result2 == codecvt_base::ok);
+                out_result.append(buffer, out);
+            }
+
+            from = mid;
+        }
+
+        assert(out_result == narrow);
+    }
+}
+
+void test_codecvt_utf8_utf16() {
+    const string narrow  = make_utf8(20);
+    const u16string wide = make_utf16(20);
+    codecvt_utf8_utf16<char16_t> facet;
+    test_codecvt_chunks(facet, narrow, wide);
+
+    // the header is still consumed and generated when the rest is converted in bulk
+    codecvt_utf8_utf16<char16_t, 0x10ffff, codecvt_mode(consume_header | generate_header)> with_header;
+    const string with_bom = "\xEF\xBB\xBF" + narrow;
+    mbstate_t state{};
+    const char* mid;
+    u16string buffer(wide.size() + 1, u'\0');
+    char16_t* out;
+    assert(with_header.in(state, with_bom.data(), with_bom.data() + with_bom.size(), mid, &buffer[0],
+               &buffer[0] + buffer.size(), out)
+           == codecvt_base::ok);
+    assert(u16string(&buffer[0], out) == wide);
+
+    state = mbstate_t{};
+    const char16_t* from;
+    string bytes(with_bom.size(), '\0');
+    char* to;
+    assert(with_header.out(state, wide.data(), wide.data() + wide.size(), from, &bytes[0], &bytes[0] + bytes.size(), to)
+           == codecvt_base::ok);
+    assert(bytes == with_bom);
+
+    // ill-formed input is still reported after a well-formed prefix
+    const string bad = narrow + "\x80";
+    state            = mbstate_t{};
+    assert(facet.in(state, bad.data(), bad.data() + bad.size(), mid, &buffer[0], &buffer[0] + buffer.size(), out)
+           == codecvt_base::error);
+    assert(static_cast<size_t>(out - &buffer[0]) == wide.size());
+}
+
+#ifdef __cpp_lib_char8_t
+struct char8_facet : codecvt<char16_t, char8_t, mbstate_t> {};
+
+void test_codecvt_char8_t() {
+    const string narrow  = make_utf8(20);
+    const u16string wide = make_utf16(20);
+    const u8string narrow8(narrow.begin(), narrow.end());
+    const char8_facet facet;
+
+    mbstate_t state{};
+    const char8_t* mid8;
+    u16string wide_out(wide.size(), u'\0');
+    char16_t* out16;
+    assert(facet.in(state, narrow8.data(), narrow8.data() + narrow8.size(), mid8, wide_out.data(),
+               wide_out.data() + wide_out.size(), out16)
+           == codecvt_base::ok);
+    assert(mid8 == narrow8.data() + narrow8.size());
+    assert(wide_out == wide);
+
+    // a surrogate pair doesn't fit in one remaining code unit
+    const size_t pair_offset = wide.find(u'\xD83D');
+    assert(facet.in(state, narrow8.data(), narrow8.data() + narrow8.size(), mid8, wide_out.data(),
+               wide_out.data() + pair_offset + 1, out16)
+           == codecvt_base::partial);
+    assert(out16 == wide_out.data() + pair_offset);
+
+    const char16_t* mid16;
+    u8string narrow_out(narrow8.size(), u8'\0');
+    char8_t* out8;
+    assert(facet.out(state, wide.data(), wide.data() + wide.size(), mid16, narrow_out.data(),
+               narrow_out.data() + narrow_out.size(), out8)
+           == codecvt_base::ok);
+    assert(narrow_out == narrow8);
+
+    const u16string unpaired = wide + u'\xDC00';
+    assert(facet.out(state, unpaired.data(), unpaired.data() + unpaired.size(), mid16, narrow_out.data(),
+               narrow_out.data() + narrow_out.size(), out8)
+           == codecvt_base::error);
+    assert(mid16 == unpaired.data() + wide.size());
+}
+#endif // __cpp_lib_char8_t
+
+#if _HAS_CXX17
+void test_filesystem() {
+    const string narrow  = make_utf8(20);
+    const u16string wide = make_utf16(20);
+    const wstring native(wide.begin(), wide.end());
+
+    const filesystem::path p = filesystem::u8path(narrow);
+    assert(p.native() == native);
+    assert(p.u16string() == wide);
+#ifdef __cpp_lib_char8_t
+    assert(p.u8string() == u8string(narrow.begin(), narrow.end()));
+#else // ^^^ __cpp_lib_char8_t / !__cpp_lib_char8_t vvv
+    assert(p.u8string() == narrow);
+#endif // __cpp_lib_char8_t
+
+    // ill-formed UTF-8 and unpaired surrogates are still rejected
+    bool threw = false;
+    try {
+        (void) filesystem::u8path(narrow + "\xED\xA0\x80");
+    } catch (const system_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    threw = false;
+    try {
+        (void) filesystem::path(native + L'\xD800').u8string();
+    } catch (const system_error&) {
+        threw = true;
+    }
+    assert(threw);
+}
+#endif // _HAS_CXX17
+
+int main() {
+#ifndef _M_CEE_PURE
+    test_abi();
+#endif // _M_CEE_PURE
+    test_codecvt_utf8_utf16();
+#ifdef __cpp_lib_char8_t
+    test_codecvt_char8_t();
+#endif // __cpp_lib_char8_t
+#if _HAS_CXX17
+    test_filesystem();
+#endif // _HAS_CXX17
+}
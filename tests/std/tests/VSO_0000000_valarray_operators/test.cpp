@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <valarray>
+
+using namespace std;
+
+template <class T>
+bool eq(const valarray<T>& v, initializer_list<T> il) {
+    return equal(begin(v), end(v), il.begin(), il.end());
+}
+
+void test_expiring_operands() {
+    const valarray<int> a{1, 2, 3, 4};
+    const valarray<int> b{4, 3, 2, 1};
+
+    // every overload taking an rvalue agrees with the one taking lvalues
+    assert(eq(valarray<int>(a) + b, {5, 5, 5, 5}));
+    assert(eq(a - valarray<int>(b), {-3, -1, 1, 3}));
+    assert(eq(valarray<int>(a) * valarray<int>(b), {4, 6, 6, 4}));
+    assert(eq(valarray<int>(a) / 2, {0, 1, 1, 2}));
+    assert(eq(12 / valarray<int>(a), {12, 6, 4, 3}));
+    assert(eq(valarray<int>(a) % 3, {1, 2, 0, 1}));
+    assert(eq(valarray<int>(a) ^ b, {5, 1, 1, 5}));
+    assert(eq(a & valarray<int>(b), {0, 2, 2, 0}));
+    assert(eq(valarray<int>(a) | valarray<int>(b), {5, 3, 3, 5}));
+    assert(eq(1 << valarray<int>(a), {2, 4, 8, 16}));
+    assert(eq(valarray<int>(a) >> 1, {0, 1, 1, 2}));
+
+    // the result takes over the storage of the expiring operand
+    valarray<int> tmp   = a * b;
+    const int* const p  = &tmp[0];
+    valarray<int> fused = move(tmp) + a;
+    assert(&fused[0] == p);
+    assert(eq(fused, {5, 8, 9, 8}));
+
+    // a scalar operand may refer into the expiring operand
+    valarray<int> alias = a;
+    valarray<int> twice = move(alias) * alias[1];
+    assert(eq(twice, {2, 4, 6, 8}));
+
+    valarray<string> s{"x", "y"};
+    assert(eq(s + s + string("!"), {string("xx!"), string("yy!")}));
+}
+
+template <class T>
+void test_reductions() {
+    valarray<T> v(37);
+    for (size_t i = 0; i < v.size(); ++i) {
+        v[i] = static_cast<T>((i * 7) % 37);
+    }
+
+    assert(v.sum() == static_cast<T>(36 * 37 / 2));
+    assert((v.min)() == T{0});
+    assert((v.max)() == T{36});
+
+    valarray<T> small{T{3}, T{1}, T{2}};
+    assert(small.sum() == T{6});
+    assert((small.min)() == T{1});
+    assert((small.max)() == T{3});
+
+    valarray<T> squares = v.apply([](T x) { return x * x; });
+    assert(squares[1] == T{49});
+}
+
+int main() {
+    test_expiring_operands();
+    test_reductions<int>();
+    test_reductions<long long>();
+    test_reductions<float>();
+    test_reductions<double>();
+}
@@ -3,10 +3,21 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <bitset>
+#include <cmath>
+#include <complex>
 #include <deque>
 #include <isa_availability.h>
+#include <iterator>
+#include <limits>
 #include <list>
+#include <locale>
+#include <numeric>
 #include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <valarray>
 #include <vector>
 
 using namespace std;
@@ -21,6 +32,719 @@ void disable_instructions(ISA_AVAILABILITY isa) {
 
 constexpr size_t dataCount = 1024;
 
+template <class FwdIt, class T>
+ptrdiff_t last_known_good_count(FwdIt first, FwdIt last, T v) {
+    ptrdiff_t result = 0;
+    for (; first != last; ++first) {
+        result += (*first == v);
+    }
+    return result;
+}
+
+template <class T>
+void test_case_count(const vector<T>& input, T v) {
+    auto expected = last_known_good_count(input.begin(), input.end(), v);
+    auto actual   = count(input.begin(), input.end(), v);
+    assert(expected == actual);
+#ifdef __cpp_lib_concepts
+    assert(expected == ranges::count(input, v));
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_count(mt19937_64& gen) {
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    binomial_distribution<TD> dis(10);
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_count(input, static_cast<T>(dis(gen)));
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        test_case_count(input, static_cast<T>(dis(gen)));
+    }
+}
+
+template <class FwdIt, class T>
+auto last_known_good_find(FwdIt first, FwdIt last, T v) {
+    for (; first != last; ++first) {
+        if (*first == v) {
+            break;
+        }
+    }
+    return first;
+}
+
+template <class T>
+void test_case_find(const vector<T>& input, T v) {
+    auto expected = last_known_good_find(input.begin(), input.end(), v);
+    auto actual   = find(input.begin(), input.end(), v);
+    assert(expected == actual);
+#ifdef __cpp_lib_concepts
+    assert(expected == ranges::find(input, v));
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_find(mt19937_64& gen) {
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    binomial_distribution<TD> dis(10);
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_find(input, static_cast<T>(dis(gen)));
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        test_case_find(input, static_cast<T>(dis(gen)));
+    }
+}
+
+void test_find_count_value_conversions() {
+    // values that cannot be represented by the element type must not be found
+    const vector<unsigned char> uc = {0, 1, 0x7F, 0x80, 0xFF};
+    assert(find(uc.begin(), uc.end(), -1) == uc.end());
+    assert(find(uc.begin(), uc.end(), 0x1FF) == uc.end());
+    assert(find(uc.begin(), uc.end(), 0xFF) == uc.begin() + 4);
+    assert(count(uc.begin(), uc.end(), -1) == 0);
+    assert(count(uc.begin(), uc.end(), 0x80) == 1);
+
+    // both operands are promoted to int, so 255 never equals (signed char) -1
+    const vector<signed char> sc = {-1, 0, 1};
+    assert(find(sc.begin(), sc.end(), static_cast<unsigned char>(0xFF)) == sc.end());
+    assert(count(sc.begin(), sc.end(), static_cast<unsigned char>(0xFF)) == 0);
+
+    const vector<short> s = {-1, 0, 1, -1, 0x7FFF, -0x8000};
+    assert(find(s.begin(), s.end(), 0xFFFF) == s.end());
+    assert(find(s.begin(), s.end(), -1LL) == s.begin());
+    assert(count(s.begin(), s.end(), 0xFFFFu) == 0);
+    assert(count(s.begin(), s.end(), -1) == 2);
+
+    // the usual arithmetic conversions make -1 equal to the largest unsigned int
+    const vector<unsigned int> ui = {1, 2, 0xFFFFFFFFu, 3, 0xFFFFFFFFu};
+    assert(find(ui.begin(), ui.end(), -1) == ui.begin() + 2);
+    assert(count(ui.begin(), ui.end(), -1) == 2);
+    assert(count(ui.begin(), ui.end(), 0x1FFFFFFFFLL) == 0);
+
+    const vector<long long> ll = {-1, 0x100000000LL, 5};
+    assert(find(ll.begin(), ll.end(), 0xFFFFFFFFu) == ll.end());
+    assert(find(ll.begin(), ll.end(), 5) == ll.begin() + 2);
+
+    const bool bools[] = {false, true, true};
+    assert(find(begin(bools), end(bools), true) == begin(bools) + 1);
+    assert(count(begin(bools), end(bools), true) == 2);
+
+    int arr[3]{};
+    int* const ptrs[] = {&arr[0], nullptr, &arr[2], &arr[2]};
+    assert(find(begin(ptrs), end(ptrs), nullptr) == begin(ptrs) + 1);
+    assert(find(begin(ptrs), end(ptrs), &arr[2]) == begin(ptrs) + 2);
+    assert(find(begin(ptrs), end(ptrs), &arr[1]) == end(ptrs));
+    assert(count(begin(ptrs), end(ptrs), &arr[2]) == 2);
+#ifdef __cpp_lib_concepts
+    assert(ranges::find(ptrs, nullptr) == begin(ptrs) + 1);
+    assert(ranges::count(ptrs, &arr[2]) == 2);
+    assert(ranges::find(uc, -1) == uc.end());
+    assert(ranges::count(s, -1) == 2);
+#endif // __cpp_lib_concepts
+}
+
+template <class FwdIt>
+FwdIt last_known_good_min_element(FwdIt first, FwdIt last) {
+    FwdIt result = first;
+    for (; first != last; ++first) {
+        if (*first < *result) {
+            result = first;
+        }
+    }
+    return result;
+}
+
+template <class FwdIt>
+FwdIt last_known_good_max_element(FwdIt first, FwdIt last) {
+    FwdIt result = first;
+    for (; first != last; ++first) {
+        if (*result < *first) {
+            result = first;
+        }
+    }
+    return result;
+}
+
+template <class FwdIt>
+pair<FwdIt, FwdIt> last_known_good_minmax_element(FwdIt first, FwdIt last) {
+    // minmax_element returns the first smallest and the last largest elements
+    pair<FwdIt, FwdIt> result(first, first);
+    for (; first != last; ++first) {
+        if (*first < *result.first) {
+            result.first = first;
+        }
+        if (!(*first < *result.second)) {
+            result.second = first;
+        }
+    }
+    return result;
+}
+
+template <class T>
+void test_case_min_max_element(const vector<T>& input) {
+    const auto expected_min    = last_known_good_min_element(input.begin(), input.end());
+    const auto expected_max    = last_known_good_max_element(input.begin(), input.end());
+    const auto expected_minmax = last_known_good_minmax_element(input.begin(), input.end());
+    assert(expected_min == min_element(input.begin(), input.end()));
+    assert(expected_max == max_element(input.begin(), input.end()));
+    assert(expected_minmax == minmax_element(input.begin(), input.end()));
+#ifdef __cpp_lib_concepts
+    assert(expected_min == ranges::min_element(input));
+    assert(expected_max == ranges::max_element(input));
+    const auto ranges_minmax = ranges::minmax_element(input);
+    assert(expected_minmax.first == ranges_minmax.min);
+    assert(expected_minmax.second == ranges_minmax.max);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_min_max_element(mt19937_64& gen) {
+    using Dis = conditional_t<is_floating_point<T>::value, normal_distribution<T>,
+        uniform_int_distribution<conditional_t<sizeof(T) == 1, int, T>>>;
+    Dis dis;
+    // a narrow distribution produces many repeated extremes, testing which of the equal elements is returned
+    uniform_int_distribution<int> narrow(-4, 4);
+    vector<T> input;
+    input.reserve(dataCount);
+    test_case_min_max_element(input);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        if (attempts % 2 == 0) {
+            input.push_back(static_cast<T>(dis(gen)));
+        } else {
+            input.push_back(static_cast<T>(narrow(gen)));
+        }
+
+        test_case_min_max_element(input);
+    }
+}
+
+void test_min_max_element_signed_zeros() {
+    // -0.0 and 0.0 are equivalent, so the position decides which one is returned
+    const vector<double> zeros = {1.0, 0.0, -0.0, 0.0, -0.0, 1.0};
+    assert(min_element(zeros.begin(), zeros.end()) == zeros.begin() + 1);
+    assert(minmax_element(zeros.begin(), zeros.end()).first == zeros.begin() + 1);
+
+    const vector<float> neg_zeros(40, -0.0f);
+    assert(min_element(neg_zeros.begin(), neg_zeros.end()) == neg_zeros.begin());
+    assert(max_element(neg_zeros.begin(), neg_zeros.end()) == neg_zeros.begin());
+    assert(minmax_element(neg_zeros.begin(), neg_zeros.end()).second == neg_zeros.end() - 1);
+}
+
+template <class T>
+void test_case_min_max_element_nan(const vector<T>& input) {
+    // NaNs aren't ordered, so the results are whatever the scalar algorithms produce; a lambda isn't vectorized
+    const auto scalar_less = [](const T left, const T right) { return left < right; };
+    assert(min_element(input.begin(), input.end()) == min_element(input.begin(), input.end(), scalar_less));
+    assert(max_element(input.begin(), input.end()) == max_element(input.begin(), input.end(), scalar_less));
+    assert(minmax_element(input.begin(), input.end()) == minmax_element(input.begin(), input.end(), scalar_less));
+#ifdef __cpp_lib_concepts
+    assert(ranges::min_element(input) == ranges::min_element(input, scalar_less));
+    assert(ranges::max_element(input) == ranges::max_element(input, scalar_less));
+    const auto ranges_minmax = ranges::minmax_element(input);
+    const auto scalar_minmax = ranges::minmax_element(input, scalar_less);
+    assert(ranges_minmax.min == scalar_minmax.min);
+    assert(ranges_minmax.max == scalar_minmax.max);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_min_max_element_nans() {
+    const T nan = numeric_limits<T>::quiet_NaN();
+
+    const vector<T> leading_nan = {nan, T{1}};
+    assert(min_element(leading_nan.begin(), leading_nan.end()) == leading_nan.begin());
+    assert(max_element(leading_nan.begin(), leading_nan.end()) == leading_nan.begin());
+
+    for (const size_t size : {size_t{1}, size_t{2}, size_t{5}, size_t{17}, size_t{40}, size_t{100}}) {
+        vector<T> input(size);
+        for (size_t idx = 0; idx != size; ++idx) {
+            input[idx] = static_cast<T>(static_cast<int>(idx * 7 % 11) - 5);
+        }
+
+        auto with_leading_nan    = input;
+        with_leading_nan.front() = nan;
+        test_case_min_max_element_nan(with_leading_nan);
+
+        auto with_middle_nan      = input;
+        with_middle_nan[size / 2] = nan;
+        test_case_min_max_element_nan(with_middle_nan);
+
+        auto with_trailing_nan   = input;
+        with_trailing_nan.back() = nan;
+        test_case_min_max_element_nan(with_trailing_nan);
+
+        const vector<T> all_nan(size, nan);
+        assert(min_element(all_nan.begin(), all_nan.end()) == all_nan.begin());
+        assert(max_element(all_nan.begin(), all_nan.end()) == all_nan.begin());
+        test_case_min_max_element_nan(all_nan);
+    }
+}
+
+template <class FwdIt1, class FwdIt2>
+ptrdiff_t last_known_good_mismatch(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, FwdIt2 last2) {
+    ptrdiff_t result = 0;
+    for (; first1 != last1 && first2 != last2 && *first1 == *first2; ++first1, (void) ++first2) {
+        ++result;
+    }
+    return result;
+}
+
+template <class T>
+void test_case_mismatch(const vector<T>& a, const vector<T>& b) {
+    const auto expected = last_known_good_mismatch(a.begin(), a.end(), b.begin(), b.end());
+    const auto actual   = mismatch(a.begin(), a.end(), b.begin(), b.end());
+    assert(actual.first - a.begin() == expected);
+    assert(actual.second - b.begin() == expected);
+    if (a.size() <= b.size()) {
+        assert(mismatch(a.begin(), a.end(), b.begin()).first - a.begin() == expected);
+    }
+
+    const auto size_a = static_cast<ptrdiff_t>(a.size());
+    const auto size_b = static_cast<ptrdiff_t>(b.size());
+    const bool expected_less =
+        expected == size_a ? size_a < size_b : expected != size_b && a[expected] < b[expected];
+    assert(lexicographical_compare(a.begin(), a.end(), b.begin(), b.end()) == expected_less);
+#ifdef __cpp_lib_concepts
+    const auto ranges_actual = ranges::mismatch(a, b);
+    assert(ranges_actual.in1 - a.begin() == expected);
+    assert(ranges_actual.in2 - b.begin() == expected);
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_mismatch(mt19937_64& gen) {
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    binomial_distribution<TD> dis(10);
+    vector<T> a;
+    vector<T> b;
+    a.reserve(dataCount);
+    b.reserve(dataCount);
+    test_case_mismatch(a, b);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        const T v = static_cast<T>(dis(gen));
+        a.push_back(v);
+        b.push_back(v);
+        test_case_mismatch(a, b);
+
+        // differ at a random position, then make the ranges equal again
+        const size_t pos = static_cast<size_t>(gen() % a.size());
+        b[pos]           = static_cast<T>(b[pos] + 1);
+        test_case_mismatch(a, b);
+        test_case_mismatch(b, a);
+        b[pos] = a[pos];
+
+        b.pop_back();
+        test_case_mismatch(a, b);
+        test_case_mismatch(b, a);
+        b.push_back(v);
+    }
+}
+
+template <class CharT>
+void test_string_compare(mt19937_64& gen) {
+    uniform_int_distribution<int> dis('a', 'c');
+    basic_string<CharT> left;
+    basic_string<CharT> right;
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        const auto ch = static_cast<CharT>(dis(gen));
+        left.push_back(ch);
+        right.push_back(ch);
+        assert(left.compare(right) == 0);
+
+        const size_t pos = static_cast<size_t>(gen() % left.size());
+        right[pos]       = static_cast<CharT>(left[pos] + 1);
+        assert(left.compare(right) < 0);
+        assert(right.compare(left) > 0);
+        right[pos] = left[pos];
+    }
+}
+
+template <class FwdIt1, class FwdIt2>
+FwdIt1 last_known_good_find_first_of(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, FwdIt2 last2) {
+    for (; first1 != last1; ++first1) {
+        for (auto mid2 = first2; mid2 != last2; ++mid2) {
+            if (*first1 == *mid2) {
+                return first1;
+            }
+        }
+    }
+    return first1;
+}
+
+template <class T>
+void test_case_find_first_of(const vector<T>& input, const vector<T>& needle) {
+    auto expected = last_known_good_find_first_of(input.begin(), input.end(), needle.begin(), needle.end());
+    auto actual   = find_first_of(input.begin(), input.end(), needle.begin(), needle.end());
+    assert(expected == actual);
+#ifdef __cpp_lib_concepts
+    assert(expected == ranges::find_first_of(input, needle));
+#endif // __cpp_lib_concepts
+}
+
+template <class T>
+void test_find_first_of(mt19937_64& gen) {
+    using TD = conditional_t<sizeof(T) == 1, int, T>;
+    binomial_distribution<TD> dis(10);
+    vector<T> input;
+    vector<T> needle;
+    input.reserve(dataCount);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        needle.assign(attempts % 20, T{});
+        for (auto& n : needle) {
+            n = static_cast<T>(dis(gen) + 3);
+        }
+        test_case_find_first_of(input, needle);
+    }
+}
+
+template <class CharT>
+size_t last_known_good_find_of(const basic_string<CharT>& hay, const basic_string<CharT>& needle, bool member,
+    bool forward, size_t start) {
+    const auto is_member = [&](CharT ch) { return needle.find(ch) != basic_string<CharT>::npos; };
+    if (forward) {
+        for (size_t i = start; i < hay.size(); ++i) {
+            if (is_member(hay[i]) == member) {
+                return i;
+            }
+        }
+    } else if (!hay.empty()) {
+        for (size_t i = (min)(start, hay.size() - 1);; --i) {
+            if (is_member(hay[i]) == member) {
+                return i;
+            }
+            if (i == 0) {
+                break;
+            }
+        }
+    }
+    return basic_string<CharT>::npos;
+}
+
+template <class CharT>
+void test_case_string_find_of(const basic_string<CharT>& hay, const basic_string<CharT>& needle, size_t start) {
+    assert(hay.find_first_of(needle, start) == last_known_good_find_of(hay, needle, true, true, start));
+    assert(hay.find_first_not_of(needle, start) == last_known_good_find_of(hay, needle, false, true, start));
+    assert(hay.find_last_of(needle, start) == last_known_good_find_of(hay, needle, true, false, start));
+    assert(hay.find_last_not_of(needle, start) == last_known_good_find_of(hay, needle, false, false, start));
+}
+
+template <class CharT>
+void test_string_find_of(mt19937_64& gen) {
+    // mostly ASCII letters, with some characters that only differ from them in the high bits
+    const CharT alphabet[] = {CharT('a'), CharT('b'), CharT('c'), CharT('d'), CharT('e'), CharT('f'), CharT('g'),
+        CharT('h'), CharT(0), CharT(127), CharT(static_cast<unsigned char>(0x80) | 'a'), CharT(~CharT('a'))};
+    constexpr size_t alphabet_size = sizeof(alphabet) / sizeof(alphabet[0]);
+    uniform_int_distribution<size_t> dis(0, alphabet_size - 1);
+    basic_string<CharT> hay;
+    basic_string<CharT> needle;
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        hay.push_back(alphabet[dis(gen)]);
+        needle.clear();
+        for (size_t n = attempts % 40; n != 0; --n) {
+            // make the needle ASCII-only most of the time
+            needle.push_back(alphabet[dis(gen) % (attempts % 3 == 0 ? alphabet_size : 8)]);
+        }
+        test_case_string_find_of(hay, needle, 0);
+        test_case_string_find_of(hay, needle, static_cast<size_t>(gen() % (hay.size() + 1)));
+    }
+}
+
+template <class FwdIt1, class FwdIt2>
+FwdIt1 last_known_good_search(FwdIt1 first1, FwdIt1 last1, FwdIt2 first2, FwdIt2 last2) {
+    for (;; ++first1) {
+        auto mid1 = first1;
+        for (auto mid2 = first2;; ++mid1, (void) ++mid2) {
+            if (mid2 == last2) {
+                return first1;
+            } else if (mid1 == last1) {
+                return last1;
+            } else if (*mid1 != *mid2) {
+                break;
+            }
+        }
+    }
+}
+
+template <class T>
+void test_search(mt19937_64& gen) {
+    // a haystack with few distinct values, so that partial matches are frequent
+    uniform_int_distribution<int> dis(0, 2);
+    vector<T> input;
+    vector<T> needle;
+    input.reserve(dataCount);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        needle.assign(attempts % 12, T{});
+        for (auto& n : needle) {
+            n = static_cast<T>(dis(gen));
+        }
+        const auto expected = last_known_good_search(input.begin(), input.end(), needle.begin(), needle.end());
+        assert(search(input.begin(), input.end(), needle.begin(), needle.end()) == expected);
+    }
+}
+
+template <class CharT>
+void test_string_find(mt19937_64& gen) {
+    uniform_int_distribution<int> dis('a', 'b');
+    basic_string<CharT> hay;
+    basic_string<CharT> needle;
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        hay.push_back(static_cast<CharT>(dis(gen)));
+        needle.clear();
+        for (size_t n = attempts % 12; n != 0; --n) {
+            needle.push_back(static_cast<CharT>(dis(gen)));
+        }
+        const size_t start = static_cast<size_t>(gen() % (hay.size() + 1));
+        const auto found   = last_known_good_search(hay.begin() + static_cast<ptrdiff_t>(start), hay.end(),
+            needle.begin(), needle.end());
+        const size_t expected =
+            needle.empty() || found != hay.end() ? static_cast<size_t>(found - hay.begin()) : basic_string<CharT>::npos;
+        assert(hay.find(needle, start) == expected);
+    }
+}
+
+template <class FwdIt, class T>
+FwdIt last_known_good_remove(FwdIt first, FwdIt last, T v) {
+    FwdIt dest = first;
+    for (; first != last; ++first) {
+        if (*first != v) {
+            *dest = *first;
+            ++dest;
+        }
+    }
+    return dest;
+}
+
+template <class FwdIt>
+FwdIt last_known_good_unique(FwdIt first, FwdIt last) {
+    if (first == last) {
+        return last;
+    }
+
+    FwdIt dest = first;
+    while (++first != last) {
+        if (*first != *dest) {
+            *++dest = *first;
+        }
+    }
+    return ++dest;
+}
+
+template <class T>
+void test_remove_unique(mt19937_64& gen) {
+    // few distinct values, so that removed elements and runs of duplicates are frequent
+    uniform_int_distribution<int> dis(0, 3);
+    vector<T> input;
+    vector<T> actual;
+    vector<T> expected;
+    input.reserve(dataCount);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        const T v = static_cast<T>(dis(gen));
+
+        actual   = input;
+        expected = input;
+        const auto actual_end   = remove(actual.begin(), actual.end(), v);
+        const auto expected_end = last_known_good_remove(expected.begin(), expected.end(), v);
+        assert(equal(actual.begin(), actual_end, expected.begin(), expected_end));
+
+        actual   = input;
+        expected = input;
+        const auto actual_unique_end   = unique(actual.begin(), actual.end());
+        const auto expected_unique_end = last_known_good_unique(expected.begin(), expected.end());
+        assert(equal(actual.begin(), actual_unique_end, expected.begin(), expected_unique_end));
+    }
+}
+
+template <class T>
+void test_fill_replace(mt19937_64& gen) {
+    uniform_int_distribution<int> dis(0, 3);
+    vector<T> input;
+    vector<T> expected;
+    input.reserve(dataCount);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        const T old_val = static_cast<T>(dis(gen));
+        const T new_val = static_cast<T>(dis(gen) + 4);
+
+        // fill only the middle, so that overwriting the neighbours would be noticed
+        const size_t first = input.size() / 3;
+        const size_t last  = input.size() - first;
+        vector<T> actual   = input;
+        expected           = input;
+        for (size_t i = first; i != last; ++i) {
+            expected[i] = new_val;
+        }
+        fill(actual.begin() + static_cast<ptrdiff_t>(first), actual.begin() + static_cast<ptrdiff_t>(last), new_val);
+        assert(actual == expected);
+
+        actual = input;
+        fill_n(actual.begin() + static_cast<ptrdiff_t>(first), last - first, new_val);
+        assert(actual == expected);
+
+        actual   = input;
+        expected = input;
+        for (auto& e : expected) {
+            if (e == old_val) {
+                e = new_val;
+            }
+        }
+        replace(actual.begin(), actual.end(), old_val, new_val);
+        assert(actual == expected);
+    }
+
+    const vector<T> filled(dataCount, static_cast<T>(5));
+    assert(count(filled.begin(), filled.end(), static_cast<T>(5)) == static_cast<ptrdiff_t>(dataCount));
+}
+
+template <class T, class Pred>
+void test_case_partition(const vector<T>& input, const Pred pred) {
+    // pred is stdext::less_than or stdext::greater_than, which the vectorized kernels recognize; the lambda hides it
+    const auto plain_pred = [pred](const T& elem) { return pred(elem); };
+
+    vector<T> actual = input;
+    const auto mid   = partition(actual.begin(), actual.end(), pred);
+    assert(all_of(actual.begin(), mid, plain_pred));
+    assert(none_of(mid, actual.end(), plain_pred));
+    vector<T> sorted_input = input;
+    sort(sorted_input.begin(), sorted_input.end());
+    sort(actual.begin(), actual.end());
+    assert(actual == sorted_input);
+
+    vector<T> expected_true;
+    vector<T> expected_false;
+    partition_copy(input.begin(), input.end(), back_inserter(expected_true), back_inserter(expected_false), plain_pred);
+    vector<T> actual_true(input.size());
+    vector<T> actual_false(input.size());
+    const auto ends = partition_copy(input.begin(), input.end(), actual_true.begin(), actual_false.begin(), pred);
+    assert(equal(actual_true.begin(), ends.first, expected_true.begin(), expected_true.end()));
+    assert(equal(actual_false.begin(), ends.second, expected_false.begin(), expected_false.end()));
+
+    actual                  = input;
+    vector<T> expected      = input;
+    const auto actual_mid   = stable_partition(actual.begin(), actual.end(), pred);
+    const auto expected_mid = stable_partition(expected.begin(), expected.end(), plain_pred);
+    assert(actual == expected);
+    assert(actual_mid - actual.begin() == expected_mid - expected.begin());
+}
+
+template <class T>
+void test_partition(mt19937_64& gen) {
+    uniform_int_distribution<int> dis(-50, 50);
+    vector<T> input;
+    input.reserve(dataCount);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<T>(dis(gen)));
+        const T threshold = static_cast<T>(dis(gen));
+        test_case_partition(input, stdext::less_than(threshold));
+        test_case_partition(input, stdext::greater_than(threshold));
+    }
+}
+
+template <class FwdIt>
+FwdIt last_known_good_adjacent_find(FwdIt first, const FwdIt last) {
+    if (first == last) {
+        return last;
+    }
+
+    for (FwdIt next = first; ++next != last; first = next) {
+        if (*first == *next) {
+            return first;
+        }
+    }
+    return last;
+}
+
+template <class FwdIt>
+FwdIt last_known_good_is_sorted_until(FwdIt first, const FwdIt last) {
+    if (first == last) {
+        return last;
+    }
+
+    for (FwdIt next = first; ++next != last; first = next) {
+        if (*next < *first) {
+            return next;
+        }
+    }
+    return last;
+}
+
+template <class T>
+void test_adjacent_find_is_sorted(mt19937_64& gen) {
+    vector<T> input;
+    input.reserve(dataCount);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        // mostly ascending, with occasional repeats and steps down; small types also wrap around
+        if (input.empty() || gen() % 64 == 0) {
+            input.push_back(static_cast<T>(gen())); // intentionally narrows
+        } else {
+            input.push_back(static_cast<T>(input.back() + (gen() % 16 == 0 ? 0 : 1)));
+        }
+
+        const auto found = last_known_good_adjacent_find(input.begin(), input.end());
+        assert(adjacent_find(input.begin(), input.end()) == found);
+        const auto sorted_until = last_known_good_is_sorted_until(input.begin(), input.end());
+        assert(is_sorted_until(input.begin(), input.end()) == sorted_until);
+        assert(is_sorted(input.begin(), input.end()) == (sorted_until == input.end()));
+#ifdef __cpp_lib_concepts
+        assert(ranges::adjacent_find(input) == found);
+        assert(ranges::is_sorted_until(input) == sorted_until);
+        assert(ranges::is_sorted(input) == (sorted_until == input.end()));
+#endif // __cpp_lib_concepts
+    }
+}
+
+template <size_t N, class CharT>
+void test_case_bitset(mt19937_64& gen) {
+    bitset<N> b;
+    basic_string<CharT> expected;
+    for (size_t i = N; i != 0; --i) {
+        const bool bit = (gen() & 1) != 0;
+        b[i - 1]       = bit;
+        expected.push_back(static_cast<CharT>(bit ? 'y' : 'x'));
+    }
+
+    size_t expected_count = 0;
+    for (size_t i = 0; i != N; ++i) {
+        expected_count += b[i];
+    }
+
+    assert(b.count() == expected_count);
+    assert((b.template to_string<CharT, char_traits<CharT>, allocator<CharT>>(CharT{'x'}, CharT{'y'}) == expected));
+    assert(bitset<N>(expected, 0, basic_string<CharT>::npos, CharT{'x'}, CharT{'y'}) == b);
+
+    // a shorter string sets the low bits, and a longer one is truncated
+    const auto low_half = expected.substr(N / 2);
+    assert(bitset<N>(low_half, 0, basic_string<CharT>::npos, CharT{'x'}, CharT{'y'}) == (b << N / 2 >> N / 2));
+    assert(bitset<N>(expected + expected, 0, basic_string<CharT>::npos, CharT{'x'}, CharT{'y'}) == b);
+
+    if (N != 0) {
+        auto invalid = expected;
+        invalid[static_cast<size_t>(gen() % N)] = CharT{'z'};
+        bool caught = false;
+        try {
+            (void) bitset<N>(invalid, 0, basic_string<CharT>::npos, CharT{'x'}, CharT{'y'});
+        } catch (const invalid_argument&) {
+            caught = true;
+        }
+        assert(caught);
+    }
+}
+
+template <class CharT>
+void test_bitset(mt19937_64& gen) {
+    test_case_bitset<0, CharT>(gen);
+    test_case_bitset<1, CharT>(gen);
+    test_case_bitset<31, CharT>(gen);
+    test_case_bitset<64, CharT>(gen);
+    test_case_bitset<100, CharT>(gen);
+    test_case_bitset<4096, CharT>(gen);
+    test_case_bitset<4099, CharT>(gen);
+}
+
 template <class BidIt>
 inline void last_known_good_reverse(BidIt first, BidIt last) {
     for (; first != last && first != --last; ++first) {
@@ -105,8 +829,530 @@ void test_swap_ranges(mt19937_64& gen) {
     }
 }
 
+template <class Engine>
+void test_mersenne_twister(const typename Engine::result_type seed) {
+    using T = typename Engine::result_type;
+    Engine bulk(seed);
+    Engine one_at_a_time(seed);
+    for (const size_t size : {size_t{0}, size_t{1}, size_t{7}, Engine::state_size - 1, Engine::state_size,
+             Engine::state_size + 1, size_t{5000}}) {
+        vector<T> values(size);
+        stdext::generate(bulk, values.begin(), values.end());
+        for (const T value : values) {
+            assert(value == one_at_a_time());
+        }
+
+        assert(bulk == one_at_a_time);
+
+        // distributions draw from the same sequence, and leave the engine where they stopped
+        vector<double> reals(size);
+        uniform_real_distribution<double> dist;
+        stdext::generate(bulk, dist, reals.begin(), reals.end());
+        for (const double real : reals) {
+            assert(real == dist(one_at_a_time));
+        }
+
+        assert(bulk == one_at_a_time);
+        assert(bulk() == one_at_a_time());
+    }
+
+    list<T> not_contiguous(100);
+    stdext::generate(bulk, not_contiguous.begin(), not_contiguous.end());
+    for (const T value : not_contiguous) {
+        assert(value == one_at_a_time());
+    }
+}
+
+void test_mersenne_twisters() {
+    // the 10000th consecutive invocations required by [rand.predef]
+    mt19937 mt;
+    mt.discard(9999);
+    assert(mt() == 4123659995u);
+    mt19937_64 mt_64;
+    mt_64.discard(9999);
+    assert(mt_64() == 9981545732273789042ull);
+
+    test_mersenne_twister<mt19937>(5489u);
+    test_mersenne_twister<mt19937>(1729u);
+    test_mersenne_twister<mt19937_64>(1729u);
+}
+
+template <class Engine>
+void test_philox_engine(const typename Engine::result_type seed) {
+    using T = typename Engine::result_type;
+    Engine bulk(seed);
+    Engine one_at_a_time(seed);
+    for (const size_t size : {size_t{0}, size_t{1}, size_t{3}, size_t{31}, size_t{32}, size_t{33}, size_t{5000}}) {
+        vector<T> values(size);
+        stdext::generate(bulk, values.begin(), values.end());
+        for (const T value : values) {
+            assert(value == one_at_a_time());
+        }
+
+        assert(bulk == one_at_a_time);
+    }
+
+    // discard and set_counter jump without generating
+    Engine jumped(seed);
+    jumped.discard(4 * 1000 + 2);
+    Engine counted(seed);
+    counted.set_counter({0, 0, 0, 1000});
+    (void) counted();
+    (void) counted();
+    assert(jumped == counted);
+    for (int i = 0; i < 10; ++i) {
+        assert(jumped() == counted());
+    }
+
+    // the low counter word carries into the next while generating in bulk
+    Engine carried(seed);
+    Engine carried_one(seed);
+    const T low = static_cast<T>((carried.max)() - 5);
+    carried.set_counter({0, 0, 0, low});
+    carried_one.set_counter({0, 0, 0, low});
+    vector<T> values(100);
+    stdext::generate(carried, values.begin(), values.end());
+    for (const T value : values) {
+        assert(value == carried_one());
+    }
+
+    Engine restored;
+    stringstream stream;
+    stream << carried;
+    stream >> restored;
+    assert(restored == carried);
+    assert(restored() == carried());
+}
+
+void test_philox_engines() {
+    stdext::philox4x32 ph;
+    ph.discard(9999);
+    assert(ph() == 1955073260u);
+    stdext::philox4x64 ph_64;
+    ph_64.discard(9999);
+    assert(ph_64() == 1784049179481256246ull);
+
+    test_philox_engine<stdext::philox4x32>(20111115u);
+    test_philox_engine<stdext::philox4x32>(1729u);
+    test_philox_engine<stdext::philox4x64>(1729u);
+
+    // each chunk of work owns the stream at its counter, so the values do not depend on who generates them
+    vector<uint_fast32_t> serial(4 * 256);
+    stdext::philox4x32 eng(42);
+    stdext::generate(eng, serial.begin(), serial.end());
+    for (uint_fast32_t chunk = 4; chunk-- != 0;) {
+        stdext::philox4x32 chunk_eng(42);
+        chunk_eng.set_counter({0, 0, 0, chunk * 64});
+        for (size_t i = 0; i < 256; ++i) {
+            assert(chunk_eng() == serial[chunk * 256 + i]);
+        }
+    }
+}
+
+template <class T>
+bool is_close_to(const T actual, const T expected, const int ulps) {
+    if (isnan(expected)) {
+        return isnan(actual);
+    }
+
+    if (actual == expected) {
+        return true;
+    }
+
+    const T magnitude = abs(expected);
+    if (isinf(magnitude) || isinf(actual)) {
+        return false;
+    }
+
+    const T spacing = nextafter(magnitude, numeric_limits<T>::infinity()) - magnitude;
+    return abs(actual - expected) <= ulps * spacing;
+}
+
+template <class T>
+bool is_same_value(const T left, const T right) {
+    return left == right || (isnan(left) && isnan(right));
+}
+
+template <class T, class ArrayFn, class ScalarFn>
+void test_case_math(const vector<T>& input, ArrayFn array_fn, ScalarFn scalar_fn, const int ulps) {
+    const valarray<T> result = array_fn(valarray<T>(input.data(), input.size()));
+    assert(result.size() == input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        assert(is_close_to(result[i], scalar_fn(input[i]), ulps));
+    }
+
+    // an element's result doesn't depend on its position, including in the padded tail
+    for (size_t length = 0; length < 9; ++length) {
+        const valarray<T> prefix = array_fn(valarray<T>(input.data(), length));
+        assert(prefix.size() == length);
+        for (size_t i = 0; i < length; ++i) {
+            assert(is_same_value(prefix[i], result[i]));
+        }
+    }
+}
+
+#ifdef __cpp_lib_span
+template <class T, class SpanFn>
+void test_case_span_math(const vector<T>& input, const valarray<T>& expected, SpanFn span_fn) {
+    vector<T> output(input.size());
+    span_fn(input, output);
+    vector<T> in_place = input;
+    span_fn(in_place, in_place);
+    for (size_t i = 0; i < input.size(); ++i) {
+        assert(is_same_value(output[i], expected[i]));
+        assert(is_same_value(in_place[i], expected[i]));
+    }
+}
+#endif // __cpp_lib_span
+
+template <class T>
+void test_math(mt19937_64& gen) {
+    // the tolerances allow for the CRT's own error too; float results are rounded from the double kernels
+    constexpr int ulps      = 2;
+    constexpr int tanh_ulps = 4;
+    constexpr int pow_ulps  = 3;
+
+    // arguments across many binades, and the ones the kernels leave to the CRT
+    constexpr T inf = numeric_limits<T>::infinity();
+    vector<T> args  = {T{0}, -T{0}, T{1}, T{-1}, inf, -inf, numeric_limits<T>::quiet_NaN(),
+        numeric_limits<T>::denorm_min(), (numeric_limits<T>::min)(), (numeric_limits<T>::max)(),
+        static_cast<T>(88.5), static_cast<T>(-103.5), static_cast<T>(709.5), static_cast<T>(-745.5),
+        static_cast<T>(1.0e5), static_cast<T>(-1.0e6), static_cast<T>(22.5), static_cast<T>(1.0e-9)};
+    uniform_real_distribution<T> mantissa(T{-1}, T{1});
+    uniform_int_distribution<int> exponent(-30, 20);
+    while (args.size() < dataCount) {
+        args.push_back(ldexp(mantissa(gen), exponent(gen)));
+    }
+
+    vector<T> bases;
+    for (const T arg : args) {
+        bases.push_back(abs(arg));
+    }
+
+    test_case_math(
+        args, [](const valarray<T>& v) { return exp(v); }, [](const T x) { return exp(x); }, ulps);
+    test_case_math(
+        bases, [](const valarray<T>& v) { return log(v); }, [](const T x) { return log(x); }, ulps);
+    test_case_math(
+        args, [](const valarray<T>& v) { return log(v); }, [](const T x) { return log(x); }, ulps);
+    test_case_math(
+        args, [](const valarray<T>& v) { return sin(v); }, [](const T x) { return sin(x); }, ulps);
+    test_case_math(
+        args, [](const valarray<T>& v) { return cos(v); }, [](const T x) { return cos(x); }, ulps);
+    test_case_math(
+        args, [](const valarray<T>& v) { return tanh(v); }, [](const T x) { return tanh(x); }, tanh_ulps);
+    test_case_math(
+        args, [](const valarray<T>& v) { return sqrt(v); }, [](const T x) { return sqrt(x); }, 0);
+    test_case_math(
+        bases, [](const valarray<T>& v) { return pow(v, T{2.5}); }, [](const T x) { return pow(x, T{2.5}); },
+        pow_ulps);
+    test_case_math(
+        args, [](const valarray<T>& v) { return pow(T{1.5}, v); }, [](const T x) { return pow(T{1.5}, x); },
+        pow_ulps);
+    test_case_math(
+        args, [](const valarray<T>& v) { return pow(v, T{3}); }, [](const T x) { return pow(x, T{3}); }, pow_ulps);
+
+    const valarray<T> base_array(bases.data(), bases.size());
+    const valarray<T> arg_array(args.data(), args.size());
+    const valarray<T> powers = pow(base_array, arg_array);
+    for (size_t i = 0; i < args.size(); ++i) {
+        assert(is_close_to(powers[i], pow(bases[i], args[i]), pow_ulps));
+    }
+
+#ifdef __cpp_lib_span
+    // the span functions compute what valarray does, also in place
+    test_case_span_math(args, exp(arg_array), [](const vector<T>& src, vector<T>& dest) { stdext::exp(src, dest); });
+    test_case_span_math(args, log(arg_array), [](const vector<T>& src, vector<T>& dest) { stdext::log(src, dest); });
+    test_case_span_math(args, sin(arg_array), [](const vector<T>& src, vector<T>& dest) { stdext::sin(src, dest); });
+    test_case_span_math(args, cos(arg_array), [](const vector<T>& src, vector<T>& dest) { stdext::cos(src, dest); });
+    test_case_span_math(
+        args, tanh(arg_array), [](const vector<T>& src, vector<T>& dest) { stdext::tanh(src, dest); });
+    test_case_span_math(
+        args, sqrt(arg_array), [](const vector<T>& src, vector<T>& dest) { stdext::sqrt(src, dest); });
+    test_case_span_math(
+        args, pow(arg_array, T{3}), [](const vector<T>& src, vector<T>& dest) { stdext::pow(src, T{3}, dest); });
+    test_case_span_math(
+        args, pow(T{1.5}, arg_array), [](const vector<T>& src, vector<T>& dest) { stdext::pow(T{1.5}, src, dest); });
+    test_case_span_math(
+        args, powers, [&bases](const vector<T>& src, vector<T>& dest) { stdext::pow(bases, src, dest); });
+#endif // __cpp_lib_span
+}
+
+template <class T>
+void test_complex(mt19937_64& gen) {
+    uniform_real_distribution<T> dist(-100, 100);
+    vector<complex<T>> left;
+    vector<complex<T>> right;
+    for (int i = 0; i < 99; ++i) {
+        left.emplace_back(dist(gen), dist(gen));
+        right.emplace_back(dist(gen), dist(gen));
+    }
+
+    // fast_divide is within a few ulp of operator/ for moderate divisors
+    for (size_t i = 0; i < left.size(); ++i) {
+        const complex<T> quotient = stdext::fast_divide(left[i], right[i]);
+        const complex<T> expected = left[i] / right[i];
+        assert(abs(quotient - expected) <= abs(expected) * numeric_limits<T>::epsilon() * 8);
+    }
+
+    assert(stdext::fast_divide(complex<T>(4, 2), complex<T>(0, 2)) == complex<T>(1, -2));
+
+#ifdef __cpp_lib_span
+    // the span functions match operator* exactly, for every length (and so every tail), and also in place
+    for (size_t count = 0; count <= left.size(); count += (count < 16 ? 1 : 27)) {
+        const span<const complex<T>> left_span(left.data(), count);
+        const span<const complex<T>> right_span(right.data(), count);
+        vector<complex<T>> products(count);
+        vector<complex<T>> sums(left.begin(), left.begin() + static_cast<ptrdiff_t>(count));
+        stdext::multiply(left_span, right_span, products);
+        stdext::multiply_add(left_span, right_span, sums);
+        for (size_t i = 0; i < count; ++i) {
+            assert(products[i] == left[i] * right[i]);
+            assert(sums[i] == left[i] + left[i] * right[i]);
+        }
+
+        vector<complex<T>> in_place(left.begin(), left.begin() + static_cast<ptrdiff_t>(count));
+        stdext::multiply(in_place, right_span, in_place);
+        assert(in_place == products);
+    }
+#endif // __cpp_lib_span
+}
+
+char last_known_good_ascii_lower(const char ch) {
+    return 'A' <= ch && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch;
+}
+
+char last_known_good_ascii_upper(const char ch) {
+    return 'a' <= ch && ch <= 'z' ? static_cast<char>(ch - 'a' + 'A') : ch;
+}
+
+void test_ascii_case(mt19937_64& gen) {
+    // every byte value, so the range checks are exercised at both edges of each letter range
+    uniform_int_distribution<int> dis(-128, 127);
+    const auto& classic_ctype = use_facet<ctype<char>>(locale::classic());
+    string input;
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        input.push_back(static_cast<char>(dis(gen)));
+
+        string lower    = input;
+        string upper    = input;
+        string expected = input;
+        stdext::ascii_tolower(&lower[0], &lower[0] + lower.size());
+        stdext::ascii_toupper(&upper[0], &upper[0] + upper.size());
+        transform(input.begin(), input.end(), expected.begin(), last_known_good_ascii_lower);
+        assert(lower == expected);
+        transform(input.begin(), input.end(), expected.begin(), last_known_good_ascii_upper);
+        assert(upper == expected);
+
+        string facet_lower = input;
+        classic_ctype.tolower(&facet_lower[0], &facet_lower[0] + facet_lower.size());
+        assert(facet_lower == lower);
+        string facet_upper = input;
+        classic_ctype.toupper(&facet_upper[0], &facet_upper[0] + facet_upper.size());
+        assert(facet_upper == upper);
+
+#if _HAS_CXX17
+        assert(stdext::iequals(lower, upper));
+        assert(stdext::icompare(lower, upper) == 0);
+        assert(stdext::icompare(input, upper + 'x') < 0);
+        assert(stdext::icompare(input + 'x', lower) > 0);
+
+        // a difference that isn't only case is found at any position, and ordered on the lowercased bytes
+        const size_t pos = static_cast<size_t>(gen() % input.size());
+        string other     = upper;
+        other[pos]       = static_cast<char>(lower[pos] ^ 0x01);
+
+        const bool less = static_cast<unsigned char>(lower[pos])
+                        < static_cast<unsigned char>(last_known_good_ascii_lower(other[pos]));
+        assert(!stdext::iequals(input, other));
+        assert(stdext::icompare(input, other) == (less ? -1 : +1));
+        assert(stdext::icompare(other, input) == (less ? +1 : -1));
+#endif // _HAS_CXX17
+    }
+
+#if _HAS_CXX17
+    assert(stdext::iequals("Content-Length", "content-length"));
+    assert(!stdext::iequals("Content-Length", "content-length "));
+    assert(!stdext::iequals("[", "{")); // '[' and '{' differ only in the case bit, but aren't letters
+    assert(stdext::icompare("apple", "BANANA") < 0);
+    assert(stdext::icompare("", "") == 0);
+#endif // _HAS_CXX17
+}
+
+#if _HAS_CXX17
+template <class T>
+void test_scans(mt19937_64& gen) {
+    // small whole numbers, so that the reassociated floating-point sums are exact too
+    uniform_int_distribution<int> dis(-100, 100);
+    vector<T> input;
+    vector<T> expected_inclusive;
+    vector<T> expected_exclusive;
+    vector<T> actual;
+    const T init = static_cast<T>(7);
+    for (size_t attempts = 0; attempts < dataCount; ++attempts) {
+        expected_inclusive.clear();
+        expected_exclusive.clear();
+        T sum = init;
+        for (const T& val : input) {
+            expected_exclusive.push_back(sum);
+            sum += val;
+            expected_inclusive.push_back(sum);
+        }
+
+        actual.assign(input.size(), T{});
+        inclusive_scan(input.begin(), input.end(), actual.begin(), plus<>{}, init);
+        assert(actual == expected_inclusive);
+        exclusive_scan(input.begin(), input.end(), actual.begin(), init);
+        assert(actual == expected_exclusive);
+
+        actual = input;
+        exclusive_scan(actual.begin(), actual.end(), actual.begin(), init, plus<T>{});
+        assert(actual == expected_exclusive);
+
+        // without an initial value, the first element seeds the sums
+        actual = input;
+        inclusive_scan(actual.begin(), actual.end(), actual.begin());
+        vector<T> seeded = input;
+        partial_sum(seeded.begin(), seeded.end(), seeded.begin(), [](T left, T right) { return left + right; });
+        assert(actual == seeded);
+
+        partial_sum(input.begin(), input.end(), actual.begin());
+        assert(actual == seeded);
+
+        input.push_back(static_cast<T>(dis(gen)));
+    }
+}
+
+void test_scan_signed_zeros() {
+    // the sums start from -0.0, so that a run of -0.0 stays negative
+    const double negative_zeros[] = {-0.0, -0.0, -0.0, -0.0, -0.0, -0.0, -0.0, -0.0, -0.0};
+    double sums[size(negative_zeros)];
+    inclusive_scan(begin(negative_zeros), end(negative_zeros), begin(sums));
+    for (const double sum : sums) {
+        assert(sum == 0.0 && signbit(sum));
+    }
+
+    exclusive_scan(begin(negative_zeros), end(negative_zeros), begin(sums), -0.0);
+    for (const double sum : sums) {
+        assert(sum == 0.0 && signbit(sum));
+    }
+}
+#endif // _HAS_CXX17
+
 void test_vector_algorithms() {
     mt19937_64 gen(1729);
+    test_count<char>(gen);
+    test_count<signed char>(gen);
+    test_count<unsigned char>(gen);
+    test_count<short>(gen);
+    test_count<unsigned short>(gen);
+    test_count<int>(gen);
+    test_count<unsigned int>(gen);
+    test_count<long long>(gen);
+    test_count<unsigned long long>(gen);
+
+    test_find<char>(gen);
+    test_find<signed char>(gen);
+    test_find<unsigned char>(gen);
+    test_find<short>(gen);
+    test_find<unsigned short>(gen);
+    test_find<int>(gen);
+    test_find<unsigned int>(gen);
+    test_find<long long>(gen);
+    test_find<unsigned long long>(gen);
+
+    test_find_count_value_conversions();
+
+    test_min_max_element<char>(gen);
+    test_min_max_element<signed char>(gen);
+    test_min_max_element<unsigned char>(gen);
+    test_min_max_element<short>(gen);
+    test_min_max_element<unsigned short>(gen);
+    test_min_max_element<int>(gen);
+    test_min_max_element<unsigned int>(gen);
+    test_min_max_element<long long>(gen);
+    test_min_max_element<unsigned long long>(gen);
+    test_min_max_element<float>(gen);
+    test_min_max_element<double>(gen);
+    test_min_max_element<long double>(gen);
+    test_min_max_element_signed_zeros();
+    test_min_max_element_nans<float>();
+    test_min_max_element_nans<double>();
+
+    test_mismatch<char>(gen);
+    test_mismatch<signed char>(gen);
+    test_mismatch<unsigned char>(gen);
+    test_mismatch<short>(gen);
+    test_mismatch<unsigned short>(gen);
+    test_mismatch<int>(gen);
+    test_mismatch<unsigned int>(gen);
+    test_mismatch<long long>(gen);
+    test_mismatch<unsigned long long>(gen);
+
+    test_string_compare<wchar_t>(gen);
+    test_string_compare<char16_t>(gen);
+    test_string_compare<char32_t>(gen);
+
+    test_ascii_case(gen);
+
+    test_find_first_of<char>(gen);
+    test_find_first_of<unsigned char>(gen);
+    test_find_first_of<short>(gen);
+    test_find_first_of<unsigned short>(gen);
+    test_find_first_of<int>(gen);
+    test_find_first_of<unsigned int>(gen);
+    test_find_first_of<long long>(gen);
+    test_find_first_of<unsigned long long>(gen);
+
+    test_string_find_of<char>(gen);
+    test_string_find_of<wchar_t>(gen);
+    test_string_find_of<char16_t>(gen);
+    test_string_find_of<char32_t>(gen);
+
+    test_search<char>(gen);
+    test_search<short>(gen);
+    test_search<int>(gen);
+    test_search<long long>(gen);
+
+    test_string_find<char>(gen);
+    test_string_find<wchar_t>(gen);
+    test_string_find<char32_t>(gen);
+
+    test_remove_unique<int>(gen);
+    test_remove_unique<unsigned int>(gen);
+    test_remove_unique<long long>(gen);
+    test_remove_unique<unsigned long long>(gen);
+    test_remove_unique<short>(gen);
+
+    test_fill_replace<char>(gen);
+    test_fill_replace<short>(gen);
+    test_fill_replace<int>(gen);
+    test_fill_replace<unsigned int>(gen);
+    test_fill_replace<long long>(gen);
+    test_fill_replace<float>(gen);
+    test_fill_replace<double>(gen);
+
+    test_partition<int>(gen);
+    test_partition<unsigned int>(gen);
+    test_partition<long long>(gen);
+    test_partition<unsigned long long>(gen);
+    test_partition<float>(gen);
+    test_partition<double>(gen);
+    test_partition<short>(gen);
+
+    test_adjacent_find_is_sorted<char>(gen);
+    test_adjacent_find_is_sorted<signed char>(gen);
+    test_adjacent_find_is_sorted<unsigned char>(gen);
+    test_adjacent_find_is_sorted<short>(gen);
+    test_adjacent_find_is_sorted<unsigned short>(gen);
+    test_adjacent_find_is_sorted<int>(gen);
+    test_adjacent_find_is_sorted<unsigned int>(gen);
+    test_adjacent_find_is_sorted<long long>(gen);
+    test_adjacent_find_is_sorted<unsigned long long>(gen);
+
+    test_bitset<char>(gen);
+    test_bitset<wchar_t>(gen);
+
     test_reverse<char>(gen);
     test_reverse<signed char>(gen);
     test_reverse<unsigned char>(gen);
@@ -138,6 +1384,25 @@ void test_vector_algorithms() {
     test_swap_ranges<int>(gen);
     test_swap_ranges<unsigned int>(gen);
     test_swap_ranges<unsigned long long>(gen);
+
+    test_mersenne_twisters();
+    test_philox_engines();
+
+    test_math<float>(gen);
+    test_math<double>(gen);
+
+    test_complex<float>(gen);
+    test_complex<double>(gen);
+
+#if _HAS_CXX17
+    test_scans<int>(gen);
+    test_scans<unsigned int>(gen);
+    test_scans<long long>(gen);
+    test_scans<unsigned long long>(gen);
+    test_scans<float>(gen);
+    test_scans<double>(gen);
+    test_scan_signed_zeros();
+#endif // _HAS_CXX17
 }
 
 template <typename Container1, typename Container2>
@@ -183,8 +1448,11 @@ int main() {
     test_various_containers();
 #ifndef _M_CEE_PURE
 #if defined(_M_IX86) || defined(_M_X64)
+    disable_instructions(__ISA_AVAILABLE_AVX512);
+    test_vector_algorithms();
     disable_instructions(__ISA_AVAILABLE_AVX2);
     test_vector_algorithms();
+    disable_instructions(__ISA_AVAILABLE_AVX);
     disable_instructions(__ISA_AVAILABLE_SSE42);
     test_vector_algorithms();
 #endif // defined(_M_IX86) || defined(_M_X64)
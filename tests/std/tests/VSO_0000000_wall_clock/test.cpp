@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <chrono>
+#include <ctime>
+#include <list>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <wall_clock>
+
+using namespace std;
+using namespace std::chrono;
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using stdext::civil_time;
+using stdext::coarse_system_clock;
+
+STATIC_ASSERT(is_same_v<coarse_system_clock::time_point, system_clock::time_point>);
+STATIC_ASSERT(!coarse_system_clock::is_steady);
+
+void test_coarse_system_clock() {
+    // the coarse clock lags the precise one by at most a timer tick, 16 ms by default but as long as the system allows
+    const auto before = system_clock::now();
+    const auto coarse = coarse_system_clock::now();
+    const auto after  = system_clock::now();
+    assert(coarse <= after);
+    assert(before - coarse < seconds{1});
+}
+
+bool matches(const civil_time& civil, const system_clock::time_point time) {
+    auto ticks = time.time_since_epoch();
+    auto secs  = duration_cast<seconds>(ticks);
+    if (secs > ticks) {
+        secs -= seconds{1};
+    }
+
+    const __time64_t whole = secs.count();
+    tm expected;
+    if (_gmtime64_s(&expected, &whole) != 0) {
+        return false;
+    }
+
+    return civil.year == expected.tm_year + 1900 && civil.month == expected.tm_mon + 1
+        && civil.day == expected.tm_mday && civil.hour == expected.tm_hour && civil.minute == expected.tm_min
+        && civil.second == expected.tm_sec
+        && civil.nanosecond == static_cast<unsigned int>(duration_cast<nanoseconds>(ticks - secs).count());
+}
+
+void test_known_values() {
+    const system_clock::time_point times[] = {
+        system_clock::time_point{}, // the epoch
+        system_clock::time_point{seconds{1'000'000'000}}, // 2001-09-09 01:46:40
+        system_clock::time_point{seconds{951'782'400} + milliseconds{123}}, // 2000-02-29, a leap day
+        system_clock::time_point{system_clock::duration{-1}}, // one tick before the epoch
+    };
+
+    civil_time civil[4];
+    assert(stdext::to_civil_time(begin(times), end(times), civil) == end(civil));
+
+    assert(civil[0].year == 1970 && civil[0].month == 1 && civil[0].day == 1);
+    assert(civil[0].hour == 0 && civil[0].minute == 0 && civil[0].second == 0 && civil[0].nanosecond == 0);
+    assert(civil[1].year == 2001 && civil[1].month == 9 && civil[1].day == 9);
+    assert(civil[1].hour == 1 && civil[1].minute == 46 && civil[1].second == 40);
+    assert(civil[2].year == 2000 && civil[2].month == 2 && civil[2].day == 29);
+    assert(civil[2].nanosecond == 123'000'000);
+    assert(civil[3].year == 1969 && civil[3].month == 12 && civil[3].day == 31);
+    assert(civil[3].hour == 23 && civil[3].minute == 59 && civil[3].second == 59);
+    assert(civil[3].nanosecond == 999'999'900);
+}
+
+void test_against_gmtime() {
+    mt19937_64 gen(1729);
+    // _gmtime64_s accepts 1970 through 3000
+    uniform_int_distribution<long long> dist(0, 32'503'679'999LL * 10'000'000);
+    vector<system_clock::time_point> times;
+    for (int i = 0; i < 10000; ++i) {
+        times.emplace_back(system_clock::duration{dist(gen)});
+    }
+
+    const auto now = system_clock::now();
+    for (int i = 0; i < 10000; ++i) { // a log's worth of timestamps, mostly from the same day
+        times.push_back(now + milliseconds{i * 37});
+    }
+
+    vector<civil_time> civil(times.size());
+    stdext::to_civil_time(times.begin(), times.end(), civil.begin());
+    for (size_t i = 0; i < times.size(); ++i) {
+        assert(matches(civil[i], times[i]));
+    }
+
+    // other iterators and time_point durations work too
+    const list<time_point<system_clock, seconds>> coarse_times{time_point<system_clock, seconds>{seconds{86'399}}};
+    civil_time last{};
+    stdext::to_civil_time(coarse_times.begin(), coarse_times.end(), &last);
+    assert(last.year == 1970 && last.day == 1 && last.hour == 23 && last.minute == 59 && last.second == 59);
+}
+
+int main() {
+    test_coarse_system_clock();
+    test_known_values();
+    test_against_gmtime();
+}
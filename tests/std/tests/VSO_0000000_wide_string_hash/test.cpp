@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#define _STL_WIDE_STRING_HASH 1
+
+#include <assert.h>
+#include <filesystem>
+#include <functional>
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+using namespace std;
+
+template <class CharT>
+void test_string_hash() {
+    // every length from empty through several iterations of the widest loop, including each cutoff between the
+    // short, medium, and long paths, should hash distinctly, and agree between basic_string and basic_string_view
+    basic_string<CharT> str;
+    unordered_set<size_t> seen;
+    for (size_t len = 0; len <= 300; ++len) {
+        const size_t h = hash<basic_string<CharT>>{}(str);
+        assert(h == hash<basic_string_view<CharT>>{}(str));
+        assert(seen.insert(h).second);
+
+        // changing any single element must change the hash
+        for (size_t idx = 0; idx < len; ++idx) {
+            auto changed = str;
+            changed[idx] = static_cast<CharT>(changed[idx] ^ 1);
+            assert(hash<basic_string<CharT>>{}(changed) != h);
+        }
+
+        str.push_back(static_cast<CharT>('a' + len % 26));
+    }
+
+    // strings of NULs differ only by length
+    for (size_t len = 0; len <= 64; ++len) {
+        assert(seen.insert(hash<basic_string<CharT>>{}(basic_string<CharT>(len, CharT{}))).second || len == 0);
+    }
+}
+
+void test_unordered_set() {
+    unordered_set<string> words;
+    for (int i = 0; i < 10000; ++i) {
+        words.insert("key number " + to_string(i) + string(static_cast<size_t>(i % 70), 'x'));
+    }
+
+    assert(words.size() == 10000);
+    for (int i = 0; i < 10000; ++i) {
+        assert(words.count("key number " + to_string(i) + string(static_cast<size_t>(i % 70), 'x')) == 1);
+    }
+
+    assert(words.count("key number 10000") == 0);
+}
+
+void test_path_hash() {
+    using filesystem::path;
+
+    // equivalent paths hash alike, however their separators are spelled
+    const auto h = [](const path& p) { return filesystem::hash_value(p); };
+    assert(h(path(L"c:\\foo\\bar")) == h(path(L"c:/foo//bar")));
+    assert(h(path(L"c:\\foo\\bar\\")) == h(path(L"c:\\foo\\bar////")));
+    assert(h(path(L"\\\\server\\share\\dir")) == h(path(L"\\\\server/share\\\\dir")));
+    assert(h(path(L"foo\\bar")) == h(path(L"foo/bar")));
+    assert(h(path(L"foo\\bar")) == hash<path>{}(path(L"foo///bar")));
+
+    // and distinct paths should not
+    assert(h(path(L"c:\\foo\\bar")) != h(path(L"c:foo\\bar")));
+    assert(h(path(L"c:\\foo\\bar")) != h(path(L"c:\\foobar")));
+    assert(h(path(L"c:\\foo\\bar")) != h(path(L"c:\\foo\\bar\\")));
+    assert(h(path(L"foo\\bar")) != h(path(L"foo\\ba\\r")));
+    assert(h(path(L"a-rather-long-directory-name\\and-a-rather-long-file-name.txt"))
+           != h(path(L"a-rather-long-directory-name\\and-a-rather-long-file-name.txT")));
+}
+
+int main() {
+    test_string_hash<char>();
+    test_string_hash<wchar_t>();
+    test_string_hash<char16_t>();
+    test_string_hash<char32_t>();
+    test_unordered_set();
+    test_path_hash();
+}
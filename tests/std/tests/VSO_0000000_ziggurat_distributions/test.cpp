@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+constexpr int sample_count = 1'000'000;
+
+struct moments {
+    double mean;
+    double variance;
+};
+
+template <class Dist, class Engine>
+moments measure(Dist& dist, Engine& eng) {
+    double sum         = 0.0;
+    double sum_squares = 0.0;
+    for (int i = 0; i < sample_count; ++i) {
+        const double val = dist(eng);
+        sum += val;
+        sum_squares += val * val;
+    }
+
+    const double mean = sum / sample_count;
+    return {mean, sum_squares / sample_count - mean * mean};
+}
+
+template <class Engine>
+void test_normal() {
+    Engine eng;
+    stdext::ziggurat_normal_distribution<> dist(3.0, 2.0);
+    assert(dist.mean() == 3.0 && dist.stddev() == 2.0);
+
+    const moments m = measure(dist, eng);
+    assert(abs(m.mean - 3.0) < 0.01);
+    assert(abs(m.variance - 4.0) < 0.03);
+
+    // the fraction of values beyond two standard deviations, which crosses many layers and the base
+    stdext::ziggurat_normal_distribution<float> unit;
+    int outside = 0;
+    for (int i = 0; i < sample_count; ++i) {
+        outside += abs(unit(eng)) > 2.0f;
+    }
+
+    assert(abs(outside / static_cast<double>(sample_count) - 0.0455) < 0.001);
+}
+
+template <class Engine>
+void test_exponential() {
+    Engine eng;
+    stdext::ziggurat_exponential_distribution<> dist(0.5);
+    assert(dist.lambda() == 0.5);
+    assert((dist.min)() == 0.0);
+
+    const moments m = measure(dist, eng);
+    assert(abs(m.mean - 2.0) < 0.01);
+    assert(abs(m.variance - 4.0) < 0.05);
+
+    // values in the tail beyond the base layer, which starts at 7.697
+    stdext::ziggurat_exponential_distribution<> unit;
+    int tail = 0;
+    for (int i = 0; i < sample_count; ++i) {
+        const double val = unit(eng);
+        assert(val >= 0.0);
+        tail += val > 8.0;
+    }
+
+    assert(abs(tail / static_cast<double>(sample_count) - exp(-8.0)) < 0.0001);
+}
+
+void test_params_and_streams() {
+    stdext::ziggurat_normal_distribution<> normal(1.5, 0.25);
+    stdext::ziggurat_normal_distribution<> normal_copy;
+    assert(normal != normal_copy);
+    stringstream normal_stream;
+    normal_stream << normal;
+    normal_stream >> normal_copy;
+    assert(normal == normal_copy);
+
+    normal_copy.param(decltype(normal)::param_type{});
+    assert(normal_copy.mean() == 0.0 && normal_copy.stddev() == 1.0);
+
+    stdext::ziggurat_exponential_distribution<float> expo(4.0f);
+    stdext::ziggurat_exponential_distribution<float> expo_copy;
+    stringstream expo_stream;
+    expo_stream << expo;
+    expo_stream >> expo_copy;
+    assert(expo == expo_copy);
+
+    // the param_type overload, and the same engine state giving the same values
+    mt19937 eng1(1729);
+    mt19937 eng2(1729);
+    for (int i = 0; i < 1000; ++i) {
+        assert(normal(eng1) == normal_copy(eng2, normal.param()));
+    }
+}
+
+void test_bulk_generate() {
+    mt19937 eng1(42);
+    mt19937 eng2(42);
+    stdext::ziggurat_normal_distribution<> dist;
+    vector<double> bulk(10'000);
+    stdext::generate(eng1, dist, bulk.begin(), bulk.end());
+    for (const double val : bulk) {
+        assert(val == dist(eng2));
+    }
+
+    assert(eng1 == eng2);
+}
+
+int main() {
+    test_normal<mt19937>();
+    test_normal<mt19937_64>();
+    test_normal<minstd_rand>(); // 31-bit values, assembled by _Rng_from_urng
+    test_exponential<mt19937>();
+    test_exponential<mt19937_64>();
+    test_params_and_streams();
+    test_bulk_generate();
+}
@@ -17,6 +17,20 @@ int main() {} // COMPILE-ONLY
 STATIC_ASSERT(__cpp_lib_addressof_constexpr == 201603L);
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_allocate_at_least
+#error __cpp_lib_allocate_at_least is not defined
+#elif __cpp_lib_allocate_at_least != 202106L
+#error __cpp_lib_allocate_at_least is not 202106L
+#else
+STATIC_ASSERT(__cpp_lib_allocate_at_least == 202106L);
+#endif
+#else
+#ifdef __cpp_lib_allocate_at_least
+#error __cpp_lib_allocate_at_least is defined
+#endif
+#endif
+
 #ifndef __cpp_lib_allocator_traits_is_always_equal
 #error __cpp_lib_allocator_traits_is_always_equal is not defined
 #elif __cpp_lib_allocator_traits_is_always_equal != 201411L
@@ -139,6 +153,20 @@ STATIC_ASSERT(__cpp_lib_atomic_lock_free_type_aliases == 201907L);
 #endif
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_atomic_ref
+#error __cpp_lib_atomic_ref is not defined
+#elif __cpp_lib_atomic_ref != 201806L
+#error __cpp_lib_atomic_ref is not 201806L
+#else
+STATIC_ASSERT(__cpp_lib_atomic_ref == 201806L);
+#endif
+#else
+#ifdef __cpp_lib_atomic_ref
+#error __cpp_lib_atomic_ref is defined
+#endif
+#endif
+
 #if _HAS_CXX20
 #ifndef __cpp_lib_atomic_shared_ptr
 #error __cpp_lib_atomic_shared_ptr is not defined
@@ -175,6 +203,20 @@ STATIC_ASSERT(__cpp_lib_atomic_wait == 201907L);
 #endif
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_barrier
+#error __cpp_lib_barrier is not defined
+#elif __cpp_lib_barrier != 201907L
+#error __cpp_lib_barrier is not 201907L
+#else
+STATIC_ASSERT(__cpp_lib_barrier == 201907L);
+#endif
+#else
+#ifdef __cpp_lib_barrier
+#error __cpp_lib_barrier is defined
+#endif
+#endif
+
 #if _HAS_CXX20
 #ifndef __cpp_lib_bind_front
 #error __cpp_lib_bind_front is not defined
@@ -369,6 +411,20 @@ STATIC_ASSERT(__cpp_lib_constexpr_complex == 201711L);
 #endif
 #endif
 
+#if _HAS_CXX20 && defined(__cpp_constexpr_dynamic_alloc)
+#ifndef __cpp_lib_constexpr_dynamic_alloc
+#error __cpp_lib_constexpr_dynamic_alloc is not defined
+#elif __cpp_lib_constexpr_dynamic_alloc != 201907L
+#error __cpp_lib_constexpr_dynamic_alloc is not 201907L
+#else
+STATIC_ASSERT(__cpp_lib_constexpr_dynamic_alloc == 201907L);
+#endif
+#else
+#ifdef __cpp_lib_constexpr_dynamic_alloc
+#error __cpp_lib_constexpr_dynamic_alloc is defined
+#endif
+#endif
+
 #if _HAS_CXX20
 #ifndef __cpp_lib_constexpr_functional
 #error __cpp_lib_constexpr_functional is not defined
@@ -425,6 +481,20 @@ STATIC_ASSERT(__cpp_lib_constexpr_numeric == 201911L);
 #endif
 #endif
 
+#if _HAS_CXX20 && defined(__cpp_constexpr_dynamic_alloc)
+#ifndef __cpp_lib_constexpr_string
+#error __cpp_lib_constexpr_string is not defined
+#elif __cpp_lib_constexpr_string != 201907L
+#error __cpp_lib_constexpr_string is not 201907L
+#else
+STATIC_ASSERT(__cpp_lib_constexpr_string == 201907L);
+#endif
+#else
+#ifdef __cpp_lib_constexpr_string
+#error __cpp_lib_constexpr_string is defined
+#endif
+#endif
+
 #if _HAS_CXX20
 #ifndef __cpp_lib_constexpr_string_view
 #error __cpp_lib_constexpr_string_view is not defined
@@ -467,6 +537,20 @@ STATIC_ASSERT(__cpp_lib_constexpr_utility == 201811L);
 #endif
 #endif
 
+#if _HAS_CXX20 && defined(__cpp_constexpr_dynamic_alloc)
+#ifndef __cpp_lib_constexpr_vector
+#error __cpp_lib_constexpr_vector is not defined
+#elif __cpp_lib_constexpr_vector != 201907L
+#error __cpp_lib_constexpr_vector is not 201907L
+#else
+STATIC_ASSERT(__cpp_lib_constexpr_vector == 201907L);
+#endif
+#else
+#ifdef __cpp_lib_constexpr_vector
+#error __cpp_lib_constexpr_vector is defined
+#endif
+#endif
+
 #if _HAS_CXX20
 #ifndef __cpp_lib_destroying_delete
 #error __cpp_lib_destroying_delete is not defined
@@ -577,6 +661,34 @@ STATIC_ASSERT(__cpp_lib_filesystem == 201703L);
 #endif
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_flat_map
+#error __cpp_lib_flat_map is not defined
+#elif __cpp_lib_flat_map != 202207L
+#error __cpp_lib_flat_map is not 202207L
+#else
+STATIC_ASSERT(__cpp_lib_flat_map == 202207L);
+#endif
+#else
+#ifdef __cpp_lib_flat_map
+#error __cpp_lib_flat_map is defined
+#endif
+#endif
+
+#if _HAS_CXX20
+#ifndef __cpp_lib_flat_set
+#error __cpp_lib_flat_set is not defined
+#elif __cpp_lib_flat_set != 202207L
+#error __cpp_lib_flat_set is not 202207L
+#else
+STATIC_ASSERT(__cpp_lib_flat_set == 202207L);
+#endif
+#else
+#ifdef __cpp_lib_flat_set
+#error __cpp_lib_flat_set is defined
+#endif
+#endif
+
 #if _HAS_CXX17
 #ifndef __cpp_lib_gcd_lcm
 #error __cpp_lib_gcd_lcm is not defined
@@ -815,6 +927,34 @@ STATIC_ASSERT(__cpp_lib_is_swappable == 201603L);
 #endif
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_jthread
+#error __cpp_lib_jthread is not defined
+#elif __cpp_lib_jthread != 201911L
+#error __cpp_lib_jthread is not 201911L
+#else
+STATIC_ASSERT(__cpp_lib_jthread == 201911L);
+#endif
+#else
+#ifdef __cpp_lib_jthread
+#error __cpp_lib_jthread is defined
+#endif
+#endif
+
+#if _HAS_CXX20
+#ifndef __cpp_lib_latch
+#error __cpp_lib_latch is not defined
+#elif __cpp_lib_latch != 201907L
+#error __cpp_lib_latch is not 201907L
+#else
+STATIC_ASSERT(__cpp_lib_latch == 201907L);
+#endif
+#else
+#ifdef __cpp_lib_latch
+#error __cpp_lib_latch is defined
+#endif
+#endif
+
 #if _HAS_CXX17
 #ifndef __cpp_lib_launder
 #error __cpp_lib_launder is not defined
@@ -917,6 +1057,20 @@ STATIC_ASSERT(__cpp_lib_math_special_functions == 201603L);
 #endif
 #endif
 
+#if _HAS_CXX20 && defined(__cpp_concepts)
+#ifndef __cpp_lib_mdspan
+#error __cpp_lib_mdspan is not defined
+#elif __cpp_lib_mdspan != 202207L
+#error __cpp_lib_mdspan is not 202207L
+#else
+STATIC_ASSERT(__cpp_lib_mdspan == 202207L);
+#endif
+#else
+#ifdef __cpp_lib_mdspan
+#error __cpp_lib_mdspan is defined
+#endif
+#endif
+
 #if _HAS_CXX17
 #ifndef __cpp_lib_memory_resource
 #error __cpp_lib_memory_resource is not defined
@@ -931,6 +1085,20 @@ STATIC_ASSERT(__cpp_lib_memory_resource == 201603L);
 #endif
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_move_only_function
+#error __cpp_lib_move_only_function is not defined
+#elif __cpp_lib_move_only_function != 202110L
+#error __cpp_lib_move_only_function is not 202110L
+#else
+STATIC_ASSERT(__cpp_lib_move_only_function == 202110L);
+#endif
+#else
+#ifdef __cpp_lib_move_only_function
+#error __cpp_lib_move_only_function is defined
+#endif
+#endif
+
 #if _HAS_CXX17
 #ifndef __cpp_lib_node_extract
 #error __cpp_lib_node_extract is not defined
@@ -1083,6 +1251,20 @@ STATIC_ASSERT(__cpp_lib_scoped_lock == 201703L);
 #endif
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_semaphore
+#error __cpp_lib_semaphore is not defined
+#elif __cpp_lib_semaphore != 201907L
+#error __cpp_lib_semaphore is not 201907L
+#else
+STATIC_ASSERT(__cpp_lib_semaphore == 201907L);
+#endif
+#else
+#ifdef __cpp_lib_semaphore
+#error __cpp_lib_semaphore is defined
+#endif
+#endif
+
 #ifndef __cpp_lib_shared_mutex
 #error __cpp_lib_shared_mutex is not defined
 #elif __cpp_lib_shared_mutex != 201505L
@@ -1149,6 +1331,20 @@ STATIC_ASSERT(__cpp_lib_shift == 201806L);
 #endif
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_smart_ptr_for_overwrite
+#error __cpp_lib_smart_ptr_for_overwrite is not defined
+#elif __cpp_lib_smart_ptr_for_overwrite != 202002L
+#error __cpp_lib_smart_ptr_for_overwrite is not 202002L
+#else
+STATIC_ASSERT(__cpp_lib_smart_ptr_for_overwrite == 202002L);
+#endif
+#else
+#ifdef __cpp_lib_smart_ptr_for_overwrite
+#error __cpp_lib_smart_ptr_for_overwrite is defined
+#endif
+#endif
+
 #if _HAS_CXX20
 #ifndef __cpp_lib_span
 #error __cpp_lib_span is not defined
@@ -1163,6 +1359,20 @@ STATIC_ASSERT(__cpp_lib_span == 202002L);
 #endif
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_spanstream
+#error __cpp_lib_spanstream is not defined
+#elif __cpp_lib_spanstream != 202106L
+#error __cpp_lib_spanstream is not 202106L
+#else
+STATIC_ASSERT(__cpp_lib_spanstream == 202106L);
+#endif
+#else
+#ifdef __cpp_lib_spanstream
+#error __cpp_lib_spanstream is defined
+#endif
+#endif
+
 #if _HAS_CXX20
 #ifndef __cpp_lib_ssize
 #error __cpp_lib_ssize is not defined
@@ -1191,6 +1401,20 @@ STATIC_ASSERT(__cpp_lib_starts_ends_with == 201711L);
 #endif
 #endif
 
+#if _HAS_CXX20
+#ifndef __cpp_lib_string_resize_and_overwrite
+#error __cpp_lib_string_resize_and_overwrite is not defined
+#elif __cpp_lib_string_resize_and_overwrite != 202110L
+#error __cpp_lib_string_resize_and_overwrite is not 202110L
+#else
+STATIC_ASSERT(__cpp_lib_string_resize_and_overwrite == 202110L);
+#endif
+#else
+#ifdef __cpp_lib_string_resize_and_overwrite
+#error __cpp_lib_string_resize_and_overwrite is defined
+#endif
+#endif
+
 #ifndef __cpp_lib_string_udls
 #error __cpp_lib_string_udls is not defined
 #elif __cpp_lib_string_udls != 201304L
@@ -1213,6 +1437,34 @@ STATIC_ASSERT(__cpp_lib_string_view == 201803L);
 #endif
 #endif
 
+#if _HAS_CXX20 && defined(__cpp_concepts)
+#ifndef __cpp_lib_submdspan
+#error __cpp_lib_submdspan is not defined
+#elif __cpp_lib_submdspan != 202306L
+#error __cpp_lib_submdspan is not 202306L
+#else
+STATIC_ASSERT(__cpp_lib_submdspan == 202306L);
+#endif
+#else
+#ifdef __cpp_lib_submdspan
+#error __cpp_lib_submdspan is defined
+#endif
+#endif
+
+#if _HAS_CXX20
+#ifndef __cpp_lib_syncbuf
+#error __cpp_lib_syncbuf is not defined
+#elif __cpp_lib_syncbuf != 201711L
+#error __cpp_lib_syncbuf is not 201711L
+#else
+STATIC_ASSERT(__cpp_lib_syncbuf == 201711L);
+#endif
+#else
+#ifdef __cpp_lib_syncbuf
+#error __cpp_lib_syncbuf is defined
+#endif
+#endif
+
 #if _HAS_CXX20
 #ifndef __cpp_lib_to_address
 #error __cpp_lib_to_address is not defined
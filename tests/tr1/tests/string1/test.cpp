@@ -537,6 +537,32 @@ void test_main() { // test basic workings of string definitions
         CHECK(STD stoll("0xffffffff00", nullptr, 0) == ll);
         CHECK(STD stoull("0xffffffff00", nullptr, 0) == (unsigned long long) ll);
 
+        CHECK_INT(STD stoi("0002147483647x", &idx), 2147483647);
+        CHECK_SIZE_T(idx, 13);
+        CHECK(STD stoll("-9223372036854775808") == -9223372036854775807LL - 1);
+        CHECK(STD stoull("18446744073709551615 ", &idx) == 18446744073709551615ULL);
+        CHECK_SIZE_T(idx, 20);
+
+        ok = false;
+        try {
+            STD stoi("-2147483649");
+        } catch (STD out_of_range) {
+            ok = true;
+        } catch (...) {
+            CHECK_MSG("unknown exception thrown", false);
+        }
+        CHECK_MSG("out_of_range not thrown", ok);
+
+        ok = false;
+        try {
+            STD stoull("18446744073709551616");
+        } catch (STD out_of_range) {
+            ok = true;
+        } catch (...) {
+            CHECK_MSG("unknown exception thrown", false);
+        }
+        CHECK_MSG("out_of_range not thrown", ok);
+
         CHECK_STR(STD to_string((int) -23).c_str(), "-23");
         CHECK_STR(STD to_string((unsigned int) 23).c_str(), "23");
         CHECK_STR(STD to_string((long) -23).c_str(), "-23");